@@ -11,6 +11,8 @@ const state = {
   windows: [],
   wifiModal: { open: false, ssid: "", secure: true, ch: 0, bssid: "" },
   redirect: { ip: "", startedAtMs: 0, countdownSec: 0 },
+  live: { source: null, connected: false, everConnected: false, pollTimers: [] },
+  dash: { v: 0, busy: false, again: false },
 };
 
 function $(id) {
@@ -32,9 +34,11 @@ function toast(msg) {
   }, 2800);
 }
 
+// `cache: "no-cache"` for endpoints that send an ETag: the browser revalidates and a 304 reuses its copy.
 async function apiGet(path, options) {
   const timeoutMs = Number((options && options.timeoutMs) || 0);
-  const res = await _fetchWithTimeout(path, { cache: "no-store" }, timeoutMs);
+  const cache = (options && options.cache) || "no-store";
+  const res = await _fetchWithTimeout(path, { cache }, timeoutMs);
   const text = await res.text();
   let data = null;
   try {
@@ -80,6 +84,30 @@ async function apiPost(path, body, options) {
   return data;
 }
 
+// Long operations answer 202 with a job id and the outcome is polled from /api/jobs/<id>. Resolves with
+// the job's result, throws its message (result as `data`) when it failed. `settled(job)` may end the wait
+// early: an OTA flash never reports back, the device reboots instead.
+async function runJob(path, options) {
+  const method = (options && options.method) || "POST";
+  const started = method === "GET" ? await apiGet(path) : await apiPost(path, (options && options.body) || {});
+  const id = Number(started?.job || 0);
+  if (!id) return started;
+  const settled = options && options.settled;
+  const deadline = Date.now() + Number((options && options.timeoutMs) || 120000);
+  for (;;) {
+    await sleep(500);
+    const job = await apiGet(`/api/jobs/${id}`, { timeoutMs: 5000 });
+    if (settled && settled(job)) return job.result ?? {};
+    if (job?.done) {
+      if (job.state === "done") return job.result ?? {};
+      const err = new Error(job.message || "failed");
+      err.data = job.result || { error: job.message };
+      throw err;
+    }
+    if (Date.now() > deadline) throw new Error("timeout");
+  }
+}
+
 async function _fetchWithTimeout(url, opts, timeoutMs) {
   const ms = Number(timeoutMs || 0);
   if (!ms) return fetch(url, opts);
@@ -716,6 +744,8 @@ function applyConfigToUi(cfg) {
 
   // OTA
   if ($("otaAuto")) $("otaAuto").checked = !!cfg?.ota?.auto;
+  if ($("otaPrefetch")) $("otaPrefetch").checked = cfg?.ota?.prefetch !== false;
+  if ($("otaPrefetchHolyTime")) $("otaPrefetchHolyTime").checked = !!cfg?.ota?.prefetchHolyTime;
   if ($("otaCheckHours")) $("otaCheckHours").value = String(cfg?.ota?.checkHours ?? 12);
   if ($("otaManifestUrl")) $("otaManifestUrl").value = cfg?.ota?.manifestUrl || DEFAULT_OTA_MANIFEST;
 
@@ -759,7 +789,7 @@ async function loadConfig() {
 
 async function refreshStatusLite() {
   try {
-    state.status = await apiGet("/api/status?lite=1");
+    state.status = await apiGet("/api/status?lite=1", { cache: "no-cache" });
     renderStatus();
   } catch {
     setText("healthLine", "אין חיבור");
@@ -782,7 +812,7 @@ async function refreshTime() {
 
 async function refreshSchedule() {
   try {
-    state.schedule = await apiGet("/api/schedule");
+    state.schedule = await apiGet("/api/schedule", { cache: "no-cache" });
     const upcoming = state.schedule?.upcoming || [];
     renderNextWindow(upcoming);
     renderUpcoming(upcoming);
@@ -802,6 +832,61 @@ async function refreshHistory() {
   }
 }
 
+// One request for status/time/schedule/history/OTA: the device answers only the sections that changed since
+// `state.dash.v`, and history as the entries added since then. Calls made while one is in flight are folded
+// into a single follow-up.
+async function refreshDashboard() {
+  if (state.dash.busy) {
+    state.dash.again = true;
+    return;
+  }
+  state.dash.busy = true;
+  try {
+    const d = await apiGet(`/api/dashboard?since=${state.dash.v || 0}`);
+    applyDashboard(d);
+  } catch {
+    setText("healthLine", "אין חיבור");
+    setPill("holyPill", "—", "bad");
+  } finally {
+    state.dash.busy = false;
+    if (state.dash.again) {
+      state.dash.again = false;
+      refreshDashboard();
+    }
+  }
+}
+
+function applyDashboard(d) {
+  if (!d) return;
+  if (d.time) {
+    state.time = d.time;
+    setClockBaseFromDevice(d.time);
+  }
+  if (d.status) state.status = d.status;
+  if (d.status || d.time) {
+    renderStatus();
+    renderClockInfo();
+    renderClockTick();
+  }
+  if (d.schedule) {
+    state.schedule = d.schedule;
+    const upcoming = d.schedule.upcoming || [];
+    renderNextWindow(upcoming);
+    renderUpcoming(upcoming);
+  }
+  if (d.history) {
+    const kept = d.history.reset ? [] : state.history?.items || [];
+    const items = kept.concat(d.history.items || []).slice(-60);
+    state.history = { ok: true, items };
+    renderHistory(items);
+  }
+  if (d.ota) {
+    renderOtaStatus(d.ota);
+    updateOtaActionButton();
+  }
+  state.dash.v = Number(d.v || 0);
+}
+
 function renderNetworks(nets) {
   const box = $("netList");
   if (!box) return;
@@ -828,17 +913,21 @@ function renderNetworks(nets) {
   }
 }
 
+function sortNetworks(nets) {
+  return Array.isArray(nets)
+    ? nets.slice().sort((a, b) => (Number(b?.rssi ?? -999) || -999) - (Number(a?.rssi ?? -999) || -999))
+    : [];
+}
+
 async function scanNetworks() {
   setText("scanBtn", "סורק…");
   $("scanBtn").disabled = true;
   try {
-    const nets = await apiGet("/api/wifi/scan");
-    const sorted = Array.isArray(nets)
-      ? nets
-          .slice()
-          .sort((a, b) => (Number(b?.rssi ?? -999) || -999) - (Number(a?.rssi ?? -999) || -999))
-      : [];
-    renderNetworks(sorted);
+    // Whatever the device already knows is shown at once; a scan result replaces it when it arrives.
+    const cached = await apiGet("/api/wifi/scan?cached=1").catch(() => null);
+    if (cached?.networks?.length) renderNetworks(sortNetworks(cached.networks));
+    const r = await runJob("/api/wifi/scan", { method: "GET", timeoutMs: 30000 });
+    renderNetworks(sortNetworks(r?.networks));
   } catch {
     renderNetworks([]);
     toast("סריקה נכשלה");
@@ -1216,7 +1305,7 @@ async function setManualTime() {
 
 async function ntpSyncNow() {
   try {
-    await apiPost("/api/ntp/sync", {});
+    await runJob("/api/ntp/sync", { timeoutMs: 20000 });
     toast("סנכרון בוצע");
   } catch {
     toast("סנכרון נכשל");
@@ -1287,40 +1376,46 @@ async function saveTimerPrefs() {
   }
 }
 
-async function refreshOtaStatus() {
-  try {
-    const s = await apiGet("/api/ota/status");
-    state.ota = s;
+function renderOtaStatus(s) {
+  state.ota = s;
 
-    setText("otaCurrent", s.currentVersion || "—");
+  setText("otaCurrent", s.currentVersion || "—");
 
-    try {
-      const cur = String(s.currentVersion || "").trim();
-      const key = "smartshabat_last_version";
-      const prev = String(localStorage.getItem(key) || "").trim();
-      if (cur && prev && cur !== prev) {
-        toast(`עודכן לגרסה ${cur}`);
-      }
-      if (cur) localStorage.setItem(key, cur);
-    } catch {
-      // ignore (private mode / storage disabled)
+  try {
+    const cur = String(s.currentVersion || "").trim();
+    const key = "smartshabat_last_version";
+    const prev = String(localStorage.getItem(key) || "").trim();
+    if (cur && prev && cur !== prev) {
+      toast(`עודכן לגרסה ${cur}`);
     }
+    if (cur) localStorage.setItem(key, cur);
+  } catch {
+    // ignore (private mode / storage disabled)
+  }
 
-    const available = !!s.state?.available;
-    setText("otaAvailable", available ? s.state?.availableVersion || "כן" : "לא");
-    setText("otaLastCheck", s.state?.lastCheckUtc ? fmtUtcAsLocal(s.state.lastCheckUtc) : "—");
-
-    const configured = !!s.config?.manifestUrl;
-    if (!configured) {
-      setPill("otaPill", "לא מוגדר", "warn");
-      setText("otaHintTop", "לא מוגדר");
-    } else if (available) {
-      setPill("otaPill", "יש עדכון", "warn");
-      setText("otaHintTop", "יש עדכון");
-    } else {
-      setPill("otaPill", "מעודכן", "good");
-      setText("otaHintTop", "מעודכן");
-    }
+  const available = !!s.state?.available;
+  let availableText = available ? s.state?.availableVersion || "כן" : "לא";
+  if (available && s.download?.staged) availableText += " (הורד, ממתין להתקנה)";
+  else if (available && s.download?.active) availableText += ` (מוריד ${Number(s.download.progress || 0)}%)`;
+  setText("otaAvailable", availableText);
+  setText("otaLastCheck", s.state?.lastCheckUtc ? fmtUtcAsLocal(s.state.lastCheckUtc) : "—");
+
+  const configured = !!s.config?.manifestUrl;
+  if (!configured) {
+    setPill("otaPill", "לא מוגדר", "warn");
+    setText("otaHintTop", "לא מוגדר");
+  } else if (available) {
+    setPill("otaPill", "יש עדכון", "warn");
+    setText("otaHintTop", "יש עדכון");
+  } else {
+    setPill("otaPill", "מעודכן", "good");
+    setText("otaHintTop", "מעודכן");
+  }
+}
+
+async function refreshOtaStatus() {
+  try {
+    renderOtaStatus(await apiGet("/api/ota/status"));
   } catch {
     setPill("otaPill", "שגיאה", "bad");
     setText("otaHintTop", "שגיאה");
@@ -1329,7 +1424,7 @@ async function refreshOtaStatus() {
   }
 }
 
-function updateOtaActionButton({ checking = false, updating = false } = {}) {
+function updateOtaActionButton({ checking = false, updating = false, progress = 0 } = {}) {
   const btn = $("otaActionBtn");
   if (!btn) return;
   if (checking) {
@@ -1338,7 +1433,7 @@ function updateOtaActionButton({ checking = false, updating = false } = {}) {
     return;
   }
   if (updating) {
-    btn.textContent = "מעדכן…";
+    btn.textContent = progress ? `מעדכן… ${progress}%` : "מעדכן…";
     btn.disabled = true;
     return;
   }
@@ -1349,10 +1444,12 @@ function updateOtaActionButton({ checking = false, updating = false } = {}) {
 
 async function saveOtaPrefs() {
   const auto = !!$("otaAuto")?.checked;
+  const prefetch = !!$("otaPrefetch")?.checked;
+  const prefetchHolyTime = !!$("otaPrefetchHolyTime")?.checked;
   const checkHours = Number($("otaCheckHours")?.value || 0);
   const manifestUrl = String($("otaManifestUrl")?.value || "").trim();
   try {
-    await apiPost("/api/config", { ota: { auto, checkHours, manifestUrl } });
+    await apiPost("/api/config", { ota: { auto, prefetch, prefetchHolyTime, checkHours, manifestUrl } });
     toast("נשמר");
     await loadConfig();
     await refreshOtaStatus();
@@ -1364,7 +1461,7 @@ async function saveOtaPrefs() {
 async function otaCheckNow() {
   updateOtaActionButton({ checking: true });
   try {
-    const r = await apiPost("/api/ota/check", {});
+    const r = await runJob("/api/ota/check");
     toast(r.available ? "יש עדכון" : "אין עדכון");
   } catch (e) {
     const msg = String(e?.data?.message || e?.data?.error || e?.message || "").trim();
@@ -1377,7 +1474,14 @@ async function otaUpdateNow() {
   if (!confirm("להתחיל עדכון? המכשיר יאתחל בסיום.")) return;
   updateOtaActionButton({ updating: true });
   try {
-    const r = await apiPost("/api/ota/update", {});
+    // The download runs inside the job (and resumes if it was cut off); the device reboots once it installs.
+    const r = await runJob("/api/ota/update", {
+      timeoutMs: 600000,
+      settled: (job) => {
+        if (job?.progress) updateOtaActionButton({ updating: true, progress: job.progress });
+        return job?.result?.installing === true;
+      }
+    });
     if (r && r.started === false) {
       toast("אין עדכון זמין");
       updateOtaActionButton();
@@ -1488,20 +1592,56 @@ function bindEvents() {
   });
 }
 
+// Polling is the fallback; while /api/events is connected the device pushes changes instead.
+function startPolling() {
+  if (state.live.pollTimers.length) return;
+  state.live.pollTimers = [setInterval(refreshDashboard, 2000)];
+}
+
+function stopPolling() {
+  state.live.pollTimers.forEach((t) => clearInterval(t));
+  state.live.pollTimers = [];
+}
+
+function startLiveEvents() {
+  if (!window.EventSource) return;
+  const es = new EventSource("/api/events");
+  state.live.source = es;
+  es.addEventListener("hello", () => {
+    const resync = !state.live.connected && state.live.everConnected;
+    state.live.connected = true;
+    state.live.everConnected = true;
+    stopPolling();
+    // Changes may have been missed while disconnected.
+    if (resync) refreshDashboard();
+  });
+  es.addEventListener("status", (e) => {
+    try {
+      state.status = JSON.parse(e.data);
+      renderStatus();
+    } catch {
+      // ignore
+    }
+  });
+  es.addEventListener("schedule", refreshDashboard);
+  es.addEventListener("history", refreshDashboard);
+  es.addEventListener("ota", refreshDashboard);
+  es.addEventListener("time", refreshDashboard);
+  // EventSource reconnects by itself; poll until it does.
+  es.onerror = () => {
+    if (!state.live.connected) return;
+    state.live.connected = false;
+    startPolling();
+  };
+}
+
 (async function main() {
   bindEvents();
-  await refreshTime();
-  await refreshStatusLite();
+  await refreshDashboard();
   await loadConfig();
   await loadSavedNetworks();
-  await refreshSchedule();
-  await refreshOtaStatus();
-  await refreshHistory();
 
   setInterval(renderClockTick, 1000);
-  setInterval(refreshTime, 60000);
-  setInterval(refreshStatusLite, 2000);
-  setInterval(refreshSchedule, 15000);
-  setInterval(refreshOtaStatus, 20000);
-  setInterval(refreshHistory, 12000);
+  startPolling();
+  startLiveEvents();
 })();
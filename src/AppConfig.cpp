@@ -3,8 +3,12 @@
 #include <ArduinoJson.h>
 #include <LittleFS.h>
 
+#include "JsonWriter.h"
+#include "SpanTrace.h"
+
 namespace {
 constexpr const char *kConfigPath = "/config.json";
+uint32_t savedVersion = 0;
 
 String readFile(const char *path) {
   File file = LittleFS.open(path, "r");
@@ -16,83 +20,102 @@ String readFile(const char *path) {
   }
   return out;
 }
-
-bool writeFile(const char *path, const String &contents) {
-  File file = LittleFS.open(path, "w");
-  if (!file) return false;
-  size_t written = file.print(contents);
-  return written == contents.length();
-}
 } // namespace
 
 namespace appcfg {
 
-String toJson(const AppConfig &cfg) {
-  DynamicJsonDocument doc(4096);
-
-  doc["deviceName"] = cfg.deviceName;
-
-  JsonObject net = doc.createNestedObject("network");
-  net["hostName"] = cfg.hostName;
-  JsonObject sta = net.createNestedObject("sta");
-  sta["dhcp"] = cfg.staDhcp;
-  JsonObject st = sta.createNestedObject("static");
-  st["ip"] = cfg.staIp.toString();
-  st["gateway"] = cfg.staGateway.toString();
-  st["subnet"] = cfg.staSubnet.toString();
-  st["dns1"] = cfg.staDns1.toString();
-  st["dns2"] = cfg.staDns2.toString();
-
-  JsonObject ap = net.createNestedObject("ap");
-  ap["ssid"] = cfg.apSsid;
-  ap["passwordSet"] = cfg.apPassword.length() >= 8;
-
-  JsonObject time = doc.createNestedObject("time");
-  time["ntpEnabled"] = cfg.ntpEnabled;
-  time["ntpServer"] = cfg.ntpServer;
-  time["ntpResyncMinutes"] = cfg.ntpResyncMinutes;
-  time["tzOffsetMinutes"] = cfg.tzOffsetMinutes;
-  time["dstMode"] = cfg.dstMode;
-  time["dstEnabled"] = cfg.dstEnabled;
-  time["dstOffsetMinutes"] = cfg.dstOffsetMinutes;
-
-  JsonObject loc = doc.createNestedObject("location");
-  loc["name"] = cfg.locationName;
-  loc["israel"] = cfg.israel;
-
-  JsonObject halacha = doc.createNestedObject("halacha");
-  halacha["minutesBeforeShkia"] = cfg.minutesBeforeShkia;
-  halacha["minutesAfterTzeit"] = cfg.minutesAfterTzeit;
-
-  JsonObject relay = doc.createNestedObject("relay");
-  relay["gpio"] = cfg.relayGpio;
-  relay["activeLow"] = cfg.relayActiveLow;
-  relay["holyOnNo"] = cfg.relayHolyOnNo;
-  relay["bootMode"] = cfg.relayBootMode;
-
-  JsonObject op = doc.createNestedObject("operation");
-  op["runMode"] = cfg.runMode;
-  JsonArray wins = op.createNestedArray("windows");
+void toJson(JsonWriter &w, const AppConfig &cfg) {
+  w.beginObject();
+  w.field("deviceName", cfg.deviceName);
+
+  w.beginObject("network");
+  w.field("hostName", cfg.hostName);
+  w.beginObject("sta");
+  w.field("dhcp", cfg.staDhcp);
+  w.beginObject("static");
+  w.field("ip", cfg.staIp);
+  w.field("gateway", cfg.staGateway);
+  w.field("subnet", cfg.staSubnet);
+  w.field("dns1", cfg.staDns1);
+  w.field("dns2", cfg.staDns2);
+  w.endObject();
+  w.endObject();
+
+  w.beginObject("ap");
+  w.field("ssid", cfg.apSsid);
+  w.field("passwordSet", cfg.apPassword.length() >= 8);
+  w.endObject();
+  w.endObject();
+
+  w.beginObject("time");
+  w.field("ntpEnabled", cfg.ntpEnabled);
+  w.field("ntpServer", cfg.ntpServer);
+  w.beginArray("ntpExtraServers");
+  for (uint8_t i = 0; i < cfg.ntpExtraServerCount && i < AppConfig::kMaxExtraNtpServers; i += 1) {
+    w.value(cfg.ntpExtraServers[i]);
+  }
+  w.endArray();
+  w.field("ntpSamplesPerServer", cfg.ntpSamplesPerServer);
+  w.field("ntpMaxRttMs", cfg.ntpMaxRttMs);
+  w.field("ntpResyncMinutes", cfg.ntpResyncMinutes);
+  w.field("sntpServerEnabled", cfg.sntpServerEnabled);
+  w.field("tzOffsetMinutes", cfg.tzOffsetMinutes);
+  w.field("dstMode", cfg.dstMode);
+  w.field("dstEnabled", cfg.dstEnabled);
+  w.field("dstOffsetMinutes", cfg.dstOffsetMinutes);
+  w.endObject();
+
+  w.beginObject("location");
+  w.field("name", cfg.locationName);
+  w.field("israel", cfg.israel);
+  w.endObject();
+
+  w.beginObject("halacha");
+  w.field("minutesBeforeShkia", cfg.minutesBeforeShkia);
+  w.field("minutesAfterTzeit", cfg.minutesAfterTzeit);
+  w.endObject();
+
+  w.beginObject("relay");
+  w.field("gpio", cfg.relayGpio);
+  w.field("activeLow", cfg.relayActiveLow);
+  w.field("holyOnNo", cfg.relayHolyOnNo);
+  w.field("bootMode", cfg.relayBootMode);
+  w.endObject();
+
+  w.beginObject("operation");
+  w.field("runMode", cfg.runMode);
+  w.beginArray("windows");
   for (uint8_t i = 0; i < cfg.windowCount && i < AppConfig::kMaxWindows; i += 1) {
-    const ManualTimeWindow &w = cfg.windows[i];
-    JsonObject o = wins.createNestedObject();
-    o["startUtc"] = w.startUtc;
-    o["endUtc"] = w.endUtc;
-    o["on"] = w.on;
+    const ManualTimeWindow &win = cfg.windows[i];
+    w.beginObject();
+    w.field("startUtc", win.startUtc);
+    w.field("endUtc", win.endUtc);
+    w.field("on", win.on);
+    w.endObject();
   }
-
-  JsonObject led = doc.createNestedObject("led");
-  led["gpio"] = cfg.statusLedGpio;
-  led["activeLow"] = cfg.statusLedActiveLow;
-
-  JsonObject ota = doc.createNestedObject("ota");
-  ota["manifestUrl"] = cfg.otaManifestUrl;
-  ota["auto"] = cfg.otaAuto;
-  ota["checkHours"] = cfg.otaCheckHours;
-
-  String out;
-  serializeJson(doc, out);
-  return out;
+  w.endArray();
+  w.endObject();
+
+  w.beginObject("led");
+  w.field("gpio", cfg.statusLedGpio);
+  w.field("activeLow", cfg.statusLedActiveLow);
+  w.endObject();
+
+  w.beginObject("ota");
+  w.field("manifestUrl", cfg.otaManifestUrl);
+  w.field("auto", cfg.otaAuto);
+  w.field("checkHours", cfg.otaCheckHours);
+  w.field("prefetch", cfg.otaPrefetch);
+  w.field("prefetchHolyTime", cfg.otaPrefetchHolyTime);
+  w.endObject();
+
+  w.beginObject("diagnostics");
+  w.field("traceMode", cfg.traceMode);
+  w.field("logLevels", cfg.logLevels);
+  w.field("logUdpHost", cfg.logUdpHost);
+  w.field("logUdpPort", cfg.logUdpPort);
+  w.endObject();
+  w.endObject();
 }
 
 bool fromJson(AppConfig &cfg, const String &json) {
@@ -133,7 +156,24 @@ bool fromJson(AppConfig &cfg, const String &json) {
   if (!time.isNull()) {
     if (time.containsKey("ntpEnabled")) cfg.ntpEnabled = time["ntpEnabled"].as<bool>();
     if (time.containsKey("ntpServer")) cfg.ntpServer = time["ntpServer"].as<String>();
+    if (time.containsKey("ntpExtraServers")) {
+      cfg.ntpExtraServerCount = 0;
+      JsonArray extra = time["ntpExtraServers"].as<JsonArray>();
+      if (!extra.isNull()) {
+        for (JsonVariant v : extra) {
+          if (cfg.ntpExtraServerCount >= AppConfig::kMaxExtraNtpServers) break;
+          String host = v.as<String>();
+          host.trim();
+          if (!host.length() || host == cfg.ntpServer) continue;
+          cfg.ntpExtraServers[cfg.ntpExtraServerCount] = host;
+          cfg.ntpExtraServerCount += 1;
+        }
+      }
+    }
+    if (time.containsKey("ntpSamplesPerServer")) cfg.ntpSamplesPerServer = time["ntpSamplesPerServer"].as<uint8_t>();
+    if (time.containsKey("ntpMaxRttMs")) cfg.ntpMaxRttMs = time["ntpMaxRttMs"].as<uint16_t>();
     if (time.containsKey("ntpResyncMinutes")) cfg.ntpResyncMinutes = time["ntpResyncMinutes"].as<uint16_t>();
+    if (time.containsKey("sntpServerEnabled")) cfg.sntpServerEnabled = time["sntpServerEnabled"].as<bool>();
     if (time.containsKey("tzOffsetMinutes")) cfg.tzOffsetMinutes = time["tzOffsetMinutes"].as<int>();
     bool sawDstEnabled = false;
     if (time.containsKey("dstEnabled")) {
@@ -203,6 +243,19 @@ bool fromJson(AppConfig &cfg, const String &json) {
     if (ota.containsKey("manifestUrl")) cfg.otaManifestUrl = ota["manifestUrl"].as<String>();
     if (ota.containsKey("auto")) cfg.otaAuto = ota["auto"].as<bool>();
     if (ota.containsKey("checkHours")) cfg.otaCheckHours = ota["checkHours"].as<uint16_t>();
+    if (ota.containsKey("prefetch")) cfg.otaPrefetch = ota["prefetch"].as<bool>();
+    if (ota.containsKey("prefetchHolyTime")) cfg.otaPrefetchHolyTime = ota["prefetchHolyTime"].as<bool>();
+  }
+
+  JsonObject diag = doc["diagnostics"];
+  if (!diag.isNull()) {
+    if (diag.containsKey("traceMode")) {
+      const uint8_t mode = diag["traceMode"].as<uint8_t>();
+      cfg.traceMode = mode <= 2 ? mode : 1;
+    }
+    if (diag.containsKey("logLevels")) cfg.logLevels = diag["logLevels"].as<String>();
+    if (diag.containsKey("logUdpHost")) cfg.logUdpHost = diag["logUdpHost"].as<String>();
+    if (diag.containsKey("logUdpPort")) cfg.logUdpPort = diag["logUdpPort"].as<uint16_t>();
   }
 
   return true;
@@ -216,7 +269,16 @@ bool load(AppConfig &cfg) {
 }
 
 bool save(const AppConfig &cfg) {
-  return writeFile(kConfigPath, toJson(cfg));
+  spantrace::Span span(spantrace::Lane::Fs, "config.save");
+  savedVersion += 1;
+  File file = LittleFS.open(kConfigPath, "w");
+  if (!file) return false;
+  JsonWriter w(file);
+  toJson(w, cfg);
+  w.flush();
+  return w.ok();
 }
 
+uint32_t version() { return savedVersion; }
+
 } // namespace appcfg
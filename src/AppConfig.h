@@ -3,6 +3,8 @@
 #include <Arduino.h>
 #include <IPAddress.h>
 
+class JsonWriter;
+
 #ifndef SHABAT_RELAY_DEFAULT_OTA_URL
 #define SHABAT_RELAY_DEFAULT_OTA_URL "https://github.com/yk8-git/smart-shabat/releases/latest/download/ota.json"
 #endif
@@ -31,7 +33,14 @@ struct AppConfig {
   // Time
   bool ntpEnabled = true;
   String ntpServer = "pool.ntp.org";
+  // Additional servers sampled alongside ntpServer; the sample with the lowest round trip wins.
+  static constexpr uint8_t kMaxExtraNtpServers = 3;
+  String ntpExtraServers[kMaxExtraNtpServers] = {"time.google.com", "time.cloudflare.com"};
+  uint8_t ntpExtraServerCount = 2;
+  uint8_t ntpSamplesPerServer = 4;
+  uint16_t ntpMaxRttMs = 400; // samples with a longer round trip are discarded
   uint16_t ntpResyncMinutes = 360; // 0 = disable periodic resync
+  bool sntpServerEnabled = true; // answer SNTP requests from LAN/Hotspot clients on UDP 123
   int tzOffsetMinutes = 120; // UTC+2
   uint8_t dstMode = 1; // 0=off, 1=auto, 2=manual
   bool dstEnabled = true; // manual-only (dstMode=2)
@@ -71,11 +80,21 @@ struct AppConfig {
   String otaManifestUrl = SHABAT_RELAY_DEFAULT_OTA_URL;
   bool otaAuto = true;
   uint16_t otaCheckHours = 24; // 0 = disable periodic checks
+  bool otaPrefetch = true;          // download + verify an available update in the background, install later
+  bool otaPrefetchHolyTime = false; // the operator accepts that prefetch also runs during Shabbat / Yom Tov
+
+  // Diagnostics
+  uint8_t traceMode = 1; // input trace: 0=off, 1=RAM ring, 2=RAM ring + LittleFS (see InputTrace.h)
+  String logLevels;       // per-module log levels, e.g. "warn,net=debug" (see AppLog.h); empty = all info
+  String logUdpHost;      // log copy over UDP: target IP, empty = subnet broadcast
+  uint16_t logUdpPort = 0; // 0 = off
 };
 
 namespace appcfg {
 bool load(AppConfig &cfg);
 bool save(const AppConfig &cfg);
-String toJson(const AppConfig &cfg);
+// Bumps on every save(), i.e. whenever the running config was changed.
+uint32_t version();
+void toJson(JsonWriter &w, const AppConfig &cfg);
 bool fromJson(AppConfig &cfg, const String &json);
 } // namespace appcfg
@@ -0,0 +1,268 @@
+#include "AppLog.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "JsonWriter.h"
+
+namespace {
+constexpr uint8_t kModuleCount = static_cast<uint8_t>(applog::Module::Count);
+
+char ring[applog::kRingBytes];
+// Absolute byte positions (ring index = position % kRingBytes).
+uint32_t head = 0;
+uint32_t tail = 0;   // next byte for Serial
+uint32_t remote = 0; // next byte for the remote sink (always on a line start)
+applog::LineSink remoteSink = nullptr;
+applog::Level levels[kModuleCount];
+bool levelsInit = false;
+applog::Stats st;
+
+void initLevels() {
+  if (levelsInit) return;
+  for (uint8_t i = 0; i < kModuleCount; i += 1) levels[i] = applog::Level::Info;
+  levelsInit = true;
+}
+
+char at(uint32_t pos) { return ring[pos % applog::kRingBytes]; }
+
+// Moves the remote cursor to the first line start at or after `pos`, counting the lines it passes.
+void skipRemoteTo(uint32_t pos) {
+  while (remote < pos) {
+    if (at(remote) == '\n') st.remoteSkipped += 1;
+    remote += 1;
+  }
+  if (remote == 0 || at(remote - 1) == '\n') return;
+  // Landed mid-line: skip the rest of it too (every line ends in '\n', so this stops by `head`).
+  while (remote < head && at(remote) != '\n') remote += 1;
+  remote += 1;
+  st.remoteSkipped += 1;
+}
+
+void append(applog::Module module, const char *line, size_t len) {
+  const uint32_t used = head - tail;
+  if (len > applog::kRingBytes - used) {
+    st.dropped += 1;
+    st.droppedBy[static_cast<uint8_t>(module)] += 1;
+    return;
+  }
+  if (remoteSink) {
+    const uint32_t keepFrom = head + len - applog::kRingBytes;
+    if (head + len > applog::kRingBytes && remote < keepFrom) skipRemoteTo(keepFrom);
+  }
+  for (size_t i = 0; i < len; i += 1) ring[(head + i) % applog::kRingBytes] = line[i];
+  head += len;
+  if (!remoteSink) remote = head;
+  st.lines += 1;
+  st.bytes += len;
+  if (head - tail > st.maxUsed) st.maxUsed = static_cast<uint16_t>(head - tail);
+}
+
+void vlog(applog::Module module, applog::Level level, const char *fmt, va_list ap) {
+  if (!applog::enabled(module, level)) {
+    st.filtered += 1;
+    return;
+  }
+  char line[applog::kMaxLineBytes];
+  int n = snprintf(line, sizeof(line), "[%s] ", applog::moduleName(module));
+  const int body = vsnprintf(line + n, sizeof(line) - n, fmt, ap);
+  if (body < 0) return;
+  n += body;
+  if (static_cast<size_t>(n) >= sizeof(line) - 1) {
+    // No room for the newline: mark the cut.
+    n = static_cast<int>(sizeof(line)) - 2;
+    line[n - 1] = '~';
+    st.truncated += 1;
+  } else if (n > 0 && line[n - 1] == '\n') {
+    n -= 1; // callers may still end with "\n"
+  }
+  line[n] = '\n';
+  append(module, line, static_cast<size_t>(n) + 1);
+  applog::drain();
+}
+} // namespace
+
+void applog::log(Module module, Level level, const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  vlog(module, level, fmt, ap);
+  va_end(ap);
+}
+
+void applog::error(Module module, const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  vlog(module, Level::Error, fmt, ap);
+  va_end(ap);
+}
+
+void applog::warn(Module module, const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  vlog(module, Level::Warn, fmt, ap);
+  va_end(ap);
+}
+
+void applog::info(Module module, const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  vlog(module, Level::Info, fmt, ap);
+  va_end(ap);
+}
+
+void applog::debug(Module module, const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  vlog(module, Level::Debug, fmt, ap);
+  va_end(ap);
+}
+
+void applog::drain() {
+  while (tail < head) {
+    const int room = Serial.availableForWrite();
+    if (room <= 0) return;
+    // Contiguous run up to the ring end.
+    const uint32_t idx = tail % kRingBytes;
+    size_t n = head - tail;
+    if (n > kRingBytes - idx) n = kRingBytes - idx;
+    if (n > static_cast<size_t>(room)) n = static_cast<size_t>(room);
+    const size_t written = Serial.write(reinterpret_cast<const uint8_t *>(ring + idx), n);
+    if (!written) return;
+    tail += written;
+  }
+}
+
+void applog::flush() {
+  while (tail < head) {
+    drain();
+    if (tail < head) delay(1);
+  }
+  Serial.flush();
+}
+
+void applog::pumpRemote(uint8_t maxLines) {
+  if (!remoteSink) return;
+  char line[kMaxLineBytes];
+  for (uint8_t sent = 0; sent < maxLines && remote < head; sent += 1) {
+    size_t len = 0;
+    while (remote + len < head && at(remote + len) != '\n' && len < sizeof(line)) {
+      line[len] = at(remote + len);
+      len += 1;
+    }
+    if (remote + len >= head) return; // unterminated (cannot happen: lines are appended whole)
+    if (!remoteSink(line, len)) return;
+    remote += len + 1;
+    st.remoteLines += 1;
+  }
+}
+
+void applog::setRemoteSink(LineSink sink) {
+  remoteSink = sink;
+  remote = head; // start with what comes next, not the backlog
+}
+
+void applog::setLevel(Module module, Level level) {
+  initLevels();
+  levels[static_cast<uint8_t>(module)] = level;
+}
+
+applog::Level applog::level(Module module) {
+  initLevels();
+  return levels[static_cast<uint8_t>(module)];
+}
+
+bool applog::enabled(Module module, Level lvl) { return static_cast<uint8_t>(lvl) <= static_cast<uint8_t>(level(module)); }
+
+void applog::setLevels(const String &spec) {
+  initLevels();
+  for (uint8_t i = 0; i < kModuleCount; i += 1) levels[i] = Level::Info;
+
+  auto parseLevel = [](const String &s, Level &out) {
+    for (uint8_t l = 0; l <= static_cast<uint8_t>(Level::Debug); l += 1) {
+      if (s == levelName(static_cast<Level>(l))) {
+        out = static_cast<Level>(l);
+        return true;
+      }
+    }
+    return false;
+  };
+
+  int start = 0;
+  while (start < static_cast<int>(spec.length())) {
+    int end = spec.indexOf(',', start);
+    if (end < 0) end = spec.length();
+    String item = spec.substring(start, end);
+    item.trim();
+    start = end + 1;
+    if (!item.length()) continue;
+
+    const int eq = item.indexOf('=');
+    Level lvl = Level::Info;
+    if (eq < 0) {
+      if (!parseLevel(item, lvl)) continue;
+      for (uint8_t i = 0; i < kModuleCount; i += 1) levels[i] = lvl;
+      continue;
+    }
+    String name = item.substring(0, eq);
+    String value = item.substring(eq + 1);
+    name.trim();
+    value.trim();
+    if (!parseLevel(value, lvl)) continue;
+    for (uint8_t i = 0; i < kModuleCount; i += 1) {
+      if (name == moduleName(static_cast<Module>(i))) levels[i] = lvl;
+    }
+  }
+}
+
+const char *applog::moduleName(Module module) {
+  static const char *const kNames[kModuleCount] = {"boot", "cfg",   "fs",    "net",   "ntp", "sntp",
+                                                   "ota",  "relay", "reset", "state", "web"};
+  const uint8_t i = static_cast<uint8_t>(module);
+  return i < kModuleCount ? kNames[i] : "?";
+}
+
+const char *applog::levelName(Level level) {
+  switch (level) {
+  case Level::Error:
+    return "error";
+  case Level::Warn:
+    return "warn";
+  case Level::Info:
+    return "info";
+  case Level::Debug:
+    return "debug";
+  default:
+    return "?";
+  }
+}
+
+size_t applog::usedBytes() { return head - tail; }
+
+const applog::Stats &applog::stats() { return st; }
+
+void applog::statsJson(JsonWriter &w) {
+  w.beginObject();
+  w.field("ok", true);
+  w.field("ringBytes", kRingBytes);
+  w.field("usedBytes", usedBytes());
+  w.field("maxUsed", st.maxUsed);
+  w.field("lines", st.lines);
+  w.field("bytes", st.bytes);
+  w.field("dropped", st.dropped);
+  w.field("truncated", st.truncated);
+  w.field("filtered", st.filtered);
+  w.beginObject("remote");
+  w.field("active", static_cast<bool>(remoteSink));
+  w.field("lines", st.remoteLines);
+  w.field("skipped", st.remoteSkipped);
+  w.endObject();
+  w.beginObject("modules");
+  for (uint8_t i = 0; i < kModuleCount; i += 1) {
+    w.beginObject(moduleName(static_cast<Module>(i)));
+    w.field("level", levelName(level(static_cast<Module>(i))));
+    w.field("dropped", st.droppedBy[i]);
+    w.endObject();
+  }
+  w.endObject();
+  w.endObject();
+}
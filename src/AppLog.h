@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Arduino.h>
+
+class JsonWriter;
+
+// Non-blocking log: lines are formatted into a RAM ring and drained to Serial only as far as the UART
+// FIFO has room (availableForWrite), so a long line never stalls the loop waiting for 115200 baud.
+// Every call drains opportunistically and loop() drains once per pass; a line that does not fit in the
+// ring is dropped whole and counted per module.
+//
+// Optionally the same lines go to a remote sink (main.cpp sends them as UDP datagrams). That sink has
+// its own read cursor: if it falls behind, it skips ahead (counted) instead of holding back Serial.
+//
+// Output format is unchanged from the old Serial.printf calls: "[module] message\n".
+namespace applog {
+constexpr size_t kRingBytes = 2048;
+constexpr size_t kMaxLineBytes = 192; // longer lines are truncated (ending in "~")
+
+enum class Level : uint8_t { Error = 0, Warn, Info, Debug };
+enum class Module : uint8_t { Boot = 0, Cfg, Fs, Net, Ntp, Sntp, Ota, Relay, Reset, State, Web, Count };
+
+// Sends one line (without the trailing newline); false = try again later.
+using LineSink = bool (*)(const char *line, size_t len);
+
+struct Stats {
+  uint32_t lines = 0;
+  uint32_t bytes = 0;
+  uint32_t dropped = 0;         // lines lost because the ring was full
+  uint32_t truncated = 0;
+  uint32_t filtered = 0;        // below the module's level
+  uint32_t remoteLines = 0;
+  uint32_t remoteSkipped = 0;   // lines overwritten before the remote sink sent them
+  uint16_t maxUsed = 0;         // ring high-water mark (bytes)
+  uint32_t droppedBy[static_cast<uint8_t>(Module::Count)] = {};
+};
+
+void log(Module module, Level level, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+void error(Module module, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+void warn(Module module, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+void info(Module module, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+void debug(Module module, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+// Writes what the UART accepts without blocking.
+void drain();
+// Blocks until the ring reached Serial (before a restart).
+void flush();
+// Sends up to `maxLines` complete lines through the remote sink (no-op without one).
+void pumpRemote(uint8_t maxLines);
+void setRemoteSink(LineSink sink);
+
+void setLevel(Module module, Level level);
+Level level(Module module);
+bool enabled(Module module, Level level);
+// "info" sets every module, "net=debug,ota=warn" only those named; unknown names are ignored.
+// Starts from all-info, so an empty spec restores the default.
+void setLevels(const String &spec);
+
+const char *moduleName(Module module);
+const char *levelName(Level level);
+size_t usedBytes();
+const Stats &stats();
+void statsJson(JsonWriter &w);
+} // namespace applog
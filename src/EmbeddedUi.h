@@ -1,2617 +1,917 @@
 #pragma once
 
 #include <pgmspace.h>
-
-// Embedded UI assets (served directly from flash).
-// Generated by tools/gen_embedded_ui.py from /data.
-
-// text/html
-static const char kEmbeddedIndexHtml[] PROGMEM = R"SMARTSHABAT_HTML(
-<!doctype html>
-<html lang="he" dir="rtl">
-  <head>
-    <meta charset="utf-8" />
-    <meta name="viewport" content="width=device-width, initial-scale=1" />
-    <title>שעון שבת</title>
-    <link rel="stylesheet" href="/styles.css" />
-  </head>
-  <body>
-    <svg class="sprite" xmlns="http://www.w3.org/2000/svg">
-      <symbol id="i-status" viewBox="0 0 24 24">
-        <path
-          d="M12 2a10 10 0 1 0 10 10A10.01 10.01 0 0 0 12 2Zm0 18a8 8 0 1 1 8-8 8.01 8.01 0 0 1-8 8Zm1-13h-2v6l5 3 1-1.73-4-2.27Z"
-        />
-      </symbol>
-      <symbol id="i-wifi" viewBox="0 0 24 24">
-        <path
-          d="M12 18a2 2 0 1 0 2 2 2 2 0 0 0-2-2Zm7-5.74a11.2 11.2 0 0 0-14 0l1.43 1.43a9.2 9.2 0 0 1 11.14 0ZM12 4a16 16 0 0 0-10.2 3.7l1.43 1.43a14 14 0 0 1 17.54 0l1.43-1.43A16 16 0 0 0 12 4Zm0 8a8 8 0 0 0-5.2 1.93l1.43 1.43a6 6 0 0 1 7.54 0l1.43-1.43A8 8 0 0 0 12 12Z"
-        />
-      </symbol>
-      <symbol id="i-clock" viewBox="0 0 24 24">
-        <path
-          d="M12 2a10 10 0 1 0 10 10A10.01 10.01 0 0 0 12 2Zm0 18a8 8 0 1 1 8-8 8.01 8.01 0 0 1-8 8Zm.5-13h-2v6l5.2 3.1 1-1.64-4.2-2.46Z"
-        />
-      </symbol>
-      <symbol id="i-sliders" viewBox="0 0 24 24">
-        <path
-          d="M10 6h10v2H10Zm-6 0h4v2H4Zm2 6h14v2H6Zm-2 0h0v2H4Zm6 6h10v2H10Zm-6 0h4v2H4Z"
-        />
-      </symbol>
-      <symbol id="i-update" viewBox="0 0 24 24">
-        <path
-          d="M12 6V3L8 7l4 4V8a6 6 0 1 1-5.65 8H4.26A8 8 0 1 0 12 6Z"
-        />
-      </symbol>
-      <symbol id="i-chevron" viewBox="0 0 24 24">
-        <path d="M12 15.5 5.5 9l1.4-1.4L12 12.7l5.1-5.1L18.5 9Z" />
-      </symbol>
-    </svg>
-
-    <header class="top">
-      <div class="brand">
-        <div class="title">שעון שבת</div>
-        <div class="subtitle" id="deviceMeta">—</div>
-      </div>
-      <div class="badges">
-        <div class="badge" id="netBadge">—</div>
-      </div>
-    </header>
-
-    <section class="status-grid" aria-label="מצב מהיר">
-      <div class="kv status-block">
-        <div class="k">שעה</div>
-        <div class="v" id="nowTime">—</div>
-        <div class="subDate" id="nowHebrewDate">—</div>
-      </div>
-      <div class="kv status-block">
-        <div class="k">מצב ממסר</div>
-        <div class="v" id="relayState">—</div>
-      </div>
-      <div class="kv status-block">
-        <div class="k">מצב</div>
-        <div class="v" id="modeState">—</div>
-      </div>
-      <div class="kv status-block">
-        <div class="k">החלפה הבאה</div>
-        <div class="v" id="nextChange">—</div>
-      </div>
-    </section>
-
-    <main class="wrap">
-      <details class="card" id="networkCard">
-        <summary class="sum">
-          <div class="cardTitle">
-            <svg class="icon"><use href="#i-wifi" /></svg>
-            <div>
-              <div class="sumTitle">רשת</div>
-              <div class="sumSub" id="netHint">—</div>
-            </div>
-          </div>
-          <div class="sumRight">
-            <svg class="chev"><use href="#i-chevron" /></svg>
-          </div>
-        </summary>
-        <div class="content">
-          <div class="actions">
-            <button class="btn" id="scanBtn" type="button">סריקה</button>
-          </div>
-          <div id="netList" class="list"></div>
-
-          <div class="miniTitle">רשתות שמורות</div>
-          <div id="savedList" class="list"></div>
-
-          <details class="subdetails" id="ipDetails">
-            <summary class="subsum">
-              <div>IP (DHCP / קבוע)</div>
-              <svg class="chev"><use href="#i-chevron" /></svg>
-            </summary>
-            <div class="content">
-              <div class="row">
-                <label class="label">מצב</label>
-                <select id="ipMode">
-                  <option value="dhcp">אוטומטי (DHCP)</option>
-                  <option value="static">קבוע (Static IP)</option>
-                </select>
-              </div>
-
-              <div class="grid2" id="staticIpGrid" style="display: none">
-                <div class="row">
-                  <label class="label">IP</label>
-                  <input id="staIp" type="text" placeholder="192.168.1.50" />
-                </div>
-                <div class="row">
-                  <label class="label">Gateway</label>
-                  <input id="staGw" type="text" placeholder="192.168.1.1" />
-                </div>
-                <div class="row">
-                  <label class="label">Subnet</label>
-                  <input id="staMask" type="text" placeholder="255.255.255.0" />
-                </div>
-                <div class="row">
-                  <label class="label">DNS 1</label>
-                  <input id="staDns1" type="text" placeholder="1.1.1.1" />
-                </div>
-                <div class="row">
-                  <label class="label">DNS 2</label>
-                  <input id="staDns2" type="text" placeholder="8.8.8.8" />
-                </div>
-              </div>
-              <div class="muted" style="margin-top: 8px">שינוי IP מחייב אתחול (מתבצע אוטומטית לאחר שמירה).</div>
-            </div>
-          </details>
-
-          <details class="subdetails" id="apDetails">
-            <summary class="subsum">
-              <div>Hotspot</div>
-              <svg class="chev"><use href="#i-chevron" /></svg>
-            </summary>
-            <div class="content">
-              <div class="row">
-                <label class="label">שם רשת (SSID)</label>
-                <input id="apSsid" type="text" placeholder="SmartShabat-XXXX" />
-              </div>
-
-              <div class="row">
-                <div class="inline">
-                  <label class="switch">
-                    <input id="apProtected" type="checkbox" />
-                    <span></span>
-                  </label>
-                  <div>
-                    <div class="label">להגן עם סיסמה</div>
-                    <div class="muted">מינימום 8 תווים</div>
-                  </div>
-                </div>
-              </div>
-
-              <div class="row" id="apPasswordRow" style="display: none">
-                <label class="label">סיסמה</label>
-                <input id="apPassword" type="password" placeholder="••••••••" />
-              </div>
-            </div>
-          </details>
-
-          <details class="subdetails" id="hostDetails">
-            <summary class="subsum">
-              <div>שם מכשיר ברשת</div>
-              <svg class="chev"><use href="#i-chevron" /></svg>
-            </summary>
-            <div class="content">
-              <div class="row">
-                <label class="label">Hostname</label>
-                <input id="hostName" type="text" placeholder="SmartShabat-XXXX" />
-              </div>
-            </div>
-          </details>
-
-          <div class="actions">
-            <button class="btn primary" id="saveNetworkBtn" type="button">שמור</button>
-            <button class="btn danger" id="resetWifiBtn" type="button">איפוס Wi‑Fi</button>
-          </div>
-
-          <details class="subdetails" id="resetDetails">
-            <summary class="subsum">
-              <div>איפוס מפעל</div>
-              <svg class="chev"><use href="#i-chevron" /></svg>
-            </summary>
-            <div class="content">
-              <div class="muted">מוחק את כל ההגדרות, הרשתות השמורות, ההיסטוריה ונתוני העדכון.</div>
-              <div class="actions">
-                <button class="btn danger" id="factoryResetBtn" type="button">איפוס מפעל</button>
-              </div>
-            </div>
-          </details>
-        </div>
-      </details>
-
-      <details class="card" id="clockCard">
-        <summary class="sum">
-          <div class="cardTitle">
-            <svg class="icon"><use href="#i-clock" /></svg>
-            <div>
-              <div class="sumTitle">שעון</div>
-              <div class="sumSub" id="clockHint">—</div>
-            </div>
-          </div>
-          <div class="sumRight">
-            <div class="pill" id="clockPill">—</div>
-            <svg class="chev"><use href="#i-chevron" /></svg>
-          </div>
-        </summary>
-        <div class="content">
-          <div class="grid">
-            <div class="kv">
-              <div class="k">מקור</div>
-              <div class="v" id="clockSource">—</div>
-            </div>
-            <div class="kv">
-              <div class="k">סנכרון אחרון</div>
-              <div class="v" id="clockLastSync">—</div>
-            </div>
-            <div class="kv">
-              <div class="k">שעון קיץ</div>
-              <div class="v" id="dstState">—</div>
-            </div>
-            <div class="kv">
-              <div class="k">המעבר הבא</div>
-              <div class="v" id="dstNext">—</div>
-            </div>
-          </div>
-
-          <div class="row" style="margin-top: 12px">
-            <label class="label">כיוון ידני</label>
-            <input id="manualTime" type="datetime-local" />
-            <button class="btn" id="setManualBtn" type="button">קבע</button>
-          </div>
-
-          <div class="actions">
-            <button class="btn" id="setNowBtn" type="button">כוון מהטלפון</button>
-            <button class="btn" id="ntpSyncBtn" type="button">סנכרון עכשיו</button>
-          </div>
-
-          <details class="subdetails" id="ntpDetails">
-            <summary class="subsum">
-              <div>NTP</div>
-              <svg class="chev"><use href="#i-chevron" /></svg>
-            </summary>
-            <div class="content">
-              <div class="row">
-                <div class="inline">
-                  <label class="switch">
-                    <input id="ntpEnabled" type="checkbox" />
-                    <span></span>
-                  </label>
-                  <div>
-                    <div class="label">סנכרון אוטומטי</div>
-                    <div class="muted">מומלץ כדי לתקן סטייה</div>
-                  </div>
-                </div>
-              </div>
-
-              <div class="row">
-                <label class="label">שרת NTP</label>
-                <input id="ntpServer" type="text" placeholder="pool.ntp.org" />
-              </div>
-
-              <div class="row">
-                <label class="label">ריענון</label>
-                <select id="ntpResync">
-                  <option value="0">כבוי</option>
-                  <option value="60">כל שעה</option>
-                  <option value="360">כל 6 שעות</option>
-                  <option value="720">כל 12 שעות</option>
-                  <option value="1440">כל 24 שעות</option>
-                </select>
-              </div>
-            </div>
-          </details>
-
-          <details class="subdetails" id="tzDetails">
-            <summary class="subsum">
-              <div>אזור זמן / שעון קיץ</div>
-              <svg class="chev"><use href="#i-chevron" /></svg>
-            </summary>
-            <div class="content">
-              <div class="row">
-                <label class="label">GMT</label>
-                <select id="tzOffset" disabled>
-                  <option value="120">UTC+2 (ישראל)</option>
-                </select>
-              </div>
-
-              <div class="row">
-                <label class="label">מיקום</label>
-                <select id="locationSelect" disabled>
-                  <option value="kiryat_shmona">קרית שמונה (מובנה)</option>
-                </select>
-              </div>
-
-              <div class="row">
-                <label class="label">שעון קיץ</label>
-                <select id="dstMode">
-                  <option value="1">אוטומטי</option>
-                  <option value="2">ידני</option>
-                  <option value="0">כבוי</option>
-                </select>
-              </div>
-
-              <div class="row" id="dstManualRow" style="display: none">
-                <div class="inline">
-                  <label class="switch">
-                    <input id="dstManualOn" type="checkbox" />
-                    <span></span>
-                  </label>
-                  <div>
-                    <div class="label">מופעל</div>
-                    <div class="muted">ידני</div>
-                  </div>
-                </div>
-              </div>
-            </div>
-          </details>
-
-          <div class="actions">
-            <button class="btn primary" id="saveClockBtn" type="button">שמור</button>
-          </div>
-        </div>
-      </details>
-
-      <details class="card" id="timerCard">
-        <summary class="sum">
-          <div class="cardTitle">
-            <svg class="icon"><use href="#i-sliders" /></svg>
-            <div>
-              <div class="sumTitle">זמנים</div>
-              <div class="sumSub">שבת/חג לפי לוח מובנה</div>
-            </div>
-          </div>
-          <div class="sumRight">
-            <svg class="chev"><use href="#i-chevron" /></svg>
-          </div>
-        </summary>
-        <div class="content">
-          <div class="row">
-            <label class="label">מצב עבודה</label>
-            <select id="runMode">
-              <option value="0">אוטומטי</option>
-              <option value="1">חול</option>
-              <option value="2">שבת/חג</option>
-            </select>
-          </div>
-
-          <div class="grid2">
-            <div class="row">
-              <label class="label">דקות לפני הדלקת נרות</label>
-              <input id="beforeShkia" type="number" min="0" max="240" step="1" />
-            </div>
-            <div class="row">
-              <label class="label">דקות אחרי מוצאי שבת/חג</label>
-              <input id="afterTzeit" type="number" min="0" max="240" step="1" />
-            </div>
-          </div>
-
-          <div class="miniTitle">החלון הבא</div>
-          <div id="nextWindow" class="item"><div class="muted">—</div></div>
-
-          <details class="subdetails" id="moreWindowsDetails">
-            <summary class="subsum">
-              <div>חלונות נוספים</div>
-              <svg class="chev"><use href="#i-chevron" /></svg>
-            </summary>
-            <div class="content">
-              <div id="upcomingList" class="list"></div>
-            </div>
-          </details>
-
-          <details class="subdetails" id="windowsDetails">
-            <summary class="subsum">
-              <div>חלונות ידניים (הדלקה/כיבוי)</div>
-              <svg class="chev"><use href="#i-chevron" /></svg>
-            </summary>
-            <div class="content">
-              <div id="windowsList" class="list"></div>
-
-              <div class="miniTitle">הוספה</div>
-              <div class="grid2">
-                <div class="row">
-                  <label class="label">התחלה</label>
-                  <input id="winStart" type="datetime-local" />
-                </div>
-                <div class="row">
-                  <label class="label">סיום</label>
-                  <input id="winEnd" type="datetime-local" />
-                </div>
-              </div>
-              <div class="row">
-                <label class="label">פעולה</label>
-                <select id="winAction">
-                  <option value="on">הדלקה</option>
-                  <option value="off">כיבוי</option>
-                </select>
-                <button class="btn" id="addWinBtn" type="button">הוסף</button>
-              </div>
-            </div>
-          </details>
-
-          <div class="actions">
-            <button class="btn primary" id="saveTimerBtn" type="button">שמור</button>
-          </div>
-        </div>
-      </details>
-
-      <details class="card" id="wiringCard">
-        <summary class="sum">
-          <div class="cardTitle">
-            <svg class="icon"><use href="#i-sliders" /></svg>
-            <div>
-              <div class="sumTitle">חיווט</div>
-              <div class="sumSub">NC/NO · Active LOW/HIGH</div>
-            </div>
-          </div>
-          <div class="sumRight">
-            <svg class="chev"><use href="#i-chevron" /></svg>
-          </div>
-        </summary>
-        <div class="content">
-          <div class="row">
-            <label class="label">חיבור לעומס</label>
-            <select id="contactMap">
-              <option value="0">NO (מומלץ)</option>
-              <option value="1">NC</option>
-            </select>
-          </div>
-          <div class="row">
-            <label class="label">הפעלה</label>
-            <select id="relayActiveLow">
-              <option value="1">Active LOW (LOW = מחובר/קליק)</option>
-              <option value="0">Active HIGH (HIGH = מחובר/קליק)</option>
-            </select>
-          </div>
-          <div class="muted" id="contactMapHint"></div>
-
-          <details class="subdetails" id="bootRelayDetails">
-            <summary class="subsum">
-              <div>לאחר הפסקת חשמל</div>
-              <svg class="chev"><use href="#i-chevron" /></svg>
-            </summary>
-            <div class="content">
-              <div class="row">
-                <label class="label">לפני שהשעון מכוון</label>
-                <select id="relayBootMode">
-                  <option value="0">מצב אחרון</option>
-                  <option value="1">חול</option>
-                  <option value="2">שבת/חג</option>
-                </select>
-              </div>
-              <div class="muted">לאחר שהשעה תקינה, המכשיר חוזר לחישוב אוטומטי.</div>
-            </div>
-          </details>
-        </div>
-      </details>
-
-      <details class="card" id="historyCard">
-        <summary class="sum">
-          <div class="cardTitle">
-            <svg class="icon"><use href="#i-status" /></svg>
-            <div>
-              <div class="sumTitle">היסטוריה</div>
-              <div class="sumSub">רישום אירועים</div>
-            </div>
-          </div>
-          <div class="sumRight">
-            <svg class="chev"><use href="#i-chevron" /></svg>
-          </div>
-        </summary>
-        <div class="content">
-          <div id="historyList" class="list"></div>
-          <div class="actions">
-            <button class="btn ghost" id="clearHistoryBtn" type="button">נקה</button>
-          </div>
-        </div>
-      </details>
-
-      <details class="card" id="updatesCard">
-        <summary class="sum">
-          <div class="cardTitle">
-            <svg class="icon"><use href="#i-update" /></svg>
-            <div>
-              <div class="sumTitle">עדכונים</div>
-              <div class="sumSub" id="otaHintTop">—</div>
-            </div>
-          </div>
-          <div class="sumRight">
-            <div class="pill" id="otaPill">—</div>
-            <svg class="chev"><use href="#i-chevron" /></svg>
-          </div>
-        </summary>
-        <div class="content">
-          <div class="grid">
-            <div class="kv">
-              <div class="k">גרסה</div>
-              <div class="v" id="otaCurrent">—</div>
-            </div>
-            <div class="kv">
-              <div class="k">זמין</div>
-              <div class="v" id="otaAvailable">—</div>
-            </div>
-            <div class="kv">
-              <div class="k">בדיקה אחרונה</div>
-              <div class="v" id="otaLastCheck">—</div>
-            </div>
-          </div>
-
-          <div class="row">
-            <div class="inline">
-              <label class="switch">
-                <input id="otaAuto" type="checkbox" />
-                <span></span>
-              </label>
-              <div>
-                <div class="label">עדכון אוטומטי</div>
-                <div class="muted">(רק בימות החול)</div>
-              </div>
-            </div>
-          </div>
-         <div class="row">
-            <label class="label">בדיקה כל כמה שעות?</label>
-            <select id="otaCheckHours">
-              <option value="0">כבוי</option>
-              <option value="6">כל 6 שעות</option>
-              <option value="12">כל 12 שעות</option>
-              <option value="24">כל 24 שעות</option>
-              <option value="72">כל 3 ימים</option>
-            </select>
-            <button class="btn" id="saveOtaBtn" type="button">שמור</button>
-          </div>
-          <div class="row">
-            <label class="label">כתובת manifest</label>
-            <input id="otaManifestUrl" type="text" placeholder="https://github.com/yk8-git/smart-shabat/releases/latest/download/ota.json" />
-          </div>
-          <div class="row">
-            <button class="btn ghost" id="otaResetManifestBtn" type="button">איפוס לברירת מחדל</button>
-          </div>
-
-          <div class="actions">
-            <button class="btn primary" id="otaActionBtn" type="button">בדוק עכשיו</button>
-          </div>
-          <div class="muted" id="otaHint" style="margin-top: 10px"></div>
-        </div>
-      </details>
-    </main>
-
-    <div class="modal" id="wifiModal" style="display: none" role="dialog" aria-modal="true">
-      <div class="modalBox">
-        <div class="modalTitle">התחברות ל‑Wi‑Fi</div>
-        <div class="muted" id="wifiModalSsid" style="margin-top: 2px">—</div>
-
-	        <div class="row" id="wifiModalPassRow" style="border-top: none; padding-top: 0; margin-top: 12px">
-	          <label class="label">סיסמה</label>
-	          <input id="wifiModalPass" type="password" placeholder="••••••••" />
-	        </div>
-
-        <div class="actions">
-          <button class="btn" id="wifiModalCancel" type="button">ביטול</button>
-          <button class="btn primary" id="wifiModalConnect" type="button">התחבר</button>
-        </div>
-        <div class="muted" id="wifiModalHint" style="margin-top: 10px"></div>
-      </div>
-    </div>
-
-    <div class="toast" id="toast" style="display: none"></div>
-    <script src="/app.js"></script>
-  </body>
-</html>
-)SMARTSHABAT_HTML";
-
-// text/css
-static const char kEmbeddedStylesCss[] PROGMEM = R"SMARTSHABAT_CSS(
-:root {
-  --bg: #0b1020;
-  --card: rgba(255, 255, 255, 0.06);
-  --card2: rgba(255, 255, 255, 0.08);
-  --text: #eaf0ff;
-  --muted: rgba(234, 240, 255, 0.72);
-  --line: rgba(234, 240, 255, 0.12);
-  --good: #22c55e;
-  --warn: #f59e0b;
-  --bad: #ef4444;
-  --accent: #60a5fa;
-  --shadow: 0 10px 30px rgba(0, 0, 0, 0.35);
-}
-
-* {
-  box-sizing: border-box;
-}
-
-body {
-  margin: 0;
-  font-family: system-ui, -apple-system, Segoe UI, Roboto, Helvetica, Arial, "Apple Color Emoji", "Segoe UI Emoji";
-  color: var(--text);
-  background: radial-gradient(900px 500px at 20% 0%, rgba(96, 165, 250, 0.18), transparent 60%),
-    radial-gradient(700px 500px at 80% 20%, rgba(34, 197, 94, 0.12), transparent 60%), var(--bg);
-}
-
-.sprite {
-  position: absolute;
-  width: 0;
-  height: 0;
-  overflow: hidden;
-}
-
-.top {
-  position: sticky;
-  top: 0;
-  z-index: 10;
-  display: flex;
-  gap: 12px;
-  justify-content: space-between;
-  align-items: center;
-  padding: 14px 16px;
-  background: rgba(11, 16, 32, 0.7);
-  backdrop-filter: blur(10px);
-  border-bottom: 1px solid var(--line);
-}
-
-.brand .title {
-  font-weight: 800;
-  letter-spacing: 0.2px;
-  font-size: 18px;
-}
-
-.brand .subtitle {
-  margin-top: 2px;
-  color: var(--muted);
-  font-size: 12px;
-}
-
-.badges {
-  display: flex;
-  gap: 8px;
-  align-items: center;
-}
-
-.badge,
-.pill {
-  font-size: 12px;
-  padding: 6px 10px;
-  border-radius: 999px;
-  border: 1px solid var(--line);
-  background: rgba(255, 255, 255, 0.04);
-  color: var(--text);
-  white-space: nowrap;
-}
-
-.pill.good {
-  border-color: rgba(34, 197, 94, 0.4);
-  background: rgba(34, 197, 94, 0.12);
-}
-
-.pill.warn {
-  border-color: rgba(245, 158, 11, 0.45);
-  background: rgba(245, 158, 11, 0.14);
-}
-
-.pill.bad {
-  border-color: rgba(239, 68, 68, 0.45);
-  background: rgba(239, 68, 68, 0.14);
-}
-
-.status-grid {
-  max-width: 960px;
-  margin: 0 auto 14px;
-  display: grid;
-  gap: 14px;
-  grid-template-columns: repeat(auto-fit, minmax(180px, 1fr));
-  padding: 0 16px 14px;
-}
-
-.status-block {
-  border-radius: 16px;
-  border: 1px solid var(--line);
-  background: var(--card);
-  padding: 14px;
-  display: flex;
-  flex-direction: column;
-  gap: 6px;
-}
-
-.wrap {
-  max-width: 960px;
-  margin: 0 auto;
-  padding: 16px;
-  display: grid;
-  gap: 14px;
-}
-
-.card {
-  background: var(--card);
-  border: 1px solid var(--line);
-  border-radius: 16px;
-  padding: 0;
-  box-shadow: var(--shadow);
-  overflow: hidden;
-}
-
-.card > summary {
-  list-style: none;
-}
-
-.card > summary::-webkit-details-marker {
-  display: none;
-}
-
-.sum {
-  display: flex;
-  align-items: center;
-  justify-content: space-between;
-  gap: 10px;
-  padding: 14px;
-  cursor: pointer;
-  user-select: none;
-}
-
-.sumTitle {
-  font-size: 16px;
-  font-weight: 800;
-}
-
-.sumSub {
-  margin-top: 2px;
-  color: var(--muted);
-  font-size: 12px;
-  max-width: 56vw;
-  overflow: hidden;
-  text-overflow: ellipsis;
-  white-space: nowrap;
-}
-
-.sumRight {
-  display: flex;
-  align-items: center;
-  gap: 10px;
-}
-
-.chev {
-  width: 18px;
-  height: 18px;
-  fill: currentColor;
-  opacity: 0.8;
-  transition: transform 0.15s ease;
-}
-
-details[open] > summary .chev {
-  transform: rotate(180deg);
-}
-
-.content {
-  padding: 14px;
-  border-top: 1px solid var(--line);
-}
-
-.cardHead {
-  display: flex;
-  justify-content: space-between;
-  align-items: center;
-  gap: 10px;
-  margin-bottom: 10px;
-}
-
-.cardTitle {
-  display: flex;
-  align-items: center;
-  gap: 10px;
-}
-
-.cardTitle h2 {
-  margin: 0;
-  font-size: 16px;
-  font-weight: 800;
-}
-
-.icon {
-  width: 18px;
-  height: 18px;
-  fill: currentColor;
-  opacity: 0.9;
-}
-
-.muted {
-  color: var(--muted);
-  font-size: 13px;
-  line-height: 1.35;
-}
-
-.grid {
-  display: grid;
-  grid-template-columns: repeat(auto-fit, minmax(190px, 1fr));
-  gap: 10px;
-}
-
-.kv {
-  padding: 10px;
-  border-radius: 14px;
-  border: 1px solid var(--line);
-  background: rgba(255, 255, 255, 0.03);
-}
-
-.kv .k {
-  font-size: 12px;
-  color: var(--muted);
-}
-
-.kv .v {
-  margin-top: 6px;
-  font-weight: 800;
-  font-size: 14px;
-}
-
-.kv .subDate {
-  margin-top: 3px;
-  font-size: 12px;
-  color: var(--muted);
-  line-height: 1.2;
-}
-
-.miniTitle {
-  margin-top: 12px;
-  margin-bottom: 8px;
-  font-size: 12px;
-  letter-spacing: 0.2px;
-  color: var(--muted);
-}
-
-.subdetails {
-  margin-top: 12px;
-  border: 1px solid var(--line);
-  border-radius: 14px;
-  background: rgba(255, 255, 255, 0.03);
-  overflow: hidden;
-}
-
-.subdetails > summary {
-  list-style: none;
-}
-
-.subdetails > summary::-webkit-details-marker {
-  display: none;
-}
-
-.subsum {
-  display: flex;
-  justify-content: space-between;
-  align-items: center;
-  gap: 10px;
-  padding: 10px 12px;
-  cursor: pointer;
-  color: var(--text);
-  font-weight: 800;
-  font-size: 13px;
-}
-
-.subdetails .content {
-  border-top: 1px solid var(--line);
-  padding: 12px;
-}
-
-.grid2 {
-  display: grid;
-  grid-template-columns: 1fr;
-  gap: 10px;
-}
-
-.grid2 .row {
-  margin-top: 0;
-  padding-top: 0;
-  border-top: none;
-}
-
-.list {
-  display: grid;
-  gap: 8px;
-}
-
-.item {
-  display: flex;
-  justify-content: space-between;
-  align-items: center;
-  gap: 10px;
-  padding: 10px;
-  border-radius: 14px;
-  border: 1px solid var(--line);
-  background: var(--card2);
-}
-
-.item .left {
-  min-width: 0;
-}
-
-.item .title {
-  font-weight: 800;
-  font-size: 14px;
-}
-
-.item .sub {
-  margin-top: 2px;
-  font-size: 12px;
-  color: var(--muted);
-  overflow: hidden;
-  text-overflow: ellipsis;
-  white-space: nowrap;
-}
-
-.actions {
-  display: flex;
-  gap: 10px;
-  flex-wrap: wrap;
-  margin-top: 12px;
-}
-
-.row {
-  margin-top: 10px;
-  padding-top: 10px;
-  border-top: 1px dashed var(--line);
-  display: flex;
-  gap: 10px;
-  align-items: center;
-  flex-wrap: wrap;
-}
-
-.label {
-  font-size: 12px;
-  color: var(--muted);
-}
-
-input[type="number"],
-input[type="text"],
-input[type="password"],
-input[type="datetime-local"],
-select {
-  flex: 1;
-  min-width: 180px;
-  padding: 10px 10px;
-  border-radius: 12px;
-  border: 1px solid var(--line);
-  background: rgba(0, 0, 0, 0.22);
-  color: var(--text);
-  outline: none;
-}
-
-select {
-  min-width: 220px;
-}
-
-.btn {
-  border: 1px solid var(--line);
-  background: rgba(255, 255, 255, 0.06);
-  color: var(--text);
-  border-radius: 12px;
-  padding: 10px 12px;
-  cursor: pointer;
-  font-weight: 800;
-  font-size: 13px;
-}
-
-.btn:hover {
-  background: rgba(255, 255, 255, 0.09);
-}
-
-.btn:disabled {
-  opacity: 0.6;
-  cursor: default;
-}
-
-.btn.primary {
-  border-color: rgba(96, 165, 250, 0.55);
-  background: rgba(96, 165, 250, 0.18);
-}
-
-.btn.danger {
-  border-color: rgba(239, 68, 68, 0.55);
-  background: rgba(239, 68, 68, 0.18);
-}
-
-.btn.ghost {
-  background: transparent;
-}
-
-.inline {
-  display: flex;
-  align-items: center;
-  gap: 12px;
-}
-
-.switch {
-  position: relative;
-  width: 48px;
-  height: 28px;
-  flex: 0 0 auto;
-}
-
-.switch input {
-  position: absolute;
-  opacity: 0;
-  pointer-events: none;
-}
-
-.switch span {
-  position: absolute;
-  inset: 0;
-  border-radius: 999px;
-  border: 1px solid var(--line);
-  background: rgba(255, 255, 255, 0.06);
-  transition: 0.15s ease;
-}
-
-.switch span::after {
-  content: "";
-  position: absolute;
-  top: 3px;
-  right: 3px;
-  width: 22px;
-  height: 22px;
-  border-radius: 999px;
-  background: rgba(234, 240, 255, 0.9);
-  transition: 0.15s ease;
-}
-
-.switch input:checked + span {
-  background: rgba(34, 197, 94, 0.18);
-  border-color: rgba(34, 197, 94, 0.55);
-}
-
-.switch input:checked + span::after {
-  transform: translateX(-20px);
-  background: rgba(34, 197, 94, 0.95);
-}
-
-.modal {
-  position: fixed;
-  inset: 0;
-  padding: 16px;
-  background: rgba(0, 0, 0, 0.55);
-  backdrop-filter: blur(10px);
-  display: flex;
-  align-items: flex-end;
-  justify-content: center;
-  z-index: 50;
-}
-
-.modalBox {
-  width: 100%;
-  max-width: 520px;
-  border: 1px solid var(--line);
-  border-radius: 16px;
-  background: rgba(11, 16, 32, 0.92);
-  box-shadow: var(--shadow);
-  padding: 14px;
-}
-
-.modalTitle {
-  font-weight: 900;
-  font-size: 15px;
-}
-
-.toast {
-  position: fixed;
-  left: 14px;
-  right: 14px;
-  bottom: 14px;
-  padding: 12px 14px;
-  border-radius: 14px;
-  border: 1px solid var(--line);
-  background: rgba(0, 0, 0, 0.45);
-  backdrop-filter: blur(10px);
-  box-shadow: var(--shadow);
-  font-weight: 800;
-  text-align: center;
-}
-
-@media (min-width: 600px) {
-  .modal {
-    align-items: center;
-  }
-}
-
-@media (min-width: 900px) {
-  .wrap {
-    grid-template-columns: 1fr 1fr;
-  }
-  .grid2 {
-    grid-template-columns: 1fr 1fr;
-  }
-}
-)SMARTSHABAT_CSS";
-
-// application/javascript
-static const char kEmbeddedAppJs[] PROGMEM = R"SMARTSHABAT_JS(
-const DEFAULT_OTA_MANIFEST = "https://github.com/yk8-git/smart-shabat/releases/latest/download/ota.json";
-
-const state = {
-  status: null,
-  time: null,
-  clock: { baseLocal: 0, baseMs: 0, valid: false },
-  config: null,
-  schedule: null,
-  ota: null,
-  history: null,
-  windows: [],
-  wifiModal: { open: false, ssid: "", secure: true, ch: 0, bssid: "" },
-  redirect: { ip: "", startedAtMs: 0, countdownSec: 0 },
+#include <stddef.h>
+#include <stdint.h>
+
+// Embedded UI assets, minified and gzipped (served as-is with Content-Encoding: gzip).
+// Generated by tools/gen_embedded_ui.py from /data; `etag` is a hash of the minified content,
+// and the CSS/JS `path` carries it so those URLs never change content.
+struct EmbeddedAsset {
+  const char *path;
+  const char *mime;
+  const char *etag;
+  const uint8_t *gz;
+  size_t gzLen;
 };
 
-function $(id) {
-  return document.getElementById(id);
-}
-
-function sleep(ms) {
-  return new Promise((r) => setTimeout(r, ms));
-}
-
-function toast(msg) {
-  const el = $("toast");
-  if (!el) return;
-  el.textContent = msg;
-  el.style.display = "block";
-  clearTimeout(toast._t);
-  toast._t = setTimeout(() => {
-    el.style.display = "none";
-  }, 2800);
-}
-
-async function apiGet(path, options) {
-  const timeoutMs = Number((options && options.timeoutMs) || 0);
-  const res = await _fetchWithTimeout(path, { cache: "no-store" }, timeoutMs);
-  const text = await res.text();
-  let data = null;
-  try {
-    data = text ? JSON.parse(text) : null;
-  } catch {
-    data = null;
-  }
-  if (!res.ok) {
-    const msg = (data && (data.error || data.message)) || text || `HTTP ${res.status}`;
-    const err = new Error(msg);
-    err.status = res.status;
-    err.data = data;
-    throw err;
-  }
-  return data;
-}
-
-async function apiPost(path, body, options) {
-  const timeoutMs = Number((options && options.timeoutMs) || 0);
-  const res = await _fetchWithTimeout(
-    path,
-    {
-      method: "POST",
-      headers: { "content-type": "application/json" },
-      body: JSON.stringify(body || {}),
-    },
-    timeoutMs
-  );
-  const text = await res.text();
-  let data = null;
-  try {
-    data = text ? JSON.parse(text) : null;
-  } catch {
-    data = null;
-  }
-  if (!res.ok) {
-    const msg = (data && (data.error || data.message)) || text || `HTTP ${res.status}`;
-    const err = new Error(msg);
-    err.status = res.status;
-    err.data = data;
-    throw err;
-  }
-  return data;
-}
-
-async function _fetchWithTimeout(url, opts, timeoutMs) {
-  const ms = Number(timeoutMs || 0);
-  if (!ms) return fetch(url, opts);
-  if (typeof AbortController === "undefined") {
-    return await Promise.race([
-      fetch(url, opts),
-      new Promise((_, reject) => setTimeout(() => reject(new Error("timeout")), ms))
-    ]);
-  }
-  const controller = new AbortController();
-  const timer = setTimeout(() => controller.abort(), ms);
-  try {
-    const options = Object.assign({}, opts || {});
-    if (!options.signal) options.signal = controller.signal;
-    return await fetch(url, options);
-  } finally {
-    clearTimeout(timer);
-  }
-}
-
-function setText(id, text) {
-  const el = $(id);
-  if (el) el.textContent = text;
-}
-
-function setHtml(id, html) {
-  const el = $(id);
-  if (el) el.innerHTML = html;
-}
-
-function setPill(id, text, tone) {
-  const el = $(id);
-  if (!el) return;
-  el.textContent = text;
-  el.classList.remove("good", "warn", "bad");
-  if (tone) el.classList.add(tone);
-}
-
-function fmtLocal(epochLocal) {
-  if (!epochLocal) return "—";
-  const d = new Date(epochLocal * 1000);
-  return d.toLocaleString("he-IL", { hour12: false, timeZone: "UTC" });
-}
-
-let _hebrewFmt = null;
-function getHebrewFormatter() {
-  if (_hebrewFmt) return _hebrewFmt;
-  try {
-    _hebrewFmt = new Intl.DateTimeFormat("he-IL-u-ca-hebrew-nu-hebr", {
-      timeZone: "UTC",
-      day: "numeric",
-      month: "long",
-      year: "numeric",
-    });
-    return _hebrewFmt;
-  } catch {
-    _hebrewFmt = null;
-    return null;
-  }
-}
-
-const hebrewGematriaMap = {
-  א: 1,
-  ב: 2,
-  ג: 3,
-  ד: 4,
-  ה: 5,
-  ו: 6,
-  ז: 7,
-  ח: 8,
-  ט: 9,
-  י: 10,
-  כ: 20,
-  ך: 20,
-  ל: 30,
-  מ: 40,
-  ם: 40,
-  נ: 50,
-  ן: 50,
-  ס: 60,
-  ע: 70,
-  פ: 80,
-  ף: 80,
-  צ: 90,
-  ץ: 90,
-  ק: 100,
-  ר: 200,
-  ש: 300,
-  ת: 400,
+// / (text/html; charset=utf-8): 23250 B source, 16568 B minified, 3648 B gzip
+static const uint8_t kEmbeddedIndexHtmlGz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x1c, 0x5d, 0x53, 0xdb, 0x48, 0xf2, 0x3d, 0xbf, 0x62,
+  0xce, 0xf7, 0x02, 0x75, 0x6b, 0xd9, 0x32, 0xb6, 0x71, 0xb2, 0x81, 0xab, 0x84, 0xec, 0x05, 0xaa, 0x80, 0x50, 0x81, 0xdd,
+  0x5c, 0xe5, 0xe5, 0x6a, 0x6c, 0xc9, 0x58, 0x87, 0x2c, 0xa9, 0xa4, 0xb1, 0x0d, 0xfb, 0x94, 0x9f, 0x10, 0x16, 0xb3, 0xc4,
+  0x87, 0x21, 0xc0, 0x65, 0x17, 0x36, 0x7f, 0xe0, 0xde, 0xef, 0x4f, 0xe8, 0x3d, 0xbf, 0xe4, 0xba, 0x67, 0x24, 0xf9, 0x6b,
+  0x24, 0xcb, 0x5e, 0x92, 0xec, 0x05, 0xb0, 0xad, 0xd1, 0xa8, 0xa7, 0xbb, 0xa7, 0xbf, 0x7b, 0x9c, 0xc7, 0x7f, 0xd2, 0xec,
+  0x1a, 0x3b, 0x72, 0x74, 0xd2, 0x60, 0x4d, 0x73, 0xf5, 0xc1, 0x63, 0x7c, 0x23, 0x26, 0xb5, 0xf6, 0x57, 0x32, 0x0d, 0x3d,
+  0x43, 0x34, 0xc3, 0x5d, 0xc9, 0xb8, 0xcc, 0xcc, 0xe0, 0x2d, 0x9d, 0x6a, 0xf0, 0xd6, 0xd4, 0x19, 0x25, 0xb5, 0x06, 0x75,
+  0x3d, 0x9d, 0xad, 0x64, 0x5a, 0xac, 0x9e, 0xad, 0x64, 0x48, 0x2e, 0xbc, 0x61, 0xd1, 0xa6, 0xbe, 0x92, 0x69, 0x1b, 0x7a,
+  0xc7, 0xb1, 0x5d, 0x96, 0x21, 0x35, 0xdb, 0x62, 0xba, 0x05, 0x13, 0x3b, 0x86, 0xc6, 0x1a, 0x2b, 0x9a, 0xde, 0x36, 0x6a,
+  0x7a, 0x96, 0x5f, 0x7c, 0x43, 0x0c, 0xcb, 0x60, 0x06, 0x35, 0xb3, 0x5e, 0x8d, 0x9a, 0xfa, 0x8a, 0x2a, 0xc0, 0x30, 0x83,
+  0x99, 0xfa, 0xaa, 0xff, 0x9b, 0x7f, 0xe3, 0x9f, 0xfa, 0xef, 0x09, 0x7c, 0x38, 0xf6, 0x3f, 0x3e, 0xce, 0x89, 0xe1, 0x07,
+  0x8f, 0x4d, 0xc3, 0x3a, 0x20, 0xae, 0x6e, 0xae, 0x64, 0x3c, 0x76, 0x64, 0xea, 0x5e, 0x43, 0xd7, 0x61, 0x99, 0x86, 0xab,
+  0xd7, 0x57, 0x32, 0x39, 0x31, 0xa4, 0x14, 0xf3, 0x0f, 0x4b, 0xe5, 0xd2, 0x92, 0xa6, 0xd5, 0x94, 0x9a, 0xe7, 0x09, 0xb0,
+  0xb9, 0x00, 0xfd, 0xaa, 0xad, 0x1d, 0xc1, 0x9b, 0xd7, 0xde, 0x27, 0x35, 0x93, 0x7a, 0x1e, 0xc0, 0x71, 0x5c, 0x83, 0x01,
+  0xad, 0x87, 0x4d, 0xd3, 0x82, 0xcb, 0x06, 0x63, 0xce, 0xa3, 0x5c, 0xae, 0xd3, 0xe9, 0x28, 0x9d, 0x25, 0xc5, 0x76, 0xf7,
+  0x73, 0x85, 0x7c, 0x3e, 0x9f, 0x83, 0x07, 0x90, 0x09, 0xde, 0x51, 0xb3, 0x6a, 0x9b, 0xc4, 0xd0, 0x56, 0x32, 0x46, 0xd6,
+  0x63, 0x94, 0xb5, 0x00, 0x3e, 0x92, 0xfb, 0xd4, 0x3e, 0x5c, 0xc9, 0xe4, 0x49, 0x9e, 0x14, 0x8a, 0xf0, 0x8b, 0x53, 0x1d,
+  0xca, 0x1a, 0x0f, 0x60, 0xde, 0x96, 0x5a, 0x20, 0x05, 0xaa, 0xe6, 0x89, 0x8a, 0xb7, 0x55, 0xc2, 0x3f, 0xa8, 0xf9, 0x27,
+  0x6a, 0x5e, 0xc9, 0xab, 0x44, 0xbc, 0xe6, 0xf9, 0x0f, 0x4e, 0x7c, 0xdd, 0x84, 0xf7, 0x0a, 0xad, 0x90, 0x0a, 0x9f, 0xac,
+  0x92, 0x4a, 0x16, 0x3e, 0xe3, 0x9c, 0x4a, 0x38, 0x51, 0xc5, 0x91, 0xd7, 0x4d, 0x35, 0xab, 0x2e, 0x35, 0xb2, 0x85, 0x76,
+  0xd9, 0x2c, 0x91, 0x25, 0x18, 0x54, 0x95, 0xe5, 0xa5, 0x6c, 0x31, 0x5b, 0x50, 0x0a, 0xcb, 0xaf, 0x33, 0x0f, 0x38, 0xcd,
+  0x02, 0xdb, 0x71, 0xb4, 0x3b, 0x46, 0xdd, 0x48, 0x83, 0x34, 0xa0, 0x01, 0x08, 0x05, 0x38, 0x17, 0x82, 0x1f, 0x8e, 0x69,
+  0xb6, 0x90, 0x05, 0x44, 0x97, 0xb3, 0x25, 0x65, 0xb9, 0x48, 0x55, 0x55, 0x81, 0xb9, 0xf8, 0x22, 0xee, 0xa9, 0x45, 0x92,
+  0x37, 0x55, 0xa5, 0x08, 0x38, 0xc1, 0x0b, 0x7d, 0x08, 0x37, 0x1e, 0x06, 0x37, 0x55, 0x9c, 0x87, 0xf7, 0x5f, 0x23, 0x7c,
+  0x78, 0xb4, 0x4c, 0xe0, 0x37, 0x78, 0x2c, 0x0f, 0x93, 0x96, 0x94, 0xe5, 0xa1, 0x47, 0x61, 0x26, 0x4e, 0x16, 0x0f, 0x2e,
+  0x2b, 0xa5, 0x10, 0x70, 0x16, 0x5f, 0x9e, 0x0c, 0x3d, 0x8c, 0x9c, 0x2b, 0x22, 0xe7, 0x42, 0xc6, 0x21, 0xc0, 0x12, 0xa2,
+  0xa5, 0x3c, 0x5c, 0x1a, 0x02, 0x58, 0x26, 0xe5, 0x00, 0xdc, 0x04, 0xb4, 0xe8, 0x39, 0x84, 0xa5, 0x16, 0x92, 0x39, 0x58,
+  0x33, 0xed, 0xda, 0xc1, 0xd7, 0xda, 0x77, 0xa5, 0x34, 0xd8, 0x78, 0xce, 0x32, 0x95, 0x6f, 0x7e, 0xb9, 0x98, 0x2d, 0x2a,
+  0xb0, 0x2f, 0x4a, 0xb1, 0x9c, 0x8c, 0xbc, 0x67, 0x1a, 0x9a, 0xee, 0xa6, 0x10, 0xdb, 0x3c, 0x29, 0x37, 0xd4, 0x7c, 0xbb,
+  0xb0, 0xae, 0xe6, 0x5f, 0x37, 0xb3, 0xc0, 0xb9, 0x46, 0x11, 0x2e, 0x80, 0xcf, 0x05, 0xbc, 0x81, 0x9f, 0xcb, 0x30, 0x0e,
+  0x3b, 0xdb, 0xc8, 0x8b, 0xf1, 0x72, 0xcc, 0x03, 0x89, 0xe8, 0xb4, 0x1c, 0x8d, 0xa2, 0xfa, 0x4d, 0x67, 0x66, 0xf9, 0x87,
+  0xa5, 0xcd, 0x0a, 0x59, 0x36, 0x8b, 0xa4, 0xf8, 0x43, 0x25, 0xd8, 0x4b, 0xa4, 0xbd, 0xa4, 0x94, 0x4b, 0xa4, 0xb2, 0x0e,
+  0xd4, 0x97, 0x9f, 0x84, 0xfc, 0xe3, 0x4c, 0x9d, 0xc2, 0x88, 0x5a, 0x43, 0x6f, 0xbb, 0xb6, 0x95, 0xb4, 0x34, 0x09, 0x55,
+  0xa1, 0xa4, 0x94, 0x08, 0xfe, 0x3d, 0x44, 0x91, 0x41, 0x89, 0xd9, 0xe4, 0x62, 0x02, 0xe2, 0x5a, 0x52, 0x10, 0x03, 0x75,
+  0x53, 0xad, 0xe0, 0xed, 0xd7, 0x81, 0xb5, 0x89, 0x56, 0x44, 0xc3, 0x11, 0x18, 0x4f, 0xdd, 0x0d, 0x4d, 0x0e, 0xb3, 0x1d,
+  0x5c, 0x41, 0x33, 0xda, 0xe1, 0x48, 0xd5, 0xa5, 0x96, 0x36, 0x36, 0xc6, 0x4d, 0x5e, 0x66, 0xd2, 0x14, 0xc2, 0x94, 0xd1,
+  0x89, 0x5e, 0xab, 0x2a, 0xe6, 0x72, 0xc2, 0x84, 0x8d, 0xdd, 0x02, 0x6b, 0x9c, 0x59, 0xfd, 0xf4, 0xa6, 0x1b, 0xce, 0x9f,
+  0x7c, 0xac, 0x4a, 0xb5, 0x7d, 0xdd, 0xcb, 0x48, 0x06, 0x05, 0x20, 0x4b, 0x67, 0x4f, 0xf9, 0x95, 0x04, 0x4c, 0x4e, 0x10,
+  0x84, 0x2c, 0xd5, 0x6b, 0xcc, 0xb0, 0xad, 0x08, 0x17, 0x6e, 0x13, 0xb3, 0xfb, 0xae, 0xa1, 0x65, 0x08, 0x75, 0x0d, 0x9a,
+  0x35, 0x69, 0x15, 0xcd, 0xb5, 0x7f, 0xe9, 0xff, 0xea, 0x1f, 0x13, 0x78, 0xeb, 0xfa, 0x3d, 0xff, 0x6e, 0x6c, 0xd9, 0x83,
+  0x36, 0x09, 0x9e, 0xac, 0x72, 0xdd, 0x1a, 0xbb, 0x1b, 0x70, 0xa1, 0x2b, 0xa1, 0xa2, 0x1d, 0x20, 0x6b, 0x77, 0xf6, 0x8c,
+  0xe6, 0x28, 0xae, 0xa3, 0x2c, 0x7a, 0xc6, 0xc5, 0x2c, 0x98, 0xbb, 0xae, 0x57, 0x5d, 0xbd, 0xc3, 0x87, 0x92, 0x99, 0x34,
+  0x1d, 0xb1, 0x88, 0xae, 0x4b, 0xff, 0xda, 0xbf, 0x8b, 0xc7, 0x10, 0x9c, 0x16, 0x3d, 0xda, 0x65, 0xf7, 0xb6, 0x64, 0xfc,
+  0x4a, 0x4d, 0x5b, 0xd3, 0xef, 0x67, 0xa1, 0xae, 0x7f, 0xe6, 0xf7, 0xfd, 0x0f, 0x7e, 0x97, 0xc0, 0xc7, 0x63, 0xff, 0x6d,
+  0xe2, 0x0e, 0xe8, 0x87, 0x6c, 0xad, 0x01, 0xa1, 0x83, 0x5c, 0x60, 0x02, 0x39, 0xc1, 0x40, 0x81, 0x1a, 0x91, 0xb8, 0x74,
+  0x5c, 0x2a, 0x54, 0x01, 0xc4, 0xd5, 0x30, 0xbd, 0x70, 0xb8, 0x46, 0x5d, 0x2d, 0x12, 0xc2, 0x8e, 0xed, 0x1e, 0xac, 0xe1,
+  0x00, 0x4a, 0x5b, 0xab, 0xd9, 0xa4, 0xee, 0xd1, 0x60, 0x5b, 0x9b, 0x63, 0x58, 0xe3, 0x93, 0x7b, 0x42, 0x71, 0x46, 0xbc,
+  0xbc, 0x01, 0x91, 0x48, 0x66, 0xf5, 0x71, 0xcb, 0xd3, 0x83, 0x60, 0xe1, 0xcf, 0xa1, 0x23, 0xcc, 0xad, 0x86, 0x4a, 0x2a,
+  0x91, 0x9a, 0x66, 0x00, 0xcb, 0xbf, 0x03, 0x01, 0x94, 0xeb, 0x5e, 0x73, 0xb7, 0x55, 0x8d, 0x70, 0x5d, 0x37, 0x2c, 0x26,
+  0x25, 0x5f, 0xf6, 0xe0, 0x4b, 0x63, 0xbf, 0xc1, 0xc6, 0xf0, 0x44, 0xa3, 0x34, 0x8e, 0x67, 0x64, 0xa8, 0x06, 0xa8, 0x46,
+  0x5c, 0x15, 0xfc, 0x18, 0xe3, 0x81, 0x08, 0xba, 0xc6, 0x38, 0x43, 0x39, 0xff, 0xb9, 0xbe, 0x57, 0x5b, 0x8c, 0x0d, 0x54,
+  0xb6, 0xca, 0x2c, 0x81, 0x3f, 0xc4, 0x61, 0xd6, 0x53, 0xbc, 0xc0, 0x88, 0x10, 0xc6, 0xf9, 0x2c, 0xa0, 0x1d, 0xc4, 0x1a,
+  0x54, 0xf6, 0x16, 0x37, 0x5f, 0x8c, 0x8d, 0x12, 0x14, 0x90, 0xbe, 0x69, 0x78, 0x18, 0xf0, 0x09, 0x98, 0x26, 0x5e, 0xac,
+  0x4a, 0xc8, 0x6e, 0x42, 0xd0, 0x37, 0xc2, 0x53, 0x30, 0x6d, 0x1f, 0xd1, 0xb4, 0x5d, 0xc2, 0x87, 0x3b, 0xbc, 0x18, 0x07,
+  0xed, 0xd1, 0xb6, 0xae, 0x25, 0x01, 0x1f, 0x15, 0x1d, 0xd0, 0xf4, 0x60, 0x44, 0x10, 0x65, 0x38, 0xcf, 0x82, 0x4b, 0x99,
+  0xf8, 0x54, 0x07, 0x12, 0xb4, 0xba, 0xb1, 0x43, 0x16, 0x9e, 0xad, 0xaf, 0xed, 0x90, 0x1c, 0x01, 0x62, 0x8f, 0x01, 0x97,
+  0x9b, 0xc5, 0x70, 0x91, 0x39, 0x76, 0x68, 0x86, 0xad, 0x71, 0xed, 0x0e, 0x8e, 0x70, 0x4b, 0x19, 0x11, 0x89, 0x17, 0x03,
+  0x5d, 0xe7, 0x97, 0xdc, 0xdc, 0x9a, 0xa0, 0x48, 0x01, 0x65, 0x5b, 0xa0, 0xe8, 0xf8, 0xa0, 0xed, 0x70, 0x13, 0xdc, 0xa6,
+  0x66, 0x0b, 0xf6, 0x4d, 0x6b, 0xd4, 0x40, 0xa7, 0x40, 0x59, 0x4f, 0xfd, 0x77, 0xf0, 0x77, 0x09, 0xaf, 0x3d, 0x41, 0x19,
+  0x90, 0x23, 0xa6, 0x4e, 0x3c, 0x83, 0x76, 0xc0, 0xa8, 0xc1, 0x53, 0x01, 0xe1, 0x64, 0x61, 0x97, 0x8f, 0x90, 0x8d, 0x91,
+  0x87, 0x72, 0x62, 0x79, 0xa9, 0x40, 0xa3, 0xc9, 0x2f, 0x04, 0x82, 0xc4, 0x9f, 0xdd, 0x70, 0x9e, 0x73, 0x2f, 0xc0, 0xa3,
+  0x72, 0x40, 0xcb, 0xf0, 0x1c, 0xb0, 0x80, 0x8f, 0x88, 0x65, 0x5b, 0x7a, 0x7a, 0x06, 0x6c, 0xec, 0x0c, 0x88, 0x37, 0x2c,
+  0xa7, 0xc5, 0xc2, 0x15, 0x36, 0x9c, 0x50, 0x50, 0x19, 0x58, 0x9e, 0x0c, 0x01, 0xe0, 0x35, 0xbd, 0x61, 0x9b, 0xe0, 0x96,
+  0x56, 0x32, 0xea, 0xc3, 0x82, 0xa2, 0x96, 0x2b, 0x8a, 0xaa, 0x94, 0xf2, 0x81, 0x4b, 0x9e, 0x40, 0x38, 0x61, 0xd1, 0xe7,
+  0x60, 0x3c, 0x3b, 0xf4, 0x28, 0x66, 0xe5, 0xe7, 0x9d, 0x54, 0x2b, 0xab, 0x73, 0x2c, 0x0c, 0xb6, 0x04, 0x54, 0x29, 0x66,
+  0xdd, 0x2d, 0xea, 0x1d, 0x24, 0xac, 0x5c, 0x28, 0x41, 0x3c, 0x18, 0xfc, 0xcd, 0x43, 0xf4, 0xb3, 0xed, 0x5d, 0xa2, 0xc6,
+  0x2c, 0xfd, 0xcc, 0xf2, 0xd4, 0x24, 0xa2, 0x15, 0x75, 0x4e, 0x82, 0x71, 0xd1, 0x42, 0xfc, 0xa2, 0x85, 0x84, 0x45, 0x2b,
+  0x0a, 0xff, 0x19, 0x59, 0x54, 0x62, 0x70, 0x5a, 0x4c, 0x1f, 0x08, 0x21, 0x68, 0xe4, 0xbe, 0x61, 0x65, 0x21, 0x00, 0x7b,
+  0x44, 0x2a, 0xce, 0x21, 0x8f, 0x2b, 0x7a, 0xfe, 0x15, 0x88, 0x7c, 0x0f, 0x44, 0x1d, 0xbd, 0xf8, 0x19, 0x5c, 0xf7, 0xd0,
+  0xa1, 0xbf, 0x05, 0xdb, 0x74, 0x06, 0x37, 0xfa, 0x64, 0x01, 0x86, 0x3f, 0x82, 0x5e, 0xfc, 0x0a, 0x7a, 0x31, 0xaa, 0x56,
+  0x68, 0xba, 0xfa, 0x30, 0x74, 0xe6, 0xdf, 0x09, 0x1b, 0x06, 0x91, 0x8d, 0xdf, 0x5d, 0x54, 0x26, 0xac, 0xbf, 0x30, 0x41,
+  0xd3, 0xad, 0x15, 0x4d, 0x6d, 0xad, 0xd6, 0x6d, 0xe6, 0x39, 0x36, 0xfb, 0xfa, 0x06, 0xea, 0x37, 0xff, 0x82, 0x08, 0x53,
+  0x0e, 0x46, 0x63, 0x77, 0xe3, 0xd9, 0xa2, 0x6c, 0x37, 0xa9, 0xb3, 0xeb, 0xa1, 0x2d, 0x88, 0xdd, 0xcc, 0x5d, 0x40, 0x85,
+  0xed, 0x36, 0x68, 0x95, 0xb2, 0xec, 0xdf, 0xe1, 0xdf, 0x14, 0x51, 0x1a, 0x1a, 0x31, 0x2c, 0xd3, 0x10, 0x06, 0x65, 0x04,
+  0x3d, 0xaf, 0x63, 0xb0, 0x5a, 0x23, 0x33, 0x86, 0xc5, 0x8e, 0x6b, 0x33, 0x30, 0x60, 0x7a, 0x84, 0x0a, 0x30, 0xa6, 0x76,
+  0x50, 0xb5, 0x0f, 0xc5, 0x7a, 0x9e, 0x43, 0x2d, 0x64, 0x10, 0xbe, 0x3d, 0x18, 0xd0, 0x31, 0x81, 0x45, 0x48, 0x7b, 0x1f,
+  0xc2, 0xa2, 0x9f, 0x30, 0x34, 0xbf, 0x41, 0x26, 0x5c, 0xc3, 0xf6, 0x5f, 0x63, 0x80, 0x1b, 0x2b, 0x86, 0xab, 0x5c, 0x44,
+  0xae, 0xe0, 0x0f, 0xdd, 0xdd, 0x05, 0x24, 0x2b, 0xdc, 0x01, 0x82, 0xf4, 0xf9, 0x17, 0xf2, 0x88, 0x41, 0xce, 0x81, 0x90,
+  0x1a, 0x18, 0x80, 0xe8, 0x48, 0x7b, 0x89, 0x43, 0x71, 0x66, 0x56, 0xba, 0x69, 0x43, 0xa8, 0xca, 0x36, 0x2b, 0x04, 0x1c,
+  0x72, 0xc9, 0x89, 0xae, 0x47, 0x36, 0xed, 0xd3, 0x9b, 0x1b, 0xe9, 0xaf, 0x4c, 0x25, 0xd3, 0xeb, 0x40, 0xc3, 0xf6, 0x58,
+  0x5a, 0x2d, 0x10, 0xd2, 0x77, 0xe9, 0x9f, 0x73, 0x3d, 0x06, 0x25, 0x3c, 0x1e, 0x8d, 0xd4, 0xbe, 0x9a, 0x5a, 0xac, 0x03,
+  0x11, 0x58, 0x0c, 0x93, 0xf1, 0x17, 0x09, 0xdc, 0x86, 0x7b, 0xf3, 0xaa, 0x83, 0x84, 0xa3, 0xe9, 0xc2, 0x3c, 0xe2, 0xb8,
+  0x06, 0xd2, 0x96, 0x89, 0x02, 0xab, 0x6d, 0x11, 0x5e, 0xcb, 0xa2, 0xbe, 0x20, 0x24, 0x1b, 0x8a, 0xf9, 0x26, 0xe1, 0x69,
+  0x18, 0xee, 0xbb, 0x61, 0x7e, 0xe3, 0xe9, 0xec, 0x15, 0x84, 0xd4, 0x32, 0x60, 0x6f, 0x61, 0x77, 0x3e, 0x00, 0xb8, 0x6b,
+  0xf2, 0xca, 0xf8, 0xf4, 0xe6, 0xf8, 0x6f, 0x86, 0x24, 0x94, 0x4c, 0x96, 0x0a, 0x0e, 0x3e, 0xb5, 0x58, 0x0c, 0xd6, 0x03,
+  0x2a, 0x3e, 0x80, 0x7a, 0xf6, 0xbf, 0x8c, 0x44, 0x0c, 0xd4, 0xfc, 0x14, 0x9c, 0xc2, 0x2d, 0xf7, 0x22, 0x04, 0xa4, 0xb3,
+  0x8f, 0x09, 0x14, 0xda, 0x8a, 0x13, 0x11, 0xe4, 0x7e, 0x83, 0xd7, 0x43, 0xf1, 0x6f, 0x77, 0x38, 0x02, 0xfe, 0x46, 0x4c,
+  0x46, 0x0d, 0x7d, 0xc7, 0xc7, 0x7a, 0x98, 0x80, 0x9d, 0x82, 0xdd, 0xf8, 0xc8, 0x5f, 0x7b, 0x78, 0xff, 0x06, 0x40, 0x9d,
+  0x63, 0x5d, 0x40, 0x91, 0xd8, 0x88, 0x44, 0x21, 0x18, 0xde, 0xb4, 0x3a, 0xcc, 0xb4, 0xdd, 0xa3, 0x97, 0xc8, 0xdc, 0xe4,
+  0x7d, 0x1b, 0xf0, 0x71, 0x7c, 0xe3, 0x26, 0xc5, 0x71, 0xaa, 0xca, 0x0f, 0xf2, 0x3b, 0x5e, 0x4a, 0xfb, 0x2c, 0xd9, 0x5d,
+  0x50, 0xa4, 0x4b, 0x97, 0xde, 0x05, 0x35, 0x96, 0x29, 0x09, 0x1e, 0x07, 0x39, 0x5f, 0x8a, 0x37, 0x34, 0xec, 0x18, 0xa6,
+  0x39, 0x04, 0x6f, 0x07, 0x2f, 0x87, 0xe1, 0x7d, 0x91, 0x6c, 0x90, 0x17, 0x68, 0xc6, 0xcb, 0x01, 0xd2, 0x52, 0xc3, 0xad,
+  0xb0, 0x02, 0x71, 0x69, 0x3f, 0xa7, 0x61, 0xd7, 0x6e, 0xb9, 0xb5, 0xe9, 0xe5, 0x06, 0x09, 0xfc, 0x6b, 0x90, 0xe7, 0x73,
+  0x2e, 0xf6, 0xef, 0x89, 0x08, 0xa4, 0x62, 0xf6, 0x61, 0x78, 0xb9, 0x4d, 0xea, 0xb1, 0xdd, 0x23, 0xab, 0x36, 0xcf, 0x82,
+  0x51, 0x35, 0xed, 0x16, 0x44, 0xfb, 0x97, 0xf8, 0x85, 0x34, 0x58, 0x22, 0x55, 0x0d, 0x45, 0x5a, 0x36, 0xb9, 0x84, 0x55,
+  0x8e, 0xd1, 0x1f, 0xf1, 0xb2, 0x49, 0xe2, 0x2a, 0xdb, 0x68, 0xfd, 0x53, 0xc9, 0x93, 0x3b, 0xe4, 0xe6, 0x87, 0x03, 0x59,
+  0xb5, 0x80, 0x91, 0x6c, 0x8c, 0xa7, 0x3f, 0x07, 0x32, 0x4f, 0x05, 0xc5, 0x3d, 0x30, 0x19, 0x60, 0x3d, 0x64, 0x2e, 0xa9,
+  0x49, 0xad, 0x16, 0x35, 0x79, 0x05, 0x2d, 0x30, 0x01, 0x58, 0x95, 0x65, 0x70, 0x9d, 0x05, 0x86, 0x53, 0x53, 0xf8, 0x9f,
+  0xb8, 0xba, 0x81, 0xce, 0xb6, 0xf8, 0xf3, 0x32, 0x0b, 0x82, 0x09, 0xe5, 0x8d, 0xbc, 0x70, 0x90, 0xbe, 0x30, 0xa1, 0xb3,
+  0x6d, 0xbb, 0x23, 0x83, 0x7e, 0x1e, 0xd2, 0x86, 0x65, 0xc5, 0x77, 0xbc, 0x56, 0xc5, 0xc5, 0x27, 0xde, 0x67, 0x05, 0xa5,
+  0x1a, 0xe6, 0xa0, 0x00, 0xc9, 0xab, 0x1d, 0x43, 0x12, 0x79, 0x13, 0x44, 0x16, 0xa7, 0x33, 0xfb, 0x2b, 0x58, 0x21, 0xad,
+  0xb7, 0xda, 0xde, 0xdb, 0xf9, 0xa2, 0xf1, 0xca, 0x7c, 0xc1, 0x33, 0x10, 0xf4, 0x9d, 0x45, 0xab, 0xe6, 0x7d, 0xc5, 0xce,
+  0x63, 0x9a, 0x3f, 0x94, 0x55, 0x25, 0x86, 0xcf, 0x38, 0xa7, 0xef, 0xff, 0x82, 0x4e, 0xf5, 0x04, 0x3d, 0x61, 0x1f, 0x9c,
+  0xe2, 0x2d, 0x82, 0xb8, 0xe6, 0x09, 0x59, 0xcf, 0xef, 0xce, 0x12, 0x48, 0xc7, 0x27, 0x35, 0x77, 0xe0, 0x96, 0xf9, 0xc6,
+  0x4c, 0x2a, 0x0b, 0x0a, 0x8f, 0xee, 0xb6, 0xd1, 0x87, 0xc6, 0x06, 0x70, 0x8e, 0x6d, 0x9b, 0x0a, 0x4c, 0xc4, 0x0e, 0xe2,
+  0x1c, 0x69, 0x31, 0x77, 0xfa, 0x37, 0x3c, 0x31, 0x7d, 0x2f, 0x2d, 0xfe, 0x00, 0x68, 0x70, 0xda, 0xdc, 0x06, 0x8e, 0xd7,
+  0x72, 0xf2, 0x5c, 0x2f, 0xb0, 0x8c, 0xd3, 0x8b, 0xad, 0xf7, 0x94, 0xc5, 0xa4, 0x3e, 0x09, 0xeb, 0xea, 0x31, 0xf3, 0x96,
+  0xa2, 0x89, 0x65, 0x12, 0x98, 0xce, 0x8f, 0xb1, 0x93, 0x97, 0x0b, 0xe1, 0x64, 0xb5, 0x30, 0x7d, 0xb6, 0x5a, 0x2c, 0x86,
+  0xd3, 0x0b, 0x45, 0xd9, 0xf4, 0x89, 0x62, 0xd3, 0xcc, 0x99, 0x04, 0xfb, 0x71, 0x86, 0x80, 0xf1, 0x67, 0xf4, 0x73, 0x04,
+  0xde, 0x2e, 0x41, 0x9a, 0x72, 0x24, 0xc6, 0x51, 0x7c, 0xb5, 0x84, 0xe2, 0xf9, 0xd6, 0x9e, 0x54, 0x10, 0xd8, 0x8f, 0x2f,
+  0xea, 0x75, 0x0f, 0x9b, 0xe0, 0x90, 0xf9, 0x71, 0xf5, 0x9c, 0xe4, 0x34, 0xee, 0xcb, 0xf7, 0x7b, 0x6b, 0x7f, 0x29, 0x90,
+  0x05, 0xa0, 0x05, 0x65, 0xfb, 0xad, 0xdf, 0x4f, 0x5b, 0xd7, 0x4b, 0x2e, 0x4e, 0xf6, 0x78, 0x7c, 0x70, 0x21, 0x45, 0x0d,
+  0x3d, 0x07, 0x2e, 0xb0, 0xcb, 0x87, 0x12, 0x10, 0x3c, 0x30, 0xdc, 0x23, 0xca, 0xfe, 0xe1, 0x35, 0x9a, 0xb6, 0x45, 0xb9,
+  0xcf, 0xb8, 0x13, 0xb5, 0x15, 0x11, 0x14, 0x5f, 0x41, 0xf8, 0xbb, 0xc0, 0x3f, 0x1d, 0xe3, 0xe7, 0xfb, 0x40, 0x7c, 0x7c,
+  0x73, 0x25, 0xd8, 0x83, 0x6b, 0x96, 0xd7, 0x57, 0xd5, 0xf1, 0xe2, 0x6a, 0xac, 0x88, 0x17, 0x60, 0x66, 0xe4, 0x74, 0x63,
+  0xe6, 0xc8, 0xb5, 0x75, 0x1a, 0x5d, 0x11, 0x86, 0xdc, 0xef, 0x26, 0xe6, 0xff, 0xf3, 0x59, 0xfb, 0x08, 0xf6, 0x0b, 0xeb,
+  0x7e, 0xcc, 0x3d, 0x6e, 0xdf, 0x48, 0x22, 0x26, 0xb1, 0xee, 0x11, 0xaf, 0x12, 0x0c, 0xf8, 0x3d, 0x26, 0xbf, 0x6b, 0x18,
+  0x4b, 0xa6, 0x4b, 0x7d, 0xd3, 0x5a, 0xa0, 0x41, 0x62, 0x83, 0xb1, 0x93, 0xfb, 0x59, 0x12, 0x9b, 0xa8, 0x81, 0x9f, 0x2e,
+  0xb5, 0x41, 0x83, 0x76, 0x35, 0x5c, 0x60, 0x9a, 0x4c, 0x6e, 0x56, 0x45, 0x6b, 0x39, 0x07, 0xe1, 0xf7, 0x4f, 0x84, 0x07,
+  0x51, 0xdc, 0xb1, 0x42, 0x0a, 0x4b, 0x06, 0x6a, 0xf7, 0xc7, 0xeb, 0x68, 0x4d, 0x6d, 0x9b, 0x10, 0x1e, 0x85, 0x9f, 0x82,
+  0x54, 0x75, 0xa5, 0x2a, 0xee, 0xb6, 0x2c, 0xb9, 0x8a, 0xe7, 0x53, 0xab, 0x38, 0x1a, 0x03, 0x5e, 0x25, 0x4e, 0x34, 0x02,
+  0x03, 0xf6, 0xce, 0xd4, 0x4c, 0x49, 0x4f, 0xee, 0x09, 0x37, 0xc3, 0x1f, 0xc5, 0xe6, 0x05, 0x15, 0x82, 0x13, 0xb8, 0xb8,
+  0xc5, 0xb1, 0xab, 0xb0, 0xb1, 0x36, 0x19, 0xca, 0x54, 0xf5, 0xba, 0xed, 0xea, 0xbb, 0x8d, 0x03, 0x83, 0x86, 0x5a, 0x60,
+  0xb5, 0x9a, 0x55, 0x0c, 0x6d, 0x9a, 0x86, 0x85, 0x8c, 0x20, 0x4d, 0x7a, 0x08, 0x44, 0x80, 0xaf, 0x06, 0x0b, 0xa3, 0x3b,
+  0x48, 0xf1, 0x1c, 0xe1, 0x4c, 0x84, 0x9f, 0x48, 0xf1, 0x7a, 0x42, 0xae, 0x7e, 0xc5, 0xfa, 0x02, 0x19, 0xe1, 0x8e, 0xa4,
+  0x1a, 0x59, 0x67, 0xba, 0xbb, 0xf7, 0xa3, 0x6e, 0xb0, 0xf9, 0x30, 0x4c, 0xee, 0x41, 0x8a, 0x0e, 0x37, 0x77, 0x05, 0x13,
+  0xa9, 0x5a, 0xd8, 0xd5, 0x7e, 0x65, 0x58, 0x1a, 0x5a, 0xd8, 0x50, 0x27, 0x99, 0x0e, 0xea, 0x2b, 0xb1, 0x5f, 0x51, 0x0e,
+  0x97, 0x32, 0x45, 0x68, 0x02, 0xeb, 0x05, 0x6c, 0x2f, 0x75, 0x9c, 0x22, 0xb0, 0xbd, 0x12, 0xcc, 0xc4, 0xb7, 0x6b, 0xd4,
+  0xd6, 0x81, 0x72, 0x7f, 0xa6, 0xf8, 0x04, 0xd1, 0x6d, 0x39, 0x35, 0x1b, 0x58, 0xb7, 0x9f, 0xd0, 0x8b, 0x9d, 0x39, 0x42,
+  0xeb, 0xfc, 0x1e, 0xf2, 0x03, 0x77, 0x81, 0xe4, 0x43, 0x7c, 0x10, 0x0a, 0x7c, 0x37, 0xc7, 0x73, 0x5e, 0xee, 0x51, 0x17,
+  0xbf, 0x00, 0x5b, 0x02, 0x12, 0x66, 0x6f, 0x7f, 0x77, 0x83, 0xdd, 0xeb, 0xde, 0x83, 0xfe, 0x77, 0x79, 0xb3, 0xaa, 0x2f,
+  0xaf, 0xe7, 0x03, 0x86, 0xbb, 0x8c, 0xba, 0x2c, 0x29, 0xb5, 0x9f, 0x4d, 0x9d, 0xaf, 0x79, 0x51, 0xe1, 0x22, 0x66, 0xb1,
+  0xef, 0x2c, 0x2d, 0xc5, 0x52, 0xb3, 0xad, 0xf8, 0x81, 0x07, 0x6c, 0xfd, 0x18, 0x43, 0x0e, 0x8b, 0x3e, 0xe1, 0xae, 0x7f,
+  0xd2, 0x94, 0x73, 0x87, 0x1e, 0xc9, 0x46, 0xac, 0x95, 0xb6, 0xeb, 0xf5, 0xa0, 0x58, 0x12, 0x1f, 0x8a, 0xc5, 0xd4, 0x12,
+  0xa8, 0xa6, 0x81, 0x16, 0xcb, 0xe2, 0x08, 0xb1, 0xc3, 0xff, 0x4e, 0x15, 0x47, 0xcc, 0x1b, 0xc4, 0x60, 0xcd, 0xc6, 0xfd,
+  0x5c, 0x41, 0x4c, 0xc7, 0x70, 0x41, 0xe1, 0xff, 0x08, 0x51, 0xcc, 0x59, 0x50, 0xc6, 0x7a, 0x97, 0x10, 0xc5, 0x6c, 0xaf,
+  0xe5, 0xb6, 0x5f, 0x90, 0xff, 0xfe, 0x87, 0xa0, 0x2c, 0xb4, 0x75, 0xb2, 0xf9, 0xe2, 0x55, 0x6e, 0x7d, 0xe3, 0xf9, 0xfa,
+  0xff, 0x57, 0xe4, 0x72, 0x16, 0xc8, 0xe0, 0x1d, 0x3a, 0xf3, 0x1b, 0x1e, 0x80, 0x5c, 0x4b, 0x85, 0x1e, 0x41, 0x83, 0xac,
+  0x6c, 0x89, 0x13, 0x54, 0x13, 0x01, 0x0c, 0xb0, 0x62, 0x61, 0x50, 0x2f, 0x59, 0x4c, 0x8a, 0x60, 0xb6, 0xd7, 0xee, 0x21,
+  0xa5, 0xea, 0x8a, 0xf0, 0x3e, 0x2e, 0xd4, 0xc2, 0xd3, 0x6f, 0x62, 0x5f, 0x36, 0x05, 0x90, 0x09, 0x2c, 0x06, 0xbb, 0x46,
+  0x16, 0xf0, 0x65, 0x45, 0xb4, 0xe3, 0x31, 0xfc, 0xbc, 0xcb, 0x81, 0xf2, 0xf6, 0x31, 0xd9, 0x5c, 0x4c, 0x4a, 0xa4, 0x02,
+  0x08, 0xb8, 0xe7, 0x64, 0x81, 0xbf, 0x4e, 0x85, 0x91, 0x44, 0x6d, 0x70, 0x74, 0x60, 0x94, 0xd7, 0xa2, 0xfc, 0x9f, 0xd2,
+  0xc3, 0x57, 0x6d, 0x9b, 0xbd, 0x44, 0xca, 0x53, 0x3b, 0xb8, 0xe8, 0x34, 0x01, 0xb2, 0xf3, 0x5a, 0xc4, 0x6f, 0x67, 0x5c,
+  0x97, 0xfb, 0x5f, 0xbf, 0xd5, 0x1f, 0x05, 0x97, 0xbf, 0xf1, 0x86, 0xd5, 0x4d, 0x58, 0x7a, 0x0d, 0xaa, 0xb0, 0xf1, 0x1b,
+  0xff, 0x14, 0xf8, 0x10, 0x1f, 0x69, 0x07, 0xb1, 0xfa, 0x50, 0xf5, 0xff, 0xcb, 0x06, 0xdb, 0x61, 0xfa, 0x39, 0x74, 0x92,
+  0x43, 0x90, 0xd7, 0x25, 0xbc, 0xb8, 0x88, 0x1d, 0xfb, 0x2e, 0x6f, 0xca, 0x0d, 0x35, 0x9a, 0x11, 0x8f, 0x9f, 0x85, 0x92,
+  0x9e, 0xf1, 0xa2, 0xca, 0xa9, 0xa0, 0x61, 0x28, 0x69, 0x50, 0xee, 0xa5, 0x43, 0xd6, 0x80, 0x58, 0xc2, 0x76, 0x8f, 0x3e,
+  0x8f, 0x11, 0x0e, 0xbe, 0xc1, 0x90, 0xce, 0x06, 0x8f, 0xb5, 0x24, 0x93, 0xf2, 0xc9, 0xbb, 0x80, 0x25, 0x17, 0x84, 0xb7,
+  0x10, 0x71, 0x5b, 0x6f, 0xe2, 0x0f, 0x39, 0x7c, 0x15, 0x53, 0x3c, 0xc4, 0xdb, 0x74, 0xb1, 0x5b, 0xa2, 0x5f, 0xde, 0xc7,
+  0xa6, 0x7e, 0xd8, 0xa2, 0xd2, 0xa9, 0xbb, 0x2e, 0x20, 0xcb, 0x1c, 0xf3, 0x95, 0xfc, 0x28, 0xe5, 0x0c, 0x22, 0x21, 0xce,
+  0xcc, 0x7b, 0x9f, 0x45, 0x24, 0xc2, 0xf3, 0xf8, 0xe9, 0x44, 0x22, 0xec, 0x42, 0x4f, 0x29, 0x30, 0x70, 0xac, 0x6d, 0x46,
+  0xd1, 0x78, 0xee, 0xe1, 0xe1, 0xf7, 0x7b, 0x69, 0x9f, 0x02, 0xc0, 0x3f, 0x76, 0xf3, 0xf4, 0x27, 0x10, 0xfc, 0xeb, 0xa4,
+  0x33, 0xd3, 0x40, 0xc1, 0x5a, 0xcb, 0x75, 0x75, 0x79, 0x47, 0x79, 0x1a, 0xf8, 0x9f, 0x79, 0xfd, 0xf5, 0x7d, 0x22, 0xf8,
+  0x27, 0x6d, 0x10, 0x21, 0xac, 0xba, 0xce, 0xb3, 0xc0, 0x31, 0xb6, 0x58, 0x50, 0x5a, 0x07, 0xc6, 0xf9, 0x6a, 0x0a, 0x39,
+  0xd8, 0x9a, 0x5d, 0xc3, 0x42, 0x61, 0xfa, 0x96, 0xe6, 0xdc, 0x35, 0x4a, 0x24, 0xaf, 0xc5, 0xec, 0xfb, 0xa9, 0x4f, 0x46,
+  0xe7, 0x29, 0x52, 0x37, 0xa3, 0x16, 0x80, 0x21, 0xb7, 0x78, 0xe2, 0x48, 0x9c, 0xe6, 0xe2, 0xa7, 0x38, 0xb8, 0x77, 0x5a,
+  0x9c, 0xb1, 0x03, 0x35, 0x37, 0xf5, 0x3b, 0x20, 0xd6, 0x3a, 0xde, 0xb8, 0x17, 0x0e, 0x74, 0xb9, 0x61, 0x3f, 0xc1, 0xdd,
+  0x46, 0x7a, 0x6e, 0xe1, 0xe3, 0x25, 0x52, 0x85, 0x47, 0xaa, 0x6e, 0xb1, 0x87, 0x1b, 0xcf, 0x88, 0x2e, 0x4f, 0x40, 0x6f,
+  0x79, 0xa5, 0x3e, 0x74, 0xa2, 0xe7, 0xfe, 0xbf, 0x08, 0x77, 0x19, 0x6f, 0x87, 0xcf, 0x52, 0x02, 0xb4, 0x3e, 0xca, 0xd5,
+  0xe2, 0x54, 0xe6, 0xcc, 0xc7, 0x8a, 0x75, 0xdb, 0x3c, 0x1a, 0x6e, 0x63, 0xff, 0xfe, 0xf3, 0x7d, 0xc2, 0xdb, 0x9d, 0x10,
+  0xd0, 0xe6, 0x0b, 0x44, 0x7f, 0x38, 0xbc, 0x98, 0x22, 0x1a, 0x11, 0x47, 0xbf, 0x25, 0xa3, 0x2c, 0xfa, 0xc8, 0x35, 0xf7,
+  0x04, 0xc1, 0xcd, 0x25, 0x31, 0xd2, 0xe8, 0x6c, 0x48, 0x5b, 0x79, 0x67, 0xef, 0x1c, 0x9b, 0xe2, 0x51, 0x63, 0xed, 0xaf,
+  0xd2, 0xe8, 0x0c, 0x0d, 0x10, 0x72, 0x68, 0xdd, 0x6e, 0xb9, 0xde, 0x9c, 0xad, 0xc4, 0xf4, 0x0d, 0x42, 0xb5, 0x30, 0x43,
+  0x7f, 0x10, 0xbf, 0x85, 0x95, 0xd0, 0x1d, 0x1c, 0x6f, 0x3d, 0x06, 0x93, 0x97, 0x08, 0x57, 0x47, 0xee, 0x8d, 0xd2, 0xa7,
+  0xf0, 0x98, 0x48, 0xbf, 0x60, 0x74, 0xa6, 0x34, 0x3a, 0xe5, 0xae, 0x9c, 0xf3, 0x43, 0x5b, 0x20, 0x32, 0xa4, 0x49, 0x2d,
+  0xa3, 0xae, 0x7b, 0xd2, 0xd3, 0xdd, 0x36, 0x9e, 0xee, 0x16, 0xb7, 0xbf, 0x77, 0xcd, 0x84, 0xbe, 0x32, 0x7e, 0x3d, 0xd5,
+  0x7b, 0x94, 0xcb, 0xed, 0x1b, 0xac, 0xd1, 0xaa, 0x2a, 0x35, 0xbb, 0x99, 0x3b, 0x3a, 0xa8, 0x64, 0xe1, 0x32, 0xe7, 0xe1,
+  0x99, 0xc1, 0xac, 0xc7, 0x0f, 0x0d, 0xe6, 0x20, 0xec, 0xd6, 0xa9, 0xa7, 0x7b, 0xb0, 0x16, 0x44, 0x0a, 0x2c, 0xa7, 0xd9,
+  0x1d, 0xcb, 0xb4, 0xa9, 0x96, 0x83, 0x95, 0x94, 0x7f, 0x7a, 0xc2, 0x05, 0x26, 0xd0, 0x92, 0x18, 0xe1, 0x00, 0x0c, 0x7e,
+  0x62, 0x2c, 0x44, 0x79, 0xca, 0xc9, 0xb1, 0x3e, 0x37, 0x21, 0x3d, 0xde, 0x52, 0xe7, 0xe9, 0xd8, 0x89, 0xec, 0x18, 0xd9,
+  0x5c, 0x15, 0x10, 0x74, 0x01, 0x7c, 0xb2, 0x0c, 0x05, 0x54, 0x88, 0x53, 0xd4, 0xc3, 0xa4, 0x53, 0x1c, 0xd2, 0x74, 0x2f,
+  0x08, 0x55, 0xe4, 0xa7, 0x6d, 0xf2, 0x78, 0xda, 0x26, 0x21, 0xb4, 0xc7, 0xef, 0x37, 0x8d, 0x41, 0xb6, 0x35, 0x6a, 0x86,
+  0x15, 0x95, 0xba, 0xb1, 0x25, 0x2e, 0xa5, 0x0d, 0x3b, 0xe2, 0xda, 0x62, 0x90, 0x9a, 0xf6, 0x7e, 0xf0, 0x0d, 0x3a, 0xfe,
+  0x38, 0x48, 0x83, 0xdb, 0x1a, 0x6f, 0xe8, 0xf1, 0x3b, 0x4f, 0xed, 0x43, 0xd9, 0xf0, 0x20, 0x6a, 0x47, 0xdb, 0x7b, 0x2c,
+  0x7a, 0x00, 0xb0, 0x19, 0x9f, 0xde, 0x1c, 0x47, 0x67, 0x30, 0x93, 0x78, 0x10, 0x61, 0x2a, 0x4e, 0x6e, 0x4b, 0x38, 0xc1,
+  0x8f, 0x1d, 0xc9, 0xbf, 0x6f, 0x17, 0xf5, 0x28, 0x23, 0x28, 0x78, 0xa4, 0x78, 0xb8, 0x4f, 0x59, 0xb5, 0x5d, 0x10, 0x68,
+  0x01, 0x08, 0x29, 0xff, 0x96, 0x38, 0x54, 0xd3, 0x0c, 0x6b, 0x5f, 0x0c, 0xe5, 0xbf, 0x25, 0xa9, 0x8f, 0x38, 0x25, 0x1e,
+  0x66, 0x1e, 0x41, 0xe0, 0x3e, 0xce, 0x33, 0xcf, 0x74, 0x72, 0x29, 0x5a, 0x7d, 0x8d, 0x5a, 0x35, 0xdd, 0x94, 0x88, 0x68,
+  0x8f, 0x87, 0x1a, 0xfd, 0xc4, 0x63, 0xb6, 0x23, 0x22, 0x3f, 0x00, 0x69, 0x5b, 0x16, 0xef, 0xab, 0x4f, 0x54, 0x1d, 0x83,
+  0x0d, 0x4f, 0x2b, 0xed, 0x11, 0xc4, 0x59, 0x65, 0x7e, 0x1c, 0x26, 0xb3, 0x69, 0x68, 0x22, 0x82, 0x8f, 0xf2, 0xa6, 0x74,
+  0x14, 0xac, 0xd7, 0x5c, 0xc3, 0x61, 0xc4, 0x73, 0x6b, 0x2b, 0x99, 0x1c, 0x75, 0x1c, 0x45, 0x5d, 0xae, 0xd5, 0x0a, 0xf5,
+  0x92, 0x5e, 0xac, 0x83, 0x8d, 0xc2, 0x79, 0x62, 0x06, 0x2e, 0x16, 0x7c, 0x71, 0x3f, 0xc7, 0xff, 0xa3, 0x82, 0xff, 0x01,
+  0xf8, 0xcb, 0x8b, 0x9d, 0xb8, 0x40, 0x00, 0x00,
 };
-
-function addGershayim(text) {
-  const s = String(text || "");
-  if (!s) return "";
-  if (s.length === 1) return `${s}׳`;
-  return `${s.slice(0, -1)}״${s.slice(-1)}`;
-}
-
-function hebrewNumber(num) {
-  const n = Math.floor(Number(num || 0));
-  if (!Number.isFinite(n) || n <= 0) return "";
-  let value = n;
-  let out = "";
-
-  while (value >= 400) {
-    out += "ת";
-    value -= 400;
-  }
-
-  if (value >= 100) {
-    const h = Math.floor(value / 100);
-    if (h === 1) out += "ק";
-    else if (h === 2) out += "ר";
-    else if (h === 3) out += "ש";
-    value = value % 100;
-  }
-
-  if (value === 15) {
-    out += "טו";
-    value = 0;
-  } else if (value === 16) {
-    out += "טז";
-    value = 0;
-  }
-
-  if (value >= 10) {
-    const t = Math.floor(value / 10);
-    if (t === 1) out += "י";
-    else if (t === 2) out += "כ";
-    else if (t === 3) out += "ל";
-    else if (t === 4) out += "מ";
-    else if (t === 5) out += "נ";
-    else if (t === 6) out += "ס";
-    else if (t === 7) out += "ע";
-    else if (t === 8) out += "פ";
-    else if (t === 9) out += "צ";
-    value = value % 10;
-  }
-
-  if (value > 0) {
-    if (value === 1) out += "א";
-    else if (value === 2) out += "ב";
-    else if (value === 3) out += "ג";
-    else if (value === 4) out += "ד";
-    else if (value === 5) out += "ה";
-    else if (value === 6) out += "ו";
-    else if (value === 7) out += "ז";
-    else if (value === 8) out += "ח";
-    else if (value === 9) out += "ט";
-  }
-
-  return addGershayim(out);
-}
-
-function parseNumberFromText(text) {
-  const digits = String(text || "").match(/\d+/g);
-  if (!digits) return 0;
-  const joined = digits.join("");
-  const n = Number(joined);
-  return Number.isFinite(n) ? n : 0;
-}
-
-function hebrewGematriaValue(text) {
-  if (!text) return 0;
-  let sum = 0;
-  const clean = String(text).replace(/[^א-ת]/g, "");
-  for (const char of clean) {
-    sum += hebrewGematriaMap[char] || 0;
-  }
-  return sum;
-}
-
-function hebrewDateParts(epochLocal) {
-  if (!epochLocal) return null;
-  const fmt = getHebrewFormatter();
-  if (!fmt) return null;
-  const d = new Date(epochLocal * 1000);
-  try {
-    if (typeof fmt.formatToParts === "function") {
-      const parts = fmt.formatToParts(d);
-      const dayRaw = parts.find((p) => p.type === "day")?.value || "";
-      let month = parts.find((p) => p.type === "month")?.value || "";
-      const yearRaw = parts.find((p) => p.type === "year")?.value || "";
-      const dayNum = parseNumberFromText(dayRaw);
-      const yearNum = parseNumberFromText(yearRaw);
-      const day = dayNum ? hebrewNumber(dayNum) : dayRaw;
-      const yearVal = yearNum ? (yearNum % 1000 || yearNum) : 0;
-      const year = yearVal ? hebrewNumber(yearVal) : yearRaw;
-      month = month.replace(/^ב/, "");
-      const text = `${day} ${month} ${year}`.replace(/\s+/g, " ").trim();
-      return {
-        text: text || "—",
-        daySymbol: day || dayRaw,
-        month,
-        year: year || yearRaw,
-        dayValue: dayNum || hebrewGematriaValue(day),
-      };
-    }
-    const raw = String(fmt.format(d) || "").replace(/\s+/g, " ").trim();
-    const nums = raw.match(/\d+/g) || [];
-    if (nums.length >= 2) {
-      const dayNum = parseNumberFromText(nums[0]);
-      const yearNum = parseNumberFromText(nums[nums.length - 1]);
-      const monthRaw = raw
-        .replace(/\d+/g, " ")
-        .replace(/\s+/g, " ")
-        .trim()
-        .replace(/^ב/, "");
-      const day = dayNum ? hebrewNumber(dayNum) : "";
-      const yearVal = yearNum ? (yearNum % 1000 || yearNum) : 0;
-      const year = yearVal ? hebrewNumber(yearVal) : "";
-      const text = `${day} ${monthRaw} ${year}`.replace(/\s+/g, " ").trim();
-      return {
-        text: text || raw || "—",
-        daySymbol: day || String(nums[0] || ""),
-        month: monthRaw,
-        year: year || String(nums[nums.length - 1] || ""),
-        dayValue: dayNum || 0,
-      };
-    }
-    return { text: raw || "—", daySymbol: "", month: "", year: "", dayValue: 0 };
-  } catch {
-    return null;
-  }
-}
-
-function fmtHebrewShort(epochLocal) {
-  const parts = hebrewDateParts(epochLocal);
-  return parts?.text || "—";
-}
-
-function hebrewDateSummary(epochLocal) {
-  const parts = hebrewDateParts(epochLocal);
-  if (!parts) return null;
-  return { text: parts.text || "—", gem: "" };
-}
-
-function setClockBaseFromDevice(timeObj) {
-  const valid = !!timeObj?.valid;
-  const local = Number(timeObj?.local || 0);
-  state.clock.valid = valid && local > 0;
-  state.clock.baseLocal = state.clock.valid ? local : 0;
-  state.clock.baseMs = Date.now();
-}
-
-function clockLocalNow() {
-  if (!state.clock.valid || !state.clock.baseLocal) return 0;
-  const delta = Math.floor((Date.now() - state.clock.baseMs) / 1000);
-  return state.clock.baseLocal + Math.max(0, delta);
-}
-
-function toLocalEpochFromUtc(epochUtc) {
-  if (!epochUtc) return 0;
-  const off = state.time?.tzOffsetSeconds || 0;
-  return epochUtc + off;
-}
-
-function fmtUtcAsLocal(epochUtc) {
-  return fmtLocal(toLocalEpochFromUtc(epochUtc));
-}
-
-function isoLocalFromEpochLocal(epochLocal) {
-  if (!epochLocal) return "";
-  const d = new Date(epochLocal * 1000);
-  return d.toISOString().slice(0, 16);
-}
-
-function suffix4FromMac(mac) {
-  const clean = String(mac || "")
-    .toUpperCase()
-    .replace(/[^0-9A-F]/g, "");
-  return clean.length >= 4 ? clean.slice(clean.length - 4) : "0000";
-}
-
-function defaultSmartName() {
-  const mac = state.status?.wifi?.mac || "";
-  return `SmartShabat-${suffix4FromMac(mac)}`;
-}
-
-function buildNetBadge(wifi) {
-  if (!wifi) return "—";
-  if (wifi.staSsid) return `Wi‑Fi: ${wifi.staSsid}`;
-  if (wifi.apMode) return `Hotspot: ${wifi.apSsid || ""}`.trim();
-  return "לא מחובר";
-}
-
-function wifiStatusMessage(code) {
-  const c = Number(code || 0);
-  switch (c) {
-    case 6:
-      return "סיסמה שגויה";
-    case 4:
-      return "ההתחברות נכשלה";
-    case 1:
-      return "הרשת לא נמצאה";
-    case 5:
-      return "החיבור אבד";
-    case 7:
-      return "מנותק";
-    case 3:
-      return "מחובר";
-    case 0:
-      return "מנסה להתחבר…";
-    default:
-      return "בעיה בהתחברות";
-  }
-}
-
-function computeHealthLine(st) {
-  if (!st) return "—";
-  if (!state.time?.valid) return "צריך לכוון שעה";
-  if (st.schedule?.errorCode === "CLOCK_NOT_SET") return "צריך לכוון שעה";
-  return "מוכן";
-}
-
-function modeLabel(runMode) {
-  const m = Number(runMode || 0);
-  if (m === 1) return "חול";
-  if (m === 2) return "שבת";
-  return "אוטומטי";
-}
-
-function computeModeState() {
-  const st = state.status;
-  if (!st) return "—";
-  const rm = st.operation?.runMode ?? state.config?.operation?.runMode ?? 0;
-  return modeLabel(rm);
-}
-
-function buildNetHint(wifi) {
-  if (!wifi) return "—";
-  if (wifi.apMode && !wifi.staSsid) {
-    return `Hotspot פעיל: ${wifi.apSsid || ""}. מתחברים אליו כדי להגדיר Wi‑Fi.`;
-  }
-  if (wifi.apMode && wifi.staSsid) {
-    return `Hotspot פעיל להגדרה · מחובר גם ל‑Wi‑Fi: ${wifi.staSsid}.`;
-  }
-  if (!wifi.staSsid) {
-    return "לא מחובר ל‑Wi‑Fi. אם אין רשת זמינה, יופעל Hotspot.";
-  }
-  return `מחובר ל‑Wi‑Fi: ${wifi.staSsid} · IP ${wifi.staIp || wifi.ip || ""}`.trim();
-}
-
-function renderNextChange(st) {
-  if (!st?.schedule?.ok || !st.schedule?.nextChangeLocal) return "—";
-  const label = st.schedule.nextStateOn ? "הדלקה" : "כיבוי";
-  const when = fmtLocal(st.schedule.nextChangeLocal);
-  const h = fmtHebrewShort(st.schedule.nextChangeLocal);
-  return `${label} · ${when}${h !== "—" ? ` (${h})` : ""}`;
-}
-
-function renderClockInfo() {
-  const st = state.status;
-  const tm = state.time;
-  if (!st) return;
-
-  const clockOk = !!tm?.valid;
-  setPill("clockPill", clockOk ? "תקין" : "לא מכוון", clockOk ? "good" : "warn");
-
-  const ntpEnabled = !!state.config?.time?.ntpEnabled;
-  const src = ntpEnabled ? "ntp" : (tm?.source || "");
-  setText("clockSource", src === "ntp" ? "אוטומטי" : src === "manual" ? "ידני" : "—");
-
-  const lastNtp = tm?.lastNtpSyncUtc || 0;
-  const lastManual = tm?.lastManualSetUtc || 0;
-  const last = Math.max(lastNtp || 0, lastManual || 0);
-  setText("clockLastSync", last ? fmtUtcAsLocal(last) : "—");
-
-  const dstMode = Number(tm?.dstMode ?? 1);
-  const dstActive = !!tm?.dstActive;
-  const dstModeText = dstMode === 0 ? "כבוי" : dstMode === 2 ? "ידני" : "אוטומטי";
-  setText("dstState", `${dstModeText}${dstMode === 0 ? "" : dstActive ? " · פעיל" : " · לא פעיל"}`);
-
-  const next = Number(tm?.nextDstChangeLocal || 0);
-  setText("dstNext", next ? fmtLocal(next) : "—");
-
-  const hint = computeHealthLine(st);
-  const baseHint = hint === "מוכן" ? (clockOk ? "מכוון" : "לא מכוון") : hint;
-  const ntpMinutes = Number(tm?.ntpResyncMinutes ?? state.config?.time?.ntpResyncMinutes ?? 0);
-  const ntpSuffix = ntpEnabled && ntpMinutes > 0 ? ` · NTP כל ${ntpMinutes} דקות` : "";
-  setText("clockHint", `${baseHint}${ntpSuffix}`.trim());
-}
-
-function renderClockTick() {
-  const localNow = clockLocalNow();
-  setText("nowTime", localNow ? fmtLocal(localNow) : "—");
-  let html = `<div class="muted">—</div>`;
-  if (localNow) {
-    const summary = hebrewDateSummary(localNow);
-    if (summary && summary.text && summary.text !== "—") {
-      html = `<div>${summary.text}${summary.gem ? ` · ${summary.gem}` : ""}</div>`;
-      const nextEpoch = Number(state.time?.nextHebrewDateStartLocal || 0);
-      const afterSunset = nextEpoch > 0 && localNow >= nextEpoch;
-      if (afterSunset && nextEpoch > 0) {
-        const nextSummary = hebrewDateSummary(nextEpoch);
-        if (nextSummary && nextSummary.text && nextSummary.text !== "—") {
-          html += `<div class="muted">אור ל ${nextSummary.text}${nextSummary.gem ? ` · ${nextSummary.gem}` : ""}</div>`;
-        }
-      }
-    }
-  }
-  setHtml("nowHebrewDate", html);
-
-  // Prefill manual clock input to current local time
-  if (state.time?.valid && $("manualTime") && document.activeElement !== $("manualTime")) {
-    $("manualTime").value = isoLocalFromEpochLocal(localNow || 0);
-  }
-}
-
-function renderStatus() {
-  const st = state.status;
-  if (!st) return;
-
-  const wifi = st.wifi || {};
-  const ip = wifi.staIp || wifi.apIp || wifi.ip || "";
-  const host = wifi.hostName || defaultSmartName();
-
-  setText("deviceMeta", `${host}${ip ? ` · ${ip}` : ""}`);
-  const connected = st.relay?.connected !== undefined ? !!st.relay.connected : !!st.relay?.on;
-  setText("relayState", connected ? "מחובר" : "מנותק");
-  setText("modeState", computeModeState());
-  setText("nextChange", renderNextChange(st));
-
-  setText("netBadge", buildNetBadge(wifi));
-  setText("netHint", buildNetHint(wifi));
-
-  setText("healthLine", computeHealthLine(st));
-
-  const holy = st.schedule?.ok && st.schedule?.inHolyTime;
-  setPill("holyPill", holy ? "שבת/חג" : "חול", holy ? "warn" : "good");
-
-  renderClockInfo();
-  if (wifi.apMode && wifi.staIp && wifi.staIp !== location.hostname) {
-    navigateToIp(wifi.staIp);
-  }
-}
-
-function renderUpcoming(upcoming) {
-  const box = $("upcomingList");
-  if (!box) return;
-  if (!Array.isArray(upcoming) || upcoming.length === 0) {
-    box.innerHTML = `<div class="muted">—</div>`;
-    return;
-  }
-  box.innerHTML = "";
-  for (const w of upcoming.slice(0, 8)) {
-    const el = document.createElement("div");
-    el.className = "item";
-    const title = w.title || w.label || "—";
-    el.innerHTML = `
-      <div class="left">
-        <div class="title">${title}</div>
-        <div class="sub">${fmtLocal(w.startLocal)} → ${fmtLocal(w.endLocal)}</div>
-        <div class="sub">${fmtHebrewShort(w.startLocal)} → ${fmtHebrewShort(w.endLocal)}</div>
-      </div>
-      <div class="pill">${w.kind === 1 ? "שבת" : w.kind === 2 ? "חג" : "שבת/חג"}</div>
-    `;
-    box.appendChild(el);
-  }
-}
-
-function renderNextWindow(upcoming) {
-  const box = $("nextWindow");
-  if (!box) return;
-  if (!Array.isArray(upcoming) || upcoming.length === 0) {
-    box.innerHTML = `<div class="muted">—</div>`;
-    return;
-  }
-  const w = upcoming[0];
-  const inHoly = !!state.status?.schedule?.inHolyTime;
-  const title = w.title || w.label || "—";
-  box.innerHTML = `
-    <div class="left">
-      <div class="title">${inHoly ? "פעיל עכשיו" : "החלון הבא"} · ${title}</div>
-      <div class="sub">${fmtLocal(w.startLocal)} → ${fmtLocal(w.endLocal)}</div>
-      <div class="sub">${fmtHebrewShort(w.startLocal)} → ${fmtHebrewShort(w.endLocal)}</div>
-    </div>
-    <div class="pill">${w.kind === 1 ? "שבת" : w.kind === 2 ? "חג" : "שבת/חג"}</div>
-  `;
-}
-
-function iconForKind(kind) {
-  switch (kind) {
-    case "relay":
-      return "🔌";
-    case "network":
-      return "📶";
-    case "clock":
-      return "⏰";
-    case "update":
-      return "⬇️";
-    case "boot":
-      return "ℹ️";
-    default:
-      return "ℹ️";
-  }
-}
-
-function renderHistory(items) {
-  const box = $("historyList");
-  if (!box) return;
-  if (!Array.isArray(items) || items.length === 0) {
-    box.innerHTML = `<div class="muted">אין היסטוריה עדיין</div>`;
-    return;
-  }
-  box.innerHTML = "";
-  for (const it of items.slice().reverse().slice(0, 30)) {
-    const el = document.createElement("div");
-    el.className = "item";
-    el.innerHTML = `
-      <div class="left">
-        <div class="title">${iconForKind(it.kind)} ${it.msg || "—"}</div>
-        <div class="sub">${fmtLocal(it.t || 0)}</div>
-        <div class="sub">${fmtHebrewShort(it.t || 0)}</div>
-      </div>
-    `;
-    box.appendChild(el);
-  }
-}
-
-function renderWindowsList() {
-  const box = $("windowsList");
-  if (!box) return;
-  if (!Array.isArray(state.windows) || state.windows.length === 0) {
-    box.innerHTML = `<div class="muted">אין חלונות ידניים</div>`;
-    return;
-  }
-  box.innerHTML = "";
-  state.windows.forEach((w, idx) => {
-    const el = document.createElement("div");
-    el.className = "item";
-    const action = w.on ? "הדלקה" : "כיבוי";
-    const startLocal = toLocalEpochFromUtc(w.startUtc || 0);
-    const endLocal = toLocalEpochFromUtc(w.endUtc || 0);
-    el.innerHTML = `
-      <div class="left">
-        <div class="title">${action}</div>
-        <div class="sub">${fmtUtcAsLocal(w.startUtc)} → ${fmtUtcAsLocal(w.endUtc)}</div>
-        <div class="sub">${fmtHebrewShort(startLocal)} → ${fmtHebrewShort(endLocal)}</div>
-      </div>
-      <button class="btn danger" type="button">מחק</button>
-    `;
-    el.querySelector("button").onclick = () => {
-      state.windows.splice(idx, 1);
-      renderWindowsList();
-    };
-    box.appendChild(el);
-  });
-}
-
-function clamp(n, min, max) {
-  const v = Number(n);
-  if (!Number.isFinite(v)) return min;
-  return Math.min(max, Math.max(min, v));
-}
-
-function parseUtcFromDatetimeLocal(value) {
-  if (!value) return 0;
-  const t = new Date(value).getTime();
-  if (!Number.isFinite(t)) return 0;
-  return Math.floor(t / 1000);
-}
-
-function isValidIp(s) {
-  const m = String(s || "").trim().match(/^(\d{1,3})\.(\d{1,3})\.(\d{1,3})\.(\d{1,3})$/);
-  if (!m) return false;
-  for (let i = 1; i <= 4; i += 1) {
-    const n = Number(m[i]);
-    if (!Number.isFinite(n) || n < 0 || n > 255) return false;
-  }
-  return true;
-}
-
-function showStaticIp(show) {
-  const grid = $("staticIpGrid");
-  if (!grid) return;
-  grid.style.display = show ? "" : "none";
-}
-
-function showApPassword(show) {
-  const row = $("apPasswordRow");
-  if (!row) return;
-  row.style.display = show ? "" : "none";
-}
-
-function showDstManual(show) {
-  const row = $("dstManualRow");
-  if (!row) return;
-  row.style.display = show ? "" : "none";
-}
-
-function applyConfigToUi(cfg) {
-  // Status run-mode quick selector
-
-  // Network settings
-  if ($("hostName")) $("hostName").value = cfg?.network?.hostName ?? "";
-  if ($("apSsid")) $("apSsid").value = cfg?.network?.ap?.ssid ?? "";
-
-  const dhcp = !!cfg?.network?.sta?.dhcp;
-  if ($("ipMode")) $("ipMode").value = dhcp ? "dhcp" : "static";
-  showStaticIp(!dhcp);
-  if ($("staIp")) $("staIp").value = cfg?.network?.sta?.static?.ip ?? "";
-  if ($("staGw")) $("staGw").value = cfg?.network?.sta?.static?.gateway ?? "";
-  if ($("staMask")) $("staMask").value = cfg?.network?.sta?.static?.subnet ?? "";
-  if ($("staDns1")) $("staDns1").value = cfg?.network?.sta?.static?.dns1 ?? "";
-  if ($("staDns2")) $("staDns2").value = cfg?.network?.sta?.static?.dns2 ?? "";
-
-  const apPasswordSet = !!cfg?.network?.ap?.passwordSet;
-  if ($("apProtected")) $("apProtected").checked = apPasswordSet;
-  showApPassword(apPasswordSet);
-  if ($("apPassword")) $("apPassword").value = "";
-
-  // Clock
-  if ($("ntpEnabled")) $("ntpEnabled").checked = !!cfg?.time?.ntpEnabled;
-  if ($("ntpServer")) $("ntpServer").value = cfg?.time?.ntpServer ?? "pool.ntp.org";
-  if ($("ntpResync")) $("ntpResync").value = String(cfg?.time?.ntpResyncMinutes ?? 360);
-
-  if ($("tzOffset")) $("tzOffset").value = String(cfg?.time?.tzOffsetMinutes ?? 120);
-  if ($("dstMode")) $("dstMode").value = String(cfg?.time?.dstMode ?? 1);
-  showDstManual(String(cfg?.time?.dstMode ?? 1) === "2");
-  if ($("dstManualOn")) $("dstManualOn").checked = !!cfg?.time?.dstEnabled;
-
-  // Timer
-  if ($("runMode")) $("runMode").value = String(cfg?.operation?.runMode ?? 0);
-  if ($("beforeShkia")) $("beforeShkia").value = String(cfg?.halacha?.minutesBeforeShkia ?? 30);
-  if ($("afterTzeit")) $("afterTzeit").value = String(cfg?.halacha?.minutesAfterTzeit ?? 30);
-  if ($("contactMap")) $("contactMap").value = cfg?.relay?.holyOnNo === false ? "1" : "0";
-  if ($("relayActiveLow")) $("relayActiveLow").value = cfg?.relay?.activeLow === false ? "0" : "1";
-  if ($("relayBootMode")) $("relayBootMode").value = String(cfg?.relay?.bootMode ?? 0);
-  renderRelayWiringHint();
-
-  state.windows = Array.isArray(cfg?.operation?.windows) ? cfg.operation.windows.slice(0, 10) : [];
-  renderWindowsList();
-
-  // OTA
-  if ($("otaAuto")) $("otaAuto").checked = !!cfg?.ota?.auto;
-  if ($("otaCheckHours")) $("otaCheckHours").value = String(cfg?.ota?.checkHours ?? 12);
-  if ($("otaManifestUrl")) $("otaManifestUrl").value = cfg?.ota?.manifestUrl || DEFAULT_OTA_MANIFEST;
-
-  // Placeholders for default names
-  const def = defaultSmartName();
-  if ($("hostName") && !($("hostName").value || "").length) $("hostName").placeholder = def;
-  if ($("apSsid") && !($("apSsid").value || "").length) $("apSsid").placeholder = def;
-}
-
-function renderRelayWiringHint() {
-  const box = $("contactMapHint");
-  if (!box) return;
-
-  const wiredToNo = String($("contactMap")?.value || "0") === "0";
-  const activeLow = String($("relayActiveLow")?.value || "1") === "1";
-
-  const lines = [];
-  lines.push("מחובר = יש מתח ביציאה · מנותק = אין מתח ביציאה.");
-  lines.push(wiredToNo ? "בחרת NO: מחובר רק כשהממסר דלוק (קליק בזמן חיבור/ניתוק)." : "בחרת NC: מחובר כשהממסר כבוי.");
-  lines.push("המלצה: כדי להיות מנותק בחול ושקט (בלי קליק קבוע) — חבר את העומס ל‑NO ובחר NO כאן.");
-  if (!wiredToNo) {
-    lines.push("שים לב: אם מחברים ל‑NC ורוצים להיות מנותק בחול, הממסר עלול להיות דלוק דווקא בחול (זה תקין, אבל יש קליק/חום).");
-  }
-  lines.push(activeLow ? "Active LOW: הממסר נדלק כשהפין LOW." : "Active HIGH: הממסר נדלק כשהפין HIGH.");
-  lines.push("אם בפועל הממסר נדלק כשאמור להיות כבוי — נסה להחליף Active LOW/HIGH ואז לשמור.");
-
-  box.innerHTML = lines.map((t) => `<div>${t}</div>`).join("");
-}
-
-async function loadConfig() {
-  try {
-    const cfg = await apiGet("/api/config");
-    state.config = cfg;
-    applyConfigToUi(cfg);
-    // Config affects derived UI strings (e.g. NTP auto/manual label).
-    renderClockInfo();
-  } catch {
-    // ignore
-  }
-}
-
-async function refreshStatusLite() {
-  try {
-    state.status = await apiGet("/api/status?lite=1");
-    renderStatus();
-  } catch {
-    setText("healthLine", "אין חיבור");
-    setPill("holyPill", "—", "bad");
-  }
-}
-
-async function refreshTime() {
-  try {
-    const t = await apiGet("/api/time");
-    state.time = t;
-    setClockBaseFromDevice(t);
-    renderClockInfo();
-    renderClockTick();
-  } catch {
-    state.time = { valid: false };
-    setClockBaseFromDevice({ valid: false });
-  }
-}
-
-async function refreshSchedule() {
-  try {
-    state.schedule = await apiGet("/api/schedule");
-    const upcoming = state.schedule?.upcoming || [];
-    renderNextWindow(upcoming);
-    renderUpcoming(upcoming);
-  } catch {
-    renderNextWindow([]);
-    renderUpcoming([]);
-  }
-}
-
-async function refreshHistory() {
-  try {
-    const r = await apiGet("/api/history?limit=60");
-    state.history = r;
-    renderHistory(r.items || []);
-  } catch {
-    renderHistory([]);
-  }
-}
-
-function renderNetworks(nets) {
-  const box = $("netList");
-  if (!box) return;
-  if (!Array.isArray(nets) || nets.length === 0) {
-    box.innerHTML = `<div class="muted">לא נמצאו רשתות</div>`;
-    return;
-  }
-  box.innerHTML = "";
-  for (const n of nets) {
-    const el = document.createElement("div");
-    el.className = "item";
-    const lock = n.secure ? "🔒" : "🔓";
-    const rssi = Number(n.rssi || -100);
-    const sig = rssi > -55 ? "חזקה" : rssi > -67 ? "בינונית" : "חלשה";
-    el.innerHTML = `
-      <div class="left">
-        <div class="title">${lock} ${n.ssid || "(ללא שם)"}</div>
-        <div class="sub">${n.secure ? "מוגנת" : "פתוחה"} · קליטה ${sig}</div>
-      </div>
-      <button class="btn" type="button">התחבר</button>
-    `;
-    el.querySelector("button").onclick = () => openWifiModal(n.ssid || "", !!n.secure, Number(n.ch || 0), String(n.bssid || ""));
-    box.appendChild(el);
-  }
-}
-
-async function scanNetworks() {
-  setText("scanBtn", "סורק…");
-  $("scanBtn").disabled = true;
-  try {
-    const nets = await apiGet("/api/wifi/scan");
-    const sorted = Array.isArray(nets)
-      ? nets
-          .slice()
-          .sort((a, b) => (Number(b?.rssi ?? -999) || -999) - (Number(a?.rssi ?? -999) || -999))
-      : [];
-    renderNetworks(sorted);
-  } catch {
-    renderNetworks([]);
-    toast("סריקה נכשלה");
-  } finally {
-    setText("scanBtn", "סריקה");
-    $("scanBtn").disabled = false;
-  }
-}
-
-function renderSavedNetworks(res) {
-  const box = $("savedList");
-  if (!box) return;
-  const nets = res?.nets || [];
-  if (!Array.isArray(nets) || nets.length === 0) {
-    box.innerHTML = `<div class="muted">אין רשתות שמורות עדיין</div>`;
-    return;
-  }
-  box.innerHTML = "";
-  for (const n of nets) {
-    const el = document.createElement("div");
-    el.className = "item";
-    el.innerHTML = `
-      <div class="left">
-        <div class="title">${n.ssid || "(ללא שם)"}</div>
-        <div class="sub">${n.last ? "אחרון שהצליח" : ""}</div>
-      </div>
-      <button class="btn danger" type="button">מחק</button>
-    `;
-    el.querySelector("button").onclick = async () => {
-      if (!confirm(`למחוק את "${n.ssid}" מהרשתות השמורות?`)) return;
-      try {
-        await apiPost("/api/wifi/forget", { ssid: n.ssid });
-        toast("נמחק");
-      } catch {
-        toast("מחיקה נכשלה");
-      }
-      loadSavedNetworks();
-    };
-    box.appendChild(el);
-  }
-}
-
-async function loadSavedNetworks() {
-  try {
-    const res = await apiGet("/api/wifi/saved");
-    renderSavedNetworks(res);
-  } catch {
-    renderSavedNetworks({ nets: [] });
-  }
-}
-
-	function openWifiModal(ssid, secure, ch, bssid) {
-	  state.wifiModal = { open: true, ssid, secure, ch: Number(ch || 0), bssid: String(bssid || "") };
-	  setText("wifiModalSsid", ssid ? `רשת: ${ssid}` : "רשת: —");
-	  setText("wifiModalHint", "");
-	  if ($("wifiModalPass")) $("wifiModalPass").value = "";
-  if ($("wifiModalConnect")) {
-    $("wifiModalConnect").disabled = false;
-    $("wifiModalConnect").textContent = "התחבר";
-  }
-
-  const showPass = !!secure;
-  const passRow = $("wifiModalPassRow");
-  if (passRow) passRow.style.display = showPass ? "" : "none";
-
-  const modal = $("wifiModal");
-  if (modal) modal.style.display = "";
-  setTimeout(() => {
-    if (showPass && $("wifiModalPass")) $("wifiModalPass").focus();
-    else if ($("wifiModalConnect")) $("wifiModalConnect").focus();
-  }, 10);
-}
-
-function closeWifiModal() {
-  cancelWifiConnectWatch();
-  state.wifiModal = { open: false, ssid: "", secure: true, ch: 0, bssid: "" };
-  const modal = $("wifiModal");
-  if (modal) modal.style.display = "none";
-}
-
-function cancelWifiConnectWatch() {
-  const w = state.wifiConnectWatch;
-  if (!w) return;
-  w.cancelled = true;
-  if (w.pollTimer) clearInterval(w.pollTimer);
-  if (w.countdownTimer) clearInterval(w.countdownTimer);
-  if (w.timer) clearTimeout(w.timer);
-  state.wifiConnectWatch = null;
-}
-
-function navigateToIp(ip) {
-  const targetIp = String(ip || "").trim();
-  if (!targetIp || targetIp === "0.0.0.0") return false;
-  if (targetIp === location.hostname) return false;
-  window.location.href = `http://${targetIp}/`;
-  return true;
-}
-
-function startWifiConnectWatch(targetSsid) {
-  cancelWifiConnectWatch();
-  const hint = $("wifiModalHint");
-  const btn = $("wifiModalConnect");
-  const startedAtMs = Date.now();
-  const deadlineMs = startedAtMs + 10 * 1000;
-  state.wifiConnectWatch = {
-    ssid: targetSsid,
-    startedAtMs,
-    deadlineMs,
-    cancelled: false,
-    lastSeenStaIp: "",
-    pollTimer: null,
-    countdownTimer: null,
-    inFlight: false,
-    lastShownSec: null,
-  };
-
-  const updateUi = () => {
-    const w = state.wifiConnectWatch;
-    if (!w || w.cancelled) return;
-    const leftSec = Math.max(0, Math.ceil((w.deadlineMs - Date.now()) / 1000));
-    if (w.lastShownSec === leftSec) return;
-    w.lastShownSec = leftSec;
-    if (hint) {
-      hint.textContent =
-        leftSec > 0
-          ? `מתחבר… ננסה להעביר אותך ל‑IP החדש בעוד ${leftSec} שניות.`
-          : "מנסה להעביר ל‑IP החדש…";
-    }
-    if (btn) btn.textContent = leftSec > 0 ? `ממתין… (${leftSec})` : "מעביר…";
-  };
-
-  const stopWatch = () => {
-    const w = state.wifiConnectWatch;
-    if (!w) return;
-    w.cancelled = true;
-    if (w.pollTimer) clearInterval(w.pollTimer);
-    if (w.countdownTimer) clearInterval(w.countdownTimer);
-    state.wifiConnectWatch = null;
-  };
-
-  const failNow = (msg) => {
-    stopWatch();
-    if (hint) hint.textContent = msg;
-    toast(msg);
-    if (btn) {
-      btn.disabled = false;
-      btn.textContent = "התחבר";
-    }
-  };
-
-  const succeedNow = (ip) => {
-    const cleanIp = String(ip || "").trim();
-    if (!cleanIp || cleanIp === "0.0.0.0") return;
-    stopWatch();
-    toast(`מחובר · IP ${cleanIp}`);
-    navigateToIp(cleanIp);
-  };
-
-  const pollOnce = async () => {
-    const w = state.wifiConnectWatch;
-    if (!w || w.cancelled || w.inFlight) return;
-    w.inFlight = true;
-    try {
-      const s = await apiGet("/api/wifi/status", { timeoutMs: 900 });
-      const ip = String(s?.staIp || "").trim();
-      if (ip && ip !== "0.0.0.0") {
-        w.lastSeenStaIp = ip;
-        succeedNow(ip);
-        return;
-      }
-
-      const code = Number(s?.lastFailCode ?? s?.staStatusCode ?? 0);
-      const sdkCode = Number(s?.sdkStaStatus || 0);
-      if (code === 6 || sdkCode === 2) {
-        failNow("סיסמה שגויה.");
-        return;
-      }
-    } catch {
-      // ignore transient fetch failures (AP/STA switching)
-    } finally {
-      const w2 = state.wifiConnectWatch;
-      if (w2) w2.inFlight = false;
-    }
-  };
-
-  const onTimeout = () => {
-    const w = state.wifiConnectWatch;
-    if (!w || w.cancelled) return;
-    const leftMs = w.deadlineMs - Date.now();
-    if (leftMs > 0) return;
-    const lastIp = String(w.lastSeenStaIp || "").trim();
-    stopWatch();
-    if (lastIp) {
-      navigateToIp(lastIp);
-      return;
-    }
-    location.reload();
-  };
-
-  if (btn) {
-    btn.disabled = true;
-    btn.textContent = "ממתין… (10)";
-  }
-  updateUi();
-
-  state.wifiConnectWatch.countdownTimer = setInterval(() => {
-    updateUi();
-    onTimeout();
-  }, 250);
-  state.wifiConnectWatch.pollTimer = setInterval(pollOnce, 650);
-  setTimeout(pollOnce, 60);
-}
-
-	async function wifiModalConnect() {
-	  const ssid = state.wifiModal?.ssid || "";
-	  if (!ssid) return;
-	  const password = state.wifiModal?.secure ? String($("wifiModalPass")?.value || "") : "";
-	  const channel = Number(state.wifiModal?.ch || 0) || 0;
-	  const bssid = String(state.wifiModal?.bssid || "");
-  const btn = $("wifiModalConnect");
-  const hint = $("wifiModalHint");
-  const prev = btn?.textContent || "";
-  if (btn) {
-    btn.disabled = true;
-    btn.textContent = "מתחבר…";
-  }
-  if (hint) hint.textContent = "";
-
-  startWifiConnectWatch(ssid);
-	  try {
-	    await apiPost("/api/wifi/connect", { ssid, password, channel, bssid }, { timeoutMs: 1200 });
-	  } catch (e) {
-    // If the AP is switching channels, the request may time out even if it was received.
-    // Keep the 10s watch running; only show a user-facing error for clear failures.
-    const code = Number(e?.data?.status ?? e?.data?.staStatusCode ?? 0);
-    if (code === 6) {
-      cancelWifiConnectWatch();
-      const msg = "סיסמה שגויה.";
-      if (hint) hint.textContent = msg;
-      toast(msg);
-      if (btn) {
-        btn.disabled = false;
-        btn.textContent = prev || "התחבר";
-      }
-      return;
-    }
-  }
-
-  refreshStatusLite();
-  loadSavedNetworks();
-}
-
-async function resetWifi() {
-  if (!confirm("לאפס Wi‑Fi ולהפעיל מחדש?")) return;
-  try {
-    await apiPost("/api/wifi/reset", {});
-  } catch {
-    toast("איפוס נכשל");
-  }
-}
-
-async function factoryReset() {
-  const msg =
-    "איפוס מפעל ימחק את כל ההגדרות, רשתות Wi‑Fi שמורות, היסטוריה ונתוני עדכונים.\nלהמשיך?";
-  if (!confirm(msg)) return;
-  if (!confirm("בטוח?")) return;
-  try {
-    await apiPost("/api/factory_reset", {});
-    toast("מאפס…");
-  } catch {
-    toast("איפוס נכשל");
-  }
-}
-
-async function saveNetworkPrefs() {
-  const hostName = String($("hostName")?.value || "").trim();
-  const apSsid = String($("apSsid")?.value || "").trim();
-
-  const ipMode = String($("ipMode")?.value || "dhcp");
-  const dhcp = ipMode !== "static";
-
-  const body = { network: { hostName, ap: { ssid: apSsid }, sta: { dhcp } } };
-
-  if (!dhcp) {
-    const ip = String($("staIp")?.value || "").trim();
-    const gateway = String($("staGw")?.value || "").trim();
-    const subnet = String($("staMask")?.value || "").trim();
-    const dns1 = String($("staDns1")?.value || "").trim();
-    const dns2 = String($("staDns2")?.value || "").trim();
-
-    if (!isValidIp(ip) || !isValidIp(gateway) || !isValidIp(subnet)) {
-      toast("יש להזין IP תקין (IP/Gateway/Subnet)");
-      return;
-    }
-    if (dns1 && !isValidIp(dns1)) {
-      toast("DNS 1 לא תקין");
-      return;
-    }
-    if (dns2 && !isValidIp(dns2)) {
-      toast("DNS 2 לא תקין");
-      return;
-    }
-
-    body.network.sta.static = {
-      ip,
-      gateway,
-      subnet,
-      dns1: dns1 || "0.0.0.0",
-      dns2: dns2 || "0.0.0.0",
-    };
-  }
-
-  // Hotspot password behavior:
-  // - If protection OFF: clear password only if previously set.
-  // - If protection ON: set new password if provided; if previously not set, require >=8.
-  const apPasswordSet = !!state.config?.network?.ap?.passwordSet;
-  const protectedOn = !!$("apProtected")?.checked;
-  const apPassword = String($("apPassword")?.value || "");
-  if (!protectedOn) {
-    if (apPasswordSet) body.network.ap.password = "";
-  } else if (apPassword.trim().length) {
-    if (apPassword.trim().length < 8) {
-      toast("סיסמת Hotspot חייבת להיות לפחות 8 תווים");
-      return;
-    }
-    body.network.ap.password = apPassword.trim();
-  } else if (!apPasswordSet) {
-    toast("יש להזין סיסמה ל‑Hotspot (לפחות 8 תווים)");
-    return;
-  }
-
-  try {
-    const r = await apiPost("/api/config", body);
-    toast(r?.reboot ? "נשמר · המכשיר יאתחל…" : "נשמר");
-    if (r?.reboot) {
-      // Best effort: the IP may change. Try to reload after a bit.
-      await sleep(2500);
-      location.reload();
-      return;
-    }
-    await loadConfig();
-    await refreshStatusLite();
-  } catch {
-    toast("שמירה נכשלה");
-  }
-}
-
-async function setTimeNow() {
-  try {
-    await apiPost("/api/time", { utc: Math.floor(Date.now() / 1000) });
-    toast("השעון עודכן");
-    await refreshTime();
-    refreshStatusLite();
-  } catch {
-    toast("עדכון נכשל");
-  }
-}
-
-async function setManualTime() {
-  const value = String($("manualTime")?.value || "");
-  const utc = parseUtcFromDatetimeLocal(value);
-  if (!utc) {
-    toast("יש לבחור תאריך ושעה");
-    return;
-  }
-  try {
-    await apiPost("/api/time", { utc });
-    toast("השעון עודכן");
-    await refreshTime();
-    refreshStatusLite();
-  } catch {
-    toast("עדכון נכשל");
-  }
-}
-
-async function ntpSyncNow() {
-  try {
-    await apiPost("/api/ntp/sync", {});
-    toast("סנכרון בוצע");
-  } catch {
-    toast("סנכרון נכשל");
-  }
-  await refreshTime();
-  refreshStatusLite();
-}
-
-async function saveClockPrefs() {
-  const ntpEnabled = !!$("ntpEnabled")?.checked;
-  const ntpServer = String($("ntpServer")?.value || "pool.ntp.org").trim() || "pool.ntp.org";
-  const ntpResyncMinutes = Number($("ntpResync")?.value || 0);
-  const tzOffsetMinutes = Number($("tzOffset")?.value || 120);
-  const dstMode = Number($("dstMode")?.value || 1);
-  const dstEnabled = !!$("dstManualOn")?.checked;
-  try {
-    await apiPost("/api/config", {
-      time: { ntpEnabled, ntpServer, ntpResyncMinutes, tzOffsetMinutes, dstMode, dstEnabled },
-    });
-    toast("נשמר");
-    await loadConfig();
-    await refreshTime();
-    await refreshStatusLite();
-  } catch {
-    toast("שמירה נכשלה");
-  }
-}
-
-function addWindowOverride() {
-  const startUtc = parseUtcFromDatetimeLocal(String($("winStart")?.value || ""));
-  const endUtc = parseUtcFromDatetimeLocal(String($("winEnd")?.value || ""));
-  const on = String($("winAction")?.value || "on") === "on";
-  if (!startUtc || !endUtc || endUtc <= startUtc) {
-    toast("יש לבחור חלון תקין (התחלה/סיום)");
-    return;
-  }
-  state.windows.push({ startUtc, endUtc, on });
-  state.windows = state.windows
-    .slice()
-    .sort((a, b) => (a.startUtc || 0) - (b.startUtc || 0))
-    .slice(0, 10);
-  renderWindowsList();
-  if ($("winStart")) $("winStart").value = "";
-  if ($("winEnd")) $("winEnd").value = "";
-  toast("נוסף");
-}
-
-async function saveTimerPrefs() {
-  const runMode = Number($("runMode")?.value || 0);
-  const minutesBeforeShkia = clamp($("beforeShkia")?.value || 30, 0, 240);
-  const minutesAfterTzeit = clamp($("afterTzeit")?.value || 30, 0, 240);
-  const holyOnNo = String($("contactMap")?.value || "0") === "0";
-  const activeLow = String($("relayActiveLow")?.value || "1") === "1";
-  const bootMode = Number($("relayBootMode")?.value || 0);
-
-  try {
-    await apiPost("/api/config", {
-      operation: { runMode, windows: state.windows || [] },
-      halacha: { minutesBeforeShkia, minutesAfterTzeit },
-      relay: { holyOnNo, activeLow, bootMode },
-    });
-    toast("נשמר");
-    await loadConfig();
-    await refreshSchedule();
-    await refreshStatusLite();
-  } catch {
-    toast("שמירה נכשלה");
-  }
-}
-
-async function refreshOtaStatus() {
-  try {
-    const s = await apiGet("/api/ota/status");
-    state.ota = s;
-
-    setText("otaCurrent", s.currentVersion || "—");
-
-    try {
-      const cur = String(s.currentVersion || "").trim();
-      const key = "smartshabat_last_version";
-      const prev = String(localStorage.getItem(key) || "").trim();
-      if (cur && prev && cur !== prev) {
-        toast(`עודכן לגרסה ${cur}`);
-      }
-      if (cur) localStorage.setItem(key, cur);
-    } catch {
-      // ignore (private mode / storage disabled)
-    }
-
-    const available = !!s.state?.available;
-    setText("otaAvailable", available ? s.state?.availableVersion || "כן" : "לא");
-    setText("otaLastCheck", s.state?.lastCheckUtc ? fmtUtcAsLocal(s.state.lastCheckUtc) : "—");
-
-    const configured = !!s.config?.manifestUrl;
-    if (!configured) {
-      setPill("otaPill", "לא מוגדר", "warn");
-      setText("otaHintTop", "לא מוגדר");
-      setText("otaHint", "עדכונים לא הוגדרו בקושחה זו.");
-    } else if (available) {
-      setPill("otaPill", "יש עדכון", "warn");
-      setText("otaHintTop", "יש עדכון");
-      setText("otaHint", s.state?.notes || "");
-    } else {
-      setPill("otaPill", "מעודכן", "good");
-      setText("otaHintTop", "מעודכן");
-      setText("otaHint", s.state?.error ? `שגיאה אחרונה: ${s.state.error}` : "");
-    }
-  } catch {
-    setPill("otaPill", "שגיאה", "bad");
-    setText("otaHintTop", "שגיאה");
-  } finally {
-    updateOtaActionButton();
-  }
-}
-
-function updateOtaActionButton({ checking = false, updating = false } = {}) {
-  const btn = $("otaActionBtn");
-  if (!btn) return;
-  if (checking) {
-    btn.textContent = "בודק…";
-    btn.disabled = true;
-    return;
-  }
-  if (updating) {
-    btn.textContent = "מעדכן…";
-    btn.disabled = true;
-    return;
-  }
-  const available = !!state.ota?.state?.available;
-  btn.textContent = available ? "עדכן עכשיו" : "בדוק עכשיו";
-  btn.disabled = false;
-}
-
-async function saveOtaPrefs() {
-  const auto = !!$("otaAuto")?.checked;
-  const checkHours = Number($("otaCheckHours")?.value || 0);
-  const manifestUrl = String($("otaManifestUrl")?.value || "").trim();
-  try {
-    await apiPost("/api/config", { ota: { auto, checkHours, manifestUrl } });
-    toast("נשמר");
-    await loadConfig();
-    await refreshOtaStatus();
-  } catch {
-    toast("שמירה נכשלה");
-  }
-}
-
-async function otaCheckNow() {
-  updateOtaActionButton({ checking: true });
-  try {
-    const r = await apiPost("/api/ota/check", {});
-    toast(r.available ? "יש עדכון" : "אין עדכון");
-  } catch (e) {
-    const msg = String(e?.data?.message || e?.data?.error || e?.message || "").trim();
-    toast(msg ? `בדיקה נכשלה: ${msg}` : "בדיקה נכשלה");
-  }
-  refreshOtaStatus();
-}
-
-async function otaUpdateNow() {
-  if (!confirm("להתחיל עדכון? המכשיר יאתחל בסיום.")) return;
-  updateOtaActionButton({ updating: true });
-  try {
-    const r = await apiPost("/api/ota/update", {});
-    if (r && r.started === false) {
-      toast("אין עדכון זמין");
-      updateOtaActionButton();
-      return;
-    }
-    toast("מתעדכן…");
-    startPostUpdateReloadProbe();
-  } catch (e) {
-    const msg = String(e?.data?.message || e?.data?.error || e?.message || "").trim();
-    toast(msg ? `עדכון נכשל: ${msg}` : "עדכון נכשל");
-    updateOtaActionButton();
-  }
-}
-
-async function otaAction() {
-  if (state.ota?.state?.available) {
-    await otaUpdateNow();
-    return;
-  }
-  await otaCheckNow();
-}
-
-async function resetOtaManifest() {
-  const payload = { ota: { manifestUrl: DEFAULT_OTA_MANIFEST } };
-  try {
-    await apiPost("/api/config", payload);
-    if ($("otaManifestUrl")) $("otaManifestUrl").value = DEFAULT_OTA_MANIFEST;
-    toast("הכתובת הוחזרה לברירת מחדל");
-    await loadConfig();
-    await refreshOtaStatus();
-  } catch {
-    toast("איפוס נכשל");
-  }
-}
-
-function startPostUpdateReloadProbe() {
-  clearInterval(startPostUpdateReloadProbe._t);
-  const startedAt = Date.now();
-  const maxMs = 4 * 60 * 1000;
-
-  const probe = async () => {
-    if ((Date.now() - startedAt) > maxMs) {
-      clearInterval(startPostUpdateReloadProbe._t);
-      return;
-    }
-    try {
-      // If the device rebooted and the web server is back, this request will succeed.
-      await fetch(`/status.txt?ts=${Date.now()}`, { cache: "no-store" });
-      clearInterval(startPostUpdateReloadProbe._t);
-      setTimeout(() => location.reload(), 600);
-    } catch {
-      // still rebooting
-    }
-  };
-
-  startPostUpdateReloadProbe._t = setInterval(probe, 2000);
-  setTimeout(probe, 900);
-}
-
-async function clearHistory() {
-  if (!confirm("לנקות היסטוריה?")) return;
-  try {
-    await apiPost("/api/history/clear", {});
-    toast("נוקה");
-    refreshHistory();
-  } catch {
-    toast("נכשל");
-  }
-}
-
-function bindEvents() {
-  $("scanBtn")?.addEventListener("click", scanNetworks);
-  $("resetWifiBtn")?.addEventListener("click", resetWifi);
-  $("factoryResetBtn")?.addEventListener("click", factoryReset);
-
-  $("ipMode")?.addEventListener("change", () => showStaticIp($("ipMode").value === "static"));
-  $("apProtected")?.addEventListener("change", () => showApPassword(!!$("apProtected").checked));
-
-  $("saveNetworkBtn")?.addEventListener("click", saveNetworkPrefs);
-
-
-  $("setNowBtn")?.addEventListener("click", setTimeNow);
-  $("setManualBtn")?.addEventListener("click", setManualTime);
-  $("ntpSyncBtn")?.addEventListener("click", ntpSyncNow);
-  $("saveClockBtn")?.addEventListener("click", saveClockPrefs);
-
-  $("dstMode")?.addEventListener("change", () => showDstManual(String($("dstMode").value) === "2"));
-
-  $("addWinBtn")?.addEventListener("click", addWindowOverride);
-  $("saveTimerBtn")?.addEventListener("click", saveTimerPrefs);
-  $("contactMap")?.addEventListener("change", renderRelayWiringHint);
-  $("relayActiveLow")?.addEventListener("change", renderRelayWiringHint);
-
-  $("saveOtaBtn")?.addEventListener("click", saveOtaPrefs);
-  $("otaActionBtn")?.addEventListener("click", otaAction);
-  $("otaResetManifestBtn")?.addEventListener("click", resetOtaManifest);
-
-  $("clearHistoryBtn")?.addEventListener("click", clearHistory);
-
-  // Wi‑Fi modal
-  $("wifiModalCancel")?.addEventListener("click", closeWifiModal);
-  $("wifiModalConnect")?.addEventListener("click", wifiModalConnect);
-  $("wifiModal")?.addEventListener("click", (e) => {
-    if (e.target === $("wifiModal")) closeWifiModal();
-  });
-  document.addEventListener("keydown", (e) => {
-    if (e.key === "Escape" && state.wifiModal?.open) closeWifiModal();
-  });
-}
-
-(async function main() {
-  bindEvents();
-  await refreshTime();
-  await refreshStatusLite();
-  await loadConfig();
-  await loadSavedNetworks();
-  await refreshSchedule();
-  await refreshOtaStatus();
-  await refreshHistory();
-
-  setInterval(renderClockTick, 1000);
-  setInterval(refreshTime, 60000);
-  setInterval(refreshStatusLite, 2000);
-  setInterval(refreshSchedule, 15000);
-  setInterval(refreshOtaStatus, 20000);
-  setInterval(refreshHistory, 12000);
-})();
-)SMARTSHABAT_JS";
+static const EmbeddedAsset kEmbeddedIndexHtml = {"/", "text/html; charset=utf-8", "\"d9280c9bb7\"", kEmbeddedIndexHtmlGz, sizeof(kEmbeddedIndexHtmlGz)};
+
+// /styles.css (text/css; charset=utf-8): 8312 B source, 6649 B minified, 1932 B gzip
+static const uint8_t kEmbeddedStylesCssGz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x58, 0xeb, 0x8f, 0xa3, 0x36, 0x10, 0xff, 0x57, 0xd0,
+  0x9e, 0x4e, 0xda, 0xb4, 0x10, 0x01, 0x09, 0xb9, 0x00, 0x6a, 0xd5, 0xa7, 0xd4, 0x7e, 0x6d, 0xaf, 0x52, 0xa5, 0xaa, 0x1f,
+  0x4c, 0x30, 0x89, 0xbb, 0x04, 0x23, 0x6c, 0xf2, 0x38, 0x94, 0xff, 0xbd, 0x33, 0x36, 0x84, 0x67, 0x92, 0xdd, 0xbb, 0x76,
+  0x77, 0x93, 0x05, 0x7b, 0x3c, 0x1e, 0xff, 0xe6, 0xe9, 0x09, 0x0a, 0xce, 0x65, 0x65, 0x59, 0xd1, 0x36, 0x78, 0x67, 0x47,
+  0x8e, 0xed, 0xda, 0xa1, 0x65, 0x6d, 0x48, 0x11, 0x07, 0xc5, 0x36, 0x22, 0xcf, 0xae, 0xe7, 0x99, 0xcd, 0xc7, 0x9e, 0xdb,
+  0xab, 0x59, 0x3d, 0xeb, 0x4e, 0x4e, 0xaf, 0x71, 0x5a, 0xd2, 0x93, 0x0c, 0xde, 0x51, 0x92, 0xd8, 0x49, 0x02, 0xaf, 0xfb,
+  0x52, 0xd2, 0x86, 0xd9, 0x62, 0x69, 0xba, 0x4b, 0xbb, 0xa6, 0xfe, 0xe0, 0x22, 0x75, 0xca, 0x32, 0x3a, 0x35, 0xeb, 0xa8,
+  0xd9, 0x2d, 0xe7, 0x71, 0xf0, 0xce, 0x75, 0x37, 0x9e, 0x47, 0xe1, 0xf5, 0x48, 0x8a, 0x2c, 0x78, 0x97, 0x78, 0x3e, 0xb5,
+  0x23, 0x78, 0x8d, 0x08, 0x4c, 0xd2, 0x64, 0x09, 0x3f, 0xf0, 0x46, 0x36, 0x1b, 0x9a, 0xc1, 0xce, 0x2b, 0x9b, 0x78, 0x09,
+  0x81, 0x01, 0xb1, 0x23, 0x31, 0x3f, 0x06, 0xb6, 0xe1, 0xd8, 0xf9, 0xc9, 0x58, 0xe0, 0x97, 0xda, 0xc8, 0x36, 0xd5, 0xef,
+  0x7c, 0xe1, 0xcd, 0x2e, 0x5f, 0x55, 0x11, 0x3f, 0x59, 0x82, 0x7d, 0x62, 0xd9, 0x36, 0x88, 0x78, 0x11, 0xd3, 0xc2, 0x82,
+  0x91, 0x4b, 0xc4, 0xe3, 0x73, 0xb5, 0x27, 0xc5, 0x96, 0x65, 0x81, 0x1d, 0x26, 0x3c, 0x93, 0x56, 0x42, 0xf6, 0x2c, 0x3d,
+  0x07, 0xe2, 0x2c, 0x24, 0xdd, 0x5b, 0x25, 0x33, 0x2d, 0x92, 0xe7, 0x29, 0xb5, 0xf4, 0x80, 0xf9, 0x3b, 0xdd, 0x72, 0x6a,
+  0xfc, 0xf1, 0xab, 0xf9, 0x1b, 0x8f, 0xb8, 0xe4, 0xe6, 0x2f, 0x34, 0x3d, 0x50, 0xc9, 0x36, 0xc4, 0xfc, 0xbe, 0x60, 0x24,
+  0x35, 0x9f, 0xbe, 0x47, 0x6a, 0xe3, 0x47, 0x9e, 0xf2, 0xc2, 0xf8, 0x79, 0xcf, 0xff, 0x61, 0x4f, 0xe6, 0x53, 0xb3, 0xa8,
+  0x1e, 0x08, 0x37, 0x38, 0x1b, 0x1c, 0x48, 0xf1, 0xac, 0x71, 0x9c, 0x85, 0x11, 0xd9, 0xbc, 0x6c, 0x0b, 0x5e, 0x66, 0x80,
+  0x21, 0x89, 0x81, 0x91, 0xb5, 0xc5, 0xff, 0x70, 0xd2, 0x67, 0xdf, 0xc6, 0x23, 0x79, 0xea, 0x9b, 0x48, 0xc3, 0xb5, 0xdf,
+  0x1b, 0xf6, 0x7b, 0x53, 0x1d, 0xd1, 0x5f, 0x99, 0xce, 0x0a, 0xd5, 0x82, 0xe7, 0x74, 0xd6, 0x33, 0x53, 0x16, 0x24, 0x13,
+  0x39, 0x29, 0x60, 0x9d, 0xb1, 0xb2, 0xdf, 0xcf, 0xcc, 0x21, 0xb3, 0x0f, 0x7d, 0x66, 0x6b, 0x60, 0xe6, 0x36, 0xdc, 0x40,
+  0x31, 0x8e, 0xff, 0xc1, 0xf4, 0x97, 0x5a, 0x2f, 0x63, 0x66, 0x5a, 0xe0, 0x68, 0x3b, 0xbb, 0xcc, 0x45, 0x5e, 0x30, 0x49,
+  0xab, 0x9c, 0x0b, 0x26, 0x19, 0xcf, 0x02, 0x12, 0x09, 0x9e, 0x82, 0x09, 0x84, 0x47, 0x16, 0xcb, 0x1d, 0x60, 0xb9, 0xa3,
+  0x6c, 0xbb, 0x93, 0xf0, 0xc0, 0x0f, 0xb4, 0x48, 0x52, 0x50, 0xd0, 0x8e, 0xc5, 0x31, 0xcd, 0x2e, 0x73, 0xc9, 0xf3, 0x76,
+  0x9d, 0x00, 0xe8, 0x5e, 0xce, 0x21, 0x8c, 0x01, 0xe9, 0x27, 0x8b, 0x65, 0x31, 0x3d, 0x05, 0x8e, 0x1d, 0xc6, 0x4c, 0xe4,
+  0x29, 0x39, 0x07, 0x49, 0x4a, 0x4f, 0xe1, 0x96, 0xe4, 0x81, 0xe3, 0xe6, 0xa7, 0xf0, 0x9f, 0x12, 0xe8, 0x93, 0xb3, 0xb5,
+  0x01, 0x45, 0xa1, 0x11, 0x80, 0x74, 0x1b, 0x6a, 0x45, 0x54, 0x1e, 0x29, 0xcd, 0x42, 0x92, 0xb2, 0x6d, 0x66, 0x81, 0x58,
+  0x7b, 0x11, 0xa0, 0x8d, 0xd0, 0x22, 0xcc, 0x49, 0x1c, 0xa3, 0xca, 0x9d, 0x25, 0x9c, 0xd7, 0x59, 0x01, 0x8b, 0x2e, 0xd0,
+  0x78, 0x68, 0xc7, 0x01, 0x08, 0xcd, 0x85, 0x8b, 0x96, 0xaa, 0xd5, 0x10, 0x17, 0x3c, 0xb7, 0x12, 0x96, 0xc2, 0xfa, 0x20,
+  0x4a, 0xcb, 0xe2, 0x19, 0xed, 0x0a, 0xa6, 0x1a, 0xab, 0x91, 0x92, 0xef, 0x03, 0x07, 0xf8, 0xc1, 0x89, 0x59, 0x6c, 0x68,
+  0x50, 0xd0, 0xbe, 0x01, 0x96, 0x08, 0x20, 0x8b, 0x8d, 0xb9, 0x64, 0x32, 0xa5, 0x95, 0x32, 0xa7, 0xa3, 0xc6, 0x61, 0x6d,
+  0xdb, 0x61, 0x4a, 0x25, 0xf0, 0xb4, 0x50, 0x68, 0x94, 0xc9, 0x9e, 0xe3, 0x91, 0x14, 0x11, 0x18, 0x26, 0x0d, 0x9c, 0x75,
+  0x7e, 0xba, 0x72, 0x10, 0x65, 0xa4, 0x99, 0x68, 0xe3, 0xb4, 0x10, 0x20, 0x24, 0xef, 0x5a, 0x8e, 0x72, 0xb9, 0x59, 0x97,
+  0x83, 0xab, 0x38, 0x90, 0x78, 0x4b, 0x45, 0x35, 0x42, 0x10, 0xd8, 0x4f, 0x40, 0x54, 0xd3, 0x9b, 0xf3, 0x9c, 0xa5, 0x69,
+  0xd5, 0xe7, 0x75, 0x85, 0x6f, 0x85, 0xe8, 0xd9, 0x88, 0x9e, 0x06, 0x01, 0xad, 0xa9, 0x14, 0x81, 0xef, 0xfb, 0xd7, 0xb1,
+  0x69, 0x44, 0x46, 0x70, 0x0f, 0x22, 0xc9, 0x72, 0x36, 0xe1, 0x0b, 0xc7, 0x1d, 0x08, 0xa8, 0x60, 0xa2, 0x41, 0xc6, 0x8f,
+  0x05, 0xc9, 0x2f, 0x4a, 0xba, 0x39, 0x86, 0x89, 0xaa, 0x16, 0x41, 0x2f, 0x1b, 0xd9, 0xed, 0x72, 0xbc, 0xe5, 0xc0, 0xac,
+  0x6b, 0x5e, 0x18, 0x63, 0x26, 0x78, 0xb9, 0x4b, 0xcf, 0x74, 0xbc, 0xb5, 0x09, 0x66, 0x01, 0xcc, 0xbc, 0x89, 0x03, 0x74,
+  0x09, 0x9c, 0x65, 0xc3, 0x0e, 0x40, 0x9c, 0xe2, 0xb6, 0xf0, 0xcd, 0xd5, 0x1a, 0xff, 0x6e, 0x30, 0xeb, 0xcc, 0x2b, 0x5e,
+  0x42, 0x12, 0x59, 0x0a, 0x70, 0x57, 0x16, 0x83, 0xe6, 0x4f, 0x96, 0xf6, 0x26, 0x7f, 0x85, 0xd8, 0x37, 0x61, 0xca, 0x20,
+  0xa5, 0xe4, 0x06, 0x5a, 0xf4, 0xd5, 0x4b, 0x90, 0x5e, 0x7b, 0x09, 0x8e, 0xe2, 0x1b, 0x40, 0xb9, 0x87, 0x29, 0xc0, 0x11,
+  0xc4, 0x29, 0xf7, 0x99, 0x08, 0x0a, 0x9a, 0x53, 0x22, 0x9f, 0x71, 0x31, 0x58, 0xb7, 0x34, 0xf7, 0x2c, 0x83, 0x1d, 0x9e,
+  0x9d, 0x35, 0xf0, 0x36, 0x9d, 0xa4, 0x98, 0xcd, 0xae, 0xea, 0xb6, 0x95, 0xab, 0xa8, 0x2d, 0xae, 0x22, 0x45, 0x29, 0xdf,
+  0xbc, 0x54, 0x7d, 0xfd, 0x6b, 0x87, 0x7a, 0xa5, 0xfa, 0xf5, 0x30, 0x26, 0x95, 0x59, 0xcf, 0x2d, 0xfb, 0xae, 0x8e, 0x5f,
+  0x56, 0xcc, 0x0a, 0xba, 0x51, 0xe1, 0x41, 0x0b, 0xaf, 0x8e, 0xb6, 0x42, 0x61, 0xd0, 0x18, 0xee, 0x03, 0xd3, 0xf2, 0x5e,
+  0xdd, 0x02, 0xe8, 0x32, 0x47, 0x29, 0xaa, 0x1b, 0xb2, 0xdd, 0x3f, 0xcf, 0xf8, 0xfc, 0x57, 0xd0, 0x42, 0x95, 0x62, 0x74,
+  0x32, 0xd2, 0x6b, 0xf4, 0xcb, 0x6c, 0x1c, 0x02, 0x71, 0x27, 0xe3, 0x5b, 0x43, 0x94, 0x7b, 0x90, 0xfd, 0x5c, 0xa5, 0x4c,
+  0x80, 0xd7, 0xc9, 0x73, 0x8a, 0xf6, 0x9e, 0xd1, 0xe1, 0x7c, 0x10, 0x40, 0x14, 0x89, 0x5e, 0x98, 0xb4, 0x62, 0x2a, 0x09,
+  0x4b, 0x85, 0x05, 0xa3, 0x2f, 0xb4, 0xb8, 0xba, 0xb8, 0x5e, 0x04, 0xd4, 0x7d, 0xa7, 0x9f, 0x88, 0x87, 0xf7, 0x03, 0xa8,
+  0x02, 0xc8, 0xee, 0x9c, 0x49, 0xe9, 0x67, 0x53, 0x16, 0x02, 0x0c, 0x3a, 0xe7, 0x4c, 0xb1, 0x28, 0x05, 0xc6, 0x30, 0x9a,
+  0x82, 0x86, 0xda, 0x8d, 0x3f, 0xb6, 0x01, 0x4f, 0x47, 0x8f, 0x55, 0x13, 0xda, 0xda, 0xf8, 0xa7, 0x08, 0x7f, 0x2f, 0xa3,
+  0x37, 0x87, 0xb4, 0xb0, 0x55, 0xb8, 0xb7, 0x3a, 0x1c, 0x87, 0x70, 0x86, 0x18, 0x35, 0xac, 0xeb, 0x20, 0x4d, 0x53, 0x96,
+  0x0b, 0x26, 0x26, 0xc3, 0x08, 0x48, 0xf0, 0x1b, 0xca, 0xf3, 0x10, 0xa8, 0x06, 0x0a, 0xd0, 0xc5, 0x8e, 0x1e, 0x2a, 0xbd,
+  0x3b, 0x46, 0xe8, 0x26, 0xb1, 0xa9, 0x67, 0xc8, 0x12, 0x69, 0x00, 0xf8, 0x60, 0x8a, 0x54, 0x19, 0x3f, 0xe4, 0x18, 0xdc,
+  0xe5, 0x19, 0x82, 0xfb, 0x3a, 0x54, 0xf9, 0x53, 0xa7, 0x39, 0xf5, 0x98, 0xf0, 0x62, 0x6f, 0x80, 0xa3, 0x7b, 0xc2, 0xa0,
+  0x44, 0xd0, 0x4b, 0xad, 0xcd, 0xbf, 0x78, 0x4e, 0xb3, 0xbf, 0x5b, 0x75, 0x1b, 0x7a, 0xcb, 0xeb, 0x92, 0xa0, 0xe0, 0xe0,
+  0x82, 0x14, 0x3d, 0x35, 0xa6, 0x98, 0x7b, 0x6b, 0xe5, 0x55, 0x3d, 0x2d, 0xd5, 0x96, 0x89, 0xa0, 0xde, 0xc8, 0x4d, 0x68,
+  0x54, 0xbf, 0x50, 0x88, 0x53, 0xbd, 0xb3, 0xbf, 0x39, 0xa5, 0x5e, 0x8d, 0xa4, 0x56, 0x63, 0x93, 0x10, 0xed, 0xc6, 0xb1,
+  0xb4, 0x2d, 0xbc, 0x01, 0xe0, 0x66, 0x8d, 0xb1, 0x73, 0x07, 0xb5, 0xd8, 0x1d, 0x5b, 0x62, 0x20, 0xf0, 0xe7, 0xa8, 0xc5,
+  0xbf, 0xcc, 0x95, 0x91, 0x55, 0xf7, 0xcd, 0x6e, 0x01, 0x6c, 0x10, 0x37, 0xab, 0xe1, 0x0b, 0x65, 0xe4, 0x65, 0xae, 0xe2,
+  0x72, 0x3f, 0xa6, 0xbc, 0x29, 0xd6, 0xfa, 0x6d, 0xac, 0x6d, 0xcf, 0xff, 0x72, 0x68, 0x35, 0x39, 0xce, 0xb1, 0x1d, 0xe5,
+  0x7e, 0x5e, 0x8a, 0x5d, 0xcc, 0x70, 0x0b, 0x63, 0xfe, 0x32, 0x4c, 0xee, 0x63, 0x00, 0x34, 0xe1, 0xa1, 0xeb, 0xa0, 0x13,
+  0xd8, 0x77, 0x61, 0x5a, 0xea, 0x03, 0xa8, 0x7a, 0xe5, 0x27, 0x40, 0xa0, 0xbb, 0x74, 0xd1, 0xaf, 0x6e, 0x6e, 0xb8, 0x7a,
+  0x1f, 0x64, 0x17, 0xb4, 0xc3, 0x32, 0xf6, 0x71, 0x58, 0xfa, 0xd4, 0x61, 0xa0, 0x6b, 0x70, 0xeb, 0x31, 0xfb, 0xc9, 0x02,
+  0x6b, 0xea, 0x98, 0x20, 0x6d, 0xed, 0x7c, 0xa3, 0x4d, 0xde, 0x12, 0xfe, 0x97, 0x13, 0xf5, 0xe4, 0x08, 0xfd, 0x71, 0xf4,
+  0x6f, 0x77, 0xbf, 0x97, 0x03, 0xa6, 0xa8, 0x5e, 0x9d, 0x09, 0xa2, 0x51, 0x32, 0xf8, 0x7c, 0x3f, 0xef, 0x1a, 0xa7, 0xa1,
+  0xd5, 0xd8, 0xcf, 0x08, 0xe3, 0x0a, 0xee, 0x8e, 0xc5, 0x2c, 0x54, 0x4d, 0xd1, 0x9e, 0xed, 0x1a, 0xcd, 0x1e, 0x05, 0xb0,
+  0x56, 0x0e, 0x55, 0xe5, 0xa2, 0xe3, 0xb9, 0xaf, 0xf1, 0x45, 0x70, 0xb7, 0x8e, 0xb3, 0xa9, 0x65, 0xc6, 0xbc, 0xe0, 0xc7,
+  0xae, 0xe6, 0xed, 0x86, 0x79, 0xfd, 0xd6, 0x91, 0x45, 0x23, 0x8a, 0xda, 0xa9, 0x46, 0xc5, 0x84, 0x2a, 0xd8, 0x11, 0xb4,
+  0xff, 0x03, 0xea, 0x2f, 0x89, 0x03, 0x6d, 0x3d, 0x83, 0xf5, 0x2e, 0xee, 0x65, 0xcc, 0x53, 0x9a, 0xc8, 0x0a, 0x9c, 0xab,
+  0xce, 0xa4, 0x76, 0x33, 0x3e, 0x7d, 0x57, 0x19, 0xfa, 0xb8, 0xa6, 0x15, 0xe3, 0xec, 0xfd, 0xd8, 0xc3, 0xbf, 0x20, 0x5d,
+  0x13, 0x55, 0x05, 0x4e, 0xdc, 0x65, 0x14, 0x40, 0xaa, 0x56, 0x44, 0xc2, 0x00, 0xbf, 0xc2, 0x81, 0x27, 0x5f, 0x86, 0x4a,
+  0xee, 0x22, 0xdc, 0x0e, 0x0c, 0xcc, 0x2e, 0x26, 0x62, 0x47, 0xfb, 0xb8, 0x4e, 0x6f, 0x3e, 0xa1, 0xc6, 0xbe, 0x3c, 0x60,
+  0x34, 0x24, 0xa2, 0xe9, 0x2b, 0xa2, 0x2e, 0xcb, 0xf2, 0x52, 0xfe, 0x25, 0xcf, 0x39, 0xfd, 0xe6, 0x29, 0x2b, 0xf7, 0x11,
+  0x2d, 0x9e, 0xfe, 0x36, 0xbb, 0x83, 0x88, 0xd8, 0x60, 0x28, 0x27, 0x42, 0x1c, 0x41, 0xf4, 0xc1, 0x70, 0x0c, 0x96, 0x2f,
+  0xd9, 0x9e, 0x5a, 0x50, 0xad, 0x93, 0x14, 0x26, 0x75, 0xa1, 0x56, 0xa1, 0x68, 0x81, 0x13, 0xb6, 0xea, 0x57, 0x65, 0xff,
+  0xc0, 0xb5, 0x27, 0x8c, 0xce, 0x7d, 0x6b, 0xf2, 0x69, 0x9a, 0x2e, 0xae, 0x3b, 0x75, 0xb3, 0xe3, 0xa5, 0x54, 0x8d, 0x20,
+  0xe5, 0x54, 0xb5, 0x68, 0xad, 0x4c, 0xae, 0xab, 0x5c, 0x34, 0x92, 0xcd, 0xc5, 0xec, 0xf3, 0x12, 0xde, 0x6a, 0x6a, 0xe7,
+  0x89, 0x73, 0x3d, 0x8c, 0x6b, 0x8f, 0xa2, 0x18, 0x08, 0x1a, 0xec, 0xd0, 0x90, 0xab, 0x07, 0x12, 0xf9, 0x33, 0x4d, 0x0c,
+  0x96, 0x44, 0xa2, 0x14, 0x6a, 0x8f, 0xb6, 0x1c, 0x59, 0x35, 0x9b, 0xc6, 0x34, 0x21, 0x65, 0x2a, 0x15, 0xe1, 0x3c, 0x2f,
+  0x98, 0x4a, 0x0a, 0xe3, 0x1b, 0x65, 0xaf, 0xe3, 0xe3, 0x4d, 0x5c, 0x29, 0x87, 0x2d, 0x21, 0xcd, 0x30, 0x26, 0xd9, 0x16,
+  0xe5, 0xbc, 0x7b, 0x43, 0xf5, 0x1e, 0xdd, 0x50, 0x1b, 0x6e, 0xdb, 0x1d, 0x87, 0x70, 0xd8, 0x21, 0xed, 0x74, 0x8a, 0x20,
+  0x54, 0x64, 0xa8, 0xa6, 0xd7, 0x15, 0x80, 0xca, 0x4f, 0xc5, 0x91, 0xc9, 0xcd, 0xae, 0xed, 0x09, 0x15, 0x14, 0x02, 0x38,
+  0x3b, 0x34, 0xbd, 0xa4, 0x65, 0xa7, 0xbc, 0x73, 0xd7, 0xb5, 0xdf, 0xc3, 0x6d, 0x4f, 0xdf, 0xf7, 0x9a, 0xe5, 0x86, 0x72,
+  0x83, 0x89, 0x86, 0xd4, 0x15, 0xeb, 0xb0, 0xd6, 0xab, 0x45, 0x0f, 0x20, 0x81, 0x68, 0x72, 0xa5, 0x5e, 0x0d, 0xd2, 0x67,
+  0x13, 0x8b, 0x59, 0x26, 0xa8, 0x6c, 0x13, 0xc2, 0x7f, 0xd6, 0xf7, 0x00, 0x1b, 0xed, 0xdc, 0x0e, 0x3a, 0x77, 0x82, 0xae,
+  0x3c, 0x41, 0x40, 0x12, 0x90, 0xb7, 0x6a, 0xf2, 0xc8, 0xd3, 0x53, 0x38, 0x96, 0xb0, 0xa9, 0xb4, 0x0a, 0x85, 0x0f, 0x3e,
+  0x35, 0xce, 0xd4, 0x41, 0xcd, 0xbd, 0xd5, 0xba, 0x19, 0x69, 0xbb, 0xdb, 0x9b, 0xf5, 0x1f, 0x09, 0xa9, 0x20, 0x0f, 0xe0,
+  0xb6, 0xb2, 0x79, 0x81, 0x98, 0xf9, 0xb5, 0x06, 0xf1, 0x6e, 0xfb, 0x65, 0x7d, 0xf5, 0xc4, 0x1b, 0xfd, 0x1b, 0xb0, 0xc1,
+  0xbb, 0xec, 0x1b, 0x4c, 0xda, 0xdb, 0x91, 0x7a, 0xc2, 0x8c, 0xff, 0xe7, 0xb3, 0xe5, 0xea, 0x4e, 0xdd, 0x1d, 0x09, 0x7c,
+  0xe4, 0xbf, 0xe7, 0x31, 0x49, 0x5b, 0x6d, 0x27, 0xec, 0x44, 0xe3, 0xab, 0xaa, 0x7b, 0xfd, 0x83, 0x5b, 0xe1, 0xad, 0x71,
+  0x95, 0x1b, 0xbd, 0xc2, 0x9b, 0xb6, 0xaf, 0x52, 0x04, 0xcd, 0xe2, 0x51, 0x8d, 0x50, 0x3b, 0x45, 0xd3, 0x01, 0xf5, 0xec,
+  0x5a, 0xca, 0x1f, 0xf8, 0xa9, 0xb9, 0xe5, 0xd8, 0xf6, 0xfb, 0xee, 0x4d, 0xd8, 0xb5, 0xdf, 0x58, 0xad, 0x3e, 0xe8, 0x7e,
+  0xfa, 0xee, 0xec, 0x76, 0x07, 0xa3, 0x7b, 0xd5, 0xac, 0x25, 0xfb, 0x38, 0xaa, 0x1b, 0xfc, 0x7e, 0x8c, 0xf4, 0x90, 0x54,
+  0x72, 0x22, 0xe4, 0x10, 0x6a, 0x2c, 0x45, 0x74, 0x41, 0xa3, 0xad, 0xb6, 0xae, 0x6d, 0xf4, 0x3d, 0x72, 0xd9, 0x0d, 0xcd,
+  0x6e, 0xdd, 0x86, 0xfa, 0xe2, 0x4b, 0x51, 0xa3, 0xb8, 0xa5, 0xf7, 0xa0, 0xc9, 0x7b, 0x03, 0x80, 0x61, 0x2e, 0x50, 0x45,
+  0x8c, 0xd2, 0x6c, 0xd3, 0x47, 0xfd, 0x6e, 0x4f, 0x63, 0x46, 0x8c, 0xe7, 0x36, 0x9f, 0xad, 0xb0, 0xcb, 0x3e, 0xab, 0x6a,
+  0x73, 0x9b, 0x68, 0xbd, 0x4e, 0xac, 0xf1, 0xeb, 0x35, 0xaa, 0xd1, 0x75, 0xb3, 0xa0, 0x35, 0xe0, 0xd3, 0x94, 0xc0, 0xf7,
+  0x89, 0x2e, 0xff, 0x02, 0xd9, 0x7d, 0x6b, 0x8d, 0xf9, 0x19, 0x00, 0x00,
+};
+static const EmbeddedAsset kEmbeddedStylesCss = {"/styles.4095653ddc.css", "text/css; charset=utf-8", "\"4095653ddc\"", kEmbeddedStylesCssGz, sizeof(kEmbeddedStylesCssGz)};
+
+// /app.js (application/javascript; charset=utf-8): 51754 B source, 45383 B minified, 12110 B gzip
+static const uint8_t kEmbeddedAppJsGz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0xdb, 0x72, 0x1b, 0x47, 0xb2, 0xe0, 0x3b, 0xbe,
+  0xa2, 0x85, 0xd0, 0x38, 0x80, 0x63, 0x10, 0xbc, 0xd8, 0xd6, 0xd8, 0xa4, 0x29, 0x84, 0x2c, 0x4b, 0x96, 0xe6, 0x48, 0xa2,
+  0xc2, 0xa4, 0xc7, 0x11, 0x2b, 0x6b, 0xc4, 0x26, 0xd0, 0x24, 0xda, 0x02, 0xba, 0xb1, 0xdd, 0x0d, 0xd1, 0x3c, 0x3c, 0x88,
+  0x98, 0x87, 0x8d, 0xdd, 0x97, 0x8d, 0x38, 0x92, 0x2d, 0x59, 0xd6, 0x58, 0x96, 0x65, 0x8d, 0x77, 0x24, 0x2b, 0xf6, 0x61,
+  0x23, 0x76, 0x63, 0x2f, 0xaf, 0xfb, 0x13, 0x78, 0xf7, 0x0f, 0xec, 0xf9, 0x84, 0xcd, 0x4b, 0x5d, 0xb2, 0xaa, 0x1b, 0x20,
+  0x24, 0x7b, 0xe6, 0x9c, 0x87, 0x13, 0xbe, 0x10, 0x5d, 0x95, 0x95, 0x75, 0xcb, 0xca, 0xca, 0xca, 0xcc, 0xca, 0xea, 0xa6,
+  0x49, 0x5e, 0x04, 0x1f, 0x5e, 0xb8, 0x78, 0xee, 0x93, 0x2b, 0x3b, 0xb7, 0xb6, 0x76, 0xce, 0xdd, 0xba, 0x7a, 0xee, 0xda,
+  0xe5, 0x8b, 0x17, 0xb6, 0x77, 0x82, 0xcd, 0xa0, 0xde, 0x2f, 0x8a, 0x51, 0xbe, 0xbe, 0xbc, 0x7c, 0x10, 0x17, 0xfd, 0xf1,
+  0x5e, 0xbb, 0x9b, 0x0e, 0x97, 0x8f, 0x6e, 0xbf, 0xbb, 0x04, 0x9f, 0xcb, 0xf9, 0x30, 0xcc, 0x8a, 0xa5, 0xbc, 0x1f, 0xee,
+  0x85, 0xc5, 0x72, 0x16, 0x0d, 0xa2, 0x30, 0x8f, 0xf2, 0xe5, 0x41, 0x58, 0x44, 0x79, 0xb1, 0xdc, 0x4b, 0x0f, 0x93, 0x41,
+  0x1a, 0xf6, 0x96, 0xd3, 0x22, 0x6c, 0x7f, 0x9e, 0xa7, 0x49, 0x7d, 0xa3, 0xd6, 0xa5, 0x9a, 0xf2, 0x02, 0x20, 0x00, 0xf5,
+  0x71, 0x0d, 0x7f, 0x8d, 0xf3, 0xf5, 0x20, 0x19, 0x0f, 0x06, 0xad, 0x5a, 0x11, 0x0f, 0x23, 0xfd, 0xbb, 0x3b, 0x48, 0xbb,
+  0xb7, 0xd7, 0x83, 0xe3, 0x60, 0x0f, 0x70, 0x5e, 0x49, 0xbb, 0xe1, 0x60, 0x3d, 0x58, 0x69, 0xd1, 0xd7, 0xd5, 0x9c, 0x7e,
+  0xde, 0x09, 0x07, 0x71, 0x6f, 0x3d, 0xd8, 0x0f, 0x07, 0x79, 0x14, 0x4c, 0x5a, 0x88, 0x7b, 0x3f, 0x3e, 0xd0, 0xe5, 0xf3,
+  0x6e, 0x3f, 0xea, 0x8d, 0x07, 0x06, 0x1f, 0x34, 0x42, 0xff, 0xec, 0xc7, 0x79, 0x91, 0x66, 0x47, 0xfa, 0xf3, 0x30, 0x4e,
+  0xa0, 0xa9, 0x80, 0xf3, 0xc6, 0x4d, 0xfc, 0xd8, 0x8f, 0xaf, 0xa6, 0x3d, 0xac, 0xed, 0x38, 0x48, 0x47, 0x51, 0xa2, 0x2a,
+  0x68, 0x05, 0x79, 0x8e, 0xb5, 0xd5, 0xeb, 0xf0, 0x2b, 0xea, 0x8e, 0x33, 0x40, 0x5c, 0x64, 0x63, 0x48, 0xef, 0xf6, 0xb9,
+  0x61, 0x3a, 0x1f, 0x9b, 0x92, 0x45, 0xbd, 0x38, 0x8b, 0xba, 0x05, 0x22, 0x89, 0x47, 0xaa, 0x54, 0x01, 0x63, 0x15, 0xf5,
+  0xce, 0x15, 0xaa, 0xf9, 0xdd, 0x74, 0x9c, 0x14, 0x38, 0x46, 0xdb, 0x51, 0x17, 0x12, 0xb0, 0xd8, 0x20, 0xbe, 0x13, 0x61,
+  0x91, 0x3c, 0x1d, 0x67, 0x5d, 0xdd, 0x72, 0x00, 0x4c, 0x12, 0xc0, 0x15, 0xf5, 0x4c, 0x53, 0xa2, 0x3b, 0x51, 0x76, 0xbe,
+  0x94, 0x3a, 0x4a, 0x07, 0x83, 0x1d, 0x18, 0xc1, 0x8c, 0xba, 0x82, 0xf8, 0x7a, 0x61, 0xde, 0x47, 0x7c, 0x77, 0xb8, 0x85,
+  0xe3, 0xfc, 0xc8, 0x00, 0x87, 0x07, 0x61, 0x9c, 0x88, 0xc1, 0x9b, 0x6c, 0xd4, 0xf6, 0xc7, 0x49, 0xb7, 0x88, 0xd3, 0x24,
+  0x38, 0xdd, 0x88, 0x7b, 0x4d, 0x98, 0x9c, 0x2c, 0x2a, 0xc6, 0x59, 0x12, 0xf4, 0xd2, 0xee, 0x78, 0x18, 0x25, 0x45, 0xfb,
+  0x20, 0x2a, 0x2e, 0x0c, 0x22, 0xfc, 0xf9, 0xc1, 0xd1, 0xe5, 0x1e, 0x02, 0x6d, 0xd4, 0x26, 0xb6, 0x58, 0x3e, 0x88, 0xa2,
+  0x51, 0x63, 0x98, 0x8b, 0xa2, 0x49, 0x74, 0x18, 0x5c, 0xcf, 0xd2, 0x61, 0x9c, 0x47, 0x8d, 0x46, 0xd6, 0x0c, 0x36, 0xcf,
+  0xc2, 0xe0, 0x15, 0xd8, 0xc8, 0x74, 0x5c, 0x34, 0xb2, 0x56, 0x00, 0xd0, 0x2e, 0x92, 0x22, 0x0d, 0xf3, 0x02, 0x90, 0x1c,
+  0x20, 0x16, 0xa6, 0x96, 0x68, 0x00, 0xa4, 0x72, 0xba, 0x51, 0xa7, 0xac, 0x3a, 0x80, 0xc7, 0xfb, 0x41, 0xe3, 0x54, 0x34,
+  0x68, 0x06, 0x5c, 0xcb, 0x46, 0x2d, 0x1a, 0xb4, 0x8b, 0xe8, 0x8b, 0x02, 0x86, 0xa4, 0x80, 0xc6, 0x01, 0x34, 0x94, 0xa7,
+  0xd4, 0xbc, 0x38, 0x1a, 0x44, 0xed, 0x5e, 0x9c, 0x8f, 0x06, 0xe1, 0x11, 0xd2, 0xf2, 0x1e, 0x52, 0x15, 0xd2, 0x21, 0x90,
+  0x6a, 0xa6, 0xdb, 0x41, 0x88, 0xdb, 0xb7, 0x0a, 0x40, 0xad, 0x7f, 0x02, 0xac, 0x68, 0x68, 0x83, 0x5a, 0x7e, 0x5c, 0x89,
+  0x31, 0x49, 0x93, 0x08, 0x10, 0x4e, 0x5a, 0xc1, 0xda, 0xbb, 0x2b, 0x2b, 0xd4, 0x99, 0x30, 0x3f, 0x4a, 0xba, 0x81, 0xe9,
+  0x52, 0x38, 0x8a, 0x3f, 0x8a, 0x8a, 0xc6, 0x28, 0x2c, 0xfa, 0x2d, 0x20, 0x29, 0x4c, 0xcb, 0x6d, 0xef, 0x0a, 0xae, 0xe3,
+  0x6a, 0x0e, 0xc8, 0xae, 0x8d, 0x87, 0x7b, 0x51, 0xd6, 0x68, 0x28, 0xa0, 0xe0, 0x8d, 0x37, 0x34, 0x7c, 0xdb, 0x80, 0x35,
+  0x83, 0x7f, 0xfc, 0xc7, 0x00, 0xeb, 0xe1, 0xe2, 0xdd, 0x10, 0xe8, 0x1c, 0x8a, 0x56, 0x95, 0xa1, 0x3c, 0x82, 0x87, 0x56,
+  0x2e, 0x21, 0xcd, 0x47, 0x66, 0x09, 0x66, 0x11, 0x56, 0x18, 0x1e, 0x86, 0x71, 0x11, 0xdc, 0xda, 0x8f, 0x8a, 0x6e, 0xff,
+  0x53, 0x58, 0xde, 0xba, 0xc3, 0xdc, 0xd6, 0x63, 0x85, 0x1d, 0xfa, 0x66, 0xab, 0xd7, 0x08, 0x70, 0xc0, 0x0d, 0x06, 0xc0,
+  0x46, 0x33, 0xd0, 0x80, 0xec, 0x41, 0x54, 0x04, 0xbd, 0xb0, 0x08, 0x21, 0x13, 0xe9, 0x17, 0xc6, 0x34, 0x3b, 0x82, 0xde,
+  0xaa, 0x24, 0x2a, 0xd6, 0x09, 0x7e, 0xb7, 0xbd, 0x75, 0xad, 0x3d, 0x0a, 0x33, 0xa0, 0x0b, 0x4c, 0x69, 0x06, 0xeb, 0x0a,
+  0x78, 0x02, 0x75, 0x42, 0x63, 0x6c, 0x01, 0x95, 0xcc, 0x93, 0x8e, 0xf5, 0xa4, 0xb7, 0xed, 0xe0, 0xc1, 0x3c, 0x63, 0xdf,
+  0x09, 0x14, 0x3a, 0x4e, 0x3f, 0xda, 0x51, 0x96, 0xa5, 0x19, 0xf6, 0x9a, 0xbe, 0x86, 0x51, 0x9e, 0x87, 0x07, 0x51, 0x93,
+  0xc6, 0x81, 0x6a, 0x87, 0xbf, 0xbb, 0x97, 0x76, 0x76, 0xae, 0x07, 0xa7, 0x8f, 0x11, 0x1f, 0xb3, 0xa0, 0xc9, 0xae, 0xee,
+  0x18, 0x14, 0xc7, 0x6a, 0x81, 0x72, 0x2f, 0x20, 0x22, 0xa2, 0x45, 0x20, 0xa6, 0x2c, 0x53, 0x90, 0x90, 0x69, 0x8b, 0x71,
+  0x86, 0x6a, 0x2a, 0xfe, 0x81, 0xee, 0xf6, 0xb3, 0xf4, 0x10, 0xb1, 0x60, 0xab, 0xf5, 0x12, 0xa2, 0x9c, 0x2a, 0xca, 0xb8,
+  0x9e, 0xe6, 0x7a, 0xb8, 0xf7, 0xd2, 0xde, 0xd1, 0xaf, 0x4f, 0x20, 0xf3, 0x27, 0xba, 0x46, 0x55, 0xd7, 0x8e, 0x6b, 0xc3,
+  0xa8, 0xe8, 0xa7, 0xc8, 0xbf, 0xae, 0x6f, 0x6d, 0xef, 0xd4, 0x81, 0x47, 0x46, 0x61, 0x8f, 0x38, 0xc9, 0x71, 0x50, 0xef,
+  0xf2, 0xba, 0x5a, 0x2a, 0x8e, 0x46, 0x51, 0x1d, 0x40, 0xc2, 0xd1, 0x68, 0x10, 0xc3, 0x34, 0x41, 0xbd, 0xcb, 0xc4, 0xd7,
+  0x91, 0x81, 0x60, 0xeb, 0xd7, 0x79, 0x5e, 0xf3, 0x22, 0x8b, 0x93, 0x83, 0x78, 0xff, 0xa8, 0x81, 0x89, 0xd8, 0x9c, 0xe3,
+  0x49, 0x13, 0x58, 0x0c, 0x33, 0x78, 0x6a, 0x64, 0xed, 0xdf, 0xe8, 0xe8, 0x57, 0xa4, 0xa3, 0x6c, 0x9c, 0xfc, 0x2e, 0xdd,
+  0x9b, 0xc5, 0x61, 0x78, 0x6a, 0x67, 0xf0, 0x08, 0xce, 0x64, 0x26, 0x41, 0x53, 0x2f, 0xf6, 0x68, 0xdc, 0xae, 0x90, 0x99,
+  0xaa, 0xf2, 0x9b, 0xc0, 0xed, 0x3e, 0xba, 0xb0, 0x53, 0x87, 0x61, 0xe7, 0xd9, 0x12, 0x8c, 0x0d, 0x07, 0xde, 0x24, 0x0a,
+  0x9a, 0xae, 0xaa, 0x12, 0x89, 0xa2, 0xa9, 0xa8, 0x42, 0xd7, 0x16, 0xf7, 0x2c, 0x75, 0xab, 0x9a, 0x3b, 0xed, 0xcf, 0xd3,
+  0x3d, 0x4d, 0xcb, 0x34, 0x6b, 0xb8, 0x2b, 0xa9, 0x81, 0x50, 0x30, 0xa6, 0xb1, 0x51, 0x51, 0x0c, 0xa8, 0xb1, 0x15, 0xf5,
+  0xa9, 0x4c, 0x0d, 0xdb, 0x03, 0xca, 0x1e, 0xc4, 0x09, 0x32, 0xcd, 0x0f, 0x41, 0x0c, 0x69, 0x27, 0xe9, 0x21, 0xf0, 0xf7,
+  0x37, 0x17, 0x5f, 0x5b, 0xab, 0x6b, 0x2b, 0x2b, 0xc4, 0xe9, 0xf7, 0x81, 0x3c, 0x1a, 0x1b, 0x1b, 0x38, 0xd2, 0xdc, 0x77,
+  0xde, 0x01, 0xdf, 0x59, 0xb1, 0xab, 0x0f, 0xbb, 0xb0, 0xe9, 0x0e, 0xd7, 0xee, 0x32, 0xfc, 0x58, 0x86, 0x8c, 0x7c, 0xf9,
+  0xf4, 0x71, 0xdc, 0x9b, 0xec, 0x22, 0xa3, 0x35, 0x35, 0xac, 0x07, 0x50, 0x1c, 0x84, 0x01, 0xd5, 0x67, 0xdd, 0x31, 0x68,
+  0x8c, 0xfa, 0xd9, 0x80, 0x92, 0x4d, 0x33, 0x0e, 0xf0, 0xd1, 0x06, 0x2a, 0x1a, 0x0f, 0x60, 0x31, 0x74, 0x60, 0x40, 0xb9,
+  0x14, 0xa4, 0x76, 0xda, 0x3d, 0xd8, 0x98, 0xb0, 0x69, 0x2a, 0xa1, 0xad, 0x84, 0x2e, 0x9c, 0x45, 0xcc, 0xaa, 0xcf, 0xc1,
+  0x51, 0x4d, 0xc0, 0x08, 0xa7, 0x56, 0x01, 0x91, 0xcb, 0x7e, 0x18, 0x43, 0x7b, 0xea, 0x4d, 0x87, 0x76, 0x05, 0x32, 0x9c,
+  0xe1, 0x80, 0x16, 0xd1, 0x7a, 0x20, 0xcb, 0x4e, 0x3c, 0xda, 0xc6, 0x06, 0x8a, 0x99, 0x38, 0x6b, 0x66, 0xa8, 0x19, 0x30,
+  0x9c, 0x6d, 0x42, 0x5d, 0x8d, 0x53, 0x9d, 0xf6, 0xd9, 0xd2, 0x3a, 0x28, 0xf3, 0xb7, 0x71, 0x36, 0xa0, 0x15, 0x91, 0xcb,
+  0x2d, 0x4c, 0x2c, 0x7b, 0x4b, 0x75, 0x96, 0xcd, 0x4a, 0x92, 0x43, 0x69, 0x46, 0x0d, 0x13, 0xe1, 0xb6, 0x08, 0x15, 0x04,
+  0xf2, 0xc4, 0x74, 0x3f, 0x38, 0xb7, 0x97, 0x66, 0x24, 0x7f, 0x64, 0x20, 0x84, 0x45, 0x19, 0x0f, 0xf3, 0x38, 0xe9, 0x45,
+  0xfb, 0xd0, 0x0f, 0x18, 0x23, 0x2b, 0x12, 0x31, 0x2d, 0x28, 0xa1, 0xa8, 0x9d, 0x85, 0xdd, 0xa8, 0x71, 0xa3, 0xe6, 0xe3,
+  0x6e, 0xd5, 0x1c, 0xc9, 0xe9, 0x56, 0x0b, 0x1a, 0xf1, 0x39, 0x48, 0x7b, 0xbe, 0x04, 0xc5, 0x82, 0x09, 0xe7, 0x35, 0xaa,
+  0x86, 0xa9, 0xc9, 0x22, 0x56, 0xed, 0x26, 0x0d, 0x98, 0x12, 0x19, 0x44, 0x33, 0x69, 0x6c, 0xbd, 0xc6, 0x37, 0x2c, 0x6f,
+  0x46, 0x69, 0xb2, 0x4a, 0x14, 0xb2, 0x28, 0xda, 0x21, 0x16, 0x6e, 0x70, 0x3d, 0x9a, 0x47, 0x73, 0x69, 0xbd, 0x90, 0x36,
+  0x83, 0xad, 0x3d, 0x6c, 0x60, 0x3b, 0x04, 0x11, 0xf9, 0x20, 0x69, 0x1c, 0x4f, 0xb8, 0x97, 0x86, 0x05, 0xd0, 0x48, 0x9b,
+  0xd5, 0x0a, 0x20, 0x21, 0xc8, 0x76, 0xee, 0x37, 0x20, 0x11, 0x75, 0x72, 0xda, 0x86, 0x3b, 0xa4, 0xee, 0x18, 0x12, 0x0b,
+  0xc4, 0x6d, 0x00, 0x26, 0x20, 0x1c, 0x0c, 0xa8, 0x55, 0x8e, 0xcc, 0x87, 0x5d, 0x53, 0x54, 0x64, 0x25, 0x58, 0xe8, 0x27,
+  0xee, 0x3e, 0x71, 0xaf, 0x15, 0xf0, 0x76, 0xe2, 0xc9, 0xa0, 0x24, 0xf2, 0x62, 0x73, 0x51, 0xfa, 0x2c, 0x49, 0x9d, 0xf8,
+  0xb5, 0xe1, 0xe1, 0xbb, 0x54, 0x0c, 0x07, 0x84, 0xaf, 0x0f, 0x3f, 0x4e, 0xc4, 0x17, 0x83, 0x4c, 0x9f, 0x5d, 0xda, 0xb9,
+  0x7a, 0x05, 0x72, 0xb1, 0x80, 0x8f, 0xed, 0x7a, 0x3c, 0x18, 0x98, 0xd6, 0xc1, 0xff, 0xd5, 0x12, 0xaf, 0xc6, 0x39, 0x5f,
+  0x44, 0xe6, 0xc6, 0x42, 0x72, 0x77, 0x00, 0xf3, 0x72, 0x05, 0x8e, 0x44, 0xb0, 0x6e, 0x87, 0xe9, 0x9d, 0xa8, 0x51, 0x3f,
+  0x48, 0xd3, 0x1e, 0x1c, 0x58, 0xea, 0x87, 0x61, 0x96, 0xe0, 0xdf, 0xbd, 0xb0, 0xa7, 0xc5, 0x6e, 0xae, 0xd1, 0x29, 0x15,
+  0xf6, 0x7a, 0x9c, 0xec, 0x34, 0x76, 0x7f, 0x58, 0xd0, 0xa1, 0xad, 0x11, 0x8d, 0xd2, 0x6e, 0x9f, 0x7e, 0x6a, 0x66, 0x74,
+  0x4a, 0x26, 0xa9, 0x29, 0xac, 0xff, 0xfc, 0xc7, 0xfb, 0x66, 0xeb, 0xe9, 0x29, 0xba, 0x44, 0xa6, 0x20, 0xca, 0x07, 0x7f,
+  0x17, 0xac, 0x32, 0xe3, 0xd5, 0xbb, 0x61, 0xbb, 0x48, 0x29, 0x27, 0xda, 0x26, 0x89, 0xa3, 0x51, 0xef, 0x47, 0x4b, 0x97,
+  0xaf, 0xd4, 0x91, 0xa1, 0xf6, 0xe1, 0x08, 0xb5, 0xba, 0x66, 0x8e, 0x3b, 0x38, 0xdd, 0xff, 0x0e, 0x1a, 0x09, 0xd2, 0xcb,
+  0x27, 0x3b, 0xe7, 0xeb, 0xc4, 0x5f, 0x27, 0x24, 0x62, 0xdc, 0xea, 0x47, 0x7b, 0x59, 0x74, 0x78, 0x71, 0x58, 0x18, 0x21,
+  0xc1, 0x74, 0x02, 0x0e, 0x3c, 0x97, 0x38, 0x37, 0xcd, 0x86, 0x61, 0x51, 0xe0, 0xda, 0x50, 0x9d, 0xb0, 0xc5, 0x4c, 0x1f,
+  0x6c, 0x92, 0x5e, 0x07, 0x2e, 0x6e, 0xe8, 0xd1, 0xe5, 0xa4, 0x18, 0xb4, 0xb1, 0x5b, 0x48, 0x86, 0x8c, 0x54, 0x35, 0x7a,
+  0x69, 0xbc, 0xd4, 0x0d, 0x97, 0x18, 0x7e, 0x29, 0x19, 0xd3, 0x2f, 0xec, 0x48, 0xcd, 0x6b, 0x39, 0x1e, 0xea, 0x40, 0xce,
+  0xaa, 0x27, 0x70, 0x24, 0xcb, 0xe2, 0x2e, 0x7c, 0x0f, 0x61, 0x4a, 0xe1, 0x94, 0x57, 0x1f, 0xa4, 0xc9, 0x01, 0x7c, 0x1e,
+  0x01, 0x91, 0x3b, 0xf9, 0x13, 0x3b, 0x60, 0xb2, 0x85, 0x56, 0x40, 0xaa, 0x18, 0x01, 0x7d, 0x7c, 0x53, 0x32, 0x93, 0xe6,
+  0x1c, 0x0c, 0xf8, 0x51, 0x04, 0xcd, 0xce, 0xe2, 0xf0, 0x6a, 0x38, 0xa2, 0x33, 0xfc, 0xf4, 0xee, 0x7a, 0xb0, 0xda, 0xaa,
+  0x4d, 0xef, 0xad, 0x07, 0x6b, 0xf0, 0xe7, 0xcb, 0xf5, 0xe0, 0x2d, 0xf8, 0xf3, 0xd5, 0x7a, 0xf0, 0x36, 0xfc, 0xb9, 0x0f,
+  0x1b, 0x1a, 0xfc, 0x79, 0xb0, 0x1e, 0x9c, 0x81, 0x3f, 0x5f, 0xaf, 0x07, 0xbf, 0x85, 0x3f, 0x0f, 0xd7, 0x83, 0x77, 0xe1,
+  0xcf, 0x37, 0xeb, 0xc1, 0x7b, 0xf0, 0xe7, 0x11, 0x14, 0x5f, 0x81, 0xbf, 0xdf, 0x42, 0x79, 0xfc, 0xfb, 0x27, 0xf5, 0xf7,
+  0x31, 0x20, 0xc2, 0xbf, 0x4f, 0x00, 0x13, 0xfe, 0xfd, 0x4e, 0xfd, 0x7d, 0x8a, 0x7b, 0x24, 0xfc, 0xfd, 0x5e, 0xfd, 0xfd,
+  0x01, 0x70, 0xe3, 0xdf, 0x67, 0x80, 0x1c, 0xff, 0xfe, 0x08, 0xd8, 0xf1, 0xef, 0x9f, 0xd5, 0xdf, 0xbf, 0x40, 0x35, 0xf8,
+  0xf7, 0xbf, 0xa8, 0xbf, 0xcf, 0xb1, 0x3e, 0xfc, 0xf1, 0x02, 0x2b, 0xc2, 0x1f, 0x3f, 0x61, 0x4d, 0xf8, 0xe3, 0x25, 0x56,
+  0xb1, 0xe2, 0x9e, 0x86, 0x81, 0xbe, 0x3f, 0x02, 0x49, 0xb8, 0x1f, 0x1e, 0xc5, 0xc3, 0x86, 0xcb, 0x15, 0x90, 0xb7, 0x29,
+  0xd2, 0xd3, 0x12, 0x61, 0xdd, 0x1c, 0x50, 0xed, 0xce, 0x51, 0xaf, 0xab, 0xcd, 0xbc, 0x3d, 0x88, 0x92, 0x83, 0xa2, 0x4f,
+  0xbb, 0xc3, 0xaa, 0xc9, 0xde, 0x3d, 0x7d, 0x9c, 0x4f, 0xa6, 0xff, 0x7d, 0xd7, 0x0c, 0x3b, 0x26, 0xb4, 0x73, 0x10, 0xb1,
+  0xa3, 0x06, 0x1c, 0xdb, 0x97, 0x56, 0x9b, 0x93, 0xe9, 0xff, 0xb0, 0x49, 0xf8, 0xbd, 0xeb, 0xac, 0x35, 0x9e, 0x16, 0xb5,
+  0x8f, 0xc1, 0xc4, 0xdb, 0x06, 0x26, 0xd0, 0xc0, 0xab, 0x20, 0x88, 0xb5, 0xf7, 0x07, 0x29, 0xec, 0x0b, 0x16, 0x84, 0x37,
+  0x39, 0xdd, 0x54, 0x4e, 0x6f, 0xc7, 0xf9, 0xc5, 0x38, 0x89, 0x61, 0xcd, 0x25, 0x24, 0xe7, 0x24, 0xc1, 0xfb, 0x9b, 0x00,
+  0x24, 0x7b, 0x81, 0x0b, 0xe6, 0x4e, 0x38, 0x18, 0xa3, 0xf0, 0x94, 0xf0, 0x27, 0x30, 0x53, 0x3c, 0x06, 0x43, 0xe6, 0x61,
+  0x1f, 0xe4, 0x81, 0xa0, 0xc1, 0xf9, 0x67, 0x37, 0x71, 0x24, 0xb1, 0x25, 0x08, 0xf0, 0x26, 0x40, 0x4c, 0x5f, 0x02, 0x0c,
+  0x67, 0x2e, 0x51, 0xa6, 0xde, 0xfb, 0x4d, 0x81, 0x55, 0x2e, 0xa0, 0x68, 0xcd, 0x6d, 0x3a, 0x03, 0x2d, 0x13, 0x0c, 0xb7,
+  0xda, 0x0c, 0xa3, 0xa9, 0xe0, 0x79, 0x1d, 0x19, 0x5a, 0x1e, 0x05, 0x36, 0x7b, 0x4d, 0x64, 0xbf, 0x28, 0x67, 0xbf, 0x25,
+  0xb2, 0x7f, 0x32, 0xcd, 0xdb, 0x54, 0x7d, 0xfc, 0x0d, 0xd6, 0xe6, 0xb6, 0x92, 0xaa, 0x7c, 0xc7, 0xe9, 0xd6, 0x37, 0xd3,
+  0x07, 0xa2, 0x24, 0xc2, 0x07, 0xa6, 0x16, 0x51, 0xe8, 0x8c, 0x57, 0xe8, 0x6b, 0xaf, 0x90, 0x3f, 0x14, 0xe2, 0x00, 0x38,
+  0x6b, 0x24, 0x34, 0x4f, 0x2e, 0x0d, 0xc4, 0x23, 0xd9, 0xd3, 0xa2, 0x34, 0x10, 0xdf, 0x96, 0xb3, 0xe5, 0x40, 0x3c, 0x2e,
+  0x67, 0xbf, 0x2d, 0xb2, 0x9f, 0x94, 0xb3, 0xdf, 0x11, 0xd9, 0x4f, 0xcb, 0xd9, 0x67, 0x44, 0xf6, 0x0f, 0xe5, 0xec, 0xdf,
+  0x8a, 0xec, 0x67, 0xe5, 0xec, 0x77, 0x45, 0xf6, 0x8f, 0xe5, 0xec, 0xf7, 0x44, 0xf6, 0x5f, 0x2a, 0xa7, 0xd0, 0x1b, 0xdc,
+  0x60, 0x45, 0xf3, 0x70, 0x31, 0x3b, 0x02, 0xc9, 0x5d, 0x59, 0x87, 0x05, 0x91, 0x03, 0x78, 0xaf, 0x1a, 0x44, 0x0e, 0xe2,
+  0x97, 0xd5, 0x20, 0x72, 0x20, 0xbf, 0xaa, 0x06, 0x91, 0x83, 0x79, 0xbf, 0x1a, 0x44, 0x0e, 0xe8, 0x83, 0x6a, 0x10, 0x39,
+  0xa8, 0x5f, 0x57, 0x83, 0xc8, 0x81, 0x7d, 0x58, 0x0d, 0x22, 0x07, 0xf7, 0x9b, 0xba, 0x38, 0x88, 0x3a, 0x4c, 0x11, 0x40,
+  0xdc, 0xcd, 0x9f, 0x0e, 0xe4, 0xcc, 0x54, 0x2e, 0x82, 0x0c, 0x4b, 0x32, 0x95, 0xcb, 0x39, 0x7b, 0xf1, 0x41, 0x5c, 0x54,
+  0xb3, 0xcf, 0xf6, 0x10, 0xf7, 0xa5, 0xc6, 0xf2, 0x67, 0xbd, 0x37, 0x97, 0x0f, 0x34, 0x87, 0x62, 0x78, 0xc3, 0x8b, 0x56,
+  0xec, 0xf9, 0x0a, 0xe5, 0x6b, 0x3c, 0x33, 0x13, 0x40, 0x1b, 0xbf, 0x1b, 0xc4, 0x83, 0x2d, 0x03, 0x54, 0x5c, 0x8f, 0x41,
+  0xed, 0x66, 0x58, 0xc1, 0xf4, 0x3a, 0x00, 0xbf, 0xce, 0xab, 0xd1, 0x63, 0xae, 0x7a, 0xcf, 0xfb, 0x3d, 0x0e, 0x8d, 0xe9,
+  0x0b, 0x35, 0x8d, 0x3f, 0x6c, 0xc3, 0x90, 0x29, 0xe6, 0xc0, 0x61, 0x37, 0x6d, 0x2b, 0x51, 0xf2, 0x4c, 0xdc, 0xce, 0x36,
+  0x41, 0xda, 0x1a, 0x0d, 0x50, 0xfa, 0x5f, 0xbe, 0xf1, 0x87, 0xe9, 0xdd, 0xa5, 0xe9, 0xcb, 0x9b, 0xcb, 0x07, 0x2d, 0xde,
+  0x3e, 0xe8, 0x5c, 0xa9, 0x4a, 0xf6, 0xc3, 0x2c, 0x80, 0xf3, 0x05, 0x61, 0xc0, 0x2a, 0x11, 0x33, 0x4c, 0x47, 0x69, 0x27,
+  0xbe, 0x81, 0x90, 0x37, 0x89, 0xad, 0x8b, 0x69, 0x02, 0xe8, 0x8a, 0xce, 0xa0, 0x00, 0x72, 0x1d, 0xce, 0xcf, 0xf9, 0x82,
+  0xc2, 0x19, 0x8b, 0x01, 0xdc, 0xa0, 0x7d, 0x92, 0x12, 0xaa, 0x04, 0x23, 0x35, 0x53, 0xfb, 0x42, 0x22, 0x92, 0x05, 0x4f,
+  0x14, 0xea, 0x58, 0x64, 0x12, 0x67, 0x2a, 0xc0, 0xd4, 0xde, 0x27, 0xfc, 0x3b, 0x29, 0x35, 0x97, 0x4f, 0x55, 0xba, 0x33,
+  0x75, 0x4b, 0x4d, 0x23, 0xce, 0x2d, 0x97, 0x68, 0xf4, 0x0c, 0x25, 0x80, 0xd8, 0xf4, 0x71, 0x78, 0x08, 0x40, 0x04, 0xdc,
+  0x86, 0x63, 0x41, 0xaf, 0xd1, 0x18, 0xd1, 0x69, 0x66, 0xd4, 0xc6, 0x1a, 0xd5, 0xd1, 0x38, 0x3c, 0xaa, 0x37, 0x3b, 0x6d,
+  0x5e, 0x02, 0x44, 0x90, 0x3c, 0xa3, 0x24, 0x65, 0x9d, 0x58, 0x9a, 0xa0, 0x4a, 0xe5, 0xb9, 0x01, 0x28, 0x98, 0x2d, 0xd2,
+  0x02, 0x84, 0x9b, 0x81, 0x02, 0x1a, 0x77, 0x8d, 0x28, 0xab, 0x6a, 0x81, 0x71, 0x07, 0x9b, 0xb2, 0xba, 0xd9, 0xc0, 0xaa,
+  0x31, 0x72, 0x74, 0x48, 0xf1, 0x44, 0xf8, 0x3b, 0xae, 0x44, 0xc1, 0xa9, 0xa8, 0xe1, 0xe1, 0x2a, 0x64, 0x0d, 0xbf, 0xa7,
+  0xa3, 0x99, 0xae, 0xab, 0x13, 0x34, 0xf4, 0x4f, 0xda, 0x3b, 0x57, 0xb0, 0xf9, 0x2a, 0xa5, 0xc9, 0x2b, 0xcb, 0x16, 0x55,
+  0xe5, 0x10, 0x83, 0x57, 0xa1, 0x4a, 0xc6, 0x12, 0xaa, 0x9d, 0x1b, 0x35, 0x3d, 0xfe, 0xf4, 0xd7, 0xae, 0x9d, 0x3f, 0x4c,
+  0xef, 0x2d, 0xab, 0x55, 0xe3, 0xa8, 0x13, 0x41, 0x84, 0x82, 0xc6, 0x4e, 0x82, 0xd3, 0xc7, 0x54, 0x00, 0x7f, 0x20, 0xaa,
+  0xc9, 0xae, 0x2d, 0xfa, 0x59, 0xfe, 0x26, 0xad, 0xb8, 0x00, 0x58, 0x0e, 0x2c, 0xa2, 0x61, 0xc3, 0xb2, 0x06, 0x90, 0xba,
+  0x01, 0xcd, 0xba, 0x51, 0xf3, 0xd1, 0xe9, 0x84, 0x24, 0xef, 0xed, 0xa3, 0xe1, 0x5e, 0x3a, 0xa0, 0x91, 0x60, 0xcd, 0x20,
+  0x0e, 0x88, 0x92, 0xc1, 0xb5, 0xec, 0x4d, 0x9d, 0x53, 0x1d, 0xa7, 0x5c, 0x80, 0x22, 0xbe, 0xb1, 0xae, 0x07, 0x18, 0x32,
+  0xab, 0xd8, 0x0a, 0xe4, 0x36, 0x49, 0xf6, 0xd4, 0xf2, 0x76, 0x46, 0xe4, 0xa2, 0xb8, 0x86, 0x25, 0xee, 0x86, 0xd2, 0xd7,
+  0xd5, 0x9b, 0xf3, 0x7b, 0xa3, 0x58, 0xe0, 0x98, 0xd4, 0x1c, 0x80, 0xcb, 0xe5, 0xac, 0x88, 0xe2, 0xc6, 0x4d, 0x5e, 0xb5,
+  0x08, 0xa3, 0x85, 0xd3, 0xb3, 0xb4, 0xd7, 0x1d, 0x2f, 0x42, 0x72, 0x58, 0xec, 0xc6, 0xca, 0xcd, 0x05, 0x69, 0x8e, 0xa0,
+  0x65, 0x4d, 0x4b, 0xc1, 0xaa, 0x2d, 0x4b, 0x43, 0xc8, 0xeb, 0x03, 0x9a, 0x5a, 0x13, 0x3d, 0xeb, 0x99, 0x9e, 0xd5, 0x2a,
+  0xfb, 0x5b, 0x53, 0x1d, 0xae, 0xcd, 0x21, 0x8b, 0xc5, 0xe8, 0xdb, 0x5d, 0xac, 0x7f, 0x6d, 0xda, 0xb6, 0xb5, 0x55, 0x13,
+  0x2d, 0x0c, 0xc6, 0x2f, 0xa4, 0x5b, 0xa4, 0x9f, 0x79, 0xe4, 0xab, 0x28, 0x4b, 0x4d, 0xa3, 0xa2, 0x29, 0x73, 0xa2, 0xd4,
+  0x8d, 0xf0, 0xe9, 0x5a, 0x96, 0xf2, 0xa7, 0xd3, 0xe0, 0xa8, 0xa2, 0xf9, 0x15, 0x45, 0xdc, 0xba, 0xb5, 0x01, 0xb7, 0xd6,
+  0x69, 0x65, 0x20, 0x5a, 0x89, 0x56, 0x53, 0x7d, 0xba, 0x85, 0x9f, 0xea, 0x64, 0xcb, 0x30, 0x0a, 0xf9, 0x0a, 0x6a, 0x13,
+  0xed, 0x51, 0xb6, 0x74, 0x6e, 0x95, 0xfa, 0x08, 0xde, 0xb1, 0xb6, 0xfb, 0xa8, 0xaf, 0x72, 0x37, 0x3e, 0x77, 0x17, 0x99,
+  0xb3, 0x49, 0x9a, 0x91, 0x26, 0xd8, 0x4e, 0xdb, 0x61, 0x10, 0x33, 0x76, 0xda, 0xed, 0xf1, 0x70, 0x18, 0x66, 0x47, 0xaf,
+  0x5f, 0x25, 0x6d, 0xab, 0x04, 0xe9, 0x6d, 0xac, 0xde, 0x38, 0xf2, 0xb6, 0xe2, 0xf2, 0x2c, 0xd8, 0xa9, 0x87, 0x6c, 0x94,
+  0xf6, 0x55, 0x49, 0xe7, 0xd1, 0x12, 0xfa, 0x41, 0x98, 0x47, 0xb8, 0x3e, 0x3f, 0x8c, 0xee, 0xe0, 0xd1, 0x12, 0x75, 0x0d,
+  0x5b, 0x7b, 0x9f, 0xdb, 0xf6, 0x91, 0x89, 0x1d, 0xda, 0x77, 0xea, 0x94, 0xca, 0xa2, 0x6d, 0x29, 0x36, 0xba, 0xf4, 0x01,
+  0x6d, 0xe1, 0x8e, 0x0e, 0x95, 0x80, 0x38, 0x5d, 0x29, 0x52, 0x49, 0xf1, 0xdc, 0x26, 0x7b, 0x7e, 0x5b, 0x23, 0xe4, 0xbf,
+  0x6f, 0xbc, 0xa1, 0x30, 0x9c, 0xc5, 0xe5, 0x23, 0xe1, 0x8c, 0xd1, 0x1f, 0xb5, 0x8f, 0xa5, 0xf2, 0x1d, 0x55, 0x6c, 0xbd,
+  0xaa, 0x18, 0x19, 0xca, 0xac, 0x3e, 0xd9, 0xe9, 0x37, 0x41, 0x11, 0xde, 0x6b, 0xa4, 0x6b, 0x56, 0x32, 0x4f, 0xb9, 0x06,
+  0x68, 0xfa, 0xa9, 0xca, 0xf6, 0x94, 0x45, 0xd0, 0x5e, 0x34, 0x20, 0xcd, 0xb7, 0x38, 0xa2, 0x49, 0x75, 0xf6, 0x52, 0x50,
+  0x6e, 0x60, 0x93, 0x0f, 0xb2, 0x42, 0x95, 0x55, 0xdd, 0xf7, 0x37, 0x19, 0xe9, 0x30, 0xfc, 0x02, 0x15, 0x01, 0x54, 0x91,
+  0x6f, 0x2d, 0x27, 0xc0, 0x0b, 0x48, 0x2e, 0x38, 0x8f, 0x9f, 0x14, 0x5d, 0xa6, 0x1d, 0xf8, 0xe1, 0x4a, 0x74, 0x94, 0xe0,
+  0x37, 0x3d, 0xdd, 0xdf, 0x37, 0xe3, 0x8b, 0x73, 0x07, 0x04, 0xfd, 0x0f, 0x5b, 0xfb, 0xfb, 0x40, 0x1d, 0xdb, 0x11, 0x40,
+  0xf4, 0x72, 0x25, 0x4f, 0xaa, 0x72, 0x1a, 0x11, 0xb4, 0x0b, 0x4a, 0xfa, 0xea, 0x3e, 0xc8, 0x38, 0x97, 0x0b, 0x9d, 0x9f,
+  0x6a, 0x82, 0xd6, 0x9e, 0x6b, 0x7d, 0xe0, 0xdc, 0x26, 0xbb, 0xbd, 0x8b, 0x73, 0x86, 0x45, 0xb0, 0x0b, 0x66, 0x45, 0x2c,
+  0xaa, 0x51, 0x7c, 0x2d, 0x75, 0xe2, 0xe5, 0xed, 0x2d, 0xc5, 0xde, 0x9a, 0x56, 0x03, 0x03, 0x67, 0x77, 0x77, 0xf5, 0x8c,
+  0xf7, 0xf7, 0xe3, 0x2f, 0xde, 0xc6, 0x66, 0x5d, 0x0d, 0xbb, 0x8d, 0x61, 0xd8, 0xb5, 0x2b, 0xc6, 0x13, 0xf5, 0x21, 0x4f,
+  0xb1, 0x44, 0xd8, 0xa5, 0xd2, 0x4f, 0x46, 0xa3, 0x28, 0x3b, 0x0f, 0xd3, 0xeb, 0x6c, 0x56, 0x37, 0xfe, 0xb0, 0xb2, 0xf4,
+  0xde, 0xb9, 0xa5, 0x8b, 0xf6, 0x00, 0xa0, 0x1a, 0x44, 0xb8, 0xc4, 0xb6, 0xfc, 0x36, 0x10, 0x3e, 0xa7, 0x71, 0xd3, 0x9c,
+  0xfc, 0x25, 0x3c, 0x5b, 0xc2, 0x52, 0x47, 0xdb, 0x94, 0xcb, 0x8a, 0x7a, 0xd1, 0x7e, 0x38, 0x1e, 0x14, 0xdb, 0xe8, 0xab,
+  0x73, 0x2d, 0x1c, 0x46, 0x0d, 0x61, 0x00, 0x81, 0xe6, 0x69, 0x02, 0x60, 0x43, 0x64, 0xa7, 0x8d, 0x1e, 0x30, 0x9d, 0xb6,
+  0x69, 0xb8, 0xd5, 0x4a, 0x11, 0x82, 0x6d, 0xf2, 0xf5, 0x59, 0x3a, 0x7d, 0x5c, 0x31, 0x08, 0x9e, 0x5a, 0x6a, 0x6f, 0x1c,
+  0x0f, 0x7a, 0xd7, 0xa2, 0xe2, 0x83, 0xb0, 0x77, 0x10, 0x35, 0x10, 0xad, 0x99, 0x2f, 0xfe, 0x70, 0x75, 0xbf, 0x98, 0x81,
+  0xe9, 0xd8, 0x90, 0xed, 0x5c, 0xd8, 0xfa, 0x76, 0x3f, 0x8d, 0x7f, 0xfe, 0xe3, 0xbd, 0x8b, 0xf1, 0x3a, 0x6c, 0x86, 0x12,
+  0x00, 0xab, 0x33, 0x85, 0xc2, 0xd1, 0xd5, 0xb4, 0x17, 0xd9, 0x32, 0x97, 0xd2, 0x22, 0x1f, 0xa5, 0x85, 0x29, 0x13, 0x8e,
+  0xb0, 0x08, 0x77, 0x09, 0x76, 0x53, 0x6f, 0xe3, 0xac, 0x4f, 0x1f, 0x4f, 0xef, 0x06, 0xd3, 0x27, 0xd3, 0x87, 0xd3, 0x07,
+  0xd3, 0x7b, 0xa4, 0x29, 0x12, 0x1d, 0x41, 0x04, 0xdb, 0x34, 0x3a, 0x57, 0xd9, 0x84, 0x05, 0x87, 0xb3, 0x9e, 0x50, 0xbc,
+  0x77, 0x2d, 0x07, 0xc4, 0x0c, 0xc3, 0xf7, 0x0e, 0x63, 0xdc, 0x95, 0x1a, 0x4c, 0x1d, 0x30, 0xeb, 0xc1, 0x99, 0x75, 0x5b,
+  0xe1, 0x0f, 0xd3, 0x47, 0xf0, 0xdf, 0x93, 0xe9, 0xfd, 0x60, 0xfa, 0xd3, 0xf4, 0x4b, 0xa8, 0xf6, 0x11, 0x9d, 0xf6, 0x09,
+  0xee, 0x6d, 0x01, 0x77, 0x1f, 0xfe, 0x79, 0x09, 0xed, 0x82, 0x56, 0x01, 0xd0, 0xcb, 0x60, 0xfa, 0x74, 0xfa, 0x2d, 0x94,
+  0x78, 0x6c, 0xa1, 0x57, 0x1d, 0xe8, 0x17, 0x90, 0x09, 0x50, 0xd4, 0x9f, 0xa7, 0x80, 0xff, 0x2f, 0xd3, 0xbb, 0x16, 0xf4,
+  0x1d, 0x07, 0xf4, 0x21, 0xd4, 0x79, 0x0f, 0x90, 0xbe, 0x08, 0x00, 0xe6, 0x1e, 0xe9, 0x23, 0x08, 0xea, 0xb7, 0x02, 0xea,
+  0x09, 0x20, 0x81, 0x6a, 0x49, 0xb7, 0x46, 0x99, 0x6f, 0x39, 0x99, 0x76, 0xbc, 0x28, 0x73, 0xc5, 0x2b, 0xf9, 0x03, 0x76,
+  0xef, 0xb1, 0xed, 0xc1, 0xcf, 0x7f, 0x44, 0x15, 0x8d, 0x22, 0x48, 0x01, 0x7b, 0x6f, 0xfa, 0x0c, 0xfb, 0x1f, 0xc0, 0x0f,
+  0xa7, 0xb7, 0x75, 0x6f, 0x17, 0xef, 0xa6, 0xc3, 0xd1, 0xb8, 0x88, 0x2e, 0x45, 0xe1, 0xa0, 0xe8, 0x5f, 0x81, 0xf3, 0x7c,
+  0x23, 0x2f, 0x04, 0x17, 0xaf, 0x22, 0xa9, 0x53, 0x92, 0xbd, 0x11, 0x73, 0xb7, 0x50, 0x30, 0x38, 0x2f, 0xa0, 0xde, 0x3f,
+  0x61, 0x1b, 0xbf, 0x85, 0xfa, 0x1e, 0x4c, 0xbf, 0xc7, 0xd9, 0x78, 0x36, 0xd5, 0x85, 0xf3, 0xa2, 0xad, 0xfd, 0xc8, 0x3a,
+  0xec, 0x0f, 0x70, 0x1e, 0x27, 0x98, 0xce, 0x69, 0xe7, 0xaf, 0x6c, 0x9d, 0xff, 0xfb, 0x5b, 0xd7, 0xb6, 0x76, 0x6e, 0x6d,
+  0x5f, 0xd8, 0xa9, 0x2f, 0x88, 0x54, 0x8c, 0xce, 0x03, 0xc8, 0xfd, 0xde, 0x25, 0xb4, 0x21, 0x20, 0xbf, 0x12, 0xee, 0x45,
+  0x83, 0x46, 0x36, 0x4e, 0xae, 0x3a, 0x34, 0x36, 0xb4, 0x34, 0xa6, 0xf2, 0xa4, 0x9d, 0x72, 0xe8, 0xa9, 0x94, 0xeb, 0x34,
+  0x31, 0x8f, 0xeb, 0x32, 0x77, 0x4d, 0xe4, 0xfe, 0x04, 0x03, 0xfc, 0x52, 0x36, 0xe7, 0x2e, 0x80, 0x7f, 0x03, 0xff, 0x3d,
+  0x81, 0xff, 0x3f, 0x72, 0x1b, 0xa5, 0xc6, 0x1c, 0xab, 0xc4, 0x45, 0x20, 0xd9, 0x47, 0x5e, 0x78, 0xdc, 0x63, 0x63, 0xd6,
+  0x4c, 0xa8, 0xf3, 0xcc, 0x90, 0xe0, 0xdb, 0x29, 0xb0, 0x41, 0x72, 0x1f, 0xe9, 0xb4, 0x75, 0x67, 0x3a, 0x1d, 0xbd, 0x07,
+  0x92, 0x17, 0x5f, 0x67, 0x06, 0x8c, 0xdd, 0x8c, 0xc4, 0x58, 0x0d, 0x9b, 0x95, 0x7c, 0xe7, 0x52, 0x9c, 0x14, 0xaf, 0xc0,
+  0x76, 0x98, 0x83, 0xa0, 0x4c, 0x72, 0xca, 0x65, 0x43, 0x66, 0x0f, 0xd3, 0x4c, 0x25, 0x98, 0xfe, 0x48, 0xf4, 0xfa, 0xb8,
+  0x9a, 0xbb, 0xb4, 0x91, 0x91, 0x68, 0x22, 0x7e, 0x34, 0xfd, 0x0e, 0x57, 0xd7, 0x63, 0xf8, 0xf1, 0x20, 0x80, 0x19, 0xff,
+  0x6a, 0xfa, 0x88, 0x57, 0xc4, 0x97, 0xf8, 0x13, 0x96, 0x9e, 0x62, 0x6e, 0xed, 0x5d, 0xad, 0xa6, 0xf4, 0x1a, 0xb3, 0x68,
+  0x5b, 0x2c, 0xd6, 0x17, 0xb0, 0x90, 0xfe, 0xef, 0xff, 0x12, 0xdc, 0x2c, 0x80, 0x64, 0x68, 0xc5, 0x63, 0xa8, 0x68, 0x16,
+  0x2b, 0xb5, 0xd5, 0xcf, 0xea, 0xbc, 0xcf, 0x22, 0x1d, 0x7c, 0x6d, 0xec, 0x23, 0x75, 0xf4, 0x11, 0x52, 0xbb, 0xe2, 0x41,
+  0x5f, 0x03, 0xf4, 0x23, 0xe0, 0x02, 0xf7, 0x5b, 0x01, 0x76, 0x9f, 0x5a, 0xfa, 0x38, 0x50, 0x0d, 0x6f, 0x4b, 0x75, 0xe2,
+  0xee, 0x0c, 0xbc, 0xa5, 0x76, 0x62, 0xc7, 0x2e, 0x5f, 0x17, 0xa9, 0x97, 0x47, 0x38, 0xea, 0xf4, 0x15, 0x8f, 0x4a, 0xec,
+  0x5d, 0x50, 0x45, 0x16, 0x25, 0xbd, 0x28, 0xbb, 0x86, 0x36, 0xd0, 0x7e, 0x98, 0x1c, 0x78, 0x9c, 0xa3, 0x23, 0xd6, 0x79,
+  0x7a, 0x5b, 0x89, 0x7f, 0x22, 0x2d, 0x31, 0xe5, 0xe6, 0xd8, 0x2d, 0x07, 0x48, 0x8e, 0x4c, 0xe1, 0xba, 0x24, 0x15, 0xa4,
+  0x65, 0xb3, 0x95, 0xc0, 0xee, 0x8d, 0x5c, 0xf7, 0x2b, 0x18, 0xc8, 0xe7, 0xc0, 0x0c, 0x70, 0xb3, 0x06, 0x82, 0x60, 0x16,
+  0xfc, 0xc8, 0x20, 0x39, 0xec, 0x47, 0x09, 0xab, 0xb2, 0x58, 0xda, 0xf1, 0x91, 0xc9, 0x56, 0x6c, 0x08, 0x5b, 0x89, 0x77,
+  0xc0, 0x99, 0x5f, 0xcc, 0x1a, 0x9a, 0xa8, 0xcd, 0x34, 0xac, 0x30, 0xa6, 0x50, 0xf5, 0xe4, 0xf4, 0x71, 0x3f, 0x38, 0x85,
+  0xfc, 0x0d, 0x7b, 0x06, 0x4d, 0xde, 0x0d, 0x1a, 0x90, 0x34, 0x69, 0xee, 0xd2, 0x89, 0xd5, 0xdb, 0xe2, 0x79, 0x50, 0xe9,
+  0x28, 0x71, 0x39, 0xd9, 0x4f, 0xe7, 0xb3, 0x06, 0x75, 0xd6, 0x1d, 0x3a, 0x22, 0x67, 0x89, 0x63, 0x58, 0x9d, 0x29, 0x20,
+  0xdd, 0xba, 0xcd, 0x87, 0x8f, 0xa1, 0x39, 0x77, 0x68, 0x23, 0x78, 0x9d, 0xf2, 0xf1, 0x27, 0x1c, 0x72, 0x34, 0x2c, 0x0e,
+  0x30, 0x6c, 0x55, 0x48, 0x84, 0x3c, 0xbc, 0x8a, 0x64, 0x15, 0x1b, 0x76, 0x21, 0xc9, 0xca, 0x8d, 0x50, 0x64, 0xe6, 0xb6,
+  0xea, 0x92, 0x62, 0x74, 0x21, 0x09, 0xf7, 0xd8, 0x9b, 0xe8, 0xd4, 0x29, 0x97, 0x29, 0xf1, 0x2e, 0x62, 0x41, 0x8c, 0xff,
+  0x51, 0x86, 0x32, 0x80, 0x28, 0x0a, 0xf8, 0xe1, 0x0b, 0xd1, 0x37, 0xb0, 0xf1, 0xec, 0xd0, 0x6b, 0xec, 0x83, 0xda, 0xcf,
+  0x80, 0x3b, 0xb1, 0x4d, 0x99, 0xe8, 0x21, 0x8c, 0x58, 0x70, 0xe8, 0xa9, 0x68, 0xa7, 0xc4, 0x96, 0x01, 0x9b, 0x01, 0x19,
+  0x86, 0xc9, 0x38, 0x1c, 0x30, 0xd4, 0x23, 0xa0, 0xa9, 0xa7, 0x9c, 0x4f, 0xb3, 0xd6, 0xb4, 0x04, 0x99, 0x17, 0xd7, 0x0a,
+  0xb4, 0xd2, 0x62, 0x23, 0xd4, 0xd7, 0xf6, 0x51, 0xd2, 0x45, 0x21, 0x9e, 0x45, 0x7b, 0x0b, 0x78, 0x95, 0x30, 0x0a, 0x58,
+  0x4e, 0xd8, 0x8e, 0x8a, 0x2a, 0x68, 0x7d, 0xe0, 0xc1, 0xb3, 0x89, 0xae, 0x86, 0x8e, 0xf8, 0x12, 0x97, 0x16, 0x84, 0x9c,
+  0xee, 0x5e, 0x81, 0x7c, 0x6c, 0x43, 0x9d, 0x41, 0xa1, 0x07, 0xee, 0xe1, 0x01, 0x13, 0x9b, 0xa5, 0xae, 0xf4, 0x00, 0x29,
+  0x6d, 0xbd, 0xe6, 0xac, 0x09, 0xad, 0xd4, 0x89, 0xb0, 0x31, 0xac, 0x4a, 0xc8, 0x73, 0x40, 0x9d, 0x77, 0x22, 0x43, 0x3a,
+  0x26, 0xc5, 0x43, 0xb6, 0xc3, 0x6a, 0x17, 0x83, 0x1a, 0xc6, 0x75, 0x85, 0x06, 0xf4, 0x5b, 0xb5, 0x26, 0x51, 0xe5, 0x29,
+  0x32, 0xd7, 0x4a, 0xa3, 0x5d, 0xda, 0x37, 0x4d, 0x57, 0xa1, 0x1c, 0x2d, 0x7b, 0xe8, 0x25, 0xaa, 0x75, 0x6c, 0x85, 0x13,
+  0xf3, 0x65, 0x2b, 0x54, 0x15, 0xa9, 0x66, 0x43, 0x02, 0xf1, 0x6f, 0xc5, 0xd8, 0xa9, 0x22, 0x4a, 0x20, 0x6a, 0xd6, 0xa9,
+  0x93, 0x5d, 0x4b, 0xb2, 0xdc, 0x0f, 0x31, 0x30, 0x98, 0xf2, 0x61, 0x2e, 0x17, 0x7d, 0x69, 0x2e, 0xa0, 0x3e, 0x64, 0x86,
+  0xd0, 0xbe, 0x84, 0x5d, 0x29, 0x0d, 0xc7, 0x49, 0x94, 0x23, 0xa5, 0x3b, 0x01, 0xfd, 0x98, 0xdc, 0x46, 0x2a, 0x25, 0x30,
+  0x0d, 0x83, 0x27, 0xd7, 0x4b, 0x0c, 0xc7, 0xe0, 0x9b, 0x9b, 0x42, 0xd4, 0x41, 0x15, 0x9a, 0x5c, 0xa9, 0x76, 0x5d, 0x56,
+  0xad, 0x55, 0x6c, 0x01, 0x22, 0x11, 0xeb, 0xf2, 0x6a, 0x9c, 0x40, 0xd5, 0xb9, 0xd7, 0xd5, 0x62, 0xf4, 0x71, 0x84, 0x6e,
+  0x60, 0x3a, 0xb7, 0x24, 0x49, 0x98, 0x45, 0x5b, 0x82, 0x5b, 0x91, 0xab, 0x7e, 0x9b, 0x0e, 0x34, 0xee, 0x32, 0x86, 0xfd,
+  0x57, 0xd4, 0x7b, 0x96, 0x66, 0x6b, 0x17, 0xe7, 0xe2, 0xda, 0xce, 0x75, 0xdc, 0xcd, 0x1f, 0x03, 0xd7, 0xb4, 0x00, 0x93,
+  0x00, 0x48, 0xe3, 0x39, 0xca, 0xad, 0xbb, 0x4a, 0xbd, 0xe7, 0x52, 0x3e, 0x0e, 0x0d, 0xd3, 0x83, 0x1e, 0xa8, 0x09, 0x15,
+  0xe7, 0x9a, 0xcd, 0xb6, 0xd5, 0x9c, 0xc5, 0x62, 0x77, 0xe2, 0xee, 0x6d, 0xc1, 0x62, 0x07, 0x4a, 0x8f, 0x81, 0xb3, 0xe2,
+  0xea, 0x35, 0x44, 0xc5, 0x49, 0x7a, 0x88, 0xbe, 0x26, 0xb8, 0xd8, 0x34, 0xb8, 0x98, 0x6a, 0x9d, 0x26, 0xa7, 0x1b, 0xad,
+  0x1d, 0xe8, 0x7b, 0x84, 0x0a, 0xc9, 0xf7, 0x7b, 0xf1, 0x9d, 0x80, 0x5c, 0x7d, 0x36, 0xeb, 0x43, 0xe8, 0x62, 0xaf, 0x7e,
+  0x16, 0xa0, 0xde, 0x5f, 0x86, 0xe4, 0xb3, 0xea, 0xf4, 0x65, 0x51, 0x18, 0xd6, 0xcf, 0x0a, 0x2f, 0x47, 0xad, 0xa5, 0x95,
+  0x60, 0x06, 0x5a, 0xc9, 0xd7, 0x0a, 0x14, 0xdd, 0x1b, 0xf9, 0x27, 0xeb, 0xaf, 0xfc, 0x6f, 0xb3, 0x21, 0x61, 0x2d, 0xb2,
+  0x71, 0x67, 0xf1, 0x20, 0x6a, 0x01, 0x27, 0xf6, 0xf3, 0x20, 0x1a, 0xea, 0xc9, 0x72, 0x12, 0x27, 0x6a, 0x23, 0x33, 0x9d,
+  0xb0, 0x6b, 0x88, 0x74, 0x0c, 0x8e, 0x1f, 0xaa, 0x39, 0x38, 0x60, 0xf6, 0x25, 0xdb, 0x1b, 0xf4, 0x3e, 0x75, 0x96, 0x15,
+  0x23, 0x09, 0xf7, 0x8b, 0x28, 0xdb, 0x1e, 0x27, 0x30, 0xfa, 0xa4, 0x73, 0xd0, 0x28, 0x91, 0x70, 0xb4, 0xae, 0x0b, 0x67,
+  0xe0, 0xac, 0xc8, 0xe4, 0x81, 0x90, 0x25, 0x91, 0xe8, 0x64, 0x51, 0xe1, 0xce, 0x81, 0xc2, 0xc4, 0x9c, 0xd1, 0x35, 0xc5,
+  0xd4, 0xf0, 0x4a, 0x78, 0x85, 0x75, 0xdb, 0x1b, 0xe6, 0x52, 0x5a, 0x79, 0xa8, 0xdf, 0xac, 0x26, 0x04, 0xe2, 0x7d, 0x28,
+  0xae, 0xe1, 0x1a, 0xf0, 0xb0, 0x4c, 0xdc, 0x24, 0x67, 0x2e, 0xbc, 0x8c, 0xd2, 0x7c, 0x4c, 0xd4, 0x3f, 0xda, 0x79, 0x0e,
+  0x49, 0xd8, 0x0e, 0x7d, 0x5d, 0x79, 0xd2, 0xe9, 0xf3, 0x99, 0x77, 0xb6, 0xc3, 0x2e, 0x9d, 0x6e, 0xa8, 0xdd, 0x91, 0x08,
+  0xbf, 0x89, 0x49, 0xe6, 0x0a, 0x4b, 0x48, 0x2c, 0x56, 0xdd, 0x62, 0xa1, 0xbe, 0x7a, 0xd0, 0xd8, 0x6b, 0x2f, 0xa9, 0xad,
+  0x5d, 0x0a, 0x66, 0xe8, 0xa3, 0xcc, 0xb4, 0x2a, 0x5a, 0x98, 0x94, 0x97, 0x2f, 0x6b, 0x0f, 0x5e, 0xe9, 0xe4, 0x64, 0xe4,
+  0x41, 0x10, 0x6d, 0x59, 0xa6, 0xa4, 0x5f, 0xe4, 0x33, 0x69, 0xbc, 0xa6, 0x71, 0x6b, 0xaf, 0x90, 0x84, 0xc3, 0x51, 0x85,
+  0x58, 0x6c, 0x18, 0x79, 0x4a, 0x95, 0x53, 0x1e, 0xfe, 0x46, 0x95, 0x10, 0xd9, 0xb2, 0x4a, 0x6a, 0x22, 0xb9, 0x5b, 0x90,
+  0x82, 0xf8, 0x6a, 0x54, 0x84, 0xcc, 0xc0, 0xb0, 0x20, 0x4c, 0x32, 0xe0, 0x36, 0xf3, 0x1a, 0x8f, 0xf4, 0x54, 0xda, 0x9d,
+  0xc9, 0x5c, 0x5d, 0xe2, 0x1e, 0x64, 0xd1, 0x20, 0x3c, 0xea, 0xb4, 0x6d, 0x2a, 0x4e, 0x80, 0xf1, 0x92, 0x05, 0x54, 0x28,
+  0x6f, 0x31, 0x94, 0x00, 0x5a, 0x17, 0xc9, 0x20, 0x9d, 0x27, 0xa2, 0x59, 0x94, 0xa6, 0xf7, 0x59, 0x5b, 0xa2, 0xe3, 0xe8,
+  0x26, 0x68, 0x77, 0xb1, 0x7a, 0x0c, 0xd9, 0xad, 0xa1, 0x3e, 0xd4, 0x52, 0x71, 0xff, 0x9c, 0xeb, 0xf0, 0x51, 0x23, 0x43,
+  0xd7, 0x5b, 0x95, 0x67, 0x09, 0x17, 0x98, 0x95, 0x5e, 0xf5, 0x56, 0x95, 0x12, 0xcc, 0x83, 0x54, 0xbb, 0x42, 0xf9, 0xd4,
+  0x2a, 0xe1, 0xfa, 0x66, 0xbf, 0xb5, 0x2d, 0x75, 0xf7, 0x60, 0xbb, 0x51, 0xa7, 0x83, 0x23, 0xf7, 0x10, 0x42, 0x47, 0x1a,
+  0x64, 0xa9, 0x32, 0x29, 0x4e, 0x2e, 0x01, 0xe0, 0x0e, 0x89, 0xe0, 0x46, 0xa8, 0xc6, 0xb2, 0x4a, 0xa6, 0x26, 0x34, 0x1d,
+  0xad, 0x2b, 0x58, 0x86, 0xd1, 0xfc, 0x92, 0x47, 0x92, 0x35, 0x0b, 0x16, 0x80, 0xc4, 0x67, 0xcc, 0x21, 0x81, 0x9a, 0x0e,
+  0x17, 0xde, 0xa1, 0x60, 0x63, 0xde, 0xb9, 0x16, 0x28, 0xd5, 0xfd, 0x42, 0x9a, 0xc0, 0x25, 0x85, 0xcb, 0x87, 0x08, 0x34,
+  0x01, 0x62, 0xc4, 0x95, 0x93, 0x84, 0x77, 0xe2, 0x03, 0xf4, 0x9d, 0x4c, 0x2f, 0x8f, 0x1a, 0xb6, 0x40, 0xf5, 0x8a, 0xfb,
+  0x64, 0x04, 0xa3, 0x84, 0x1a, 0xd8, 0xb1, 0xfa, 0x61, 0xd7, 0xde, 0x5e, 0xfa, 0x05, 0x5f, 0x28, 0xd3, 0x59, 0xe8, 0xc6,
+  0x6a, 0xdc, 0xf6, 0x20, 0xd7, 0x2e, 0x41, 0x4a, 0x39, 0x97, 0x65, 0x40, 0x8f, 0x71, 0x4e, 0x7f, 0x05, 0x3e, 0x58, 0x33,
+  0xfa, 0x43, 0x3a, 0xf6, 0x11, 0xbf, 0x06, 0x2c, 0x8e, 0x33, 0xef, 0x49, 0x3b, 0xa9, 0xae, 0x70, 0x52, 0x2a, 0x89, 0x0b,
+  0x57, 0x38, 0x84, 0x1c, 0xa2, 0x37, 0x88, 0xa9, 0xd6, 0xa8, 0xa8, 0xdf, 0x6d, 0x7a, 0x7e, 0xc0, 0x86, 0xe3, 0x75, 0xb3,
+  0x08, 0xc6, 0x4c, 0x71, 0x3c, 0x58, 0xc8, 0xf1, 0x1d, 0xf2, 0xd8, 0x57, 0x1e, 0xbc, 0xb4, 0xf8, 0xa1, 0x92, 0xb8, 0x88,
+  0x86, 0xd6, 0x1c, 0x19, 0x17, 0x03, 0x4c, 0x3d, 0x6c, 0xf3, 0x2f, 0xe4, 0x24, 0x6d, 0x3e, 0xdc, 0x5a, 0x5b, 0x97, 0xe7,
+  0xad, 0xbc, 0x5b, 0x93, 0x3d, 0x1c, 0x44, 0xfb, 0x45, 0xfd, 0xac, 0x93, 0x44, 0xa8, 0xea, 0xb0, 0x5f, 0xd3, 0x0f, 0xc5,
+  0xee, 0x1d, 0x88, 0x7c, 0xbc, 0x87, 0xf9, 0x46, 0x38, 0x39, 0x6c, 0xe7, 0x66, 0x9f, 0x6d, 0x4e, 0x82, 0x9f, 0xff, 0xe3,
+  0x97, 0x81, 0x93, 0x0b, 0xf3, 0xac, 0xf2, 0xe6, 0x22, 0x93, 0xa7, 0xe2, 0x59, 0x28, 0x5d, 0x98, 0x32, 0xe2, 0x32, 0xfe,
+  0x11, 0xae, 0x12, 0xa8, 0xe0, 0xb0, 0x7d, 0x3b, 0x4e, 0xf8, 0x72, 0xcc, 0xaa, 0x5d, 0x2e, 0xb8, 0x1e, 0x44, 0x0e, 0x1f,
+  0x1c, 0xcc, 0x0a, 0x12, 0x2b, 0x4a, 0xd7, 0x00, 0x24, 0x80, 0x13, 0x1f, 0x8e, 0x46, 0x50, 0xf9, 0xf9, 0x3e, 0xb0, 0x02,
+  0x74, 0x09, 0xaf, 0xa4, 0x6c, 0x64, 0x3b, 0x9f, 0xd2, 0x95, 0xd5, 0x79, 0xb4, 0x9d, 0x18, 0xa8, 0x7f, 0x35, 0x94, 0xad,
+  0x09, 0x78, 0xd3, 0x20, 0xbf, 0xb1, 0x72, 0xd3, 0x6c, 0x65, 0xc4, 0x8e, 0xc4, 0x91, 0x5b, 0x9b, 0x23, 0xaa, 0x39, 0xd6,
+  0x2b, 0x10, 0x6a, 0xa9, 0xc1, 0x0b, 0x53, 0xaa, 0x6a, 0x13, 0xce, 0x9d, 0x51, 0xb2, 0x3d, 0x23, 0xed, 0xfb, 0xa3, 0xe9,
+  0x03, 0x9e, 0x4a, 0x54, 0xa2, 0x3f, 0x66, 0x15, 0xef, 0x7d, 0x98, 0xd5, 0xbb, 0x75, 0xa5, 0x4a, 0xf9, 0x37, 0x22, 0xaf,
+  0x26, 0x72, 0x69, 0xdd, 0x83, 0x39, 0xbc, 0x98, 0x66, 0x7f, 0x8f, 0x6e, 0x50, 0x88, 0x84, 0xbc, 0xdb, 0x94, 0xc9, 0x44,
+  0x7f, 0x93, 0x51, 0x81, 0x77, 0xf9, 0xba, 0x35, 0x17, 0xfc, 0xf3, 0xf7, 0xf7, 0xff, 0xb3, 0xb6, 0x38, 0xe0, 0x0e, 0x7a,
+  0x98, 0x66, 0xb7, 0x9d, 0xec, 0xaf, 0xfe, 0xa7, 0xc9, 0xa6, 0x93, 0x91, 0xc8, 0xfc, 0xf9, 0x9f, 0xfe, 0x9b, 0xc9, 0x1b,
+  0x8f, 0x7a, 0xb8, 0xf5, 0x8b, 0xcc, 0xff, 0xfa, 0x9f, 0xfe, 0xdf, 0xff, 0xfe, 0x27, 0x93, 0xbf, 0x97, 0xa6, 0x85, 0xcc,
+  0xfd, 0x0f, 0xff, 0x87, 0x73, 0x4b, 0xf6, 0x0b, 0x93, 0x53, 0xb1, 0x5c, 0x2f, 0xf1, 0x65, 0xf3, 0x06, 0x72, 0xd8, 0xbc,
+  0x62, 0xa1, 0xaa, 0xcb, 0xe8, 0xaf, 0xb4, 0x07, 0x29, 0x5c, 0x40, 0xe3, 0xf4, 0xeb, 0xb5, 0xd6, 0xa8, 0xd6, 0xd5, 0xde,
+  0x27, 0x3b, 0x14, 0xea, 0x30, 0x5e, 0xb0, 0x09, 0xe6, 0x19, 0x29, 0xa6, 0x21, 0xef, 0xd5, 0x37, 0xa7, 0x18, 0x4d, 0xca,
+  0xaa, 0x4d, 0xbc, 0x35, 0xa1, 0x87, 0xd2, 0x9d, 0x08, 0xaf, 0x67, 0x0a, 0x7b, 0xea, 0x5b, 0x2b, 0xbf, 0xce, 0x6e, 0xf5,
+  0xda, 0x5b, 0x90, 0x24, 0xbd, 0xb8, 0x20, 0x12, 0x6e, 0xa2, 0xab, 0x0d, 0xfc, 0xc6, 0x9b, 0xa0, 0x9a, 0x77, 0x2c, 0xb2,
+  0x7e, 0xa1, 0x48, 0xc1, 0x82, 0xff, 0xe2, 0x0b, 0xb4, 0xa2, 0xcc, 0x2b, 0xef, 0x02, 0xcc, 0xdb, 0xe9, 0x06, 0x4e, 0xa3,
+  0x82, 0xaa, 0x0e, 0x6d, 0xf6, 0xc2, 0x54, 0xc5, 0x7c, 0x57, 0x95, 0x24, 0xea, 0x72, 0x52, 0x7e, 0x11, 0x95, 0x31, 0x97,
+  0x7c, 0xca, 0x16, 0x4c, 0xa5, 0x41, 0x43, 0xdb, 0xc8, 0x82, 0x34, 0xe6, 0x36, 0x04, 0x28, 0xee, 0x42, 0xd8, 0xed, 0x37,
+  0x1a, 0x87, 0xad, 0x20, 0xee, 0x7d, 0xa1, 0x2e, 0xe7, 0xff, 0x4a, 0xc2, 0x4f, 0xc8, 0xa3, 0x8c, 0x9b, 0x4a, 0xba, 0xa0,
+  0xca, 0xde, 0xb2, 0x5b, 0xd4, 0x9e, 0x56, 0xf8, 0x37, 0x28, 0x8e, 0xac, 0xf5, 0xa8, 0x46, 0x54, 0xd7, 0x3c, 0x78, 0x66,
+  0x31, 0x00, 0x10, 0x85, 0x5e, 0x9b, 0xde, 0xb9, 0x4f, 0xf3, 0x09, 0x54, 0x68, 0x60, 0x6d, 0x73, 0xe5, 0xf6, 0xe1, 0x00,
+  0x70, 0xc3, 0x5e, 0x81, 0xe6, 0x4f, 0xde, 0x92, 0x66, 0x6e, 0x48, 0x7b, 0xe3, 0xa2, 0x20, 0xdf, 0x1d, 0x42, 0xbf, 0x57,
+  0xe0, 0x35, 0x68, 0x38, 0x74, 0x65, 0xf5, 0x00, 0x9d, 0x66, 0x21, 0x85, 0xf2, 0x81, 0xd6, 0xf0, 0xc8, 0xf7, 0xfc, 0xfd,
+  0x65, 0xfe, 0xa6, 0xd5, 0x04, 0x23, 0xf6, 0xef, 0xc7, 0x51, 0x76, 0xb4, 0x1d, 0x0d, 0xe0, 0x64, 0x88, 0x37, 0x23, 0x15,
+  0x70, 0x13, 0x26, 0xb7, 0x0b, 0xfc, 0x08, 0xed, 0x0b, 0x3a, 0xba, 0x83, 0x4b, 0x64, 0xf9, 0x88, 0xd8, 0x15, 0xd0, 0x57,
+  0x8b, 0x94, 0xcb, 0x15, 0xcb, 0x6e, 0x03, 0xdd, 0xd9, 0xaa, 0x17, 0xac, 0xef, 0x76, 0x14, 0x0e, 0x47, 0x8d, 0xa4, 0x15,
+  0x80, 0xd0, 0x03, 0xff, 0x0b, 0xbf, 0x10, 0x1e, 0x56, 0x56, 0xdf, 0x94, 0xcc, 0xba, 0x8e, 0x73, 0xc7, 0xde, 0xf7, 0x05,
+  0x04, 0xc6, 0x7a, 0xc3, 0xfa, 0xf7, 0x38, 0x69, 0x00, 0xc2, 0x96, 0xd5, 0xc6, 0x53, 0x1d, 0x77, 0x9a, 0x15, 0x1e, 0xf9,
+  0x30, 0x63, 0xe4, 0xec, 0x05, 0xdd, 0x44, 0x95, 0x09, 0xcf, 0x25, 0x29, 0x37, 0x8c, 0x25, 0x4c, 0x7d, 0xf9, 0x8e, 0x42,
+  0x85, 0x74, 0xa1, 0x61, 0x18, 0x8c, 0x06, 0x82, 0xb2, 0x58, 0x63, 0x56, 0xab, 0x8b, 0xa6, 0xc4, 0x23, 0xdb, 0xcc, 0x4e,
+  0x52, 0x85, 0x75, 0x82, 0x72, 0x7c, 0x7e, 0x7e, 0x8f, 0x7a, 0x1c, 0x38, 0xe1, 0xe5, 0xae, 0xf1, 0x5b, 0x39, 0xd4, 0xe4,
+  0xda, 0xf3, 0x95, 0x75, 0xa5, 0xda, 0xa5, 0xf5, 0x0f, 0x8d, 0xcf, 0x7a, 0xc7, 0xab, 0xad, 0xb7, 0x26, 0xcd, 0xcf, 0xda,
+  0x27, 0xfc, 0x3c, 0xbd, 0x6c, 0x2e, 0xf7, 0xda, 0xbb, 0xbd, 0x78, 0x4b, 0x50, 0x6d, 0x65, 0xa8, 0xff, 0x44, 0x8d, 0xcb,
+  0xea, 0x06, 0xfc, 0x79, 0x7f, 0x33, 0x78, 0x1b, 0xff, 0xbe, 0x49, 0xd6, 0xf5, 0xe3, 0xf2, 0xad, 0x82, 0xe1, 0x8d, 0xf8,
+  0xe6, 0x89, 0xd7, 0xa8, 0x82, 0x15, 0xfe, 0x71, 0x36, 0x58, 0x7b, 0xe7, 0x1d, 0xbf, 0x52, 0x63, 0x04, 0xc5, 0x70, 0x32,
+  0xae, 0x9f, 0x51, 0x3f, 0x3d, 0x44, 0x55, 0x44, 0xdc, 0xc5, 0xe1, 0xe8, 0x4b, 0x1d, 0xeb, 0x41, 0x46, 0x6e, 0x74, 0xc0,
+  0xe9, 0x73, 0x05, 0xf0, 0x11, 0xa4, 0x18, 0x56, 0x8f, 0xd9, 0x96, 0xd7, 0xe3, 0x57, 0x29, 0x70, 0x09, 0xe2, 0xd3, 0xb6,
+  0x07, 0x13, 0xc4, 0xc4, 0xad, 0xfb, 0xdc, 0xe8, 0x3a, 0x2c, 0x39, 0x90, 0xae, 0x7a, 0x5e, 0xed, 0x19, 0x29, 0x9d, 0xa1,
+  0xf2, 0xd0, 0x40, 0x7c, 0x2c, 0x0e, 0x1a, 0x19, 0xc2, 0xea, 0xca, 0xe1, 0xe3, 0x75, 0xea, 0xfe, 0x50, 0x1b, 0x91, 0x66,
+  0x55, 0xdd, 0xd3, 0x00, 0xbf, 0x66, 0xcd, 0x18, 0xd9, 0xe2, 0xe8, 0x3c, 0xd9, 0x0d, 0x76, 0xd2, 0x4f, 0xe2, 0x46, 0x77,
+  0xff, 0x40, 0x2f, 0x0d, 0x14, 0xd5, 0x94, 0xb6, 0x0c, 0xb5, 0x84, 0xce, 0xa7, 0xd1, 0x10, 0x02, 0x3c, 0xea, 0x8a, 0x49,
+  0x22, 0xed, 0x58, 0xed, 0x5a, 0xa7, 0x63, 0xee, 0x00, 0xd2, 0xa0, 0xa1, 0x29, 0x5b, 0x21, 0xd1, 0x1f, 0x33, 0x50, 0x84,
+  0x23, 0x38, 0x01, 0xa1, 0x6b, 0x81, 0x42, 0xa1, 0xec, 0x57, 0xfd, 0xee, 0x88, 0x8e, 0x4a, 0x2e, 0x30, 0x90, 0x42, 0xa7,
+  0x8d, 0x79, 0xa6, 0xaa, 0x98, 0xd4, 0x2d, 0xaa, 0x2a, 0xfd, 0x61, 0xaa, 0x22, 0x34, 0x80, 0x17, 0xff, 0xd2, 0x80, 0x30,
+  0x2d, 0xe1, 0x7e, 0x2b, 0x29, 0xef, 0x14, 0xe6, 0x37, 0x0d, 0x4e, 0x52, 0xba, 0x28, 0x94, 0xea, 0xf7, 0x8c, 0xc6, 0x53,
+  0x7b, 0x18, 0x67, 0x07, 0xd5, 0x90, 0xee, 0x30, 0x40, 0xc6, 0x47, 0x87, 0x16, 0x0f, 0xfe, 0x5e, 0x04, 0x0f, 0x6a, 0x80,
+  0x0e, 0x61, 0x2e, 0x4b, 0xc8, 0xae, 0x86, 0xf9, 0x6d, 0x8b, 0x8e, 0xbf, 0x16, 0x41, 0x08, 0xfb, 0x15, 0x64, 0x94, 0xf1,
+  0x7d, 0x98, 0xe4, 0xab, 0x16, 0x1f, 0x7f, 0x2d, 0x82, 0xaf, 0x07, 0x90, 0x95, 0xd8, 0xd6, 0x1c, 0x6c, 0x6b, 0x0b, 0x63,
+  0x5b, 0x73, 0x27, 0xdf, 0xae, 0xb9, 0x6d, 0x32, 0x33, 0xf8, 0x54, 0x80, 0x24, 0x33, 0xb2, 0x10, 0x82, 0xec, 0xae, 0x67,
+  0x69, 0x41, 0x0a, 0x52, 0x43, 0x7b, 0x22, 0xa5, 0x0d, 0xe7, 0xec, 0xee, 0x6d, 0xd2, 0xd4, 0x3a, 0x35, 0x30, 0x31, 0x08,
+  0x56, 0xe0, 0xe4, 0x36, 0x25, 0x7a, 0x95, 0x6c, 0xb1, 0x9b, 0x04, 0xd3, 0x53, 0x31, 0x28, 0xd6, 0xcc, 0xa6, 0x0a, 0xc8,
+  0x04, 0xd1, 0x1a, 0xd5, 0xbf, 0xb2, 0xe9, 0xdd, 0xe2, 0xd9, 0x8e, 0x32, 0x38, 0x64, 0x58, 0x34, 0xfa, 0xdb, 0x1d, 0x60,
+  0x83, 0x81, 0xb3, 0x69, 0x54, 0x47, 0x69, 0x3a, 0xc0, 0xa4, 0x76, 0x9a, 0x1d, 0x38, 0x4d, 0x63, 0x5b, 0xa1, 0x45, 0xa9,
+  0xbf, 0x0d, 0x4a, 0xb5, 0x1f, 0xb9, 0x98, 0x4b, 0x16, 0xc6, 0xb7, 0xce, 0xac, 0xd8, 0x21, 0xd2, 0xce, 0xb5, 0x0a, 0xab,
+  0xfd, 0x9c, 0x83, 0x54, 0x03, 0x09, 0x9c, 0xab, 0x6b, 0x02, 0xa7, 0xb2, 0x25, 0x2b, 0x94, 0xe6, 0x6b, 0x0e, 0x46, 0xcf,
+  0x68, 0xee, 0x32, 0xdb, 0x13, 0xc0, 0xd9, 0xa2, 0xbb, 0x56, 0x77, 0xeb, 0xa7, 0xa2, 0x5b, 0x89, 0x68, 0x83, 0x49, 0x99,
+  0x35, 0x8f, 0x00, 0xe4, 0xcf, 0xa3, 0xf2, 0xf2, 0x52, 0x58, 0xcc, 0x57, 0x65, 0x4f, 0x66, 0x38, 0x87, 0xd9, 0x66, 0xed,
+  0x45, 0xb0, 0x97, 0x47, 0xdb, 0xfd, 0xdb, 0x71, 0xa8, 0x10, 0x3a, 0x29, 0x95, 0x48, 0xfb, 0xe1, 0x00, 0x4e, 0x15, 0xb0,
+  0xf6, 0x86, 0x3c, 0xd6, 0x1f, 0xd8, 0x12, 0x34, 0x95, 0x02, 0x3d, 0x99, 0xeb, 0x76, 0xfe, 0x21, 0x8a, 0xf5, 0x5c, 0xca,
+  0x84, 0x85, 0x90, 0x9f, 0x33, 0x05, 0x7c, 0xdc, 0x18, 0xe7, 0x02, 0x04, 0xf6, 0xab, 0xa1, 0x66, 0xb2, 0x32, 0xc1, 0xa5,
+  0x68, 0x65, 0x12, 0x41, 0x4d, 0xfc, 0x56, 0x72, 0x2d, 0xa5, 0xd9, 0xe1, 0x88, 0x6e, 0x40, 0xda, 0xab, 0xc4, 0xd2, 0x57,
+  0x2c, 0x55, 0x13, 0x34, 0xfb, 0x18, 0x5c, 0x49, 0x35, 0xe7, 0xf5, 0x13, 0x2b, 0x2b, 0x08, 0x75, 0xbe, 0x5b, 0xc3, 0x0a,
+  0xd5, 0xb0, 0xea, 0xd5, 0xf0, 0x41, 0x9a, 0x4a, 0x92, 0xf4, 0xd2, 0x2a, 0x07, 0x47, 0x55, 0xb3, 0xa7, 0xa0, 0xf4, 0x5c,
+  0xb2, 0xc8, 0xfd, 0x31, 0x66, 0x7e, 0x1a, 0x23, 0x34, 0xd9, 0x46, 0x9a, 0xde, 0x71, 0x10, 0x70, 0xb9, 0xe7, 0x58, 0x9f,
+  0x42, 0xcc, 0x89, 0xb6, 0x83, 0x9d, 0xb2, 0x39, 0x56, 0xd4, 0x37, 0x8e, 0xde, 0x2b, 0x68, 0x08, 0xc7, 0x4b, 0x51, 0x95,
+  0xd2, 0xbe, 0xea, 0x65, 0x5a, 0x84, 0xe7, 0xc6, 0x45, 0xaa, 0xfa, 0x67, 0xbe, 0xca, 0xa4, 0x9e, 0x22, 0x23, 0x0f, 0x21,
+  0x53, 0x16, 0xbd, 0x9e, 0x45, 0x14, 0xa9, 0xc4, 0x16, 0xb7, 0x29, 0x02, 0x85, 0x45, 0x30, 0x52, 0xd9, 0x64, 0x18, 0x51,
+  0x32, 0x63, 0x19, 0x9d, 0x56, 0x8d, 0x96, 0xd1, 0xda, 0x9c, 0x19, 0x2d, 0x1c, 0x79, 0x80, 0x12, 0xfd, 0x79, 0x2c, 0x71,
+  0x29, 0x1d, 0x67, 0xb9, 0x45, 0x2c, 0xd3, 0xaa, 0x57, 0x27, 0x62, 0xed, 0x1a, 0x28, 0xe6, 0x59, 0xce, 0xf8, 0x01, 0x83,
+  0x88, 0xf7, 0xa3, 0xbc, 0xf8, 0x24, 0x1b, 0x58, 0xbc, 0x4e, 0xa2, 0x4b, 0x87, 0x84, 0x71, 0x68, 0xf3, 0x51, 0x9c, 0xae,
+  0x0a, 0x57, 0x69, 0xef, 0x64, 0xe0, 0xc5, 0x86, 0x2a, 0x8b, 0x66, 0x49, 0x94, 0x23, 0x87, 0xcf, 0x46, 0x95, 0x38, 0xa7,
+  0x0e, 0x1a, 0xac, 0xf6, 0xf0, 0x25, 0x3e, 0xf2, 0xdd, 0x87, 0x85, 0xd7, 0xa3, 0x00, 0x39, 0x50, 0x53, 0x49, 0xbc, 0x33,
+  0x88, 0x3d, 0x11, 0xaf, 0x8c, 0xd6, 0x00, 0x54, 0x20, 0x2d, 0x29, 0x7e, 0x4a, 0xcb, 0xa1, 0xac, 0xfc, 0xb1, 0x0c, 0x83,
+  0x6c, 0x8b, 0x95, 0xfa, 0x1f, 0x6d, 0x5c, 0xce, 0xa2, 0xde, 0x4e, 0x8a, 0xac, 0x43, 0xcf, 0xa0, 0xc7, 0x70, 0xe4, 0x3d,
+  0xd4, 0x95, 0xba, 0xda, 0x00, 0x56, 0x1c, 0x6d, 0x89, 0xe2, 0x0c, 0x02, 0x81, 0xcf, 0x54, 0x24, 0x92, 0x55, 0x8d, 0x64,
+  0xd5, 0xfa, 0x4d, 0xc6, 0x09, 0x79, 0xf5, 0xe0, 0xc2, 0xa3, 0xdf, 0xed, 0xd1, 0x38, 0xef, 0x37, 0x84, 0x0d, 0x17, 0x32,
+  0xa7, 0x8f, 0xa6, 0x3f, 0x29, 0xc7, 0x5a, 0x74, 0x13, 0x7f, 0x34, 0xfd, 0x0b, 0xfc, 0x77, 0xd7, 0xb8, 0xba, 0x2a, 0xeb,
+  0x2e, 0x02, 0x2a, 0x95, 0x53, 0x19, 0xb4, 0x4d, 0xee, 0x2d, 0xb6, 0x02, 0xdb, 0xfb, 0x0e, 0xf9, 0xa0, 0x3f, 0x9c, 0xbe,
+  0x98, 0xbe, 0x0c, 0xae, 0x6d, 0xad, 0x3b, 0x6e, 0xae, 0x2f, 0x00, 0x2b, 0x29, 0xfd, 0xef, 0x43, 0xea, 0x93, 0xe9, 0x0f,
+  0x98, 0xf6, 0x15, 0xa9, 0xb3, 0x9e, 0x07, 0x8d, 0xe9, 0x73, 0x72, 0xed, 0x7d, 0x8e, 0xf5, 0xa0, 0xbb, 0x2b, 0xa9, 0xba,
+  0x94, 0x57, 0xfd, 0x32, 0x29, 0xb9, 0x5e, 0x22, 0x60, 0xb3, 0xcd, 0xba, 0x23, 0x53, 0xc7, 0x79, 0xb7, 0x0e, 0x0f, 0xbd,
+  0xf2, 0x3f, 0xf3, 0xdb, 0x5b, 0x27, 0x98, 0xc7, 0xd0, 0x9d, 0xfb, 0xeb, 0x8e, 0x2f, 0xf1, 0x23, 0xd6, 0xab, 0xd9, 0x51,
+  0xa0, 0x8a, 0x1e, 0xa0, 0xbd, 0xe2, 0x01, 0x60, 0x7e, 0x3e, 0xfd, 0x06, 0x5a, 0x7a, 0x0f, 0x5b, 0x1a, 0xd8, 0x06, 0x3f,
+  0xa7, 0x4a, 0x9e, 0x35, 0x83, 0x9f, 0xff, 0x78, 0x3f, 0x60, 0x6f, 0x65, 0x1c, 0xbb, 0x97, 0xa8, 0x12, 0x7e, 0x46, 0x2e,
+  0x6d, 0x3f, 0xb0, 0x2f, 0xee, 0xb5, 0xad, 0x80, 0xda, 0x09, 0x4d, 0x0f, 0xf0, 0xf7, 0xb7, 0x00, 0xf5, 0x7d, 0xdb, 0x90,
+  0x95, 0x19, 0x45, 0xa4, 0x44, 0xa7, 0xb5, 0x3f, 0xb1, 0xf7, 0xf3, 0x63, 0x8c, 0x0c, 0xc3, 0xfe, 0xc1, 0x4f, 0xa4, 0x57,
+  0x34, 0xe1, 0x3e, 0x1f, 0x90, 0xe6, 0xf9, 0x01, 0xcd, 0xd1, 0x77, 0x27, 0x74, 0xa7, 0x15, 0xc8, 0x51, 0x7a, 0x46, 0x93,
+  0xf0, 0xd8, 0x29, 0xa3, 0x27, 0x06, 0x7e, 0xa0, 0x1b, 0xd9, 0x73, 0xf4, 0x29, 0xd3, 0x63, 0xd1, 0x80, 0x19, 0x82, 0x9e,
+  0x2a, 0x07, 0xd1, 0x16, 0x5f, 0x7a, 0x78, 0xac, 0x08, 0x4b, 0x0d, 0xcb, 0x32, 0xc1, 0x7e, 0xd7, 0x6c, 0x73, 0x84, 0x31,
+  0xd1, 0x1d, 0x4b, 0xe9, 0x40, 0x2c, 0xca, 0x53, 0xef, 0xca, 0xd6, 0xa7, 0xeb, 0x4e, 0x93, 0x9e, 0xb2, 0xaa, 0x50, 0x4f,
+  0xe8, 0x8f, 0x44, 0x89, 0x00, 0xc5, 0xd3, 0xaf, 0x4a, 0x5d, 0xba, 0xfc, 0xd1, 0xa5, 0x05, 0x8a, 0x21, 0x58, 0x99, 0x02,
+  0x68, 0x18, 0xef, 0x01, 0xc8, 0x03, 0x72, 0xa6, 0x9e, 0x89, 0xe5, 0x2e, 0xb9, 0xdd, 0xbd, 0x70, 0x06, 0x47, 0x91, 0x15,
+  0x4f, 0xb8, 0xb8, 0x9c, 0xf1, 0x90, 0xfa, 0xfe, 0xe7, 0xc0, 0xf6, 0x6a, 0x19, 0x2b, 0xc7, 0x99, 0xb9, 0x3b, 0xfd, 0x1a,
+  0x61, 0x7e, 0x62, 0x6c, 0xd4, 0x1c, 0x5f, 0x3f, 0xcb, 0xcd, 0x1b, 0x86, 0xa3, 0x46, 0x83, 0xe3, 0x93, 0x69, 0xc7, 0xac,
+  0x42, 0xfb, 0xf4, 0x34, 0x45, 0x58, 0x86, 0x52, 0xcc, 0x36, 0x8c, 0x10, 0xcc, 0x27, 0x6e, 0x62, 0x65, 0x32, 0x80, 0x18,
+  0xb0, 0x7e, 0x3f, 0x78, 0x5e, 0x9d, 0x82, 0xe7, 0xb1, 0x67, 0x5f, 0xdd, 0xde, 0x2d, 0xa4, 0x6f, 0xde, 0x2c, 0x36, 0x6a,
+  0x55, 0x87, 0xf8, 0x4a, 0xaf, 0x04, 0x7b, 0x6f, 0xb4, 0x22, 0x96, 0x1c, 0x6c, 0x8a, 0x59, 0x94, 0xf7, 0xd9, 0x73, 0xe7,
+  0x4a, 0xac, 0xee, 0x3d, 0x70, 0xf3, 0xa4, 0x85, 0xb2, 0xba, 0x85, 0xca, 0x7a, 0x39, 0x80, 0x72, 0x9b, 0xab, 0x75, 0x13,
+  0x4a, 0x95, 0x94, 0x0e, 0x4b, 0xf4, 0x93, 0x63, 0x50, 0xb9, 0xee, 0x41, 0xb2, 0x49, 0xd5, 0xae, 0x1f, 0x75, 0xab, 0x50,
+  0x57, 0x5c, 0x46, 0xf9, 0xb3, 0x94, 0xfc, 0x37, 0xd4, 0xfd, 0x4f, 0x1d, 0xbc, 0x6b, 0x76, 0x0f, 0x59, 0x89, 0xe7, 0x0d,
+  0x7d, 0x51, 0xdd, 0xad, 0x82, 0xe4, 0x08, 0x3d, 0xec, 0xf8, 0x85, 0xaa, 0x6b, 0x6a, 0x40, 0xe5, 0x7d, 0xd2, 0xea, 0x71,
+  0x2f, 0xb9, 0x34, 0x3a, 0xfd, 0x96, 0xa8, 0x8f, 0xbd, 0x20, 0xcf, 0x33, 0x6b, 0xf2, 0x01, 0xe7, 0xf6, 0x78, 0x5b, 0x99,
+  0x94, 0xcb, 0x33, 0xaa, 0x32, 0x66, 0xcc, 0xa9, 0xca, 0x9d, 0x33, 0x9d, 0x3c, 0x78, 0xda, 0xbc, 0x6d, 0x5d, 0xbc, 0x8c,
+  0x0d, 0xdb, 0x64, 0xa9, 0xcb, 0xf7, 0xb3, 0x4d, 0xfa, 0x3a, 0xaf, 0xec, 0xc8, 0xe2, 0x5e, 0x78, 0xf6, 0xca, 0xdf, 0xb8,
+  0x59, 0x2e, 0x79, 0xe3, 0xe6, 0xdc, 0xe1, 0xd0, 0x16, 0x4a, 0x9f, 0x06, 0xb2, 0xea, 0x61, 0x50, 0x06, 0x4b, 0xa0, 0xed,
+  0x61, 0x5c, 0x6c, 0x9e, 0x59, 0xb1, 0xf4, 0xa0, 0x72, 0xf0, 0x06, 0xbf, 0x6e, 0x83, 0xc6, 0x9d, 0xb5, 0xc9, 0x2a, 0xc8,
+  0xdd, 0xae, 0xe8, 0x81, 0x86, 0x3b, 0xa1, 0xa9, 0x1f, 0x86, 0x79, 0x7f, 0x2f, 0x0d, 0xb3, 0x9e, 0xb9, 0xbb, 0xcb, 0x35,
+  0x63, 0xa0, 0xeb, 0x36, 0xc6, 0xb7, 0x6e, 0x9a, 0xb9, 0xa4, 0x24, 0x8a, 0x72, 0x8d, 0x24, 0x4a, 0xaa, 0x55, 0x6b, 0x63,
+  0xf2, 0x4a, 0x19, 0x08, 0xd9, 0xfd, 0x5e, 0x75, 0xe0, 0xce, 0x9e, 0x6e, 0x42, 0x27, 0x8f, 0x93, 0x6e, 0xb4, 0x79, 0xfa,
+  0x58, 0x20, 0xbb, 0x43, 0xa6, 0x1a, 0x72, 0x80, 0x23, 0x2e, 0x64, 0xdb, 0xdb, 0xfb, 0xab, 0x2e, 0x6e, 0x11, 0xe5, 0xb0,
+  0xdc, 0x35, 0x71, 0x66, 0xf0, 0x87, 0x66, 0xc6, 0x70, 0xa9, 0x12, 0xe5, 0x41, 0xd7, 0xde, 0x99, 0xae, 0xc2, 0x54, 0xf6,
+  0x52, 0x1b, 0x12, 0x7a, 0xae, 0xa9, 0xb1, 0x47, 0x2b, 0xba, 0xe9, 0xaf, 0xef, 0x9e, 0xba, 0x03, 0x32, 0x63, 0x55, 0xab,
+  0x52, 0xfa, 0x6a, 0x52, 0x4f, 0xb1, 0xdc, 0x66, 0xe0, 0x31, 0xe0, 0x9e, 0xe3, 0x44, 0xa9, 0xbf, 0xc8, 0xa9, 0xd1, 0xd4,
+  0xeb, 0x73, 0xda, 0x05, 0xf9, 0x92, 0xc6, 0xa8, 0x56, 0x70, 0xb3, 0x8a, 0x57, 0xd8, 0xec, 0x0a, 0x0e, 0x60, 0x33, 0x7f,
+  0xad, 0xc5, 0xaf, 0x9a, 0xa4, 0x56, 0x9b, 0x95, 0xff, 0x6f, 0x47, 0x23, 0xba, 0xce, 0xa0, 0x73, 0x30, 0x0e, 0x2b, 0x2a,
+  0x36, 0x31, 0x18, 0xfc, 0x7a, 0xe0, 0x2c, 0xd1, 0x8e, 0x5c, 0x8e, 0xc6, 0x05, 0x87, 0x92, 0x36, 0x09, 0x0f, 0x6e, 0xa9,
+  0x5d, 0x8c, 0x34, 0x62, 0x90, 0xc9, 0xf5, 0xab, 0x23, 0xd1, 0x9d, 0x59, 0xa9, 0x58, 0xfb, 0xc7, 0x41, 0x7a, 0x5b, 0xc7,
+  0xc6, 0xe7, 0x42, 0x13, 0x9f, 0x1b, 0xb0, 0xff, 0x82, 0xed, 0x0a, 0x1c, 0xef, 0xec, 0x14, 0x6d, 0x15, 0xa1, 0x9a, 0x25,
+  0xce, 0xd8, 0xa8, 0xb1, 0x9f, 0x06, 0xa4, 0x9f, 0x23, 0xa2, 0xfb, 0x80, 0x4c, 0x78, 0x3c, 0x3b, 0xce, 0xda, 0x33, 0x46,
+  0x99, 0x9e, 0x5a, 0x88, 0xd5, 0x37, 0xc0, 0x48, 0x4f, 0x9a, 0x37, 0x92, 0xa8, 0xc8, 0x2b, 0x1d, 0xa7, 0x8a, 0x57, 0xb2,
+  0x9a, 0x33, 0x1a, 0x34, 0xef, 0xc0, 0x8f, 0xd7, 0xb3, 0x91, 0x3b, 0x77, 0x75, 0x1f, 0xa8, 0xeb, 0x73, 0x28, 0xb2, 0xbd,
+  0xba, 0x07, 0x46, 0x82, 0x0e, 0x18, 0x6e, 0xcf, 0x7e, 0xb1, 0x45, 0x1c, 0xd7, 0x03, 0xda, 0xff, 0xda, 0xfc, 0xee, 0x01,
+  0xca, 0xbf, 0xff, 0xfc, 0xfd, 0x7d, 0x76, 0xf3, 0x81, 0x1f, 0x5f, 0xd9, 0xeb, 0x9d, 0x79, 0x1e, 0x0b, 0x73, 0x66, 0x9b,
+  0xbe, 0x61, 0x64, 0x96, 0x56, 0x45, 0x44, 0xe4, 0x9c, 0x04, 0x35, 0xca, 0x3a, 0x1b, 0x2c, 0xbd, 0xf3, 0x8e, 0xf2, 0x1a,
+  0xfa, 0x5a, 0x1b, 0xd8, 0x75, 0xce, 0x99, 0xdf, 0xaa, 0x53, 0xd9, 0x23, 0x3a, 0x06, 0xd0, 0x51, 0x4a, 0x3b, 0xa0, 0xa2,
+  0x40, 0xfa, 0x8b, 0x7c, 0x10, 0xb1, 0x4b, 0xe8, 0xf0, 0x91, 0xb0, 0x71, 0x05, 0xcf, 0xa5, 0x0d, 0xc0, 0x4a, 0x13, 0xf1,
+  0x13, 0x88, 0xff, 0xf3, 0x5c, 0x3f, 0xe4, 0x38, 0x90, 0x58, 0xfc, 0x25, 0x34, 0x4e, 0x35, 0xed, 0x47, 0x9a, 0xb7, 0x87,
+  0xd0, 0x38, 0xf2, 0x03, 0x53, 0xa7, 0x8a, 0x6f, 0x40, 0xd0, 0x86, 0x6d, 0x22, 0x3e, 0x38, 0xd1, 0xb2, 0x5d, 0x32, 0x69,
+  0x9b, 0xdb, 0xd0, 0xaf, 0x6b, 0xd6, 0xc6, 0x27, 0x2c, 0x3e, 0xd5, 0x6f, 0x5a, 0x34, 0x44, 0x7f, 0x61, 0xfb, 0x38, 0x75,
+  0x4a, 0xf7, 0xa5, 0x65, 0x27, 0x0d, 0xf6, 0x27, 0x5a, 0x3a, 0x2d, 0x13, 0xe7, 0xa5, 0xbd, 0x67, 0x0b, 0x35, 0x9b, 0x8b,
+  0xb8, 0xa8, 0xe4, 0x69, 0x56, 0x94, 0xd6, 0x99, 0xb2, 0x72, 0x56, 0xac, 0x9e, 0x5a, 0x87, 0x17, 0x8f, 0x76, 0x19, 0xc2,
+  0xe2, 0x8d, 0x46, 0xd8, 0x0a, 0xf6, 0xa8, 0x0b, 0x3a, 0x6c, 0xe5, 0x5e, 0x87, 0x29, 0xaa, 0xd3, 0x09, 0x96, 0xde, 0x7b,
+  0xef, 0x3d, 0x5a, 0x74, 0xfc, 0x63, 0xc9, 0xc0, 0x84, 0xb3, 0x60, 0x9a, 0x35, 0x56, 0xec, 0x95, 0x24, 0x8b, 0xbc, 0x1b,
+  0x26, 0xa6, 0xad, 0x4d, 0xb9, 0x37, 0x63, 0xce, 0x07, 0x05, 0x45, 0xc0, 0x85, 0xb3, 0x12, 0x9e, 0x52, 0x9f, 0xe3, 0xfd,
+  0x75, 0xe8, 0xec, 0x69, 0x9b, 0xd9, 0x44, 0xe3, 0xa2, 0xbe, 0x2e, 0x58, 0x16, 0x22, 0x48, 0x36, 0xec, 0x55, 0x0b, 0x52,
+  0xe8, 0xc2, 0xbc, 0x8c, 0x78, 0x3a, 0x0c, 0xb5, 0x89, 0x06, 0x26, 0x92, 0x10, 0x54, 0x94, 0x65, 0x8c, 0xf2, 0xa2, 0xd8,
+  0x10, 0x43, 0x18, 0x2b, 0x4f, 0xde, 0x31, 0xfa, 0x23, 0x8f, 0xab, 0x39, 0x43, 0xcf, 0xa5, 0x4c, 0x21, 0xeb, 0x23, 0x6e,
+  0x45, 0x3b, 0x15, 0x3a, 0xde, 0x6b, 0x11, 0x89, 0xb8, 0xe6, 0x49, 0x00, 0x0c, 0xfa, 0xde, 0x92, 0x21, 0xca, 0xdf, 0x5a,
+  0xd1, 0x31, 0xca, 0xe7, 0xd5, 0x9e, 0x75, 0x9c, 0x9a, 0xcb, 0x42, 0xab, 0x82, 0x23, 0x99, 0x8f, 0xdf, 0xfd, 0xc0, 0x81,
+  0x46, 0xed, 0xc0, 0xf3, 0xe9, 0x7d, 0x19, 0xe8, 0xc0, 0x17, 0x71, 0xaa, 0x67, 0x48, 0x15, 0x9c, 0x37, 0x41, 0xc6, 0xe4,
+  0x5e, 0xbe, 0xa1, 0x11, 0xde, 0x89, 0x7a, 0xb6, 0xe9, 0x51, 0xd5, 0xd6, 0x90, 0x23, 0xcc, 0xec, 0xcd, 0x41, 0xdf, 0xd1,
+  0x29, 0x54, 0x68, 0x7f, 0xea, 0x7e, 0x2e, 0xc3, 0x6c, 0xfd, 0xfa, 0x5b, 0x87, 0xbc, 0x70, 0xcd, 0x87, 0x7c, 0x75, 0x54,
+  0xe7, 0x8f, 0x5f, 0xe0, 0xcb, 0xf7, 0xeb, 0xee, 0x24, 0xaf, 0xcd, 0xa9, 0x5f, 0x8f, 0x43, 0xab, 0x8b, 0xa5, 0x28, 0x50,
+  0x3f, 0xa4, 0xb1, 0xa0, 0x10, 0x0c, 0xf7, 0x61, 0x83, 0x45, 0x7e, 0xfc, 0xb0, 0x2e, 0xaf, 0x1c, 0xfd, 0xcd, 0xfc, 0x8c,
+  0x98, 0xf1, 0x68, 0x6f, 0x23, 0xa2, 0x07, 0x52, 0x5c, 0x64, 0xc3, 0xc6, 0x2e, 0xb4, 0x8b, 0xd5, 0x81, 0xcf, 0x59, 0x07,
+  0x57, 0xd7, 0x3d, 0x9f, 0xd4, 0x51, 0x11, 0x76, 0x5f, 0xce, 0xf0, 0x7d, 0x39, 0xc7, 0x9d, 0xdd, 0xa6, 0xa5, 0x40, 0xe6,
+  0x3c, 0xee, 0x3b, 0x0c, 0x62, 0x65, 0xc3, 0xec, 0x1e, 0x44, 0x05, 0xad, 0x6d, 0x7e, 0xac, 0x48, 0x0d, 0xee, 0x44, 0xac,
+  0xbf, 0xa7, 0xdc, 0xbb, 0xba, 0xb3, 0x60, 0x75, 0xe6, 0x13, 0x3a, 0x99, 0x54, 0x2c, 0xce, 0x1a, 0x6a, 0x71, 0xdc, 0x25,
+  0x34, 0xcf, 0x3b, 0xaa, 0x5a, 0x0b, 0xe4, 0x95, 0xf7, 0x4f, 0xa3, 0x51, 0x3e, 0x8f, 0x8d, 0x62, 0x59, 0x7b, 0xf9, 0xa4,
+  0xbc, 0x9a, 0xcb, 0xfc, 0xc7, 0x85, 0x39, 0x26, 0x5a, 0xe7, 0x87, 0x93, 0xfc, 0xed, 0xcc, 0xdd, 0x43, 0x71, 0xc8, 0xf4,
+  0x1b, 0x50, 0xf8, 0xfa, 0x93, 0x7a, 0xfa, 0xa9, 0x29, 0x3c, 0xc8, 0x14, 0x28, 0x0b, 0xc3, 0xf4, 0x86, 0x14, 0x8b, 0xc3,
+  0x7e, 0xd1, 0x75, 0x13, 0x36, 0xc6, 0x6c, 0xba, 0xea, 0x19, 0x29, 0xb5, 0xf7, 0xca, 0x9d, 0x57, 0x69, 0x3f, 0x98, 0xf3,
+  0x99, 0x3a, 0xc8, 0x72, 0xc0, 0x98, 0xf1, 0x2a, 0x16, 0xd3, 0x09, 0x86, 0x4d, 0x20, 0xe2, 0xa1, 0x0b, 0x59, 0x3a, 0x4d,
+  0xdd, 0xef, 0x2c, 0xe3, 0x50, 0x37, 0x90, 0xea, 0xc2, 0xac, 0x6b, 0xf2, 0xd0, 0x86, 0xaf, 0x4c, 0x34, 0x5e, 0x5a, 0x95,
+  0x4d, 0xdf, 0x80, 0xa8, 0xd7, 0xa9, 0xcc, 0x7d, 0xba, 0x72, 0x46, 0x05, 0x5b, 0xae, 0x86, 0x73, 0xc3, 0xd6, 0xd7, 0xad,
+  0x48, 0x54, 0xb7, 0x97, 0x0a, 0xd0, 0x88, 0x8d, 0xad, 0xe2, 0xfb, 0x03, 0x34, 0xbe, 0x1b, 0x26, 0xc4, 0x5a, 0x9e, 0x7f,
+  0xac, 0x9d, 0x86, 0x9c, 0x2e, 0x08, 0xc7, 0x21, 0x05, 0xd4, 0xd4, 0xd0, 0x95, 0x7e, 0x43, 0x54, 0x81, 0xe7, 0x3b, 0xa4,
+  0x63, 0x17, 0xf2, 0x6c, 0xcb, 0x1a, 0x34, 0x6a, 0xca, 0x6b, 0x32, 0x48, 0xf9, 0xf5, 0x28, 0x75, 0x47, 0xd8, 0x7b, 0x67,
+  0x8a, 0x8e, 0xea, 0xba, 0x46, 0xbe, 0xd1, 0xb8, 0xc8, 0x84, 0xec, 0x03, 0x6b, 0xa6, 0x85, 0x67, 0x22, 0xf9, 0xce, 0x98,
+  0x92, 0xea, 0x81, 0x36, 0xc5, 0x27, 0x2d, 0x0e, 0x2e, 0xed, 0x06, 0x4e, 0xcb, 0x23, 0xbb, 0x06, 0xd8, 0x37, 0x3f, 0xe9,
+  0x46, 0x03, 0x4c, 0x53, 0x28, 0x3e, 0x25, 0xd1, 0x45, 0x98, 0x67, 0xcb, 0xcb, 0xe0, 0x95, 0x9f, 0x52, 0xfb, 0xe5, 0x23,
+  0x5c, 0x76, 0xf2, 0x9a, 0xd5, 0x70, 0xc3, 0x6a, 0x0e, 0x8d, 0xe2, 0xee, 0xd0, 0x03, 0xd2, 0x26, 0x0f, 0xcb, 0x72, 0x0f,
+  0xdb, 0x8c, 0x4e, 0x0a, 0x80, 0x74, 0xdb, 0xad, 0x6d, 0x9e, 0x63, 0x6b, 0x52, 0xd0, 0xae, 0xec, 0x32, 0x90, 0x70, 0x76,
+  0x87, 0xbc, 0x67, 0x6d, 0x96, 0x06, 0x36, 0x8f, 0xc1, 0xcd, 0x28, 0xe1, 0xe5, 0xeb, 0x62, 0x85, 0x80, 0xd6, 0x44, 0xa4,
+  0x53, 0xe5, 0x3c, 0xc8, 0x3e, 0x88, 0xb7, 0x90, 0xcc, 0x90, 0x38, 0x57, 0xeb, 0xe2, 0x91, 0x88, 0x3d, 0x1e, 0xe2, 0x96,
+  0x71, 0x79, 0x64, 0xcd, 0x7b, 0xfa, 0x3a, 0xa9, 0x0d, 0x3e, 0xc9, 0x51, 0x90, 0x35, 0x20, 0xbe, 0x8e, 0x64, 0x0a, 0x91,
+  0xb1, 0xb0, 0x4d, 0xff, 0xd4, 0x7d, 0xbf, 0x47, 0x8a, 0xf4, 0x2b, 0x21, 0x2b, 0x2e, 0xfd, 0xb9, 0x25, 0xd8, 0x5e, 0xdf,
+  0xb6, 0x70, 0x19, 0x99, 0x79, 0x77, 0xf1, 0x81, 0xc2, 0xf5, 0xe5, 0xe5, 0xd3, 0xc7, 0x1a, 0xdd, 0x64, 0xd9, 0x06, 0xd3,
+  0x2f, 0x7b, 0x55, 0xa2, 0x27, 0x72, 0x69, 0xf6, 0xb9, 0xa8, 0x8e, 0x79, 0x33, 0x9b, 0xb6, 0x9d, 0x60, 0x08, 0xa7, 0x7d,
+  0x26, 0x6a, 0x23, 0x21, 0x14, 0x89, 0x97, 0x6f, 0xd6, 0x99, 0xf7, 0xc0, 0xd2, 0xb9, 0xa2, 0x14, 0xb0, 0xd0, 0x7d, 0xa7,
+  0x88, 0xb2, 0x25, 0xf0, 0x9b, 0xb0, 0x3a, 0x55, 0xf0, 0xba, 0x39, 0x73, 0x0c, 0xbb, 0x11, 0xad, 0x22, 0xdb, 0xb1, 0x56,
+  0x4d, 0x60, 0x69, 0xd5, 0x2c, 0xfe, 0x56, 0xcd, 0xd0, 0xb0, 0x5e, 0xa2, 0x35, 0x94, 0xa0, 0xb6, 0xa3, 0x28, 0xd9, 0x46,
+  0x0f, 0x3f, 0x5a, 0xab, 0x35, 0x43, 0xb5, 0xe6, 0x89, 0x46, 0x87, 0x28, 0x75, 0x6a, 0x9c, 0x5c, 0x1c, 0xc4, 0x07, 0xfd,
+  0xc2, 0x45, 0xd5, 0xd7, 0x0f, 0x1d, 0x32, 0xd0, 0xc4, 0x6a, 0xca, 0x50, 0xb7, 0xf3, 0x49, 0x2c, 0xfc, 0xb0, 0x17, 0x5d,
+  0x84, 0x7c, 0xdd, 0xcb, 0x34, 0xdd, 0x17, 0xc4, 0x51, 0xaa, 0x84, 0x1a, 0x65, 0xa0, 0x92, 0x15, 0xe5, 0x26, 0xdd, 0x8d,
+  0xe2, 0x41, 0x03, 0x16, 0x8a, 0x18, 0xe2, 0x25, 0x31, 0x03, 0x26, 0x3c, 0xa3, 0x59, 0x67, 0xb2, 0x0b, 0x4c, 0xab, 0x8c,
+  0x5c, 0xf2, 0x01, 0x17, 0x46, 0x43, 0xa8, 0xb7, 0x0a, 0x80, 0x38, 0xe8, 0x3e, 0x3d, 0xfc, 0x75, 0x37, 0xb4, 0x9a, 0x6e,
+  0xe6, 0xd9, 0x60, 0xa5, 0xd6, 0xa1, 0x40, 0x48, 0x36, 0x56, 0x1a, 0x8a, 0x59, 0xc2, 0x4e, 0xf7, 0x8c, 0xb4, 0x21, 0x64,
+  0xa5, 0x45, 0xbb, 0xe8, 0x9f, 0xd8, 0x84, 0x7a, 0xf9, 0x7a, 0x40, 0x36, 0xbc, 0xaf, 0xd0, 0x8c, 0x79, 0x8f, 0x4c, 0xb7,
+  0x5f, 0xc1, 0xfe, 0xaf, 0xf0, 0x4e, 0x50, 0xf0, 0x7d, 0xca, 0x16, 0xc0, 0xf6, 0x6e, 0x6d, 0xdd, 0x0f, 0xcc, 0x66, 0x70,
+  0x7a, 0xa8, 0x38, 0x52, 0x1b, 0x2b, 0xe8, 0x80, 0x98, 0x9b, 0x48, 0xd1, 0xde, 0x56, 0x2c, 0x5a, 0x1e, 0x70, 0xcb, 0xb1,
+  0xed, 0x70, 0xd8, 0xc0, 0x96, 0x37, 0x6c, 0x0b, 0x38, 0x74, 0x10, 0x64, 0xaa, 0xba, 0x14, 0x6a, 0xbb, 0x0e, 0xd2, 0x91,
+  0x26, 0xda, 0x57, 0x25, 0x81, 0x7f, 0x79, 0x3e, 0x7c, 0x12, 0x8f, 0x35, 0x71, 0xd3, 0xc3, 0x58, 0xc5, 0xea, 0xe0, 0xc7,
+  0x2d, 0xd5, 0x8d, 0x03, 0xd5, 0x75, 0xcd, 0x46, 0x99, 0x4e, 0xca, 0x54, 0xc2, 0x0f, 0x5a, 0xda, 0xb7, 0x31, 0x37, 0xec,
+  0xbc, 0xc0, 0x41, 0x11, 0x66, 0xa6, 0x2c, 0x4c, 0x95, 0xe7, 0xcb, 0x17, 0x9d, 0xec, 0x0c, 0x8c, 0xbb, 0xdd, 0x08, 0x64,
+  0x61, 0x6e, 0x5e, 0x3c, 0x72, 0x26, 0x81, 0x82, 0x4c, 0x2e, 0xb0, 0x01, 0x68, 0x38, 0xc8, 0x33, 0x45, 0xaa, 0xd8, 0xff,
+  0x86, 0xdb, 0x6b, 0xee, 0x93, 0x8c, 0xff, 0xa5, 0x23, 0x7c, 0x29, 0x2c, 0x64, 0x4c, 0x71, 0xf6, 0x27, 0x95, 0xd1, 0x14,
+  0xa3, 0x8b, 0x13, 0xb9, 0x05, 0xd3, 0x5f, 0x3a, 0x65, 0xbd, 0x26, 0x2f, 0xe1, 0x4f, 0xcd, 0xc9, 0x24, 0x95, 0xe9, 0xb4,
+  0x4a, 0x6d, 0xcf, 0xdc, 0x13, 0x0a, 0xe9, 0xb4, 0xeb, 0xde, 0x63, 0x6f, 0xef, 0x29, 0x3d, 0x8a, 0x88, 0xe7, 0xa0, 0x2f,
+  0x3a, 0x74, 0x6c, 0x50, 0x07, 0x7f, 0xb0, 0x63, 0xba, 0x33, 0x1f, 0xf3, 0x5d, 0x79, 0x31, 0xc2, 0xc7, 0x9a, 0x0d, 0x69,
+  0xc6, 0x8d, 0x41, 0x2b, 0x46, 0x30, 0xe2, 0x66, 0x82, 0x71, 0x76, 0xcb, 0x77, 0x72, 0xbb, 0x4e, 0x64, 0xa5, 0x9c, 0xc3,
+  0x3f, 0x5d, 0x04, 0x8a, 0x3d, 0xaf, 0x43, 0xf3, 0x51, 0x63, 0x58, 0x2d, 0x7f, 0x5e, 0x78, 0xe8, 0xa9, 0x6e, 0xf7, 0x6e,
+  0x9f, 0xf7, 0x31, 0x40, 0xda, 0xb6, 0x2e, 0x21, 0x23, 0x15, 0x76, 0x75, 0xe0, 0xa3, 0x33, 0x74, 0xc1, 0x4c, 0x97, 0xdc,
+  0x54, 0x41, 0xc7, 0xd5, 0x32, 0x69, 0x54, 0xc7, 0xc7, 0x6c, 0xd7, 0x9d, 0xc6, 0x0b, 0xfb, 0xbd, 0x7c, 0xe6, 0x8b, 0xa7,
+  0x7c, 0xed, 0x84, 0x39, 0x3f, 0x84, 0xfa, 0x0e, 0xd7, 0xe4, 0x7c, 0x5a, 0xe5, 0x90, 0x89, 0x8f, 0x9b, 0x28, 0xa1, 0xea,
+  0xaf, 0xb3, 0x3b, 0xd1, 0xce, 0x3e, 0x73, 0x17, 0x52, 0xe1, 0x75, 0x18, 0xee, 0xac, 0x7d, 0x88, 0x47, 0x46, 0xe1, 0x92,
+  0xeb, 0xd2, 0x9f, 0x7a, 0x8f, 0x6e, 0x4a, 0xbc, 0x86, 0xcb, 0x97, 0x02, 0x2b, 0xa8, 0x64, 0x39, 0xce, 0x46, 0xe0, 0xca,
+  0x22, 0x3c, 0xa7, 0xab, 0xa3, 0xfd, 0x6c, 0x0e, 0xc4, 0x0b, 0xa3, 0x8a, 0x01, 0xb9, 0x5b, 0x04, 0x1c, 0x32, 0x88, 0x11,
+  0x69, 0x19, 0xa0, 0x31, 0x93, 0x9f, 0x7a, 0x7c, 0x97, 0x9f, 0xa4, 0x33, 0x6c, 0x59, 0x4f, 0x8d, 0xc4, 0x63, 0xa6, 0x4e,
+  0x1d, 0x68, 0xd6, 0xde, 0x59, 0x99, 0x8d, 0xdd, 0xec, 0x03, 0x1e, 0x62, 0xcd, 0x56, 0x5a, 0xc1, 0x99, 0x77, 0x74, 0xf0,
+  0x2c, 0xfd, 0x42, 0xae, 0xcd, 0xaa, 0x7c, 0xf4, 0xd7, 0x97, 0xfb, 0x64, 0xec, 0x97, 0x3c, 0xee, 0x39, 0xe4, 0x43, 0x70,
+  0x1d, 0xa1, 0x9a, 0xd7, 0xc1, 0x60, 0xf2, 0xb8, 0x44, 0x37, 0xda, 0xb3, 0xbf, 0x12, 0x81, 0xb6, 0x4b, 0x58, 0x4f, 0x3c,
+  0xef, 0x88, 0xe8, 0xbc, 0x2a, 0xe1, 0xc6, 0xa0, 0xef, 0xf6, 0x43, 0x68, 0xe8, 0xc0, 0x0f, 0x7f, 0x24, 0xd0, 0x6b, 0x25,
+  0x85, 0x13, 0x0b, 0x6e, 0x4f, 0xf5, 0x46, 0x73, 0x2d, 0xbf, 0x90, 0xd4, 0x60, 0xbc, 0x82, 0x70, 0x7c, 0xa2, 0x80, 0x3d,
+  0xca, 0x22, 0x34, 0xf8, 0x01, 0xaa, 0x8e, 0x43, 0x65, 0x62, 0xfc, 0x5e, 0x9d, 0x38, 0x9d, 0x28, 0xb5, 0x93, 0xf9, 0x3b,
+  0xb2, 0xba, 0x96, 0x5a, 0x71, 0x94, 0xa0, 0x69, 0x3b, 0x51, 0x19, 0xa7, 0xa2, 0xd5, 0x18, 0x6d, 0x5c, 0xcb, 0x4c, 0x6d,
+  0x4b, 0xcf, 0x85, 0x3a, 0x09, 0xe3, 0xfb, 0xcb, 0xce, 0xa6, 0x81, 0x0f, 0x90, 0xb2, 0x96, 0x4a, 0x31, 0xc0, 0x86, 0x0c,
+  0x46, 0xec, 0x70, 0x62, 0x74, 0xb5, 0x0f, 0xf5, 0x7d, 0x92, 0x31, 0xb9, 0xe2, 0xca, 0xa4, 0x32, 0x47, 0x77, 0x79, 0xf4,
+  0x22, 0x67, 0x21, 0x7e, 0x3b, 0x77, 0x16, 0xc3, 0xfe, 0x1b, 0xc8, 0x35, 0x44, 0x0a, 0x38, 0xef, 0x9e, 0x7c, 0x23, 0x36,
+  0x8a, 0x5a, 0x85, 0x37, 0xd7, 0xc6, 0x0c, 0xa5, 0x65, 0xd9, 0xf5, 0x04, 0x96, 0x3d, 0x76, 0xdf, 0xc6, 0x8b, 0xd7, 0x6a,
+  0x5b, 0x0a, 0x5a, 0x37, 0xfd, 0x71, 0xfa, 0x83, 0x8e, 0xe2, 0x8a, 0x2e, 0x73, 0x8f, 0xc9, 0x83, 0x4f, 0x85, 0x8b, 0x78,
+  0xc2, 0xd2, 0x74, 0xa7, 0xbe, 0xb8, 0x96, 0x96, 0xea, 0x43, 0xb2, 0x98, 0x54, 0xea, 0x60, 0x51, 0xe3, 0x8f, 0xde, 0x7f,
+  0x3f, 0x18, 0x1d, 0xec, 0x0c, 0xf7, 0xae, 0xfd, 0x10, 0x35, 0xd1, 0x47, 0x1f, 0x23, 0xba, 0x86, 0xf7, 0xd4, 0x71, 0xcd,
+  0xc1, 0xf3, 0x44, 0x45, 0x66, 0x85, 0x14, 0x52, 0xfe, 0x2a, 0x37, 0xd0, 0x6f, 0xd9, 0xbf, 0x50, 0x07, 0x95, 0x85, 0x03,
+  0x44, 0x4b, 0x5a, 0x1a, 0x4c, 0x97, 0x85, 0x36, 0xba, 0x55, 0x11, 0x4f, 0x00, 0x6d, 0xb7, 0x2f, 0xd9, 0x82, 0xcb, 0x06,
+  0x89, 0x6f, 0x95, 0x39, 0xf7, 0xbb, 0xf6, 0x67, 0x09, 0x8d, 0xd6, 0x13, 0xf2, 0x14, 0xfd, 0x53, 0x47, 0xf3, 0x3d, 0x3d,
+  0xbc, 0x48, 0x11, 0x9e, 0xed, 0xdd, 0x8e, 0xfc, 0x3d, 0xaa, 0xe3, 0xe1, 0x82, 0x23, 0xab, 0x06, 0xe3, 0x96, 0x33, 0xb8,
+  0x56, 0xad, 0x4d, 0x93, 0xa8, 0x8c, 0x7b, 0xbf, 0x60, 0xc8, 0x51, 0x0b, 0xad, 0x68, 0x09, 0xbd, 0xef, 0x65, 0xc0, 0x2f,
+  0x73, 0x17, 0x50, 0xfa, 0x49, 0x5b, 0x7f, 0x72, 0x97, 0x31, 0x7b, 0x2f, 0xb8, 0xa8, 0xe8, 0xc2, 0xb2, 0xa4, 0x76, 0x19,
+  0x9f, 0x5b, 0x8e, 0x2f, 0xfc, 0x39, 0xe5, 0xf4, 0x1d, 0x40, 0x59, 0x8e, 0xae, 0xff, 0x35, 0xbd, 0xbb, 0x85, 0xaa, 0x2c,
+  0x09, 0x98, 0xe6, 0x5a, 0xa0, 0xb6, 0x87, 0xf5, 0xd8, 0xcf, 0x43, 0x59, 0xf7, 0xd6, 0xe9, 0xb9, 0x4d, 0xee, 0x49, 0x0b,
+  0x1a, 0xbb, 0x6e, 0xec, 0x0b, 0xaa, 0xe1, 0xc0, 0xbf, 0x00, 0x05, 0x26, 0x13, 0xf2, 0x09, 0xfe, 0xa3, 0xdf, 0xf5, 0xc2,
+  0xab, 0x85, 0x66, 0x90, 0xa4, 0xfc, 0x6b, 0x6f, 0x17, 0xce, 0xed, 0xa3, 0xbe, 0x0e, 0xe8, 0x95, 0xfb, 0xe8, 0xf0, 0x84,
+  0x72, 0xea, 0xd6, 0x9f, 0x57, 0x8c, 0x6f, 0x0d, 0xce, 0x2d, 0x48, 0xd7, 0xfb, 0xbc, 0x62, 0x7c, 0x39, 0xf0, 0xa4, 0x62,
+  0x6b, 0x15, 0xc5, 0xd6, 0x66, 0x16, 0xe3, 0x17, 0xaf, 0xcd, 0x6d, 0x68, 0x3c, 0x95, 0x61, 0x54, 0x62, 0x9b, 0xa2, 0x7a,
+  0xee, 0x27, 0x73, 0xc7, 0x48, 0xef, 0xae, 0xe9, 0x97, 0x1c, 0x9c, 0x71, 0xa1, 0x7d, 0x4d, 0xd6, 0x42, 0x3c, 0xe5, 0x2b,
+  0x27, 0xe8, 0xa0, 0x71, 0xf9, 0xfa, 0xf2, 0x47, 0x8c, 0x68, 0x79, 0x9b, 0x4b, 0xba, 0x32, 0x36, 0x39, 0xe8, 0x60, 0x97,
+  0xf1, 0x36, 0x83, 0xad, 0x05, 0x93, 0x64, 0x1d, 0x1f, 0x5e, 0xdb, 0x0e, 0x56, 0x55, 0x84, 0x52, 0x1d, 0x81, 0xb7, 0x0a,
+  0xcf, 0x5a, 0x19, 0xcf, 0x9a, 0x8f, 0x67, 0x6d, 0x1e, 0x1e, 0x24, 0x3e, 0x6d, 0x56, 0xc6, 0x1d, 0x4c, 0x5d, 0x94, 0x24,
+  0x85, 0x57, 0x3c, 0x6a, 0xd5, 0xd4, 0xa8, 0xb4, 0x6a, 0x3c, 0x0e, 0xad, 0x1a, 0xb6, 0x74, 0x9d, 0x67, 0x8d, 0xee, 0x30,
+  0xa8, 0xc3, 0x12, 0x65, 0xac, 0xad, 0xf3, 0xbc, 0xb8, 0x19, 0xe2, 0x01, 0xa6, 0xf2, 0x5d, 0x4b, 0x37, 0xb4, 0xe8, 0xec,
+  0x4b, 0x97, 0x5a, 0x4a, 0x51, 0xf7, 0x2b, 0xb7, 0x12, 0x2a, 0xed, 0x5f, 0xba, 0xec, 0xe8, 0x2b, 0x39, 0xe5, 0xcb, 0x9d,
+  0xde, 0x72, 0xb7, 0x77, 0x29, 0x5d, 0x7a, 0xd1, 0xcf, 0xc3, 0xd8, 0x8a, 0xf4, 0x2e, 0xe5, 0xde, 0xd3, 0x0c, 0x9c, 0x81,
+  0x0b, 0x47, 0x6d, 0x21, 0x48, 0xa2, 0x28, 0x23, 0x1e, 0xad, 0xb4, 0x05, 0xf5, 0x25, 0x7b, 0xed, 0x6b, 0xe0, 0x23, 0x76,
+  0xf3, 0x83, 0xf7, 0xf1, 0x49, 0xc1, 0x63, 0x61, 0xca, 0x67, 0x81, 0xe0, 0x65, 0x60, 0x62, 0x95, 0x3f, 0x24, 0x6b, 0xf4,
+  0x3d, 0x7e, 0xa0, 0xc0, 0xf8, 0xa5, 0x3f, 0x06, 0xee, 0xfa, 0x90, 0x7e, 0xbe, 0x1b, 0xd0, 0x56, 0x81, 0xb2, 0xc3, 0x77,
+  0x73, 0xe6, 0xdd, 0x6d, 0x7e, 0xa9, 0x3d, 0x4e, 0x6f, 0x4e, 0x79, 0xe3, 0x30, 0x73, 0x59, 0x48, 0x01, 0x06, 0x95, 0x61,
+  0xba, 0xd1, 0x8d, 0x19, 0xed, 0xf3, 0x16, 0xca, 0x4c, 0xcf, 0x59, 0xb1, 0x0b, 0x29, 0xbf, 0xf5, 0x16, 0x4d, 0x86, 0xd9,
+  0x80, 0x32, 0xbc, 0x00, 0x87, 0x77, 0xdf, 0xc8, 0x62, 0xfd, 0x94, 0xf6, 0x53, 0x52, 0x83, 0xd0, 0xd6, 0xc8, 0xe1, 0xa6,
+  0x5e, 0x04, 0x74, 0x85, 0x05, 0xc5, 0x9b, 0xc7, 0xb8, 0x4f, 0x91, 0x46, 0x4d, 0x81, 0x6a, 0x22, 0x30, 0x78, 0xfc, 0x07,
+  0xe9, 0xd7, 0xf8, 0x45, 0xfa, 0x8a, 0x63, 0x9c, 0x6d, 0x3e, 0xc3, 0x4b, 0x67, 0xfc, 0x0d, 0x95, 0x56, 0x29, 0x3a, 0x95,
+  0x37, 0xc9, 0x9f, 0x28, 0xd8, 0xfb, 0x8b, 0x0a, 0xdb, 0x70, 0x79, 0x9b, 0xe4, 0x63, 0x94, 0x7e, 0x82, 0x67, 0xf6, 0xae,
+  0x5d, 0x70, 0xe4, 0xda, 0xe3, 0x60, 0x5c, 0x74, 0xd7, 0x65, 0xec, 0x08, 0xf1, 0xbe, 0x8e, 0x52, 0xd5, 0x3a, 0x46, 0xec,
+  0xfb, 0xf4, 0xde, 0x02, 0x59, 0xfd, 0x49, 0x1d, 0x4a, 0xe1, 0x87, 0xfd, 0x0e, 0xe9, 0xe0, 0x15, 0x0b, 0xf6, 0x4f, 0x4b,
+  0x2e, 0xdf, 0x9f, 0x28, 0x04, 0x44, 0xea, 0xfe, 0xab, 0x71, 0xac, 0x37, 0x6f, 0x29, 0x8d, 0xdd, 0xcd, 0x58, 0x06, 0x19,
+  0xf5, 0x57, 0xb5, 0xd2, 0x8e, 0x17, 0x5d, 0xfd, 0x98, 0xda, 0x9c, 0xe0, 0x1d, 0x8a, 0x07, 0x8c, 0xf9, 0xc1, 0x1d, 0x8f,
+  0xbc, 0xf9, 0xf6, 0xcb, 0x0b, 0x24, 0xdc, 0xbb, 0xfa, 0x61, 0x8a, 0x07, 0xea, 0x3d, 0x8a, 0x0a, 0x02, 0x3e, 0x69, 0x1a,
+  0xfe, 0xf5, 0x8c, 0x73, 0xc2, 0xa1, 0xcc, 0xab, 0xa8, 0xc8, 0x71, 0x6a, 0x02, 0xb8, 0xe5, 0x9c, 0xe3, 0x8d, 0x3b, 0xa7,
+  0xa8, 0x35, 0xe3, 0xc4, 0x64, 0x19, 0x16, 0xd6, 0xa8, 0xdc, 0x45, 0xee, 0xd1, 0x9d, 0xa4, 0x67, 0xd5, 0x12, 0xa1, 0x03,
+  0xe9, 0x34, 0xf3, 0x15, 0xba, 0x5e, 0x25, 0x3d, 0x92, 0xf3, 0xb1, 0x2f, 0x3b, 0x7a, 0x21, 0xe9, 0xbd, 0xab, 0xf2, 0xa5,
+  0x3d, 0xc4, 0xde, 0x70, 0x97, 0xc4, 0x26, 0xae, 0xc5, 0x4b, 0x5a, 0x73, 0x2e, 0xc0, 0x6b, 0xe9, 0xa3, 0x9c, 0x23, 0x70,
+  0xbb, 0x77, 0xdc, 0xcd, 0x49, 0xd3, 0xbd, 0x26, 0x2f, 0xaa, 0xb0, 0x7a, 0x42, 0xff, 0x2e, 0xbb, 0x2c, 0x6b, 0x2f, 0xc3,
+  0x8b, 0xa2, 0x7c, 0xd3, 0x7d, 0x46, 0x00, 0x78, 0x79, 0xdd, 0x5d, 0x96, 0x91, 0x25, 0xbc, 0x61, 0x73, 0xae, 0xa6, 0x8b,
+  0x71, 0x9b, 0x4d, 0xfa, 0x86, 0x63, 0xf3, 0x43, 0xec, 0x28, 0xc3, 0xda, 0xb1, 0x6f, 0xd9, 0xa1, 0x6e, 0x95, 0x46, 0xa6,
+  0xe5, 0x77, 0xb7, 0xa5, 0xbb, 0xd0, 0x92, 0x2d, 0x9b, 0xf0, 0x03, 0xed, 0xd6, 0xfd, 0xc6, 0xb0, 0xf4, 0x13, 0x39, 0xb2,
+  0xa6, 0xae, 0x5f, 0x8d, 0x4d, 0xcb, 0x27, 0xcf, 0xd9, 0x23, 0x7d, 0x0b, 0xba, 0x96, 0xc5, 0x3d, 0xf7, 0xcd, 0x17, 0x15,
+  0xc9, 0x6a, 0x1e, 0x5f, 0x92, 0x0a, 0xa8, 0x84, 0xa2, 0x65, 0xfb, 0x1c, 0x4e, 0xc6, 0xc0, 0x7a, 0x25, 0x6c, 0x17, 0x92,
+  0xde, 0x4c, 0x5c, 0x69, 0xe2, 0x90, 0x3c, 0x40, 0x9f, 0x53, 0x4f, 0xc5, 0xca, 0x02, 0xf4, 0x74, 0x2c, 0xd9, 0x26, 0xe0,
+  0x97, 0x7d, 0x24, 0xc8, 0xc4, 0xe7, 0x3a, 0x65, 0xa3, 0x6e, 0xa9, 0x5f, 0xef, 0x6f, 0x9a, 0x6e, 0xcf, 0xe3, 0xb0, 0x26,
+  0x14, 0xa4, 0x91, 0xae, 0x95, 0x46, 0x02, 0xc6, 0x78, 0x99, 0xc4, 0x8b, 0x07, 0x25, 0xb1, 0xc1, 0x0d, 0x3a, 0x45, 0x97,
+  0xfc, 0x8e, 0x4d, 0x65, 0x2d, 0xd5, 0x80, 0x16, 0xf6, 0x6c, 0x52, 0x71, 0xf1, 0xdd, 0xf9, 0xae, 0x69, 0x07, 0xda, 0x5a,
+  0xc9, 0x83, 0x36, 0xf4, 0x02, 0x90, 0xa1, 0xc7, 0xec, 0x9e, 0x97, 0xd6, 0xac, 0x39, 0x17, 0xe1, 0xe7, 0xdf, 0x81, 0xb7,
+  0xd3, 0xaa, 0xbc, 0x49, 0xf4, 0x67, 0xb5, 0x57, 0x10, 0xcf, 0x9a, 0x06, 0xa5, 0x0f, 0x07, 0xd0, 0x92, 0x3f, 0x9c, 0xb2,
+  0xa7, 0x7f, 0xae, 0xcf, 0x62, 0x8f, 0xa4, 0xa4, 0xf5, 0xd9, 0xa3, 0x8e, 0x00, 0x21, 0x39, 0x83, 0x09, 0x1f, 0x51, 0xc9,
+  0x88, 0x2a, 0x02, 0x3c, 0x6c, 0xaa, 0x20, 0x5d, 0x7e, 0xa4, 0x08, 0x51, 0xfe, 0x2d, 0x18, 0x18, 0xf8, 0x77, 0xed, 0xed,
+  0x12, 0x22, 0x11, 0xcc, 0x41, 0xe0, 0x91, 0x31, 0x21, 0xe6, 0xa3, 0xb1, 0x01, 0x1c, 0xfe, 0x05, 0x6f, 0x61, 0x9b, 0xe8,
+  0x0b, 0xce, 0x38, 0xba, 0xd1, 0x1b, 0xbc, 0xd1, 0x5c, 0x88, 0x6f, 0x9a, 0x78, 0x0b, 0xc8, 0x3c, 0xd5, 0xbc, 0xb4, 0x02,
+  0x45, 0xb3, 0xeb, 0x2e, 0x09, 0xb3, 0xb3, 0x2c, 0x32, 0x45, 0x15, 0x2f, 0x03, 0xcb, 0x94, 0x67, 0xab, 0x55, 0x31, 0xf0,
+  0x50, 0x86, 0x1a, 0xcb, 0xda, 0x08, 0x1e, 0xcf, 0x96, 0x1d, 0x99, 0x96, 0xed, 0xdf, 0x2f, 0x60, 0xb9, 0xf6, 0xe6, 0xe0,
+  0x5f, 0x83, 0xed, 0xfa, 0xf7, 0x5f, 0x72, 0xeb, 0x53, 0x98, 0xd2, 0x13, 0x93, 0xb9, 0xf0, 0xde, 0xc3, 0x40, 0x0c, 0xe3,
+  0x0c, 0x8a, 0xa0, 0x3a, 0x2b, 0x6f, 0x77, 0xf9, 0xf7, 0xef, 0xa3, 0x2c, 0x47, 0x54, 0x3a, 0x84, 0x65, 0xd3, 0x73, 0x47,
+  0x1f, 0x0b, 0xa1, 0xa0, 0xb2, 0x50, 0x49, 0x71, 0x71, 0x3b, 0x22, 0x37, 0xaa, 0x1c, 0x83, 0x28, 0xe4, 0xf4, 0xf8, 0xdf,
+  0x2d, 0x34, 0x11, 0xdd, 0xba, 0xc3, 0x85, 0xea, 0x9e, 0x42, 0x5e, 0xe1, 0xa6, 0x98, 0xf8, 0xdb, 0x45, 0x9a, 0x85, 0x07,
+  0x11, 0x46, 0x8a, 0xbb, 0x5c, 0x44, 0xc3, 0x06, 0xa0, 0x6a, 0x56, 0xa9, 0x39, 0xb0, 0x55, 0x6f, 0xbc, 0xc1, 0x18, 0xe0,
+  0x2f, 0x7e, 0xa2, 0xde, 0x09, 0xbf, 0x2d, 0xbb, 0xdd, 0xb5, 0x22, 0x26, 0x32, 0xdd, 0x2f, 0x61, 0x30, 0x7f, 0xa0, 0x7b,
+  0x15, 0x00, 0x4e, 0x36, 0xe2, 0x89, 0xc6, 0xd5, 0x0c, 0x9c, 0xda, 0x73, 0x5b, 0x7b, 0x0b, 0x71, 0x7b, 0x17, 0x7f, 0xd5,
+  0x0a, 0xba, 0x13, 0xc6, 0x03, 0xdc, 0x91, 0xf9, 0x90, 0x4f, 0x5a, 0x85, 0x08, 0x8e, 0xf5, 0x3a, 0x99, 0x9f, 0xc5, 0x30,
+  0x9f, 0xea, 0xe5, 0x18, 0x5b, 0xaa, 0x13, 0x94, 0xcb, 0xc8, 0x61, 0xe5, 0x07, 0x50, 0xd4, 0x33, 0x27, 0x8a, 0x33, 0xda,
+  0xd2, 0x18, 0x9b, 0xbd, 0x8d, 0xd6, 0x2d, 0x24, 0x3d, 0x52, 0xcc, 0x1f, 0xa0, 0xc5, 0xd0, 0xad, 0xee, 0x4d, 0x98, 0x05,
+  0xda, 0x51, 0x50, 0xb3, 0xfa, 0x55, 0x2b, 0xb0, 0xc6, 0x34, 0xfd, 0xc4, 0xde, 0x73, 0x7c, 0x6b, 0xab, 0x59, 0x17, 0xfe,
+  0x7f, 0x33, 0xab, 0xe0, 0x75, 0x51, 0x51, 0xc5, 0x2e, 0x54, 0xf1, 0x44, 0x29, 0x6f, 0xd1, 0x8d, 0x44, 0x1b, 0x83, 0x4c,
+  0xd9, 0xf6, 0x28, 0x4b, 0x0f, 0x80, 0xe4, 0x95, 0x55, 0x77, 0xf2, 0x9b, 0xe6, 0xae, 0x4b, 0x95, 0xe7, 0x34, 0x4a, 0xa0,
+  0x4b, 0x07, 0x7d, 0xd3, 0x85, 0xc3, 0x77, 0x80, 0x28, 0x94, 0x08, 0xd1, 0xaf, 0x1a, 0xbc, 0x81, 0x4e, 0xc4, 0x6d, 0xc9,
+  0x7f, 0x19, 0x48, 0x41, 0x39, 0x40, 0xe5, 0x87, 0x6a, 0x98, 0xf5, 0x8c, 0x33, 0xfd, 0x80, 0x93, 0x51, 0xd6, 0x88, 0xf8,
+  0x21, 0x52, 0x9b, 0x4c, 0xa0, 0xea, 0xe2, 0x07, 0x5f, 0xb4, 0xc4, 0xe0, 0x29, 0xea, 0x9e, 0xa5, 0x7e, 0x95, 0xe6, 0x01,
+  0x2b, 0xc1, 0x31, 0x49, 0x3f, 0x17, 0x25, 0xfb, 0x82, 0xb6, 0xa9, 0x9d, 0x74, 0x54, 0x55, 0xc2, 0xd5, 0x46, 0x98, 0x01,
+  0x99, 0x59, 0x21, 0x09, 0x15, 0xe6, 0x10, 0xb4, 0x48, 0x85, 0x5e, 0x09, 0x5b, 0xe1, 0x8c, 0x1a, 0x9e, 0x88, 0xc3, 0x5a,
+  0xcb, 0x86, 0xed, 0x9f, 0x85, 0xfe, 0x89, 0x7b, 0xb6, 0x9b, 0x7d, 0x39, 0xd7, 0x32, 0x2e, 0x7b, 0x1e, 0xf3, 0x59, 0x5a,
+  0x85, 0x77, 0x04, 0x54, 0xa7, 0x9d, 0x23, 0x9a, 0xfe, 0x25, 0xd9, 0x72, 0xe3, 0xd1, 0xb4, 0x44, 0xc1, 0x3c, 0xc4, 0xf5,
+  0xd7, 0x59, 0x2d, 0xb7, 0xb0, 0xde, 0x05, 0x92, 0x39, 0x17, 0x0a, 0x05, 0x3b, 0xae, 0x86, 0x3a, 0x0e, 0xe8, 0xd8, 0xc0,
+  0x97, 0x3b, 0x95, 0x3f, 0x2b, 0x41, 0x3a, 0x29, 0x66, 0x91, 0xe0, 0x0b, 0x4f, 0x13, 0xd4, 0x4e, 0x4e, 0xc4, 0x85, 0x12,
+  0x6d, 0xff, 0x4c, 0x0d, 0xee, 0x22, 0xb1, 0x77, 0x4a, 0xd0, 0xfa, 0x25, 0x8d, 0x1e, 0xba, 0x3e, 0x6d, 0x13, 0xf3, 0xed,
+  0x96, 0xf7, 0x68, 0x7a, 0x9e, 0xb3, 0xd5, 0xb2, 0xd2, 0xda, 0xe9, 0xaa, 0x61, 0x75, 0x6b, 0xab, 0xf1, 0x99, 0x96, 0xb3,
+  0x4b, 0x17, 0xd3, 0x15, 0xd9, 0xeb, 0x4f, 0x1f, 0xeb, 0xbc, 0xc9, 0x6f, 0xac, 0x4b, 0x97, 0xce, 0x3e, 0xb9, 0xee, 0x4a,
+  0x4e, 0xab, 0x77, 0xb7, 0x4e, 0x05, 0xcb, 0x2d, 0x37, 0x4e, 0x32, 0x5c, 0xad, 0x2a, 0xf8, 0xbe, 0x14, 0x94, 0xfd, 0x1e,
+  0x45, 0xff, 0x78, 0x2e, 0xd3, 0x37, 0x66, 0x58, 0x13, 0x2b, 0xa5, 0xcc, 0x2d, 0x0e, 0x9e, 0x24, 0x65, 0x4c, 0x8c, 0xe2,
+  0xa4, 0x4f, 0x91, 0x26, 0xe2, 0x53, 0xe9, 0xe4, 0x6d, 0x42, 0x35, 0x59, 0x48, 0x1b, 0xdc, 0x69, 0x26, 0xb4, 0x8e, 0xbb,
+  0x54, 0x51, 0xca, 0xc6, 0x6e, 0x2a, 0x95, 0x16, 0xf1, 0x95, 0xa4, 0xc0, 0xe6, 0xc5, 0x67, 0xaa, 0x16, 0x7f, 0x45, 0x20,
+  0x25, 0x29, 0x30, 0xfa, 0x31, 0x98, 0x66, 0x58, 0x26, 0x16, 0x91, 0xfa, 0x82, 0x94, 0x0d, 0x3e, 0x38, 0x6e, 0x2d, 0xd3,
+  0xd3, 0x56, 0xa9, 0xcf, 0x2d, 0xd1, 0x8f, 0x96, 0xd3, 0xb0, 0x49, 0xf0, 0xba, 0x42, 0x9a, 0xe0, 0x43, 0xbf, 0x50, 0x51,
+  0xa9, 0x07, 0x53, 0xeb, 0x98, 0x4e, 0xe2, 0x08, 0xec, 0xc7, 0xce, 0x0d, 0xaf, 0x54, 0x07, 0x3b, 0x8a, 0x29, 0x64, 0x7c,
+  0x54, 0xb2, 0x6e, 0x55, 0xc1, 0x6d, 0x97, 0xc2, 0x3d, 0xd6, 0xae, 0x9e, 0x9c, 0x7b, 0xc4, 0x34, 0xef, 0x30, 0xfc, 0xb2,
+  0x23, 0x00, 0xdb, 0xe5, 0xd5, 0xec, 0x1a, 0xa3, 0xff, 0x90, 0x5f, 0x30, 0xa6, 0xc3, 0xad, 0x4e, 0xa3, 0x87, 0x6d, 0x55,
+  0x8a, 0xc8, 0x77, 0xe6, 0x5c, 0x9b, 0xe8, 0x89, 0x2d, 0xdc, 0xa3, 0x6b, 0x65, 0xee, 0x3d, 0x20, 0xbc, 0x73, 0x02, 0xf9,
+  0xea, 0xca, 0x49, 0x15, 0x04, 0x0f, 0x72, 0xe5, 0x24, 0x55, 0x0c, 0xfc, 0x27, 0x34, 0xd6, 0xce, 0x33, 0xed, 0xd2, 0xec,
+  0xce, 0x07, 0x6b, 0xf5, 0x24, 0x83, 0x1a, 0x89, 0xce, 0x2c, 0x8d, 0x39, 0x6a, 0xf3, 0xd4, 0xf1, 0xbb, 0x2d, 0xed, 0xc5,
+  0xb3, 0xe6, 0x53, 0x73, 0xc8, 0x57, 0x9f, 0x4f, 0xf5, 0xa4, 0x80, 0xd6, 0x17, 0x29, 0x55, 0xe3, 0x19, 0x54, 0x35, 0xae,
+  0xb4, 0x70, 0xa3, 0x2a, 0xc8, 0xc9, 0xba, 0xf1, 0x79, 0xba, 0x27, 0xee, 0x7a, 0xc0, 0x57, 0xc7, 0xc8, 0x55, 0xcd, 0x60,
+  0xb1, 0x66, 0xd9, 0x4d, 0x66, 0x3d, 0x00, 0x04, 0x56, 0x2e, 0x9b, 0xd8, 0x07, 0x3e, 0x09, 0x31, 0x24, 0x8e, 0x07, 0x05,
+  0xbe, 0x9f, 0x01, 0x2c, 0x76, 0x30, 0xa0, 0x7d, 0x6a, 0x73, 0xd3, 0x38, 0xc6, 0x4f, 0xb4, 0xf9, 0x00, 0x65, 0xc4, 0xac,
+  0xad, 0x7c, 0xc4, 0x6d, 0xa4, 0xbf, 0xa6, 0x67, 0x09, 0x97, 0xb4, 0xa7, 0xdf, 0x78, 0x25, 0x22, 0x9c, 0xb9, 0xab, 0x0a,
+  0x1d, 0xb3, 0xb1, 0xb8, 0xbf, 0x94, 0x5b, 0x47, 0x53, 0xb9, 0xd2, 0x20, 0x2b, 0xe1, 0x79, 0xff, 0x98, 0x4c, 0x14, 0xd7,
+  0xb3, 0x74, 0xcf, 0x39, 0x50, 0xfd, 0x8d, 0xe8, 0xbb, 0xac, 0x83, 0x76, 0xa9, 0xbb, 0x5a, 0x47, 0x3d, 0x57, 0xaa, 0x28,
+  0x13, 0x38, 0x43, 0x79, 0x81, 0x4c, 0x2a, 0x77, 0x42, 0x6b, 0xcf, 0x71, 0xd7, 0x45, 0xd9, 0x7e, 0xe3, 0x30, 0xac, 0x59,
+  0xbe, 0x2c, 0x5b, 0x96, 0xcd, 0x8b, 0x1d, 0x6e, 0x14, 0x1e, 0xe1, 0x90, 0xf3, 0x65, 0x1d, 0x66, 0xde, 0x82, 0x1d, 0xaf,
+  0x57, 0x86, 0xdb, 0x63, 0x43, 0xfe, 0x02, 0xfb, 0x81, 0x42, 0xfe, 0xba, 0x31, 0x00, 0xab, 0x43, 0xfd, 0x59, 0x2b, 0xc4,
+  0xb7, 0x64, 0x95, 0xbb, 0xc7, 0x97, 0x23, 0x1f, 0x50, 0x34, 0x81, 0x17, 0xec, 0xe0, 0xce, 0xc1, 0xc6, 0x5e, 0x70, 0x38,
+  0x31, 0x74, 0xc5, 0x79, 0xfc, 0x6b, 0x6c, 0x21, 0xb3, 0x1d, 0x42, 0xdc, 0x5b, 0x26, 0x33, 0xe8, 0x19, 0xc7, 0xdc, 0xf1,
+  0x2b, 0x9f, 0x0d, 0xdc, 0xbe, 0x55, 0x94, 0x2f, 0x8c, 0x54, 0x5e, 0x17, 0x19, 0x86, 0x5f, 0x90, 0x3f, 0xe9, 0xdb, 0xc1,
+  0xdf, 0x01, 0xbf, 0x31, 0xf7, 0x43, 0x8c, 0x1d, 0x7a, 0x2f, 0xaa, 0xbc, 0x82, 0x2a, 0x4d, 0x69, 0x4b, 0xb6, 0x8a, 0x66,
+  0x70, 0x96, 0x31, 0xbe, 0x7a, 0x63, 0xab, 0x2d, 0x4a, 0xb4, 0xeb, 0x37, 0x76, 0x95, 0xa4, 0xdf, 0x2e, 0xbe, 0x28, 0x3a,
+  0x45, 0xbe, 0x79, 0xfa, 0xd8, 0x56, 0x3f, 0xd9, 0xf5, 0xe2, 0x2a, 0x61, 0xac, 0x10, 0x1d, 0x57, 0xe9, 0x95, 0x5a, 0x50,
+  0xba, 0x51, 0x57, 0xb2, 0x7c, 0xa2, 0xd7, 0xe6, 0x8a, 0x1f, 0x01, 0x6c, 0x1e, 0x13, 0x02, 0xc4, 0xbe, 0x6f, 0x28, 0x26,
+  0xb7, 0xc8, 0x8a, 0xe4, 0x79, 0x86, 0x72, 0xc6, 0x7b, 0x2b, 0x95, 0x7e, 0xa1, 0xd4, 0x13, 0x19, 0x71, 0xa9, 0xb4, 0xb3,
+  0x3d, 0xe5, 0x27, 0x44, 0x4b, 0x9e, 0x54, 0x0b, 0x7a, 0x3a, 0xa9, 0x40, 0x2c, 0xcb, 0x54, 0x91, 0xef, 0xe9, 0xf4, 0x94,
+  0x62, 0xe2, 0x29, 0xc3, 0x9f, 0x1b, 0xfc, 0xa9, 0x8a, 0xce, 0x67, 0x11, 0xf7, 0x5e, 0x9c, 0xf4, 0x2e, 0xdc, 0x01, 0x91,
+  0x9c, 0x45, 0x64, 0x79, 0xdb, 0x1e, 0xd8, 0x56, 0x8f, 0xf3, 0x50, 0x63, 0x1c, 0x25, 0x20, 0x95, 0xd6, 0xe9, 0x02, 0x34,
+  0x9e, 0xf2, 0x45, 0xa8, 0x05, 0xbe, 0xa4, 0x6f, 0x7c, 0xeb, 0x4e, 0x2c, 0x6b, 0x20, 0xb9, 0xa0, 0x74, 0x6e, 0x3b, 0xb1,
+  0xac, 0x04, 0xe6, 0xe2, 0xd6, 0x0d, 0xaa, 0xa2, 0x94, 0x7e, 0xe5, 0x8f, 0x69, 0xc7, 0x09, 0x85, 0x5e, 0x11, 0x45, 0x5d,
+  0x38, 0x48, 0x35, 0x19, 0xb9, 0xe7, 0xe1, 0xb1, 0x50, 0x0d, 0x22, 0xbe, 0x76, 0xd9, 0x4b, 0x44, 0x8b, 0xfe, 0x0a, 0xbf,
+  0xf0, 0x32, 0x3b, 0x79, 0xc8, 0x3d, 0x8f, 0x34, 0x85, 0x21, 0x2a, 0x60, 0x87, 0x38, 0xb9, 0xb0, 0xb1, 0xd3, 0x9b, 0x62,
+  0x6c, 0x3e, 0x5b, 0xa4, 0xa4, 0xb5, 0x81, 0x73, 0x61, 0x65, 0xae, 0x3d, 0xb1, 0xa8, 0x35, 0xeb, 0xda, 0xde, 0x72, 0x6c,
+  0xa8, 0x45, 0xfa, 0x6a, 0xed, 0xa7, 0x5c, 0x5a, 0x58, 0x08, 0x17, 0x9a, 0x87, 0x52, 0x24, 0xec, 0x72, 0x50, 0x6d, 0x1b,
+  0x04, 0x5b, 0x4d, 0x37, 0x19, 0xcb, 0x4e, 0x6c, 0x5d, 0xc9, 0xa6, 0x66, 0xbb, 0x47, 0x56, 0x8d, 0x85, 0xba, 0x67, 0xed,
+  0x1f, 0x5c, 0xda, 0xb5, 0x11, 0xcc, 0xe9, 0x61, 0x65, 0xec, 0x58, 0xbd, 0x06, 0x7d, 0x33, 0xc1, 0xeb, 0xe1, 0x51, 0x27,
+  0xe7, 0x85, 0xfa, 0xa1, 0x4f, 0xd8, 0x5c, 0xd2, 0x55, 0x83, 0xcc, 0x2b, 0x6b, 0x20, 0x4d, 0x41, 0x5a, 0xd4, 0x5a, 0x6a,
+  0x58, 0x8c, 0x8b, 0x08, 0xf9, 0x47, 0x8d, 0xa2, 0xe0, 0xc9, 0x27, 0xa2, 0x90, 0xc0, 0x4d, 0xef, 0xce, 0x3a, 0x79, 0x4a,
+  0x9f, 0x54, 0x5c, 0x5e, 0xa4, 0x6e, 0xce, 0xb8, 0xf4, 0x3e, 0x0f, 0x83, 0x0f, 0xed, 0xe1, 0x98, 0x5f, 0x18, 0x05, 0x68,
+  0xb3, 0xf7, 0x47, 0x6d, 0xbe, 0x1c, 0x4a, 0x04, 0xed, 0xe2, 0x68, 0x96, 0x6e, 0x7c, 0xf3, 0xa3, 0x36, 0xf6, 0x21, 0xdd,
+  0x52, 0x15, 0xb7, 0xa3, 0x23, 0xd4, 0x11, 0x97, 0x2b, 0x21, 0x0b, 0x02, 0x2e, 0x99, 0x0b, 0xb0, 0x01, 0x8c, 0x60, 0x47,
+  0xa7, 0xa7, 0x48, 0xbd, 0x7b, 0x02, 0x78, 0x3f, 0x7c, 0x56, 0xa5, 0x65, 0xb1, 0x8a, 0x4e, 0x31, 0x9e, 0xe8, 0x3c, 0x00,
+  0x02, 0xb6, 0x37, 0x39, 0x72, 0x11, 0x20, 0x47, 0x5f, 0x3b, 0xab, 0x80, 0xc2, 0xa8, 0xc3, 0x72, 0x57, 0xf7, 0x43, 0xde,
+  0xa9, 0x0d, 0xfe, 0xa6, 0xd7, 0x88, 0x74, 0x24, 0xdb, 0x50, 0x5d, 0xbf, 0x79, 0xa5, 0x8a, 0xa3, 0xa2, 0xba, 0x22, 0x0c,
+  0xbf, 0x17, 0x3b, 0xab, 0x45, 0x37, 0xcb, 0x7d, 0xbe, 0x82, 0xcf, 0x16, 0xdb, 0x2d, 0x57, 0x45, 0xde, 0xa5, 0xfb, 0xd0,
+  0x94, 0xbc, 0x9d, 0x8e, 0xb3, 0x6e, 0xe4, 0xdf, 0x16, 0x21, 0x27, 0x0b, 0x7c, 0xb8, 0x47, 0xc0, 0x28, 0x39, 0x21, 0x22,
+  0x64, 0x75, 0xb7, 0x19, 0x39, 0x41, 0x40, 0x99, 0x28, 0xdf, 0xa8, 0x45, 0x79, 0xc5, 0x2c, 0xf7, 0xa3, 0xc1, 0x20, 0x35,
+  0x2c, 0x53, 0x04, 0xe7, 0x40, 0x29, 0x67, 0x33, 0x38, 0x25, 0x90, 0xd9, 0xf7, 0x78, 0xcd, 0x84, 0x53, 0x3a, 0x3e, 0x08,
+  0x77, 0x5e, 0xe7, 0x39, 0xd5, 0xcb, 0xe7, 0x82, 0xf9, 0x78, 0x3a, 0xab, 0x98, 0x00, 0x10, 0x73, 0xa1, 0x0e, 0xb2, 0xd4,
+  0x98, 0x66, 0x50, 0x19, 0xbe, 0xb0, 0x39, 0xa3, 0x5f, 0xe6, 0x7a, 0x9e, 0x21, 0xde, 0xca, 0x50, 0xaf, 0xbf, 0xdb, 0xde,
+  0xba, 0xd6, 0x26, 0x4f, 0x85, 0x46, 0x44, 0xa7, 0xcb, 0xb9, 0x31, 0x5c, 0x27, 0x73, 0xea, 0xb3, 0xc1, 0x44, 0xfd, 0x76,
+  0xce, 0x2a, 0xa2, 0x24, 0xbb, 0x57, 0x28, 0x91, 0xd2, 0x73, 0xcd, 0x8b, 0x42, 0x2b, 0x37, 0xaf, 0x6a, 0xf0, 0x34, 0xe1,
+  0x53, 0xf4, 0xa6, 0x1b, 0xc0, 0xa6, 0x6a, 0xf2, 0x2a, 0x97, 0x9c, 0x9c, 0x5a, 0xa5, 0x7b, 0x75, 0xd7, 0xf2, 0x06, 0xfb,
+  0xdd, 0x36, 0x3c, 0x79, 0x79, 0x18, 0xc6, 0x7c, 0x46, 0x96, 0x32, 0xa7, 0x77, 0x5a, 0x73, 0x66, 0x78, 0xf6, 0xd9, 0xae,
+  0xf2, 0xba, 0x87, 0xbb, 0xf8, 0x9d, 0xf8, 0x8f, 0x2d, 0xfd, 0x3c, 0x95, 0xdf, 0xd0, 0xd2, 0x82, 0x44, 0xba, 0x82, 0xff,
+  0xff, 0x7f, 0x80, 0xb9, 0x1b, 0x21, 0x47, 0xb1, 0x00, 0x00,
+};
+static const EmbeddedAsset kEmbeddedAppJs = {"/app.17cc2f5e4f.js", "application/javascript; charset=utf-8", "\"17cc2f5e4f\"", kEmbeddedAppJsGz, sizeof(kEmbeddedAppJsGz)};
@@ -0,0 +1,101 @@
+#include "EventStream.h"
+
+bool EventStream::add(WiFiClient &client, uint32_t nowMs) {
+  _nowMs = nowMs;
+  if (_count == kMaxClients) {
+    _slots[0].client.stop();
+    remove(0);
+    _stats.evicted += 1;
+  }
+
+  Slot &s = _slots[_count];
+  s.client = client;
+  s.client.setNoDelay(true);
+  s.sinceMs = nowMs;
+  char head[192];
+  const int n = snprintf(head, sizeof(head),
+                         "HTTP/1.1 200 OK\r\n"
+                         "Content-Type: text/event-stream\r\n"
+                         "Cache-Control: no-store\r\n"
+                         "Connection: keep-alive\r\n"
+                         "\r\n"
+                         "retry: %u\n\n",
+                         static_cast<unsigned>(kRetryMs));
+  if (!write(s, head, static_cast<size_t>(n), nowMs)) {
+    s.client = WiFiClient();
+    return false;
+  }
+  _count += 1;
+  _stats.accepted += 1;
+  return true;
+}
+
+String EventStream::format(const char *event, const String &data) {
+  String msg;
+  msg.reserve(data.length() + 24);
+  msg += "event: ";
+  msg += event;
+  msg += "\ndata: ";
+  msg += data;
+  msg += "\n\n";
+  return msg;
+}
+
+uint8_t EventStream::broadcast(const char *event, const String &data) {
+  if (!_count) return 0;
+  const String msg = format(event, data);
+  _stats.events += 1;
+  uint8_t reached = 0;
+  for (uint8_t i = 0; i < _count;) {
+    if (write(_slots[i], msg.c_str(), msg.length(), _nowMs)) {
+      reached += 1;
+      i += 1;
+    } else {
+      _slots[i].client.stop();
+      remove(i);
+      _stats.dropped += 1;
+    }
+  }
+  return reached;
+}
+
+bool EventStream::sendLatest(const char *event, const String &data) {
+  if (!_count) return false;
+  const String msg = format(event, data);
+  if (write(_slots[_count - 1], msg.c_str(), msg.length(), _nowMs)) return true;
+  _slots[_count - 1].client.stop();
+  remove(_count - 1);
+  _stats.dropped += 1;
+  return false;
+}
+
+void EventStream::tick(uint32_t nowMs) {
+  _nowMs = nowMs;
+  for (uint8_t i = 0; i < _count;) {
+    Slot &s = _slots[i];
+    bool ok = s.client.connected();
+    if (ok && nowMs - s.lastWriteMs >= kKeepaliveMs) ok = write(s, ":\n\n", 3, nowMs);
+    if (ok) {
+      i += 1;
+      continue;
+    }
+    s.client.stop();
+    remove(i);
+  }
+}
+
+bool EventStream::write(Slot &s, const char *msg, size_t len, uint32_t nowMs) {
+  if (!s.client.connected()) return false;
+  if (static_cast<size_t>(s.client.availableForWrite()) < len) return false;
+  if (s.client.write(reinterpret_cast<const uint8_t *>(msg), len) != len) return false;
+  s.lastWriteMs = nowMs;
+  _stats.sent += 1;
+  _stats.bytes += len;
+  return true;
+}
+
+void EventStream::remove(uint8_t i) {
+  for (uint8_t j = i; j + 1 < _count; j += 1) _slots[j] = _slots[j + 1];
+  _count -= 1;
+  _slots[_count] = Slot();
+}
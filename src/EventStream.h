@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+
+// Server-Sent Events fan-out for GET /api/events. ESP8266WebServer hands over the request's client
+// (add()), which is then kept here and written to directly; the server itself moves on.
+//
+// Writes never wait: an event goes to a client only if its TCP send buffer has room for the whole
+// message, otherwise that client is closed (EventSource reconnects on its own and resyncs from the
+// "hello" event). A comment line every kKeepaliveMs finds dead peers.
+class EventStream {
+public:
+  static constexpr uint8_t kMaxClients = 4;          // the oldest is dropped for a new one
+  static constexpr uint32_t kKeepaliveMs = 15000UL;
+  static constexpr uint16_t kRetryMs = 3000;         // reconnect delay suggested to the browser
+
+  struct Stats {
+    uint32_t accepted = 0;
+    uint32_t events = 0;      // broadcast() calls with at least one client
+    uint32_t sent = 0;        // messages written (events x clients)
+    uint32_t bytes = 0;
+    uint32_t dropped = 0;     // clients closed because their buffer was full
+    uint32_t evicted = 0;     // clients closed to make room for a new one
+  };
+
+  // Sends the response head and keeps `client`. False if it could not be written.
+  bool add(WiFiClient &client, uint32_t nowMs);
+  // `event` name + one-line `data` (JSON). Returns the number of clients it reached.
+  uint8_t broadcast(const char *event, const String &data);
+  // Same, to the most recently added client only (the initial sync).
+  bool sendLatest(const char *event, const String &data);
+  // Prunes closed clients, sends keepalives.
+  void tick(uint32_t nowMs);
+
+  uint8_t clientCount() const { return _count; }
+  const Stats &stats() const { return _stats; }
+
+private:
+  struct Slot {
+    WiFiClient client;
+    uint32_t sinceMs = 0;
+    uint32_t lastWriteMs = 0;
+  };
+
+  bool write(Slot &s, const char *msg, size_t len, uint32_t nowMs);
+  void remove(uint8_t i);
+  static String format(const char *event, const String &data);
+
+  Slot _slots[kMaxClients];
+  uint8_t _count = 0;
+  uint32_t _nowMs = 0;
+  Stats _stats;
+};
@@ -0,0 +1,255 @@
+#include "FastConnect.h"
+
+#include <LittleFS.h>
+
+#include "JsonWriter.h"
+#include "RtcLayout.h"
+#include "SpanTrace.h"
+
+namespace {
+constexpr const char *kFlashPath = "/wifi_fast.bin";
+
+constexpr uint32_t kRtcOffsetWords = rtcmem::kFastConnect;
+constexpr uint32_t kRtcMagic = 0x53484643; // 'SHFC'
+// Slack for the age snapshot being up to a minute old and for the reboot itself.
+constexpr uint32_t kLeaseMarginS = 120;
+
+struct Record {
+  uint32_t magic = 0;
+  uint32_t ssidHash = 0;
+  uint8_t bssid[6] = {0, 0, 0, 0, 0, 0};
+  uint8_t channel = 0;
+  uint8_t reserved = 0;
+  uint32_t ip = 0;
+  uint32_t gateway = 0;
+  uint32_t subnet = 0;
+  uint32_t dns1 = 0;
+  uint32_t dns2 = 0;
+  uint32_t leaseS = 0;
+  uint32_t ageS = 0;
+  uint32_t crc = 0;
+};
+static_assert(sizeof(Record) == 48, "fast-connect record must stay 12 words");
+static_assert(sizeof(Record) <= rtcmem::kFastConnectWords * 4, "fast-connect record outgrew its RTC words");
+
+fastconnect::Stats counters;
+Record cache;      // what RTC holds
+Record flashCache; // what the file holds
+
+uint32_t crc32(const uint8_t *data, size_t len) {
+  uint32_t crc = 0xFFFFFFFFUL;
+  for (size_t i = 0; i < len; i += 1) {
+    crc ^= data[i];
+    for (uint8_t b = 0; b < 8; b += 1) crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1UL)));
+  }
+  return ~crc;
+}
+
+uint32_t recordCrc(const Record &r) { return crc32(reinterpret_cast<const uint8_t *>(&r), offsetof(Record, crc)); }
+
+bool valid(const Record &r) { return r.magic == kRtcMagic && r.crc == recordCrc(r); }
+
+// Same AP, channel and lease (the CRC covers exactly these plus the magic).
+bool sameContent(const Record &a, const Record &b) { return memcmp(&a, &b, offsetof(Record, crc)) == 0; }
+
+void seal(Record &r) {
+  r.magic = kRtcMagic;
+  r.crc = recordCrc(r);
+}
+
+// Handed out by DHCP and still before T1, so the server holds it for us through the boot.
+bool leaseFresh(const Record &r) {
+  return r.ip != 0 && r.leaseS != 0 && r.ageS + kLeaseMarginS < r.leaseS / 2;
+}
+
+void clearLease(Record &r) {
+  r.ip = r.gateway = r.subnet = r.dns1 = r.dns2 = 0;
+  r.leaseS = r.ageS = 0;
+  seal(r);
+}
+
+bool readRtc(Record &out) {
+  Record tmp{};
+  if (!ESP.rtcUserMemoryRead(kRtcOffsetWords, reinterpret_cast<uint32_t *>(&tmp), sizeof(tmp))) return false;
+  if (!valid(tmp)) return false;
+  out = tmp;
+  return true;
+}
+
+void writeRtc(const Record &r) {
+  Record tmp = r;
+  if (ESP.rtcUserMemoryWrite(kRtcOffsetWords, reinterpret_cast<uint32_t *>(&tmp), sizeof(tmp))) {
+    counters.rtcWrites += 1;
+  }
+}
+
+bool readFlash(Record &out) {
+  File f = LittleFS.open(kFlashPath, "r");
+  if (!f) return false;
+  Record tmp{};
+  const size_t got = f.read(reinterpret_cast<uint8_t *>(&tmp), sizeof(tmp));
+  f.close();
+  if (got != sizeof(tmp) || !valid(tmp)) return false;
+  out = tmp;
+  return true;
+}
+
+void writeFlash(const Record &r) {
+  spantrace::Span span(spantrace::Lane::Fs, "wifi.fast");
+  File f = LittleFS.open(kFlashPath, "w");
+  if (!f) return;
+  const bool ok = f.write(reinterpret_cast<const uint8_t *>(&r), sizeof(r)) == sizeof(r);
+  f.close();
+  if (ok) counters.flashWrites += 1;
+}
+
+fastconnect::Lease toLease(const Record &r) {
+  fastconnect::Lease l;
+  l.ssidHash = r.ssidHash;
+  memcpy(l.bssid, r.bssid, sizeof(l.bssid));
+  l.channel = r.channel;
+  l.ip = IPAddress(r.ip);
+  l.gateway = IPAddress(r.gateway);
+  l.subnet = IPAddress(r.subnet);
+  l.dns1 = IPAddress(r.dns1);
+  l.dns2 = IPAddress(r.dns2);
+  l.leaseS = r.leaseS;
+  l.ageS = r.ageS;
+  return l;
+}
+
+Record toRecord(const fastconnect::Lease &l) {
+  Record r{};
+  r.ssidHash = l.ssidHash;
+  memcpy(r.bssid, l.bssid, sizeof(r.bssid));
+  r.channel = l.channel;
+  r.ip = static_cast<uint32_t>(l.ip);
+  r.gateway = static_cast<uint32_t>(l.gateway);
+  r.subnet = static_cast<uint32_t>(l.subnet);
+  r.dns1 = static_cast<uint32_t>(l.dns1);
+  r.dns2 = static_cast<uint32_t>(l.dns2);
+  r.leaseS = l.leaseS;
+  r.ageS = l.ageS;
+  seal(r);
+  return r;
+}
+} // namespace
+
+uint32_t fastconnect::ssidHash(const String &ssid) {
+  return crc32(reinterpret_cast<const uint8_t *>(ssid.c_str()), ssid.length());
+}
+
+fastconnect::Source fastconnect::load(Lease &out) {
+  out = Lease();
+  const bool inFlash = readFlash(flashCache);
+  if (!inFlash) flashCache = {};
+
+  if (readRtc(cache)) {
+    counters.loadedFrom = Source::Rtc;
+  } else if (inFlash) {
+    cache = flashCache;
+    counters.loadedFrom = Source::Flash;
+  } else {
+    cache = {};
+    counters.loadedFrom = Source::None;
+    return Source::None;
+  }
+  if (!leaseFresh(cache)) clearLease(cache);
+  out = toLease(cache);
+  return counters.loadedFrom;
+}
+
+void fastconnect::save(const Lease &lease) {
+  const Record r = toRecord(lease);
+  if (!valid(cache) || !sameContent(cache, r)) {
+    cache = r;
+    writeRtc(cache);
+  }
+  // Hints only, so the lease age ticking along does not rewrite flash.
+  Record hints = r;
+  clearLease(hints);
+  if (!valid(flashCache) || !sameContent(flashCache, hints)) {
+    flashCache = hints;
+    writeFlash(flashCache);
+  }
+}
+
+void fastconnect::dropLease() {
+  if (!valid(cache)) return;
+  Lease l = toLease(cache);
+  l.ip = l.gateway = l.subnet = l.dns1 = l.dns2 = IPAddress(0, 0, 0, 0);
+  l.leaseS = l.ageS = 0;
+  save(l);
+}
+
+void fastconnect::forget() {
+  Record blank{};
+  ESP.rtcUserMemoryWrite(kRtcOffsetWords, reinterpret_cast<uint32_t *>(&blank), sizeof(blank));
+  LittleFS.remove(kFlashPath);
+  cache = {};
+  flashCache = {};
+}
+
+void fastconnect::notePath(Path path) { counters.path = path; }
+
+void fastconnect::noteIp(uint32_t ms) {
+  if (!counters.ipMs) counters.ipMs = ms ? ms : 1;
+}
+
+void fastconnect::noteClock(uint32_t ms) {
+  if (!counters.clockMs) counters.clockMs = ms ? ms : 1;
+}
+
+void fastconnect::noteStaticFallback() { counters.staticFallbacks += 1; }
+
+const fastconnect::Stats &fastconnect::stats() { return counters; }
+
+const char *fastconnect::sourceToString(Source source) {
+  switch (source) {
+  case Source::Rtc:
+    return "rtc";
+  case Source::Flash:
+    return "flash";
+  default:
+    return "none";
+  }
+}
+
+const char *fastconnect::pathToString(Path path) {
+  switch (path) {
+  case Path::Full:
+    return "full";
+  case Path::Hinted:
+    return "hinted";
+  case Path::Static:
+    return "static";
+  default:
+    return "none";
+  }
+}
+
+void fastconnect::statsJson(JsonWriter &w) {
+  w.beginObject();
+  w.field("loadedFrom", sourceToString(counters.loadedFrom));
+  w.field("path", pathToString(counters.path));
+  w.key("timeToIpMs");
+  if (counters.ipMs) {
+    w.value(counters.ipMs);
+  } else {
+    w.null();
+  }
+  w.key("timeToClockMs");
+  if (counters.clockMs) {
+    w.value(counters.clockMs);
+  } else {
+    w.null();
+  }
+  w.field("staticFallbacks", counters.staticFallbacks);
+  w.field("channel", cache.channel);
+  w.field("hasLease", valid(cache) && cache.ip != 0);
+  w.field("leaseS", cache.leaseS);
+  w.field("leaseAgeS", cache.ageS);
+  w.field("rtcWrites", counters.rtcWrites);
+  w.field("flashWrites", counters.flashWrites);
+  w.endObject();
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+class JsonWriter;
+
+// What the last good station connection looked like, so the next boot can skip the channel scan and
+// DHCP:
+// - Hot copy in RTC user memory (CRC-protected), kept across resets, OTA and crash reboots. It holds the
+//   DHCP lease with its length and age; the age is refreshed every minute while the link is up.
+// - Cold copy in a small LittleFS file with only the BSSID/channel hints, rewritten only when those
+//   change, for boots after a power loss (the lease may have run out by then).
+// The static-IP fast path only takes a lease the DHCP server handed out that is still before its
+// renewal time (T1, half the lease); anything older or without a known length is refused.
+namespace fastconnect {
+enum class Source : uint8_t { None = 0, Rtc, Flash };
+// How this boot's first connection was made.
+enum class Path : uint8_t { None = 0, Full, Hinted, Static };
+
+struct Lease {
+  uint32_t ssidHash = 0;
+  uint8_t bssid[6] = {0, 0, 0, 0, 0, 0};
+  uint8_t channel = 0;
+  IPAddress ip = IPAddress(0, 0, 0, 0);
+  IPAddress gateway = IPAddress(0, 0, 0, 0);
+  IPAddress subnet = IPAddress(0, 0, 0, 0);
+  IPAddress dns1 = IPAddress(0, 0, 0, 0);
+  IPAddress dns2 = IPAddress(0, 0, 0, 0);
+  uint32_t leaseS = 0; // DHCP lease time, 0 = unknown
+  uint32_t ageS = 0;   // since the server last acknowledged the lease
+};
+
+struct Stats {
+  Source loadedFrom = Source::None;
+  Path path = Path::None;
+  uint32_t ipMs = 0;    // boot to the first station IP, 0 = not yet
+  uint32_t clockMs = 0; // boot to the first valid clock, 0 = not yet
+  uint32_t staticFallbacks = 0; // fast path tried and given up for DHCP
+  uint32_t rtcWrites = 0;
+  uint32_t flashWrites = 0;
+};
+
+uint32_t ssidHash(const String &ssid);
+
+// RTC first, then flash. A stale lease comes back as hints only (zero addresses).
+Source load(Lease &out);
+// Keeps both copies in step with `lease`; writes only what changed.
+void save(const Lease &lease);
+// Drops the static part (the lease did not work), keeping the BSSID/channel hints.
+void dropLease();
+// Drops both copies (Wi-Fi reset, factory reset).
+void forget();
+
+void notePath(Path path);
+void noteIp(uint32_t ms);
+void noteClock(uint32_t ms);
+void noteStaticFallback();
+
+const Stats &stats();
+const char *sourceToString(Source source);
+const char *pathToString(Path path);
+void statsJson(JsonWriter &w);
+} // namespace fastconnect
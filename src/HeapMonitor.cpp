@@ -0,0 +1,150 @@
+#include "HeapMonitor.h"
+
+#include "JsonWriter.h"
+
+namespace {
+const char *phaseToString(uint8_t phase) {
+  switch (phase) {
+  case 1:
+    return "before";
+  case 2:
+    return "during";
+  case 3:
+    return "after";
+  default:
+    return "periodic";
+  }
+}
+
+uint16_t clamp16(uint32_t v) { return static_cast<uint16_t>((v > 0xFFFFUL) ? 0xFFFFUL : v); }
+} // namespace
+
+void HeapMonitor::begin() {
+  _ringHead = 0;
+  _ringCount = 0;
+  _sourceCount = 0;
+  _global = {};
+  _global.name = "all";
+  addSource("periodic");
+  sample(kPeriodicSource, Phase::Periodic);
+}
+
+uint8_t HeapMonitor::addSource(const char *name) {
+  if (_sourceCount >= kMaxSources) return kInvalidSource;
+  Source &s = _sources[_sourceCount];
+  s = {};
+  s.name = name ? name : "";
+  const uint8_t id = _sourceCount;
+  _sourceCount += 1;
+  return id;
+}
+
+void HeapMonitor::sample(uint8_t source, Phase phase) {
+  if (source >= _sourceCount) return;
+
+  uint32_t freeHeap = 0;
+  uint16_t maxBlock = 0;
+  uint8_t frag = 0;
+  ESP.getHeapStats(&freeHeap, &maxBlock, &frag);
+
+  Sample s;
+  s.ms = millis();
+  s.freeHeap = clamp16(freeHeap);
+  s.maxBlock = maxBlock;
+  s.frag = frag;
+  s.stackFree = clamp16(ESP.getFreeContStack());
+  s.source = source;
+  s.phase = phase;
+
+  _ring[_ringHead] = s;
+  _ringHead = static_cast<uint8_t>((_ringHead + 1) % kRingSize);
+  if (_ringCount < kRingSize) _ringCount += 1;
+
+  Source *targets[] = {&_sources[source], &_global};
+  for (Source *t : targets) {
+    if (s.freeHeap < t->minFreeHeap) t->minFreeHeap = s.freeHeap;
+    if (s.maxBlock < t->minMaxBlock) t->minMaxBlock = s.maxBlock;
+    if (s.frag > t->maxFrag) t->maxFrag = s.frag;
+    if (s.stackFree < t->minStackFree) t->minStackFree = s.stackFree;
+  }
+
+  Source &src = _sources[source];
+  if (phase == Phase::Before) {
+    src.beforeFreeHeap = s.freeHeap;
+  } else if (phase == Phase::After || phase == Phase::Periodic) {
+    src.count += 1;
+    _global.count += 1;
+    if (phase == Phase::After && src.beforeFreeHeap > s.freeHeap) {
+      const uint16_t drop = static_cast<uint16_t>(src.beforeFreeHeap - s.freeHeap);
+      if (drop > src.maxDropBytes) src.maxDropBytes = drop;
+      if (drop > _global.maxDropBytes) _global.maxDropBytes = drop;
+    }
+  }
+}
+
+void HeapMonitor::tick() { sample(kPeriodicSource, Phase::Periodic); }
+
+void HeapMonitor::summaryJson(JsonWriter &w) const {
+  uint32_t freeHeap = 0;
+  uint16_t maxBlock = 0;
+  uint8_t frag = 0;
+  ESP.getHeapStats(&freeHeap, &maxBlock, &frag);
+
+  w.beginObject();
+  w.field("ok", true);
+  w.beginObject("now");
+  w.field("freeHeap", freeHeap);
+  w.field("maxBlock", maxBlock);
+  w.field("frag", frag);
+  w.field("stackFree", ESP.getFreeContStack());
+  w.endObject();
+
+  auto fill = [&w](const char *key, const Source &s) {
+    w.beginObject(key);
+    w.field("name", s.name);
+    w.field("count", s.count);
+    w.field("minFreeHeap", (s.minFreeHeap == 0xFFFF) ? 0 : s.minFreeHeap);
+    w.field("minMaxBlock", (s.minMaxBlock == 0xFFFF) ? 0 : s.minMaxBlock);
+    w.field("maxFrag", s.maxFrag);
+    w.field("maxDropBytes", s.maxDropBytes);
+    w.field("minStackFree", (s.minStackFree == 0xFFFF) ? 0 : s.minStackFree);
+    w.endObject();
+  };
+  fill("low", _global);
+
+  w.beginArray("sources");
+  for (uint8_t i = 0; i < _sourceCount; i += 1) {
+    if (_sources[i].minFreeHeap == 0xFFFF) continue; // never sampled
+    fill(nullptr, _sources[i]);
+  }
+  w.endArray();
+  w.endObject();
+}
+
+void HeapMonitor::samplesJson(JsonWriter &w) const {
+  w.beginObject();
+  w.field("ok", true);
+  w.beginArray("fields");
+  for (const char *f : {"ms", "freeHeap", "maxBlock", "frag", "stackFree", "source", "phase"}) w.value(f);
+  w.endArray();
+  w.beginArray("samples");
+  const uint8_t start = static_cast<uint8_t>((_ringHead + kRingSize - _ringCount) % kRingSize);
+  for (uint8_t i = 0; i < _ringCount; i += 1) {
+    const Sample &s = _ring[(start + i) % kRingSize];
+    // One string per sample keeps the response compact (the field names are sent once, above).
+    char line[96];
+    snprintf(line,
+             sizeof(line),
+             "%lu,%u,%u,%u,%u,%s,%s",
+             static_cast<unsigned long>(s.ms),
+             static_cast<unsigned>(s.freeHeap),
+             static_cast<unsigned>(s.maxBlock),
+             static_cast<unsigned>(s.frag),
+             static_cast<unsigned>(s.stackFree),
+             (s.source < _sourceCount) ? _sources[s.source].name : "?",
+             phaseToString(static_cast<uint8_t>(s.phase)));
+    w.value(line);
+  }
+  w.endArray();
+  w.endObject();
+}
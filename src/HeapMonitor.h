@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+
+class JsonWriter;
+
+// Heap / fragmentation telemetry.
+//
+// Samples free heap, largest free block, fragmentation and the continuation-stack high-water mark
+// periodically and around instrumented operations (every HTTP route, OTA phases). Samples go to a
+// small ring; each source keeps low-watermarks so the routes that fragment the heap stand out.
+class HeapMonitor {
+public:
+  static constexpr uint8_t kRingSize = 64;
+  // "periodic", the two OTA phases and WebUi::kMaxRoutes routes (checked in WebUi.cpp).
+  static constexpr uint8_t kMaxSources = 56;
+  static constexpr uint8_t kInvalidSource = 0xFF;
+  static constexpr uint8_t kPeriodicSource = 0; // registered by begin()
+
+  enum class Phase : uint8_t {
+    Periodic = 0,
+    Before, // about to run (baseline)
+    During, // resources held (e.g. TLS session open)
+    After,
+  };
+
+  void begin();
+  // `name` must outlive the monitor (string literal / static storage).
+  uint8_t addSource(const char *name);
+  void sample(uint8_t source, Phase phase);
+  void tick(); // periodic sample (call from a slow task)
+
+  // JSON: {ok, now:{...}, low:{...}, sources:[{name, count, minFreeHeap, minMaxBlock, maxFrag, maxDropBytes, minStackFree}]}
+  void summaryJson(JsonWriter &w) const;
+  // JSON: {ok, fields:[...], samples:["ms,free,maxBlock,frag,stack,source,phase", ...]} oldest first
+  void samplesJson(JsonWriter &w) const;
+
+private:
+  struct Sample {
+    uint32_t ms = 0;
+    uint16_t freeHeap = 0;
+    uint16_t maxBlock = 0;
+    uint16_t stackFree = 0;
+    uint8_t frag = 0;
+    uint8_t source = 0;
+    Phase phase = Phase::Periodic;
+  };
+
+  struct Source {
+    const char *name = "";
+    uint32_t count = 0; // completed Before/After pairs (or samples for Periodic)
+    uint16_t minFreeHeap = 0xFFFF;
+    uint16_t minMaxBlock = 0xFFFF;
+    uint8_t maxFrag = 0;
+    uint16_t minStackFree = 0xFFFF;
+    uint16_t beforeFreeHeap = 0;
+    uint16_t maxDropBytes = 0; // largest free-heap loss from Before to After
+  };
+
+  Sample _ring[kRingSize];
+  uint8_t _ringHead = 0;
+  uint8_t _ringCount = 0;
+
+  Source _sources[kMaxSources];
+  uint8_t _sourceCount = 0;
+  Source _global;
+};
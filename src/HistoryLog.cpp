@@ -2,6 +2,9 @@
 
 #include <LittleFS.h>
 
+#include "JsonWriter.h"
+#include "SpanTrace.h"
+
 namespace {
 constexpr const char *kHistoryPath = "/history.log";
 constexpr uint32_t kMaxFileBytes = 12UL * 1024UL;
@@ -14,35 +17,6 @@ String sanitize(const String &msg) {
   out.trim();
   return out;
 }
-
-String jsonEscape(const String &s) {
-  String out;
-  out.reserve(s.length() + 8);
-  for (size_t i = 0; i < s.length(); i += 1) {
-    const char c = s[i];
-    switch (c) {
-    case '\\':
-      out += "\\\\";
-      break;
-    case '"':
-      out += "\\\"";
-      break;
-    case '\n':
-      out += "\\n";
-      break;
-    case '\r':
-      out += "\\r";
-      break;
-    case '\t':
-      out += "\\t";
-      break;
-    default:
-      out += c;
-      break;
-    }
-  }
-  return out;
-}
 } // namespace
 
 const char *HistoryLog::kindToString(HistoryKind kind) {
@@ -74,6 +48,7 @@ void HistoryLog::push(const Entry &e) {
   _entries[_next] = e;
   _next = static_cast<uint8_t>((_next + 1) % kMaxEntries);
   if (_count < kMaxEntries) _count += 1;
+  _seq += 1;
 }
 
 bool HistoryLog::getLogical(uint16_t logicalIndex, Entry &out) const {
@@ -114,6 +89,7 @@ bool HistoryLog::parseLine(const String &line, Entry &out) {
 }
 
 bool HistoryLog::appendToFile(const Entry &e) const {
+  spantrace::Span span(spantrace::Lane::Fs, "history.append");
   File f = LittleFS.open(kHistoryPath, "a");
   if (!f) return false;
   f.print(String(e.localEpoch));
@@ -127,6 +103,7 @@ bool HistoryLog::appendToFile(const Entry &e) const {
 }
 
 bool HistoryLog::compactFile() const {
+  spantrace::Span span(spantrace::Lane::Fs, "history.compact");
   const String tmp = String(kHistoryPath) + ".tmp";
   File out = LittleFS.open(tmp, "w");
   if (!out) return false;
@@ -161,21 +138,6 @@ void HistoryLog::maybeCompactFile() const {
   }
 }
 
-String HistoryLog::serializeEntryJson(const Entry &e) {
-  String msg = String(e.msg);
-  const String esc = jsonEscape(msg);
-  String out;
-  out.reserve(64 + esc.length());
-  out += "{\"t\":";
-  out += String(e.localEpoch);
-  out += ",\"kind\":\"";
-  out += kindToString(e.kind);
-  out += "\",\"msg\":\"";
-  out += esc;
-  out += "\"}";
-  return out;
-}
-
 void HistoryLog::begin() {
   resetMemory();
 
@@ -197,6 +159,9 @@ void HistoryLog::begin() {
 
 void HistoryLog::clear() {
   resetMemory();
+  _version += 1;
+  _seq += 1;
+  _clearedSeq = _seq;
   LittleFS.remove(kHistoryPath);
 }
 
@@ -209,27 +174,54 @@ void HistoryLog::add(uint32_t localEpoch, HistoryKind kind, const String &messag
   e.msg[sizeof(e.msg) - 1] = '\0';
 
   push(e);
+  _version += 1;
   appendToFile(e);
   maybeCompactFile();
 }
 
-String HistoryLog::toJson(uint16_t limit) const {
+void HistoryLog::toJson(JsonWriter &w, uint16_t limit) const {
   if (limit == 0) limit = 1;
   if (limit > _count) limit = _count;
 
-  String out;
-  out.reserve(2048);
-  out += "{\"ok\":true,\"items\":[";
-
+  w.beginObject();
+  w.field("ok", true);
+  w.beginArray("items");
   const uint16_t start = (_count > limit) ? static_cast<uint16_t>(_count - limit) : 0;
-  bool first = true;
   for (uint16_t i = start; i < _count; i += 1) {
     Entry e{};
     if (!getLogical(i, e)) continue;
-    if (!first) out += ",";
-    first = false;
-    out += serializeEntryJson(e);
+    itemJson(w, e);
   }
-  out += "]}";
-  return out;
+  w.endArray();
+  w.endObject();
+}
+
+void HistoryLog::deltaJson(JsonWriter &w, uint32_t afterSeq, uint16_t limit) const {
+  const uint32_t beforeOldest = _seq - _count; // seq of the entry just before the oldest one kept
+  bool reset = afterSeq == 0 || afterSeq > _seq || afterSeq < _clearedSeq || afterSeq < beforeOldest;
+  uint32_t from = reset ? beforeOldest : afterSeq;
+  if (_seq - from > limit) {
+    from = _seq - limit;
+    reset = true;
+  }
+
+  w.beginObject();
+  w.field("reset", reset);
+  w.field("seq", _seq);
+  w.beginArray("items");
+  for (uint16_t i = static_cast<uint16_t>(from - beforeOldest); i < _count; i += 1) {
+    Entry e{};
+    if (!getLogical(i, e)) continue;
+    itemJson(w, e);
+  }
+  w.endArray();
+  w.endObject();
+}
+
+void HistoryLog::itemJson(JsonWriter &w, const Entry &e) {
+  w.beginObject();
+  w.field("t", e.localEpoch);
+  w.field("kind", kindToString(e.kind));
+  w.field("msg", e.msg);
+  w.endObject();
 }
@@ -2,6 +2,8 @@
 
 #include <Arduino.h>
 
+class JsonWriter;
+
 enum class HistoryKind : uint8_t {
   Boot = 0,
   Relay = 1,
@@ -18,7 +20,17 @@ public:
   void add(uint32_t localEpoch, HistoryKind kind, const String &message);
 
   // JSON: {ok:true, items:[{t,kind,msg}, ...]}
-  String toJson(uint16_t limit = 40) const;
+  void toJson(JsonWriter &w, uint16_t limit = 40) const;
+  // Bumps on every add/clear.
+  uint32_t version() const { return _version; }
+
+  // Entries are numbered in the order they were added since boot (the ones loaded from flash first);
+  // clear() uses up a number too, so a cursor from before it is recognised.
+  uint32_t lastSeq() const { return _seq; }
+  // JSON: {reset, seq, items:[...]} with the entries after `afterSeq` (the newest `limit` of them).
+  // reset=true when the caller has to drop what it holds first: unknown cursor, clear() since, or
+  // entries it has not seen are gone from the ring.
+  void deltaJson(JsonWriter &w, uint32_t afterSeq, uint16_t limit) const;
 
 private:
   struct Entry {
@@ -31,10 +43,14 @@ private:
   Entry _entries[kMaxEntries];
   uint8_t _count = 0;
   uint8_t _next = 0;
+  uint32_t _version = 0;
+  uint32_t _seq = 0;
+  uint32_t _clearedSeq = 0;
 
   void resetMemory();
   void push(const Entry &e);
   bool getLogical(uint16_t logicalIndex, Entry &out) const;
+  static void itemJson(JsonWriter &w, const Entry &e);
 
   bool appendToFile(const Entry &e) const;
   void maybeCompactFile() const;
@@ -42,6 +58,5 @@ private:
 
   static const char *kindToString(HistoryKind kind);
   static bool parseLine(const String &line, Entry &out);
-  static String serializeEntryJson(const Entry &e);
 };
 
@@ -0,0 +1,195 @@
+#include "HttpMux.h"
+
+HttpMuxClient::HttpMuxClient(const WiFiClient &client, String &&buffered) : WiFiClient(client) {
+  _buffered = std::make_shared<Buffered>();
+  _buffered->data = std::move(buffered);
+}
+
+size_t HttpMuxClient::bufferedLeft() const { return _buffered ? _buffered->data.length() - _buffered->pos : 0; }
+
+int HttpMuxClient::available() { return static_cast<int>(bufferedLeft()) + WiFiClient::available(); }
+
+int HttpMuxClient::read() {
+  if (!bufferedLeft()) return WiFiClient::read();
+  const char c = _buffered->data[_buffered->pos];
+  _buffered->pos += 1;
+  return static_cast<uint8_t>(c);
+}
+
+int HttpMuxClient::read(uint8_t *buf, size_t size) {
+  const size_t left = bufferedLeft();
+  if (!left) return WiFiClient::read(buf, size);
+  const size_t n = size < left ? size : left;
+  memcpy(buf, _buffered->data.c_str() + _buffered->pos, n);
+  _buffered->pos += n;
+  return static_cast<int>(n);
+}
+
+int HttpMuxClient::peek() {
+  if (!bufferedLeft()) return WiFiClient::peek();
+  return static_cast<uint8_t>(_buffered->data[_buffered->pos]);
+}
+
+size_t HttpMuxClient::readBytes(char *buf, size_t len) {
+  size_t got = 0;
+  while (got < len && bufferedLeft()) {
+    const int n = read(reinterpret_cast<uint8_t *>(buf + got), len - got);
+    if (n <= 0) break;
+    got += static_cast<size_t>(n);
+  }
+  if (got < len) got += WiFiClient::readBytes(buf + got, len - got);
+  return got;
+}
+
+String HttpMuxClient::readStringUntil(char terminator) {
+  String out;
+  while (bufferedLeft()) {
+    const char c = _buffered->data[_buffered->pos];
+    _buffered->pos += 1;
+    if (c == terminator) return out;
+    out += c;
+  }
+  // Only a request larger than the buffer gets here.
+  out += WiFiClient::readStringUntil(terminator);
+  return out;
+}
+
+size_t HttpMuxClient::peekAvailable() {
+  const size_t left = bufferedLeft();
+  return left ? left : WiFiClient::peekAvailable();
+}
+
+const char *HttpMuxClient::peekBuffer() {
+  if (!bufferedLeft()) return WiFiClient::peekBuffer();
+  return _buffered->data.c_str() + _buffered->pos;
+}
+
+void HttpMuxClient::peekConsume(size_t consume) {
+  const size_t left = bufferedLeft();
+  if (!left) {
+    WiFiClient::peekConsume(consume);
+    return;
+  }
+  _buffered->pos += consume < left ? consume : left;
+}
+
+void HttpMuxClient::setTimeout(unsigned long timeoutMs) {
+  WiFiClient::setTimeout(timeoutMs < kWriteTimeoutMs ? timeoutMs : kWriteTimeoutMs);
+}
+
+void HttpMuxServer::close() {
+  for (uint8_t i = 0; i < kMaxConnections; i += 1) {
+    if (_slots[i].used) release(_slots[i], true);
+  }
+  _listener.close();
+}
+
+void HttpMuxServer::reply(WiFiClient &client, const char *status) {
+  client.printf("HTTP/1.1 %s\r\nContent-Length: 0\r\nConnection: close\r\n\r\n", status);
+  client.stop();
+}
+
+bool HttpMuxServer::complete(Slot &s) {
+  if (s.totalBytes < 0) {
+    const int headEnd = s.buf.indexOf("\r\n\r\n");
+    if (headEnd < 0) return false;
+    int32_t body = 0;
+    String head = s.buf.substring(0, static_cast<unsigned>(headEnd));
+    head.toLowerCase();
+    const int at = head.indexOf("\ncontent-length:");
+    if (at >= 0) body = head.substring(static_cast<unsigned>(at) + 16).toInt();
+    s.totalBytes = headEnd + 4 + (body > 0 ? body : 0);
+  }
+  return static_cast<int32_t>(s.buf.length()) >= s.totalBytes;
+}
+
+void HttpMuxServer::release(Slot &s, bool stopClient) {
+  if (stopClient) s.client.stop();
+  s = Slot();
+}
+
+uint8_t HttpMuxServer::open() const {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < kMaxConnections; i += 1) n += _slots[i].used ? 1 : 0;
+  return n;
+}
+
+void HttpMuxServer::poll() {
+  const uint32_t now = millis();
+
+  while (_listener.hasClient()) {
+    WiFiClient client = _listener.accept();
+    if (!client) break;
+    Slot *free = nullptr;
+    for (uint8_t i = 0; i < kMaxConnections && !free; i += 1) {
+      if (!_slots[i].used) free = &_slots[i];
+    }
+    if (!free) {
+      reply(client, "503 Service Unavailable");
+      _stats.rejected += 1;
+      continue;
+    }
+    free->client = client;
+    free->used = true;
+    free->sinceMs = now;
+    _stats.accepted += 1;
+    const uint8_t n = open();
+    if (n > _stats.maxOpen) _stats.maxOpen = n;
+  }
+
+  for (uint8_t i = 0; i < kMaxConnections; i += 1) {
+    Slot &s = _slots[i];
+    if (!s.used || s.ready) continue;
+
+    uint8_t chunk[256];
+    int avail = s.client.available();
+    while (avail > 0 && s.buf.length() < kMaxBufferedBytes) {
+      size_t want = static_cast<size_t>(avail);
+      if (want > sizeof(chunk)) want = sizeof(chunk);
+      if (want > kMaxBufferedBytes - s.buf.length()) want = kMaxBufferedBytes - s.buf.length();
+      const int got = s.client.read(chunk, want);
+      if (got <= 0) break;
+      s.buf.concat(reinterpret_cast<const char *>(chunk), static_cast<unsigned>(got));
+      avail = s.client.available();
+    }
+
+    const bool full = s.buf.length() >= kMaxBufferedBytes;
+    if (complete(s) || full) {
+      if (full && !complete(s)) _stats.oversize += 1;
+      s.ready = true;
+      _seq += 1;
+      s.readySeq = _seq;
+    } else if (!s.client.connected()) {
+      release(s, true);
+      _stats.closedEarly += 1;
+    } else if (now - s.sinceMs > kRequestTimeoutMs) {
+      reply(s.client, "408 Request Timeout");
+      release(s, false);
+      _stats.timedOut += 1;
+    }
+  }
+}
+
+bool HttpMuxServer::hasClient() {
+  for (uint8_t i = 0; i < kMaxConnections; i += 1) {
+    if (_slots[i].ready) return true;
+  }
+  return false;
+}
+
+HttpMuxClient HttpMuxServer::accept() {
+  poll();
+  Slot *next = nullptr;
+  for (uint8_t i = 0; i < kMaxConnections; i += 1) {
+    Slot &s = _slots[i];
+    if (s.ready && (!next || s.readySeq < next->readySeq)) next = &s;
+  }
+  if (!next) return HttpMuxClient();
+
+  HttpMuxClient out(next->client, std::move(next->buf));
+  const uint32_t waited = millis() - next->sinceMs;
+  if (waited > _stats.maxWaitMs) _stats.maxWaitMs = waited;
+  _stats.served += 1;
+  release(*next, false);
+  return out;
+}
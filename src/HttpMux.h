@@ -0,0 +1,115 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <WiFiServer.h>
+
+#include <memory>
+
+// Connection front end for ESP8266WebServer, plugged in as its ServerType template parameter
+// (esp8266webserver::ESP8266WebServerTemplate<HttpMuxServer>), so the route table and handlers stay as
+// they are.
+//
+// The stock server takes one TCP client and then reads its request line, headers and body with
+// blocking timeouts, so one slow phone stalls the loop for seconds. Here every connection is accepted
+// into a small table and read without waiting on each poll(); only a connection whose whole request
+// (headers + Content-Length body) is buffered is handed to the web server, oldest first. Parsing then
+// runs on memory. Limits:
+//   - kMaxConnections at once; another one is answered 503 and closed right away
+//   - kRequestTimeoutMs to deliver a complete request, else 408 and closed
+//   - kMaxBufferedBytes buffered per request; a bigger one is handed over as is (the rest is read
+//     from the socket by the server, as before)
+//   - responses wait at most kWriteTimeoutMs for a stalled peer instead of the server's 5 s
+class HttpMuxClient : public WiFiClient {
+public:
+  static constexpr uint32_t kWriteTimeoutMs = 2000;
+
+  HttpMuxClient() = default;
+  HttpMuxClient(const WiFiClient &client, String &&buffered);
+
+  // Buffered bytes first, then the socket.
+  int available() override;
+  int read() override;
+  int read(uint8_t *buf, size_t size) override;
+  int read(char *buf, size_t size) { return read(reinterpret_cast<uint8_t *>(buf), size); }
+  int peek() override;
+  size_t readBytes(char *buf, size_t len);
+  size_t readBytes(uint8_t *buf, size_t len) { return readBytes(reinterpret_cast<char *>(buf), len); }
+  String readStringUntil(char terminator);
+  bool hasPeekBufferAPI() const override { return true; }
+  size_t peekAvailable() override;
+  const char *peekBuffer() override;
+  void peekConsume(size_t consume) override;
+
+  // Clamped to kWriteTimeoutMs.
+  void setTimeout(unsigned long timeoutMs);
+
+private:
+  struct Buffered {
+    String data;
+    size_t pos = 0;
+  };
+  std::shared_ptr<Buffered> _buffered; // shared by the copies the web server makes
+  size_t bufferedLeft() const;
+};
+
+class HttpMuxServer {
+public:
+  using ClientType = HttpMuxClient;
+
+  static constexpr uint8_t kMaxConnections = 4;
+  static constexpr size_t kMaxBufferedBytes = 4096;
+  static constexpr uint32_t kRequestTimeoutMs = 5000;
+
+  struct Stats {
+    uint32_t accepted = 0;
+    uint32_t served = 0;      // handed to the web server
+    uint32_t rejected = 0;    // 503, table full
+    uint32_t timedOut = 0;    // 408
+    uint32_t closedEarly = 0; // peer went away before sending a whole request
+    uint32_t oversize = 0;    // handed over with only kMaxBufferedBytes buffered
+    uint8_t maxOpen = 0;
+    uint32_t maxWaitMs = 0;   // accept -> handed over
+  };
+
+  explicit HttpMuxServer(uint16_t port) : _listener(port) {}
+  HttpMuxServer(IPAddress addr, uint16_t port) : _listener(addr, port) {}
+
+  void begin() { _listener.begin(); }
+  void begin(uint16_t port) { _listener.begin(port); }
+  void close();
+  void stop() { close(); }
+  void setNoDelay(bool on) { _listener.setNoDelay(on); }
+
+  // Accepts new connections and reads what has arrived, without waiting.
+  void poll();
+  // The oldest complete request, or an empty client.
+  HttpMuxClient accept();
+  HttpMuxClient available() { return accept(); }
+  bool hasClient();
+  bool hasClientData() { return hasClient(); }
+  bool hasMaxPendingClients() const { return open() == kMaxConnections; }
+
+  uint8_t open() const;
+  const Stats &stats() const { return _stats; }
+
+private:
+  struct Slot {
+    WiFiClient client;
+    bool used = false;
+    bool ready = false;
+    String buf;
+    int32_t totalBytes = -1; // head + body, once the head is complete
+    uint32_t sinceMs = 0;
+    uint32_t readySeq = 0;
+  };
+
+  static void reply(WiFiClient &client, const char *status);
+  static bool complete(Slot &s);
+  void release(Slot &s, bool stopClient);
+
+  WiFiServer _listener;
+  Slot _slots[kMaxConnections];
+  uint32_t _seq = 0;
+  Stats _stats;
+};
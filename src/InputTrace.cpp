@@ -0,0 +1,425 @@
+#include "InputTrace.h"
+
+#include <LittleFS.h>
+#include <string.h>
+
+namespace {
+constexpr uint8_t kMagic[4] = {'S', 'H', 'T', 'R'};
+constexpr uint8_t kBootBytes = 4;
+constexpr uint8_t kClockBytes = 8;
+constexpr uint8_t kRelayBytes = 3;
+constexpr uint8_t kSyncBytes = 1;
+constexpr uint8_t kWifiBytes = 10;
+constexpr uint8_t kConfigFixedBytes = 14;
+constexpr uint8_t kWindowBytes = 9;
+constexpr size_t kFlushChunkBytes = 128;
+
+constexpr uint8_t kCfgHolyOnNo = 1 << 0;
+constexpr uint8_t kCfgActiveLow = 1 << 1;
+constexpr uint8_t kCfgDstEnabled = 1 << 2;
+constexpr uint8_t kCfgIsrael = 1 << 3;
+
+void put16(uint8_t *p, uint16_t v) {
+  p[0] = static_cast<uint8_t>(v);
+  p[1] = static_cast<uint8_t>(v >> 8);
+}
+
+void put32(uint8_t *p, uint32_t v) {
+  put16(p, static_cast<uint16_t>(v));
+  put16(p + 2, static_cast<uint16_t>(v >> 16));
+}
+
+uint16_t get16(const uint8_t *p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+
+uint32_t get32(const uint8_t *p) { return get16(p) | (static_cast<uint32_t>(get16(p + 2)) << 16); }
+
+bool sizeOk(InputTrace::Type type, uint8_t len) {
+  switch (type) {
+  case InputTrace::Type::Boot:
+    return len == kBootBytes;
+  case InputTrace::Type::Clock:
+    return len == kClockBytes;
+  case InputTrace::Type::Relay:
+    return len == kRelayBytes;
+  case InputTrace::Type::Sync:
+    return len == kSyncBytes;
+  case InputTrace::Type::Wifi:
+    return len == kWifiBytes;
+  case InputTrace::Type::Http:
+    return len >= 1 && len <= InputTrace::kMaxLineBytes;
+  case InputTrace::Type::Config:
+    return len >= kConfigFixedBytes && (len - kConfigFixedBytes) % kWindowBytes == 0 &&
+           (len - kConfigFixedBytes) / kWindowBytes <= AppConfig::kMaxWindows;
+  default:
+    return false;
+  }
+}
+
+uint32_t fileSize(const char *path) {
+  if (!LittleFS.exists(path)) return 0;
+  File f = LittleFS.open(path, "r");
+  if (!f) return 0;
+  const uint32_t size = static_cast<uint32_t>(f.size());
+  f.close();
+  return size;
+}
+} // namespace
+
+InputTrace::Reader::Reader(const uint8_t *buf, size_t len) : _buf(buf), _len(len) {
+  _headerOk = len >= kFileHeaderBytes && memcmp(buf, kMagic, sizeof(kMagic)) == 0 && buf[4] == kVersion &&
+              buf[5] >= kFileHeaderBytes && buf[5] <= len;
+  _pos = _headerOk ? buf[5] : len;
+}
+
+bool InputTrace::Reader::next(Record &out) {
+  if (_pos + kRecordHeaderBytes > _len) return false;
+  const uint8_t *p = _buf + _pos;
+  const Type type = static_cast<Type>(p[0]);
+  const uint8_t len = p[1];
+  if (!sizeOk(type, len) || _pos + kRecordHeaderBytes + len > _len) return false;
+  out.type = type;
+  out.len = len;
+  out.ms = get32(p + 2);
+  out.data = p + kRecordHeaderBytes;
+  _pos += kRecordHeaderBytes + len;
+  return true;
+}
+
+void InputTrace::begin(ClockFn cycles, uint32_t cyclesPerUs, ClockFn millis) {
+  _cycles = cycles;
+  _cyclesPerUs = cyclesPerUs ? cyclesPerUs : 1;
+  _millis = millis;
+}
+
+void InputTrace::setMode(Mode mode) {
+  if (mode == Mode::Flash && _mode != Mode::Flash) {
+    // Start the file at the oldest record still in RAM, so the boot that enabled it is captured.
+    _flushed = _tail;
+  }
+  _mode = mode;
+}
+
+void InputTrace::put(uint32_t at, const uint8_t *src, size_t len) {
+  for (size_t i = 0; i < len; i += 1) _ring[(at + i) % kRingBytes] = src[i];
+}
+
+void InputTrace::get(uint32_t at, uint8_t *dst, size_t len) const {
+  for (size_t i = 0; i < len; i += 1) dst[i] = _ring[(at + i) % kRingBytes];
+}
+
+void InputTrace::evictOldest() {
+  uint8_t hdr[2];
+  get(_tail, hdr, sizeof(hdr));
+  _tail += kRecordHeaderBytes + hdr[1];
+  _ringRecords -= 1;
+  _stats.dropped += 1;
+}
+
+bool InputTrace::append(Type type, const uint8_t *payload, uint8_t len) {
+  if (_mode == Mode::Off) return false;
+  const uint32_t start = _cycles ? _cycles() : 0;
+
+  const uint32_t size = kRecordHeaderBytes + len;
+  while (_head - _tail + size > kRingBytes) evictOldest();
+
+  uint8_t hdr[kRecordHeaderBytes];
+  hdr[0] = static_cast<uint8_t>(type);
+  hdr[1] = len;
+  put32(hdr + 2, _millis ? _millis() : 0);
+  put(_head, hdr, sizeof(hdr));
+  put(_head + kRecordHeaderBytes, payload, len);
+  _head += size;
+  _ringRecords += 1;
+
+  _stats.records += 1;
+  _stats.bytes += size;
+  if (_cycles) {
+    const uint32_t spent = _cycles() - start;
+    _stats.recordCycles += spent;
+    if (spent > _stats.maxRecordCycles) _stats.maxRecordCycles = spent;
+  }
+  return true;
+}
+
+void InputTrace::boot(const BootRecord &r) {
+  _haveClock = false;
+  uint8_t p[kBootBytes];
+  p[0] = r.reason;
+  p[1] = r.restoredOn ? 1 : 0;
+  p[2] = r.source;
+  p[3] = r.relayOn ? 1 : 0;
+  append(Type::Boot, p, sizeof(p));
+}
+
+void InputTrace::clock(int64_t wallUs, const AppConfig &cfg, bool relayOn) {
+  if (_mode == Mode::Off) return;
+  const uint32_t ms = _millis ? _millis() : 0;
+  const bool keyframe = !_haveClock || (ms - _anchorMs) >= kClockAnchorMs;
+  bool step = false;
+  if (!keyframe) {
+    const int64_t predicted = _clockWallUs + static_cast<int64_t>(ms - _clockMs) * 1000LL;
+    const int64_t drift = wallUs - predicted;
+    step = drift > kClockStepUs || drift < -kClockStepUs;
+  }
+  _haveClock = true;
+  _clockMs = ms;
+  _clockWallUs = wallUs;
+  if (!keyframe && !step) return;
+
+  if (keyframe) {
+    _anchorMs = ms;
+    config(cfg);
+    const uint8_t sync = relayOn ? 1 : 0;
+    append(Type::Sync, &sync, sizeof(sync));
+  }
+  uint8_t p[kClockBytes];
+  put32(p, static_cast<uint32_t>(static_cast<uint64_t>(wallUs)));
+  put32(p + 4, static_cast<uint32_t>(static_cast<uint64_t>(wallUs) >> 32));
+  append(Type::Clock, p, sizeof(p));
+}
+
+void InputTrace::config(const AppConfig &cfg) {
+  uint8_t p[kConfigFixedBytes + kWindowBytes * AppConfig::kMaxWindows];
+  const uint8_t windows = cfg.windowCount < AppConfig::kMaxWindows ? cfg.windowCount : AppConfig::kMaxWindows;
+  p[0] = cfg.runMode;
+  p[1] = cfg.relayBootMode;
+  p[2] = static_cast<uint8_t>((cfg.relayHolyOnNo ? kCfgHolyOnNo : 0) | (cfg.relayActiveLow ? kCfgActiveLow : 0) |
+                              (cfg.dstEnabled ? kCfgDstEnabled : 0) | (cfg.israel ? kCfgIsrael : 0));
+  p[3] = cfg.dstMode;
+  put16(p + 4, static_cast<uint16_t>(cfg.tzOffsetMinutes));
+  put16(p + 6, static_cast<uint16_t>(cfg.dstOffsetMinutes));
+  put16(p + 8, static_cast<uint16_t>(cfg.minutesBeforeShkia));
+  put16(p + 10, static_cast<uint16_t>(cfg.minutesAfterTzeit));
+  p[12] = static_cast<uint8_t>(cfg.relayGpio);
+  p[13] = windows;
+  for (uint8_t i = 0; i < windows; i += 1) {
+    uint8_t *w = p + kConfigFixedBytes + i * kWindowBytes;
+    put32(w, cfg.windows[i].startUtc);
+    put32(w + 4, cfg.windows[i].endUtc);
+    w[8] = cfg.windows[i].on ? 1 : 0;
+  }
+  append(Type::Config, p, static_cast<uint8_t>(kConfigFixedBytes + windows * kWindowBytes));
+}
+
+void InputTrace::relay(const RelayRecord &r) {
+  uint8_t p[kRelayBytes];
+  p[0] = r.on ? 1 : 0;
+  p[1] = r.holy ? 1 : 0;
+  p[2] = static_cast<uint8_t>(r.cause);
+  append(Type::Relay, p, sizeof(p));
+}
+
+void InputTrace::wifi(const WifiRecord &r) {
+  uint8_t p[kWifiBytes];
+  p[0] = r.changes;
+  p[1] = static_cast<uint8_t>((r.staConnected ? 1 : 0) | (r.apActive ? 2 : 0));
+  p[2] = r.apClients;
+  p[3] = r.channel;
+  put16(p + 4, r.disconnectReason);
+  put32(p + 6, r.staIp);
+  append(Type::Wifi, p, sizeof(p));
+}
+
+void InputTrace::http(const char *method, const char *uri) {
+  if (_mode == Mode::Off) return;
+  uint8_t p[kMaxLineBytes];
+  uint8_t len = 0;
+  auto add = [&](char c) {
+    if (len < kMaxLineBytes) {
+      p[len] = static_cast<uint8_t>(c);
+      len += 1;
+    }
+  };
+  for (const char *s = method; s && *s && len < kMaxLineBytes; s += 1) add(*s);
+  add(' ');
+  for (const char *s = uri; s && *s && len < kMaxLineBytes; s += 1) add(*s);
+  append(Type::Http, p, len);
+}
+
+void InputTrace::clear() {
+  _head = 0;
+  _tail = 0;
+  _flushed = 0;
+  _ringRecords = 0;
+  _haveClock = false;
+  _stats = {};
+  LittleFS.remove(kFilePath);
+  LittleFS.remove(kOldFilePath);
+}
+
+bool InputTrace::flush() {
+  if (_mode != Mode::Flash) return true;
+  if (static_cast<int32_t>(_tail - _flushed) > 0) {
+    _stats.lostBytes += _tail - _flushed;
+    _flushed = _tail;
+  }
+  const uint32_t pending = _head - _flushed;
+  if (pending == 0) return true;
+  const uint32_t start = _cycles ? _cycles() : 0;
+
+  uint32_t size = fileSize(kFilePath);
+  if (size && size + pending > kFileMaxBytes) {
+    LittleFS.remove(kOldFilePath);
+    LittleFS.rename(kFilePath, kOldFilePath);
+    size = 0;
+  }
+  File f = LittleFS.open(kFilePath, "a");
+  bool ok = static_cast<bool>(f);
+  if (ok && size == 0) {
+    uint8_t hdr[kFileHeaderBytes];
+    fileHeader(hdr);
+    ok = f.write(hdr, sizeof(hdr)) == sizeof(hdr);
+  }
+  uint32_t done = 0;
+  while (ok && done < pending) {
+    uint8_t chunk[kFlushChunkBytes];
+    const size_t n = (pending - done) < sizeof(chunk) ? (pending - done) : sizeof(chunk);
+    get(_flushed + done, chunk, n);
+    ok = f.write(chunk, n) == n;
+    if (ok) done += n;
+  }
+  if (f) f.close();
+
+  _stats.flushes += 1;
+  if (!ok) {
+    _stats.flushFailures += 1;
+    return false;
+  }
+  _flushed += done;
+  _stats.flushedBytes += done;
+  if (_cycles) {
+    const uint32_t us = (_cycles() - start) / _cyclesPerUs;
+    if (us > _stats.maxFlushUs) _stats.maxFlushUs = us;
+  }
+  return true;
+}
+
+uint32_t InputTrace::fileBytes() const { return fileSize(kFilePath); }
+
+uint32_t InputTrace::oldFileBytes() const { return fileSize(kOldFilePath); }
+
+size_t InputTrace::copyOut(size_t offset, uint8_t *out, size_t cap) const {
+  const size_t used = usedBytes();
+  if (offset >= used) return 0;
+  const size_t n = (used - offset) < cap ? (used - offset) : cap;
+  get(_tail + static_cast<uint32_t>(offset), out, n);
+  return n;
+}
+
+void InputTrace::fileHeader(uint8_t out[kFileHeaderBytes]) {
+  memcpy(out, kMagic, sizeof(kMagic));
+  out[4] = kVersion;
+  out[5] = static_cast<uint8_t>(kFileHeaderBytes);
+  out[6] = 0;
+  out[7] = 0;
+}
+
+bool InputTrace::decode(const Record &r, BootRecord &out) {
+  if (r.type != Type::Boot || r.len != kBootBytes) return false;
+  out.reason = r.data[0];
+  out.restoredOn = r.data[1] != 0;
+  out.source = r.data[2];
+  out.relayOn = r.data[3] != 0;
+  return true;
+}
+
+bool InputTrace::decode(const Record &r, ClockRecord &out) {
+  if (r.type != Type::Clock || r.len != kClockBytes) return false;
+  out.wallUs = static_cast<int64_t>(static_cast<uint64_t>(get32(r.data)) | (static_cast<uint64_t>(get32(r.data + 4)) << 32));
+  return true;
+}
+
+bool InputTrace::decode(const Record &r, SyncRecord &out) {
+  if (r.type != Type::Sync || r.len != kSyncBytes) return false;
+  out.relayOn = r.data[0] != 0;
+  return true;
+}
+
+bool InputTrace::decode(const Record &r, RelayRecord &out) {
+  if (r.type != Type::Relay || r.len != kRelayBytes) return false;
+  out.on = r.data[0] != 0;
+  out.holy = r.data[1] != 0;
+  out.cause = static_cast<RelayCause>(r.data[2]);
+  return true;
+}
+
+bool InputTrace::decode(const Record &r, WifiRecord &out) {
+  if (r.type != Type::Wifi || r.len != kWifiBytes) return false;
+  out.changes = r.data[0];
+  out.staConnected = (r.data[1] & 1) != 0;
+  out.apActive = (r.data[1] & 2) != 0;
+  out.apClients = r.data[2];
+  out.channel = r.data[3];
+  out.disconnectReason = get16(r.data + 4);
+  out.staIp = get32(r.data + 6);
+  return true;
+}
+
+bool InputTrace::decode(const Record &r, HttpRecord &out) {
+  if (r.type != Type::Http || !sizeOk(r.type, r.len)) return false;
+  memcpy(out.line, r.data, r.len);
+  out.line[r.len] = '\0';
+  return true;
+}
+
+bool InputTrace::decode(const Record &r, AppConfig &out) {
+  if (r.type != Type::Config || !sizeOk(r.type, r.len)) return false;
+  const uint8_t *p = r.data;
+  if (p[13] != (r.len - kConfigFixedBytes) / kWindowBytes) return false;
+  out.runMode = p[0];
+  out.relayBootMode = p[1];
+  out.relayHolyOnNo = (p[2] & kCfgHolyOnNo) != 0;
+  out.relayActiveLow = (p[2] & kCfgActiveLow) != 0;
+  out.dstEnabled = (p[2] & kCfgDstEnabled) != 0;
+  out.israel = (p[2] & kCfgIsrael) != 0;
+  out.dstMode = p[3];
+  out.tzOffsetMinutes = static_cast<int16_t>(get16(p + 4));
+  out.dstOffsetMinutes = static_cast<int16_t>(get16(p + 6));
+  out.minutesBeforeShkia = static_cast<int16_t>(get16(p + 8));
+  out.minutesAfterTzeit = static_cast<int16_t>(get16(p + 10));
+  out.relayGpio = p[12];
+  out.windowCount = p[13];
+  for (uint8_t i = 0; i < out.windowCount; i += 1) {
+    const uint8_t *w = p + kConfigFixedBytes + i * kWindowBytes;
+    out.windows[i].startUtc = get32(w);
+    out.windows[i].endUtc = get32(w + 4);
+    out.windows[i].on = w[8] != 0;
+  }
+  return true;
+}
+
+const char *InputTrace::typeName(Type type) {
+  switch (type) {
+  case Type::Boot:
+    return "boot";
+  case Type::Clock:
+    return "clock";
+  case Type::Config:
+    return "config";
+  case Type::Relay:
+    return "relay";
+  case Type::Wifi:
+    return "wifi";
+  case Type::Http:
+    return "http";
+  case Type::Sync:
+    return "sync";
+  default:
+    return "?";
+  }
+}
+
+const char *InputTrace::causeName(RelayCause cause) {
+  switch (cause) {
+  case RelayCause::Schedule:
+    return "schedule";
+  case RelayCause::Override:
+    return "override";
+  case RelayCause::NoClock:
+    return "noclock";
+  case RelayCause::RunMode:
+    return "runmode";
+  default:
+    return "?";
+  }
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "AppConfig.h"
+
+// Compact binary record of the control loop's inputs, for replaying field issues on the host
+// (tools/trace_replay.sh).
+//
+// Records go into a fixed RAM ring (oldest dropped first) and, in Flash mode, are appended to
+// LittleFS by flush(). What is recorded is exactly what the relay pass depends on plus context:
+// boots, wall-clock readings, config snapshots, relay transitions, Wi‑Fi changes and HTTP request
+// lines. The relay pass also writes a keyframe (config + relay state + clock) after every boot and
+// every kClockAnchorMs, so a replay can start from a ring whose boot record was already evicted.
+//
+// Overhead is bounded: one record is at most kRecordHeaderBytes + 255 bytes copied into static
+// storage (no allocation), and every append is timed with the injected cycle counter.
+//
+// Wire format (little endian): file header "SHTR", version, header size, 2 reserved bytes; then
+// records of {type u8, payload length u8, uptime ms u32, payload}.
+class InputTrace {
+public:
+  static constexpr size_t kRingBytes = 4096;
+  static constexpr size_t kFileHeaderBytes = 8;
+  static constexpr size_t kRecordHeaderBytes = 6;
+  static constexpr uint8_t kVersion = 1;
+  static constexpr uint8_t kMaxLineBytes = 64;        // HTTP request lines are truncated to this
+  static constexpr int64_t kClockStepUs = 20000;      // wall-clock jumps larger than this are recorded
+  static constexpr uint32_t kClockAnchorMs = 600000UL; // unconditional clock reading every 10 min
+  static constexpr uint32_t kFileMaxBytes = 32UL * 1024UL; // per file; one older file is kept
+
+  static constexpr const char *kFilePath = "/trace.bin";
+  static constexpr const char *kOldFilePath = "/trace.old.bin";
+
+  enum class Mode : uint8_t { Off = 0, Ram, Flash };
+  enum class Type : uint8_t { Boot = 1, Clock, Config, Relay, Wifi, Http, Sync };
+  enum class RelayCause : uint8_t { Schedule = 0, Override, NoClock, RunMode };
+
+  using ClockFn = uint32_t (*)();
+
+  struct Stats {
+    uint32_t records = 0;
+    uint64_t bytes = 0;          // appended since boot/clear (headers included)
+    uint32_t dropped = 0;        // records evicted from the ring
+    uint64_t recordCycles = 0;   // time spent appending
+    uint32_t maxRecordCycles = 0;
+    uint32_t flushes = 0;
+    uint32_t flushFailures = 0;
+    uint64_t flushedBytes = 0;
+    uint32_t lostBytes = 0;      // evicted before they reached the file (Flash mode)
+    uint32_t maxFlushUs = 0;
+  };
+
+  struct BootRecord {
+    uint8_t reason = 0; // rst_info.reason
+    bool restoredOn = false;
+    uint8_t source = 0; // relaystate::Source
+    bool relayOn = false; // after the boot mode was applied
+  };
+
+  struct ClockRecord {
+    int64_t wallUs = 0;
+  };
+
+  struct SyncRecord {
+    bool relayOn = false;
+  };
+
+  struct RelayRecord {
+    bool on = false;
+    bool holy = false;
+    RelayCause cause = RelayCause::Schedule;
+  };
+
+  struct WifiRecord {
+    uint8_t changes = 0; // NetChange bits
+    bool staConnected = false;
+    bool apActive = false;
+    uint8_t apClients = 0;
+    uint8_t channel = 0;
+    uint16_t disconnectReason = 0;
+    uint32_t staIp = 0;
+  };
+
+  struct HttpRecord {
+    char line[kMaxLineBytes + 1] = {};
+  };
+
+  // A decoded record; `data` points into the buffer handed to Reader.
+  struct Record {
+    Type type = Type::Boot;
+    uint8_t len = 0;
+    uint32_t ms = 0;
+    const uint8_t *data = nullptr;
+  };
+
+  // Walks a trace image (file header + records). Stops at the first malformed record.
+  class Reader {
+  public:
+    Reader(const uint8_t *buf, size_t len);
+    bool headerOk() const { return _headerOk; }
+    bool next(Record &out);
+    // True when the walk stopped before the end of the buffer.
+    bool truncated() const { return _pos < _len; }
+    size_t offset() const { return _pos; }
+
+  private:
+    const uint8_t *_buf;
+    size_t _len;
+    size_t _pos = 0;
+    bool _headerOk = false;
+  };
+
+  void begin(ClockFn cycles, uint32_t cyclesPerUs, ClockFn millis);
+  void setMode(Mode mode);
+  Mode mode() const { return _mode; }
+  bool enabled() const { return _mode != Mode::Off; }
+
+  void boot(const BootRecord &r);
+  // Call from the relay pass, before it decides. Writes a keyframe (Config, Sync, Clock) on the
+  // first pass after boot/clear and every kClockAnchorMs; otherwise a Clock record only when the
+  // reading stepped by more than kClockStepUs from the one before.
+  void clock(int64_t wallUs, const AppConfig &cfg, bool relayOn);
+  void config(const AppConfig &cfg);
+  void relay(const RelayRecord &r);
+  void wifi(const WifiRecord &r);
+  // `method` + ' ' + `uri`, truncated to kMaxLineBytes.
+  void http(const char *method, const char *uri);
+
+  // Drops the ring and both trace files.
+  void clear();
+
+  // Flash mode: appends records not yet on LittleFS (rotating at kFileMaxBytes). No-op otherwise.
+  bool flush();
+  uint32_t fileBytes() const;
+  uint32_t oldFileBytes() const;
+
+  const Stats &stats() const { return _stats; }
+  uint32_t cyclesPerUs() const { return _cyclesPerUs; }
+  size_t usedBytes() const { return static_cast<size_t>(_head - _tail); }
+  uint32_t ringRecords() const { return _ringRecords; }
+  // Copies ring bytes [offset, offset + cap) counted from the oldest record. Returns bytes copied.
+  size_t copyOut(size_t offset, uint8_t *out, size_t cap) const;
+  static void fileHeader(uint8_t out[kFileHeaderBytes]);
+
+  static bool decode(const Record &r, BootRecord &out);
+  static bool decode(const Record &r, ClockRecord &out);
+  static bool decode(const Record &r, SyncRecord &out);
+  static bool decode(const Record &r, RelayRecord &out);
+  static bool decode(const Record &r, WifiRecord &out);
+  static bool decode(const Record &r, HttpRecord &out);
+  // Overwrites only the fields a config record carries.
+  static bool decode(const Record &r, AppConfig &out);
+  static const char *typeName(Type type);
+  static const char *causeName(RelayCause cause);
+
+private:
+  bool append(Type type, const uint8_t *payload, uint8_t len);
+  void put(uint32_t at, const uint8_t *src, size_t len);
+  void get(uint32_t at, uint8_t *dst, size_t len) const;
+  void evictOldest();
+
+  ClockFn _cycles = nullptr;
+  ClockFn _millis = nullptr;
+  uint32_t _cyclesPerUs = 80;
+  Mode _mode = Mode::Ram;
+
+  uint8_t _ring[kRingBytes] = {};
+  // Absolute byte positions (ring index = position % kRingBytes); always on record boundaries.
+  uint32_t _head = 0;
+  uint32_t _tail = 0;
+  uint32_t _flushed = 0;
+  uint32_t _ringRecords = 0;
+
+  bool _haveClock = false;
+  uint32_t _clockMs = 0;
+  int64_t _clockWallUs = 0;
+  uint32_t _anchorMs = 0;
+
+  Stats _stats;
+};
@@ -0,0 +1,162 @@
+#include "JobQueue.h"
+
+#include "AppLog.h"
+#include "JsonWriter.h"
+#include "SpanTrace.h"
+
+void JobQueue::begin(uint32_t firstId) {
+  _nextId = firstId ? firstId : 1;
+  for (uint8_t i = 0; i < kMaxJobs; i += 1) _jobs[i] = Job();
+  _stats = Stats();
+}
+
+uint32_t JobQueue::enqueue(const char *kind, uint32_t timeoutMs, StepFn step, uint32_t nowMs) {
+  Job *free = nullptr;
+  Job *oldestFinished = nullptr;
+  for (uint8_t i = 0; i < kMaxJobs; i += 1) {
+    Job &j = _jobs[i];
+    if (!j.id) {
+      if (!free) free = &j;
+    } else if (!finished(j)) {
+      if (strcmp(j.kind, kind) == 0) return j.id;
+    } else if (!oldestFinished || nowMs - j.finishedMs > nowMs - oldestFinished->finishedMs) {
+      oldestFinished = &j;
+    }
+  }
+  Job *slot = free ? free : oldestFinished;
+  if (!slot) {
+    _stats.rejected += 1;
+    return 0;
+  }
+
+  *slot = Job();
+  slot->id = _nextId;
+  _nextId += 1;
+  if (!_nextId) _nextId = 1;
+  slot->kind = kind;
+  slot->queuedMs = nowMs;
+  slot->timeoutMs = timeoutMs;
+  slot->step = std::move(step);
+  _stats.queued += 1;
+  applog::info(applog::Module::Web, "job %lu %s queued", static_cast<unsigned long>(slot->id), kind);
+  return slot->id;
+}
+
+void JobQueue::tick(uint32_t nowMs) {
+  Job *next = nullptr;
+  for (uint8_t i = 0; i < kMaxJobs; i += 1) {
+    Job &j = _jobs[i];
+    if (!j.id || finished(j)) continue;
+    if (!next || nowMs - j.queuedMs > nowMs - next->queuedMs) next = &j;
+  }
+  if (!next) return;
+
+  Job &j = *next;
+  if (j.state == State::Queued) {
+    j.state = State::Running;
+    j.startedMs = nowMs;
+  }
+  if (j.timeoutMs && nowMs - j.startedMs > j.timeoutMs) {
+    j.ok = false;
+    j.message = "timeout";
+    _stats.timedOut += 1;
+    finish(j, nowMs);
+    return;
+  }
+
+  const uint32_t startUs = micros();
+  bool done = false;
+  {
+    spantrace::Span span(spantrace::Lane::Http, j.kind);
+    done = j.step(j);
+  }
+  const uint32_t stepUs = micros() - startUs;
+  if (stepUs > _stats.maxStepUs) _stats.maxStepUs = stepUs;
+  j.steps += 1;
+  if (done) finish(j, millis());
+}
+
+void JobQueue::finish(Job &j, uint32_t nowMs) {
+  j.state = j.ok ? State::Done : State::Failed;
+  j.finishedMs = nowMs;
+  if (j.ok) j.progress = 100;
+  j.step = nullptr; // drops whatever the step captured
+  if (j.ok) {
+    _stats.done += 1;
+  } else {
+    _stats.failed += 1;
+  }
+  applog::info(applog::Module::Web, "job %lu %s %s in %lums (%u steps)%s%s", static_cast<unsigned long>(j.id), j.kind,
+               stateName(j.state), static_cast<unsigned long>(nowMs - j.startedMs), static_cast<unsigned>(j.steps),
+               j.message.length() ? ": " : "", j.message.c_str());
+}
+
+const JobQueue::Job *JobQueue::find(uint32_t id) const {
+  if (!id) return nullptr;
+  for (uint8_t i = 0; i < kMaxJobs; i += 1) {
+    if (_jobs[i].id == id) return &_jobs[i];
+  }
+  return nullptr;
+}
+
+bool JobQueue::busy() const {
+  for (uint8_t i = 0; i < kMaxJobs; i += 1) {
+    if (_jobs[i].id && !finished(_jobs[i])) return true;
+  }
+  return false;
+}
+
+const char *JobQueue::stateName(State s) {
+  switch (s) {
+  case State::Queued:
+    return "queued";
+  case State::Running:
+    return "running";
+  case State::Done:
+    return "done";
+  case State::Failed:
+    return "failed";
+  default:
+    return "unknown";
+  }
+}
+
+void JobQueue::jobJson(JsonWriter &w, const Job &job, uint32_t nowMs) {
+  const bool over = finished(job);
+  w.beginObject();
+  w.field("ok", true);
+  w.field("id", job.id);
+  w.field("kind", job.kind);
+  w.field("state", stateName(job.state));
+  w.field("done", over);
+  w.field("progress", job.progress);
+  w.field("message", job.message);
+  w.field("queuedMs", nowMs - job.queuedMs);
+  w.field("runMs", job.startedMs ? (over ? job.finishedMs : nowMs) - job.startedMs : 0);
+  w.field("steps", job.steps);
+  if (job.result.length()) {
+    w.key("result");
+    w.raw(job.result.c_str(), job.result.length());
+  }
+  w.endObject();
+}
+
+void JobQueue::listJson(JsonWriter &w, uint32_t nowMs) const {
+  w.beginObject();
+  w.field("ok", true);
+  w.field("busy", busy());
+  w.beginObject("stats");
+  w.field("queued", _stats.queued);
+  w.field("done", _stats.done);
+  w.field("failed", _stats.failed);
+  w.field("timedOut", _stats.timedOut);
+  w.field("rejected", _stats.rejected);
+  w.field("maxStepUs", _stats.maxStepUs);
+  w.endObject();
+  w.beginArray("jobs");
+  for (uint8_t i = 0; i < kMaxJobs; i += 1) {
+    if (_jobs[i].id) jobJson(w, _jobs[i], nowMs);
+  }
+  w.endArray();
+  w.endObject();
+}
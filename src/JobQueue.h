@@ -0,0 +1,81 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <functional>
+
+class JsonWriter;
+
+// Long-running API operations (OTA check/update, NTP sync, Wi-Fi scan) as background jobs: the HTTP
+// handler only enqueues and answers 202 with the job id, tick() (a main-loop task) advances the work one
+// bounded step at a time, and the page polls GET /api/jobs/<id>.
+//
+// One job runs at a time, oldest first: they all compete for the radio and the TLS heap. A kind that is
+// already queued or running is not queued twice, the caller gets the pending job instead. Finished jobs
+// stay readable until their slot is needed.
+class JobQueue {
+public:
+  static constexpr uint8_t kMaxJobs = 4;
+
+  enum class State : uint8_t {
+    Queued = 0,
+    Running,
+    Done,
+    Failed,
+  };
+
+  struct Job;
+  // Does one bounded piece of work; returns true when the job is finished (ok/message/result set).
+  using StepFn = std::function<bool(Job &)>;
+
+  struct Job {
+    uint32_t id = 0; // 0 = free slot
+    const char *kind = "";
+    State state = State::Queued;
+    bool ok = false;
+    uint8_t progress = 0; // percent, when the step knows it
+    String message;
+    String result; // JSON value ("" = none)
+    uint16_t steps = 0;
+    uint32_t queuedMs = 0;
+    uint32_t startedMs = 0;
+    uint32_t finishedMs = 0;
+    uint32_t timeoutMs = 0; // from the first step; 0 = none
+    StepFn step;
+  };
+
+  struct Stats {
+    uint32_t queued = 0;
+    uint32_t done = 0;
+    uint32_t failed = 0;
+    uint32_t timedOut = 0;
+    uint32_t rejected = 0; // every slot held an unfinished job
+    uint32_t maxStepUs = 0;
+  };
+
+  // Ids continue from `firstId`, so ids from before a reboot are not reused right away.
+  void begin(uint32_t firstId);
+  // Returns the job id, or 0 when the queue is full.
+  uint32_t enqueue(const char *kind, uint32_t timeoutMs, StepFn step, uint32_t nowMs);
+  // Runs one step of the oldest unfinished job.
+  void tick(uint32_t nowMs);
+
+  const Job *find(uint32_t id) const;
+  bool busy() const;
+  const Stats &stats() const { return _stats; }
+
+  // {ok, id, kind, state, done, progress, message, queuedMs, runMs, steps, result?}
+  static void jobJson(JsonWriter &w, const Job &job, uint32_t nowMs);
+  // {ok, busy, stats, jobs:[...]}
+  void listJson(JsonWriter &w, uint32_t nowMs) const;
+
+  static const char *stateName(State s);
+
+private:
+  static bool finished(const Job &j) { return j.state == State::Done || j.state == State::Failed; }
+  void finish(Job &j, uint32_t nowMs);
+
+  Job _jobs[kMaxJobs];
+  uint32_t _nextId = 1;
+  Stats _stats;
+};
@@ -0,0 +1,215 @@
+#include "JsonWriter.h"
+
+#include <math.h>
+
+void JsonWriter::beginObject(const char *k) {
+  if (k) key(k);
+  separate();
+  put('{');
+  if (_depth < kMaxDepth) _depth += 1;
+  _hasItems &= ~(1UL << _depth);
+}
+
+void JsonWriter::endObject() {
+  if (_depth) _depth -= 1;
+  put('}');
+}
+
+void JsonWriter::beginArray(const char *k) {
+  if (k) key(k);
+  separate();
+  put('[');
+  if (_depth < kMaxDepth) _depth += 1;
+  _hasItems &= ~(1UL << _depth);
+}
+
+void JsonWriter::endArray() {
+  if (_depth) _depth -= 1;
+  put(']');
+}
+
+void JsonWriter::key(const char *k) {
+  separate();
+  quoted(k, strlen(k));
+  put(':');
+  _afterKey = true;
+}
+
+void JsonWriter::value(bool v) {
+  separate();
+  if (v) {
+    write("true", 4);
+  } else {
+    write("false", 5);
+  }
+}
+
+void JsonWriter::value(const char *v) {
+  if (!v) {
+    null();
+    return;
+  }
+  string(v, strlen(v));
+}
+
+void JsonWriter::value(const __FlashStringHelper *v) {
+  if (!v) {
+    null();
+    return;
+  }
+  // Flash is read in words on the ESP8266, so the text is copied out in small pieces first.
+  const char *p = reinterpret_cast<const char *>(v);
+  const size_t n = strlen_P(p);
+  char piece[32];
+  separate();
+  put('"');
+  for (size_t off = 0; off < n; off += sizeof(piece)) {
+    const size_t take = (n - off < sizeof(piece)) ? n - off : sizeof(piece);
+    memcpy_P(piece, p + off, take);
+    escaped(piece, take);
+  }
+  put('"');
+}
+
+void JsonWriter::value(const IPAddress &ip) {
+  char buf[16];
+  const int n = snprintf(buf, sizeof(buf), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+  string(buf, static_cast<size_t>(n));
+}
+
+void JsonWriter::value(double v, uint8_t decimals) {
+  if (isnan(v) || isinf(v)) {
+    null();
+    return;
+  }
+  separate();
+  char buf[32];
+  int n = snprintf(buf, sizeof(buf), "%.*f", static_cast<int>(decimals), v);
+  if (n <= 0 || n >= static_cast<int>(sizeof(buf))) {
+    write("0", 1);
+    return;
+  }
+  // 1.500 -> 1.5, 2.000 -> 2
+  if (decimals) {
+    while (n > 1 && buf[n - 1] == '0') n -= 1;
+    if (buf[n - 1] == '.') n -= 1;
+  }
+  write(buf, static_cast<size_t>(n));
+}
+
+void JsonWriter::null() {
+  separate();
+  write("null", 4);
+}
+
+void JsonWriter::raw(const char *json, size_t len) {
+  separate();
+  write(json, len);
+}
+
+void JsonWriter::flush() {
+  if (!_len) return;
+  const size_t n = _out.write(reinterpret_cast<const uint8_t *>(_buf), _len);
+  if (n != _len) _ok = false;
+  _written += _len;
+  _len = 0;
+}
+
+void JsonWriter::separate() {
+  if (_afterKey) {
+    _afterKey = false;
+    return;
+  }
+  const uint32_t bit = 1UL << _depth;
+  if (_hasItems & bit) put(',');
+  _hasItems |= bit;
+}
+
+void JsonWriter::put(char c) {
+  if (_len == kBufferBytes) flush();
+  _buf[_len] = c;
+  _len += 1;
+}
+
+void JsonWriter::write(const char *s, size_t n) {
+  while (n) {
+    if (_len == kBufferBytes) flush();
+    size_t take = kBufferBytes - _len;
+    if (take > n) take = n;
+    memcpy(_buf + _len, s, take);
+    _len += take;
+    s += take;
+    n -= take;
+  }
+}
+
+void JsonWriter::string(const char *s, size_t n) {
+  separate();
+  quoted(s, n);
+}
+
+void JsonWriter::quoted(const char *s, size_t n) {
+  put('"');
+  escaped(s, n);
+  put('"');
+}
+
+void JsonWriter::escaped(const char *s, size_t n) {
+  size_t run = 0; // bytes of s[run..i) that need no escaping, copied in one go
+  for (size_t i = 0; i < n; i += 1) {
+    const uint8_t c = static_cast<uint8_t>(s[i]);
+    if (c >= 0x20 && c != '"' && c != '\\') continue;
+    write(s + run, i - run);
+    run = i + 1;
+    switch (c) {
+    case '"':
+      write("\\\"", 2);
+      break;
+    case '\\':
+      write("\\\\", 2);
+      break;
+    case '\n':
+      write("\\n", 2);
+      break;
+    case '\r':
+      write("\\r", 2);
+      break;
+    case '\t':
+      write("\\t", 2);
+      break;
+    default: {
+      char esc[7];
+      snprintf(esc, sizeof(esc), "\\u%04x", static_cast<unsigned>(c));
+      write(esc, 6);
+      break;
+    }
+    }
+  }
+  write(s + run, n - run);
+}
+
+void JsonWriter::number(unsigned long long v) {
+  char buf[20];
+  size_t n = 0;
+  // 32-bit division is native on the ESP8266; 64-bit only for the rare value that needs it.
+  if (v <= 0xFFFFFFFFULL) {
+    uint32_t u = static_cast<uint32_t>(v);
+    do {
+      buf[n] = static_cast<char>('0' + u % 10);
+      n += 1;
+      u /= 10;
+    } while (u);
+  } else {
+    do {
+      buf[n] = static_cast<char>('0' + v % 10);
+      n += 1;
+      v /= 10;
+    } while (v);
+  }
+  for (size_t i = 0; i < n / 2; i += 1) {
+    const char t = buf[i];
+    buf[i] = buf[n - 1 - i];
+    buf[n - 1 - i] = t;
+  }
+  write(buf, n);
+}
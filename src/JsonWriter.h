@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+#include <type_traits>
+
+// Streaming JSON output for the *Json() producers: values go through a fixed kBufferBytes buffer (on the
+// caller's stack) straight into a Print, typically a chunked HTTP response or a LittleFS file, so no
+// document or String of the whole body is ever built.
+//
+// Structure is the caller's job (begin/end must pair up); the writer only inserts commas and escapes
+// strings. Inside an object use field(key, value) / beginObject(key) / beginArray(key), inside an array
+// value(v) / beginObject() / beginArray(). Nesting is limited to kMaxDepth.
+class JsonWriter {
+public:
+  static constexpr size_t kBufferBytes = 256;
+  static constexpr uint8_t kMaxDepth = 31;
+
+  explicit JsonWriter(Print &out) : _out(out) {}
+  ~JsonWriter() { flush(); }
+  JsonWriter(const JsonWriter &) = delete;
+  JsonWriter &operator=(const JsonWriter &) = delete;
+
+  void beginObject(const char *key = nullptr);
+  void endObject();
+  void beginArray(const char *key = nullptr);
+  void endArray();
+
+  // The next value (or begin*) belongs to `key`.
+  void key(const char *key);
+
+  void value(bool v);
+  void value(const char *v); // nullptr -> null
+  void value(const String &v) { string(v.c_str(), v.length()); }
+  void value(const __FlashStringHelper *v); // F() / PROGMEM text
+  void value(const IPAddress &ip);
+  void value(double v, uint8_t decimals = 3); // NaN/inf -> null
+  template <typename T>
+  typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type value(T v) {
+    separate();
+    if (std::is_signed<T>::value && v < 0) {
+      put('-');
+      number(0ULL - static_cast<unsigned long long>(static_cast<long long>(v)));
+    } else {
+      number(static_cast<unsigned long long>(v));
+    }
+  }
+  void null();
+  // Pre-serialized JSON, copied as is.
+  void raw(const char *json, size_t len);
+
+  template <typename T> void field(const char *k, const T &v) {
+    key(k);
+    value(v);
+  }
+  void field(const char *k, double v, uint8_t decimals) {
+    key(k);
+    value(v, decimals);
+  }
+
+  void flush();
+  // Bytes handed to the Print so far plus what is still buffered.
+  size_t bytes() const { return _written + _len; }
+  // False once the Print took fewer bytes than it was given (disk full, peer gone).
+  bool ok() const { return _ok; }
+
+private:
+  void separate();
+  void put(char c);
+  void write(const char *s, size_t n);
+  void string(const char *s, size_t n);
+  void quoted(const char *s, size_t n);
+  void escaped(const char *s, size_t n);
+  void number(unsigned long long v);
+
+  Print &_out;
+  char _buf[kBufferBytes];
+  size_t _len = 0;
+  size_t _written = 0;
+  uint32_t _hasItems = 0; // bit d: the container at depth d already has a member
+  uint8_t _depth = 0;
+  bool _afterKey = false;
+  bool _ok = true;
+};
@@ -0,0 +1,198 @@
+#include "LinkStats.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "JsonWriter.h"
+
+namespace {
+const char *phyToString(uint8_t phy) {
+  switch (phy) {
+  case 1:
+    return "b";
+  case 2:
+    return "g";
+  case 3:
+    return "n";
+  default:
+    return "-";
+  }
+}
+
+void bump(uint16_t &h) {
+  if (h != 0xFFFF) h += 1;
+}
+} // namespace
+
+uint8_t LinkStats::rssiBucket(int32_t rssi) {
+  uint8_t b = 0;
+  int32_t floor = -50;
+  while (b < kRssiBuckets - 1 && rssi < floor) {
+    b += 1;
+    floor -= 5;
+  }
+  return b;
+}
+
+uint8_t LinkStats::timeBucket(uint32_t v, uint32_t first) {
+  uint8_t b = 0;
+  uint32_t limit = first;
+  while (b < kTimeBuckets - 1 && v >= limit) {
+    b += 1;
+    limit <<= 2;
+  }
+  return b;
+}
+
+void LinkStats::sample(uint32_t nowMs, bool up, int32_t rssi, uint8_t channel, uint8_t phy) {
+  _lastSampleMs = nowMs ? nowMs : 1;
+  up = up && rssi < 0; // 31 = the SDK has no reading
+  Sample &s = _ring[_ringHead];
+  s.ms = nowMs;
+  s.rssi = static_cast<int8_t>(up ? (rssi < -127 ? -127 : rssi) : 0);
+  s.channel = up ? channel : 0;
+  s.phy = phy;
+  s.up = up ? 1 : 0;
+  _ringHead = static_cast<uint8_t>((_ringHead + 1) % kRingSize);
+  if (_ringCount < kRingSize) _ringCount += 1;
+  if (!up) return;
+
+  if (!_rssiCount || rssi < _rssiMin) _rssiMin = rssi;
+  if (!_rssiCount || rssi > _rssiMax) _rssiMax = rssi;
+  _rssiSum += rssi;
+  _rssiCount += 1;
+  bump(_rssiHist[rssiBucket(rssi)]);
+}
+
+void LinkStats::noteUp(uint32_t nowMs, uint8_t channel, const uint8_t *bssid) {
+  if (_up) return;
+  _up = true;
+  _upSinceMs = nowMs;
+  _ups += 1;
+  if (_downSinceMs) {
+    const uint32_t tookMs = nowMs - _downSinceMs;
+    _reconnects += 1;
+    _downMsTotal += tookMs;
+    _lastReconnectMs = tookMs;
+    if (tookMs > _maxReconnectMs) _maxReconnectMs = tookMs;
+    bump(_reconnectHist[timeBucket(tookMs, kReconnectFirstMs)]);
+  }
+  if (_ups > 1 && channel != _channel) _channelChanges += 1;
+  if (_ups > 1 && bssid && memcmp(bssid, _bssid, sizeof(_bssid)) != 0) _bssidChanges += 1;
+  _channel = channel;
+  if (bssid) memcpy(_bssid, bssid, sizeof(_bssid));
+}
+
+void LinkStats::noteDisconnect(uint32_t nowMs, uint16_t reason, bool expected, bool wasUp) {
+  _disconnectEvents += 1;
+  if (!expected) {
+    Reason *slot = nullptr;
+    for (uint8_t i = 0; i < kMaxReasons; i += 1) {
+      Reason &r = _reasons[i];
+      if (r.count && r.reason == reason) {
+        slot = &r;
+        break;
+      }
+      // Full table: the rarest reason makes room.
+      if (!slot || r.count < slot->count) slot = &r;
+    }
+    if (slot->reason != reason || !slot->count) {
+      slot->reason = reason;
+      slot->count = 0;
+    }
+    if (slot->count != 0xFFFF) slot->count += 1;
+    slot->lastMs = nowMs;
+  }
+  if (!wasUp || !_up) return;
+
+  _up = false;
+  _downSinceMs = nowMs ? nowMs : 1;
+  _downs += 1;
+  if (expected) _expectedDowns += 1;
+  bump(_lifetimeHist[timeBucket((nowMs - _upSinceMs) / 1000UL, kLifetimeFirstS)]);
+}
+
+void LinkStats::histJson(JsonWriter &w, const char *key, const uint16_t *hist, uint32_t first, const char *unit) {
+  w.beginObject(key);
+  w.field("unit", unit);
+  // Upper bounds of all but the open-ended last bucket.
+  w.beginArray("lt");
+  uint32_t limit = first;
+  for (uint8_t i = 0; i + 1 < kTimeBuckets; i += 1) {
+    w.value(limit);
+    limit <<= 2;
+  }
+  w.endArray();
+  w.beginArray("counts");
+  for (uint8_t i = 0; i < kTimeBuckets; i += 1) w.value(hist[i]);
+  w.endArray();
+  w.endObject();
+}
+
+void LinkStats::statsJson(JsonWriter &w, uint32_t nowMs) const {
+  w.beginObject();
+  w.field("ok", true);
+  w.field("up", _up);
+  w.field("upForMs", _up ? nowMs - _upSinceMs : 0);
+  w.field("downForMs", (!_up && _downSinceMs) ? nowMs - _downSinceMs : 0);
+  w.field("sampleMs", kSampleMs);
+
+  w.beginObject("counters");
+  w.field("ups", _ups);
+  w.field("reconnects", _reconnects);
+  w.field("downs", _downs);
+  w.field("expectedDowns", _expectedDowns);
+  w.field("disconnectEvents", _disconnectEvents);
+  w.field("bssidChanges", _bssidChanges);
+  w.field("channelChanges", _channelChanges);
+  w.field("downMsTotal", _downMsTotal);
+  w.field("lastReconnectMs", _lastReconnectMs);
+  w.field("maxReconnectMs", _maxReconnectMs);
+  w.endObject();
+
+  w.beginObject("rssi");
+  w.field("samples", _rssiCount);
+  if (_rssiCount) {
+    w.field("min", _rssiMin);
+    w.field("max", _rssiMax);
+    w.field("avg", static_cast<int32_t>(_rssiSum / static_cast<int32_t>(_rssiCount)));
+  }
+  // Bucket i holds samples >= -50 - 5*i dBm (and above the previous floor); the last one everything weaker.
+  w.beginArray("ge");
+  for (uint8_t i = 0; i + 1 < kRssiBuckets; i += 1) w.value(-50 - 5 * static_cast<int32_t>(i));
+  w.endArray();
+  w.beginArray("counts");
+  for (uint8_t i = 0; i < kRssiBuckets; i += 1) w.value(_rssiHist[i]);
+  w.endArray();
+  w.endObject();
+
+  histJson(w, "reconnect", _reconnectHist, kReconnectFirstMs, "ms");
+  histJson(w, "lifetime", _lifetimeHist, kLifetimeFirstS, "s");
+
+  w.beginArray("reasons");
+  for (uint8_t i = 0; i < kMaxReasons; i += 1) {
+    const Reason &r = _reasons[i];
+    if (!r.count) continue;
+    w.beginObject();
+    w.field("reason", r.reason);
+    w.field("count", r.count);
+    w.field("agoMs", nowMs - r.lastMs);
+    w.endObject();
+  }
+  w.endArray();
+
+  w.beginArray("fields");
+  for (const char *f : {"ms", "rssi", "ch", "phy", "up"}) w.value(f);
+  w.endArray();
+  w.beginArray("samples");
+  const uint8_t start = static_cast<uint8_t>((_ringHead + kRingSize - _ringCount) % kRingSize);
+  for (uint8_t i = 0; i < _ringCount; i += 1) {
+    const Sample &s = _ring[(start + i) % kRingSize];
+    char line[40];
+    snprintf(line, sizeof(line), "%lu,%d,%u,%s,%u", static_cast<unsigned long>(s.ms), static_cast<int>(s.rssi),
+             static_cast<unsigned>(s.channel), phyToString(s.phy), static_cast<unsigned>(s.up));
+    w.value(line);
+  }
+  w.endArray();
+  w.endObject();
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <stdint.h>
+
+class JsonWriter;
+
+// Steady-state station link telemetry (the connect-attempt log in WifiController covers the attempts).
+//
+// A periodic sample of RSSI, channel and PHY mode goes to a small ring. Every link up/down goes to the
+// counters and log histograms:
+// - RSSI in 5 dB buckets (dBm is already logarithmic).
+// - Time-to-reconnect and link lifetimes in base-4 buckets.
+// - The most frequent SDK disconnect reasons.
+// Fed with plain values by WifiController, so nothing here touches the radio.
+class LinkStats {
+public:
+  static constexpr uint8_t kRingSize = 64;
+  static constexpr uint32_t kSampleMs = 20UL * 1000UL; // ring covers ~21 min
+  static constexpr uint8_t kRssiBuckets = 9;  // >=-50, >=-55, ... >=-85, <-85 dBm
+  static constexpr uint8_t kTimeBuckets = 8;  // base 4 from the first upper bound
+  static constexpr uint32_t kReconnectFirstMs = 250;   // <250ms, <1s, <4s, <16s, <64s, <256s, <17m, >=17m
+  static constexpr uint32_t kLifetimeFirstS = 16;      // <16s, <64s, <256s, <17m, <68m, <4.5h, <18h, >=18h
+  static constexpr uint8_t kMaxReasons = 8;
+
+  bool due(uint32_t nowMs) const { return !_lastSampleMs || nowMs - _lastSampleMs >= kSampleMs; }
+  // `rssi` and `channel` are ignored while the link is down.
+  void sample(uint32_t nowMs, bool up, int32_t rssi, uint8_t channel, uint8_t phy);
+  // Station got an address on `channel` / `bssid`.
+  void noteUp(uint32_t nowMs, uint8_t channel, const uint8_t *bssid);
+  // Every SDK disconnect event (they repeat while the SDK retries); `wasUp` marks the one that ended a
+  // link. Disconnects we caused (`expected`) are counted apart and stay out of the reason table.
+  void noteDisconnect(uint32_t nowMs, uint16_t reason, bool expected, bool wasUp);
+
+  // {ok, up, upForMs, downForMs, sampleMs, counters:{...}, rssi:{samples, min, max, avg, ge, counts},
+  //  reconnect:{unit, lt, counts}, lifetime:{...}, reasons:[{reason, count, agoMs}],
+  //  fields:[...], samples:["ms,rssi,ch,phy,up", ...]} (samples oldest first)
+  void statsJson(JsonWriter &w, uint32_t nowMs) const;
+
+private:
+  struct Sample {
+    uint32_t ms = 0;
+    int8_t rssi = 0;
+    uint8_t channel = 0;
+    uint8_t phy = 0;
+    uint8_t up = 0;
+  };
+
+  struct Reason {
+    uint16_t reason = 0;
+    uint16_t count = 0; // 0 = free
+    uint32_t lastMs = 0;
+  };
+
+  static uint8_t rssiBucket(int32_t rssi);
+  static uint8_t timeBucket(uint32_t v, uint32_t first);
+  static void histJson(JsonWriter &w, const char *key, const uint16_t *hist, uint32_t first, const char *unit);
+
+  Sample _ring[kRingSize];
+  uint8_t _ringHead = 0;
+  uint8_t _ringCount = 0;
+  uint32_t _lastSampleMs = 0;
+
+  bool _up = false;
+  uint32_t _upSinceMs = 0;
+  uint32_t _downSinceMs = 0; // 0 = never had a link to lose
+  uint8_t _channel = 0;
+  uint8_t _bssid[6] = {0, 0, 0, 0, 0, 0};
+
+  uint32_t _ups = 0;
+  uint32_t _reconnects = 0; // ups after a lost link
+  uint32_t _downs = 0;
+  uint32_t _expectedDowns = 0;
+  uint32_t _disconnectEvents = 0;
+  uint32_t _bssidChanges = 0;
+  uint32_t _channelChanges = 0;
+  uint32_t _downMsTotal = 0;
+  uint32_t _lastReconnectMs = 0;
+  uint32_t _maxReconnectMs = 0;
+
+  int32_t _rssiMin = 0;
+  int32_t _rssiMax = 0;
+  int32_t _rssiSum = 0;
+  uint32_t _rssiCount = 0;
+  uint16_t _rssiHist[kRssiBuckets] = {};
+  uint16_t _reconnectHist[kTimeBuckets] = {};
+  uint16_t _lifetimeHist[kTimeBuckets] = {};
+  Reason _reasons[kMaxReasons];
+};
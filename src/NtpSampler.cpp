@@ -0,0 +1,330 @@
+#include "NtpSampler.h"
+
+#include <string.h>
+
+namespace {
+constexpr int64_t kUsPerSec = 1000000LL;
+
+uint32_t readBe32(const uint8_t *p) {
+  return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) | (static_cast<uint32_t>(p[2]) << 8) |
+         static_cast<uint32_t>(p[3]);
+}
+
+void writeBe32(uint8_t *p, uint32_t v) {
+  p[0] = static_cast<uint8_t>(v >> 24);
+  p[1] = static_cast<uint8_t>(v >> 16);
+  p[2] = static_cast<uint8_t>(v >> 8);
+  p[3] = static_cast<uint8_t>(v);
+}
+
+bool isZero8(const uint8_t *p) {
+  for (uint8_t i = 0; i < 8; i += 1) {
+    if (p[i]) return false;
+  }
+  return true;
+}
+
+// NTP "short" format (16.16 seconds) to microseconds.
+uint32_t shortToUs(uint32_t v) { return static_cast<uint32_t>((static_cast<uint64_t>(v) * 1000000ULL) >> 16); }
+uint32_t usToShort(uint32_t us) {
+  const uint64_t v = (static_cast<uint64_t>(us) << 16) / 1000000ULL;
+  return (v > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : static_cast<uint32_t>(v);
+}
+} // namespace
+
+namespace ntp {
+
+int64_t fromNtpTimestamp(const uint8_t *p) {
+  const uint32_t sec = readBe32(p);
+  const uint32_t frac = readBe32(p + 4);
+  // Era 1 starts in 2036: a cleared MSB means we already wrapped (valid until 2104).
+  uint64_t s = sec;
+  if (!(sec & 0x80000000UL)) s += 0x100000000ULL;
+  const int64_t unixSec = static_cast<int64_t>(s) - static_cast<int64_t>(kUnixToNtpSeconds);
+  const int64_t us = static_cast<int64_t>((static_cast<uint64_t>(frac) * 1000000ULL) >> 32);
+  return unixSec * kUsPerSec + us;
+}
+
+void toNtpTimestamp(int64_t unixUs, uint8_t *p) {
+  if (unixUs < 0) unixUs = 0;
+  const uint64_t sec = static_cast<uint64_t>(unixUs / kUsPerSec) + kUnixToNtpSeconds;
+  const uint64_t us = static_cast<uint64_t>(unixUs % kUsPerSec);
+  writeBe32(p, static_cast<uint32_t>(sec));
+  writeBe32(p + 4, static_cast<uint32_t>((us << 32) / 1000000ULL));
+}
+
+void buildRequest(uint8_t *pkt, int64_t t1Us) {
+  memset(pkt, 0, kPacketSize);
+  pkt[0] = (0 << 6) | (4 << 3) | 3; // LI=0, VN=4, mode=client
+  toNtpTimestamp(t1Us, pkt + 40);
+}
+
+const char *sampleErrorToString(SampleError err) {
+  switch (err) {
+  case SampleError::None:
+    return "";
+  case SampleError::ShortPacket:
+    return "short packet";
+  case SampleError::BadMode:
+    return "bad mode";
+  case SampleError::KissOfDeath:
+    return "kiss-of-death";
+  case SampleError::Unsynchronized:
+    return "server unsynchronized";
+  case SampleError::OriginMismatch:
+    return "origin mismatch";
+  case SampleError::BadTimestamps:
+    return "bad timestamps";
+  case SampleError::HighRtt:
+    return "rtt above limit";
+  default:
+    return "unknown";
+  }
+}
+
+SampleError parseResponse(const uint8_t *pkt, size_t len, int64_t t1Us, int64_t t4Us, Sample &out) {
+  if (len < kPacketSize) return SampleError::ShortPacket;
+
+  const uint8_t li = pkt[0] >> 6;
+  const uint8_t mode = pkt[0] & 0x07;
+  const uint8_t stratum = pkt[1];
+  if (mode != 4) return SampleError::BadMode;
+  if (stratum == 0) return SampleError::KissOfDeath;
+  if (li == 3 || stratum > 15) return SampleError::Unsynchronized;
+
+  uint8_t origin[8];
+  toNtpTimestamp(t1Us, origin);
+  if (memcmp(origin, pkt + 24, sizeof(origin)) != 0) return SampleError::OriginMismatch;
+  if (isZero8(pkt + 32) || isZero8(pkt + 40)) return SampleError::BadTimestamps;
+
+  const int64_t t2 = fromNtpTimestamp(pkt + 32);
+  const int64_t t3 = fromNtpTimestamp(pkt + 40);
+  int64_t delay = (t4Us - t1Us) - (t3 - t2);
+  // Timestamp rounding can make a LAN round trip look slightly negative.
+  if (delay < -1000) return SampleError::BadTimestamps;
+  if (delay < 0) delay = 0;
+  if (delay > 0xFFFFFFFFLL) return SampleError::HighRtt;
+
+  out = {};
+  out.offsetUs = ((t2 - t1Us) + (t3 - t4Us)) / 2;
+  out.delayUs = static_cast<uint32_t>(delay);
+  out.rootDelayUs = shortToUs(readBe32(pkt + 4));
+  out.rootDispersionUs = shortToUs(readBe32(pkt + 8));
+  out.stratum = stratum;
+  return SampleError::None;
+}
+
+void Sampler::configure(uint8_t serverCount, uint8_t samplesPerServer, uint32_t maxRttUs, uint32_t replyTimeoutMs) {
+  _serverCount = (serverCount > kMaxServers) ? kMaxServers : serverCount;
+  if (samplesPerServer < 1) samplesPerServer = 1;
+  if (samplesPerServer > kMaxSamplesPerServer) samplesPerServer = kMaxSamplesPerServer;
+  _samplesPerServer = samplesPerServer;
+  _maxRttUs = maxRttUs;
+  _replyTimeoutMs = replyTimeoutMs ? replyTimeoutMs : 600;
+  _phase = Phase::Idle;
+}
+
+void Sampler::start(uint32_t nowMs) {
+  _server = 0;
+  _sampleIdx = 0;
+  _t1Us = 0;
+  _sentMs = nowMs;
+  _result = {};
+  for (uint8_t i = 0; i < kMaxServers; i += 1) {
+    _haveBest[i] = false;
+    _best[i] = {};
+  }
+  _phase = (_serverCount > 0) ? Phase::Send : Phase::Finish;
+}
+
+bool Sampler::active() const { return _phase == Phase::Send || _phase == Phase::Wait || _phase == Phase::Finish; }
+
+const Result &Sampler::result() const { return _result; }
+
+void Sampler::advance() {
+  _sampleIdx += 1;
+  if (_sampleIdx >= _samplesPerServer) {
+    _sampleIdx = 0;
+    _server += 1;
+  }
+  _phase = (_server < _serverCount) ? Phase::Send : Phase::Finish;
+}
+
+void Sampler::finish(ServerStats *stats) {
+  _result = {};
+  int best = -1;
+  for (uint8_t i = 0; i < _serverCount; i += 1) {
+    ServerStats &st = stats[i];
+    if (!_haveBest[i]) {
+      st.lastDelayUs = 0;
+      continue;
+    }
+    const Sample &s = _best[i];
+    st.lastDelayUs = s.delayUs;
+    st.lastOffsetUs = s.offsetUs;
+    st.stratum = s.stratum;
+    if (st.minDelayUs == 0 || s.delayUs < st.minDelayUs) st.minDelayUs = s.delayUs;
+    _result.accepted += 1;
+    if (best < 0 || s.delayUs < _best[best].delayUs) best = static_cast<int>(i);
+  }
+
+  if (best >= 0) {
+    const Sample &s = _best[best];
+    _result.ok = true;
+    _result.server = static_cast<uint8_t>(best);
+    _result.sample = s;
+    _result.uncertaintyUs = s.delayUs / 2 + s.rootDelayUs / 2 + s.rootDispersionUs;
+    stats[best].selected += 1;
+  }
+  _phase = Phase::Done;
+}
+
+void Sampler::finishNow(ServerStats *stats) {
+  if (_phase == Phase::Idle || _phase == Phase::Done) return;
+  finish(stats);
+}
+
+bool Sampler::poll(Transport &io, ServerStats *stats) {
+  if (_phase == Phase::Idle || _phase == Phase::Done) return true;
+
+  if (_phase == Phase::Send) {
+    uint8_t pkt[kPacketSize];
+    const bool resolved = io.resolve(_server);
+    _t1Us = io.wallUs();
+    buildRequest(pkt, _t1Us);
+    _sentMs = io.monoMs();
+    if (resolved && io.send(_server, pkt, sizeof(pkt))) {
+      stats[_server].sent += 1;
+      _phase = Phase::Wait;
+    } else {
+      // Unresolvable host / socket failure: give up on this server for this round.
+      stats[_server].timeouts += 1;
+      _sampleIdx = static_cast<uint8_t>(_samplesPerServer - 1);
+      advance();
+    }
+  } else if (_phase == Phase::Wait) {
+    uint8_t pkt[kPacketSize];
+    int64_t t4Us = 0;
+    const size_t n = io.receive(_server, pkt, sizeof(pkt), t4Us);
+    if (n > 0) {
+      Sample s{};
+      SampleError err = parseResponse(pkt, n, _t1Us, t4Us, s);
+      if (err == SampleError::OriginMismatch) {
+        // Late reply to an earlier (timed-out) request: ignore and keep waiting.
+        return false;
+      }
+      stats[_server].received += 1;
+      if (err == SampleError::None && _maxRttUs && s.delayUs > _maxRttUs) err = SampleError::HighRtt;
+      stats[_server].lastError = err;
+      if (err != SampleError::None) {
+        stats[_server].rejected += 1;
+        // Kiss-of-death means "stop asking": skip the rest of this server's burst.
+        if (err == SampleError::KissOfDeath) _sampleIdx = static_cast<uint8_t>(_samplesPerServer - 1);
+      } else if (!_haveBest[_server] || s.delayUs < _best[_server].delayUs) {
+        _haveBest[_server] = true;
+        _best[_server] = s;
+      }
+      advance();
+    } else if ((io.monoMs() - _sentMs) > _replyTimeoutMs) {
+      stats[_server].timeouts += 1;
+      advance();
+    }
+  }
+
+  if (_phase == Phase::Finish) finish(stats);
+  return _phase == Phase::Done;
+}
+
+const char *requestErrorToString(RequestError err) {
+  switch (err) {
+  case RequestError::None:
+    return "";
+  case RequestError::ShortPacket:
+    return "short packet";
+  case RequestError::BadMode:
+    return "bad mode";
+  case RequestError::BadVersion:
+    return "bad version";
+  default:
+    return "unknown";
+  }
+}
+
+RequestError buildReply(const uint8_t *req, size_t len, const ServerClock &clock, int64_t rxUs, int64_t txUs, uint8_t *out) {
+  if (len < kPacketSize) return RequestError::ShortPacket;
+  const uint8_t version = (req[0] >> 3) & 0x07;
+  const uint8_t mode = req[0] & 0x07;
+  if (mode != 3 && mode != 1) return RequestError::BadMode;
+  if (version < 1 || version > 4) return RequestError::BadVersion;
+
+  memset(out, 0, kPacketSize);
+  // Echo the client's version; reply as server (4) to a client, passive (2) to symmetric active.
+  out[0] = static_cast<uint8_t>((clock.leap & 0x03) << 6 | (version << 3) | (mode == 3 ? 4 : 2));
+  out[1] = clock.stratum;
+  out[2] = req[2]; // poll
+  out[3] = static_cast<uint8_t>(clock.precisionLog2);
+  writeBe32(out + 4, usToShort(clock.rootDelayUs));
+  writeBe32(out + 8, usToShort(clock.rootDispersionUs));
+  writeBe32(out + 12, clock.refId);
+  if (clock.refUs > 0) toNtpTimestamp(clock.refUs, out + 16);
+  memcpy(out + 24, req + 40, 8); // origin = client's transmit timestamp
+  toNtpTimestamp(rxUs, out + 32);
+  toNtpTimestamp(txUs, out + 40);
+  return RequestError::None;
+}
+
+void RateLimiter::configure(uint8_t burst, uint32_t refillMs, uint16_t maxPerSecond) {
+  _burst = burst ? burst : 1;
+  _refillMs = refillMs ? refillMs : 1;
+  _maxPerSecond = maxPerSecond;
+  for (uint8_t i = 0; i < kSlots; i += 1) _slots[i] = {};
+  _windowStartMs = 0;
+  _windowCount = 0;
+}
+
+bool RateLimiter::allow(uint32_t clientKey, uint32_t nowMs) {
+  if (_maxPerSecond) {
+    if (nowMs - _windowStartMs >= 1000) {
+      _windowStartMs = nowMs;
+      _windowCount = 0;
+    }
+    if (_windowCount >= _maxPerSecond) return false;
+  }
+
+  Slot *slot = nullptr;
+  Slot *oldest = &_slots[0];
+  for (uint8_t i = 0; i < kSlots; i += 1) {
+    Slot &s = _slots[i];
+    if (s.used && s.key == clientKey) {
+      slot = &s;
+      break;
+    }
+    if (!s.used) {
+      if (oldest->used) oldest = &s;
+    } else if (oldest->used && (nowMs - s.lastMs) > (nowMs - oldest->lastMs)) {
+      oldest = &s;
+    }
+  }
+
+  if (!slot) {
+    slot = oldest;
+    slot->used = true;
+    slot->key = clientKey;
+    slot->tokens = _burst;
+    slot->lastMs = nowMs;
+  } else {
+    const uint32_t refill = (nowMs - slot->lastMs) / _refillMs;
+    if (refill > 0) {
+      const uint32_t t = slot->tokens + refill;
+      slot->tokens = static_cast<uint8_t>((t > _burst) ? _burst : t);
+      slot->lastMs += refill * _refillMs;
+    }
+  }
+
+  if (slot->tokens == 0) return false;
+  slot->tokens -= 1;
+  _windowCount += 1;
+  return true;
+}
+
+} // namespace ntp
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Multi-server SNTP sampling with round-trip filtering, plus the packet/rate-limit
+// logic of the built-in SNTP server.
+//
+// This module has no Arduino dependencies so the exact same selection logic can be
+// exercised on a Linux host (see tools/ntp_probe.sh) against tools/ntp_standin.py.
+namespace ntp {
+
+constexpr uint16_t kPort = 123;
+constexpr size_t kPacketSize = 48;
+constexpr uint32_t kUnixToNtpSeconds = 2208988800UL;
+constexpr uint8_t kMaxServers = 4;
+constexpr uint8_t kMaxSamplesPerServer = 8;
+
+// Unix time in microseconds <-> 64-bit NTP timestamp (big-endian, 8 bytes).
+int64_t fromNtpTimestamp(const uint8_t *p);
+void toNtpTimestamp(int64_t unixUs, uint8_t *p);
+
+// Fills a client (mode 3) request carrying `t1Us` as the transmit timestamp.
+void buildRequest(uint8_t *pkt, int64_t t1Us);
+
+struct Sample {
+  int64_t offsetUs = 0; // server clock minus local clock
+  uint32_t delayUs = 0; // round trip minus server processing time
+  uint32_t rootDelayUs = 0;
+  uint32_t rootDispersionUs = 0;
+  uint8_t stratum = 0;
+};
+
+enum class SampleError : uint8_t {
+  None = 0,
+  ShortPacket,
+  BadMode,
+  KissOfDeath,
+  Unsynchronized,
+  OriginMismatch,
+  BadTimestamps,
+  HighRtt,
+};
+
+const char *sampleErrorToString(SampleError err);
+
+// Validates a server reply to a request sent at `t1Us` and received at `t4Us`.
+SampleError parseResponse(const uint8_t *pkt, size_t len, int64_t t1Us, int64_t t4Us, Sample &out);
+
+// Cumulative per-server quality counters (survive across rounds).
+struct ServerStats {
+  uint32_t sent = 0;
+  uint32_t received = 0;
+  uint32_t rejected = 0; // malformed, unsynchronized or above the RTT limit
+  uint32_t timeouts = 0;
+  uint32_t selected = 0; // rounds in which this server supplied the winning sample
+  uint32_t lastDelayUs = 0; // best delay of the last round (0 = no usable sample)
+  uint32_t minDelayUs = 0;  // best delay ever seen
+  int64_t lastOffsetUs = 0;
+  uint8_t stratum = 0;
+  SampleError lastError = SampleError::None;
+};
+
+struct Result {
+  bool ok = false;
+  uint8_t server = 0;
+  Sample sample;
+  // Half the round trip plus the server's own error budget (root delay / 2 + root dispersion).
+  uint32_t uncertaintyUs = 0;
+  uint8_t accepted = 0; // usable samples across all servers this round
+};
+
+// I/O hooks. The firmware implements this on WiFiUDP; the host probe on POSIX sockets.
+class Transport {
+public:
+  virtual ~Transport() = default;
+  // False when `server` has no address (its lookup failed); asked before a request is timestamped. A
+  // transport that has to look names up does so here or ahead of the round, not in send().
+  virtual bool resolve(uint8_t server) {
+    (void)server;
+    return true;
+  }
+  virtual bool send(uint8_t server, const uint8_t *pkt, size_t len) = 0;
+  // Returns the size of a pending reply from `server` (0 when nothing arrived yet), with `rxUs` the wall
+  // clock (Unix us) taken as soon as the reply was seen.
+  virtual size_t receive(uint8_t server, uint8_t *pkt, size_t cap, int64_t &rxUs) = 0;
+  virtual int64_t wallUs() = 0; // Unix time in microseconds
+  virtual uint32_t monoMs() = 0;
+};
+
+// Incremental sampling round: call `poll()` repeatedly until it returns true.
+// Never blocks; each call sends at most one request or consumes at most one reply.
+// `stats` must point at (at least) `serverCount` entries owned by the caller.
+class Sampler {
+public:
+  void configure(uint8_t serverCount, uint8_t samplesPerServer, uint32_t maxRttUs, uint32_t replyTimeoutMs);
+  void start(uint32_t nowMs);
+  bool poll(Transport &io, ServerStats *stats);
+  // Ends the round early (time budget exhausted) and selects from what arrived so far.
+  void finishNow(ServerStats *stats);
+  bool active() const;
+  const Result &result() const;
+
+private:
+  enum class Phase : uint8_t { Idle = 0, Send, Wait, Finish, Done };
+
+  Phase _phase = Phase::Idle;
+  uint8_t _serverCount = 0;
+  uint8_t _samplesPerServer = 4;
+  uint32_t _maxRttUs = 0;
+  uint32_t _replyTimeoutMs = 600;
+
+  uint8_t _server = 0;
+  uint8_t _sampleIdx = 0;
+  int64_t _t1Us = 0;
+  uint32_t _sentMs = 0;
+
+  bool _haveBest[kMaxServers] = {};
+  Sample _best[kMaxServers];
+  Result _result;
+
+  void advance();
+  void finish(ServerStats *stats);
+};
+
+// --- Server side -------------------------------------------------------------
+
+// What the local clock advertises to SNTP clients.
+struct ServerClock {
+  uint8_t leap = 0; // 0 = no warning, 3 = unsynchronized
+  uint8_t stratum = 16;
+  int8_t precisionLog2 = -18;
+  uint32_t refId = 0; // upstream IPv4 (network order) or four ASCII chars for stratum 1 / local clocks
+  int64_t refUs = 0;  // when the clock was last set
+  uint32_t rootDelayUs = 0;
+  uint32_t rootDispersionUs = 0;
+};
+
+enum class RequestError : uint8_t {
+  None = 0,
+  ShortPacket,
+  BadMode, // not a client (mode 3) or symmetric-active request
+  BadVersion,
+};
+
+const char *requestErrorToString(RequestError err);
+
+// Validates a client request and fills the 48-byte reply in `out`.
+// `rxUs` is the arrival time of the request, `txUs` the time the reply leaves (both Unix us).
+RequestError buildReply(const uint8_t *req, size_t len, const ServerClock &clock, int64_t rxUs, int64_t txUs, uint8_t *out);
+
+// Per-client token bucket (keyed by IPv4) plus a global reply budget.
+// Small fixed table: the least recently seen client is evicted when it is full.
+class RateLimiter {
+public:
+  static constexpr uint8_t kSlots = 8;
+
+  void configure(uint8_t burst, uint32_t refillMs, uint16_t maxPerSecond);
+  bool allow(uint32_t clientKey, uint32_t nowMs);
+
+private:
+  struct Slot {
+    uint32_t key = 0;
+    uint32_t lastMs = 0;
+    uint8_t tokens = 0;
+    bool used = false;
+  };
+
+  Slot _slots[kSlots];
+  uint8_t _burst = 4;
+  uint32_t _refillMs = 2000;
+  uint16_t _maxPerSecond = 20;
+  uint32_t _windowStartMs = 0;
+  uint16_t _windowCount = 0;
+};
+
+} // namespace ntp
@@ -0,0 +1,495 @@
+#include "OtaDownload.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+constexpr uint32_t kMagic = 0x53484F44; // 'SHOD'
+
+const uint32_t kMd5K[64] = {
+    0xd76aa478UL, 0xe8c7b756UL, 0x242070dbUL, 0xc1bdceeeUL, 0xf57c0fafUL, 0x4787c62aUL, 0xa8304613UL, 0xfd469501UL,
+    0x698098d8UL, 0x8b44f7afUL, 0xffff5bb1UL, 0x895cd7beUL, 0x6b901122UL, 0xfd987193UL, 0xa679438eUL, 0x49b40821UL,
+    0xf61e2562UL, 0xc040b340UL, 0x265e5a51UL, 0xe9b6c7aaUL, 0xd62f105dUL, 0x02441453UL, 0xd8a1e681UL, 0xe7d3fbc8UL,
+    0x21e1cde6UL, 0xc33707d6UL, 0xf4d50d87UL, 0x455a14edUL, 0xa9e3e905UL, 0xfcefa3f8UL, 0x676f02d9UL, 0x8d2a4c8aUL,
+    0xfffa3942UL, 0x8771f681UL, 0x6d9d6122UL, 0xfde5380cUL, 0xa4beea44UL, 0x4bdecfa9UL, 0xf6bb4b60UL, 0xbebfbc70UL,
+    0x289b7ec6UL, 0xeaa127faUL, 0xd4ef3085UL, 0x04881d05UL, 0xd9d4d039UL, 0xe6db99e5UL, 0x1fa27cf8UL, 0xc4ac5665UL,
+    0xf4292244UL, 0x432aff97UL, 0xab9423a7UL, 0xfc93a039UL, 0x655b59c3UL, 0x8f0ccc92UL, 0xffeff47dUL, 0x85845dd1UL,
+    0x6fa87e4fUL, 0xfe2ce6e0UL, 0xa3014314UL, 0x4e0811a1UL, 0xf7537e82UL, 0xbd3af235UL, 0x2ad7d2bbUL, 0xeb86d391UL,
+};
+// Left-rotation amounts, four per round.
+const uint8_t kMd5S[4][4] = {{7, 12, 17, 22}, {5, 9, 14, 20}, {4, 11, 16, 23}, {6, 10, 15, 21}};
+
+uint32_t rotl(uint32_t x, uint8_t c) { return (x << c) | (x >> (32 - c)); }
+
+void md5Block(uint32_t state[4], const uint8_t *p) {
+  uint32_t m[16];
+  for (uint8_t i = 0; i < 16; i += 1) {
+    m[i] = static_cast<uint32_t>(p[i * 4]) | (static_cast<uint32_t>(p[i * 4 + 1]) << 8) |
+           (static_cast<uint32_t>(p[i * 4 + 2]) << 16) | (static_cast<uint32_t>(p[i * 4 + 3]) << 24);
+  }
+  uint32_t a = state[0];
+  uint32_t b = state[1];
+  uint32_t c = state[2];
+  uint32_t d = state[3];
+  for (uint8_t i = 0; i < 64; i += 1) {
+    uint32_t f = 0;
+    uint8_t g = 0;
+    if (i < 16) {
+      f = (b & c) | (~b & d);
+      g = i;
+    } else if (i < 32) {
+      f = (d & b) | (~d & c);
+      g = static_cast<uint8_t>((5 * i + 1) & 15);
+    } else if (i < 48) {
+      f = b ^ c ^ d;
+      g = static_cast<uint8_t>((3 * i + 5) & 15);
+    } else {
+      f = c ^ (b | ~d);
+      g = static_cast<uint8_t>((7 * i) & 15);
+    }
+    const uint32_t next = d;
+    d = c;
+    c = b;
+    b = b + rotl(a + f + kMd5K[i] + m[g], kMd5S[i / 16][i % 4]);
+    a = next;
+  }
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+}
+
+int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Digits at `p` up to a non-digit; false when there are none or the value does not fit.
+bool parseUint(const char *&p, uint32_t &out) {
+  if (*p < '0' || *p > '9') return false;
+  uint64_t v = 0;
+  while (*p >= '0' && *p <= '9') {
+    v = v * 10 + static_cast<uint64_t>(*p - '0');
+    if (v > 0xFFFFFFFFULL) return false;
+    p += 1;
+  }
+  out = static_cast<uint32_t>(v);
+  return true;
+}
+} // namespace
+
+void otadl::md5Init(Md5 &m) {
+  m.state[0] = 0x67452301UL;
+  m.state[1] = 0xefcdab89UL;
+  m.state[2] = 0x98badcfeUL;
+  m.state[3] = 0x10325476UL;
+  m.bytesLo = 0;
+  m.bytesHi = 0;
+  memset(m.buffer, 0, sizeof(m.buffer));
+}
+
+void otadl::md5Update(Md5 &m, const uint8_t *data, size_t len) {
+  size_t used = m.bytesLo & 63U;
+  const uint32_t lo = m.bytesLo + static_cast<uint32_t>(len);
+  if (lo < m.bytesLo) m.bytesHi += 1;
+  m.bytesLo = lo;
+
+  if (used) {
+    const size_t take = (len < 64 - used) ? len : 64 - used;
+    memcpy(m.buffer + used, data, take);
+    used += take;
+    data += take;
+    len -= take;
+    if (used < 64) return;
+    md5Block(m.state, m.buffer);
+  }
+  while (len >= 64) {
+    md5Block(m.state, data);
+    data += 64;
+    len -= 64;
+  }
+  memcpy(m.buffer, data, len);
+}
+
+void otadl::md5Final(const Md5 &m, uint8_t out[16]) {
+  Md5 c = m;
+  uint8_t lengthLe[8];
+  const uint32_t bitsLo = c.bytesLo << 3;
+  const uint32_t bitsHi = (c.bytesHi << 3) | (c.bytesLo >> 29);
+  for (uint8_t i = 0; i < 4; i += 1) {
+    lengthLe[i] = static_cast<uint8_t>(bitsLo >> (8 * i));
+    lengthLe[4 + i] = static_cast<uint8_t>(bitsHi >> (8 * i));
+  }
+  static const uint8_t kPad[64] = {0x80};
+  const size_t used = c.bytesLo & 63U;
+  md5Update(c, kPad, (used < 56) ? 56 - used : 120 - used);
+  md5Update(c, lengthLe, sizeof(lengthLe));
+  for (uint8_t i = 0; i < 16; i += 1) out[i] = static_cast<uint8_t>(c.state[i / 4] >> (8 * (i % 4)));
+}
+
+bool otadl::parseMd5Hex(const char *hex, uint8_t out[16]) {
+  if (!hex || strlen(hex) != 32) return false;
+  for (uint8_t i = 0; i < 16; i += 1) {
+    const int hi = hexValue(hex[i * 2]);
+    const int lo = hexValue(hex[i * 2 + 1]);
+    if (hi < 0 || lo < 0) return false;
+    out[i] = static_cast<uint8_t>((hi << 4) | lo);
+  }
+  return true;
+}
+
+void otadl::md5Hex(const uint8_t digest[16], char out[33]) {
+  static const char kDigits[] = "0123456789abcdef";
+  for (uint8_t i = 0; i < 16; i += 1) {
+    out[i * 2] = kDigits[digest[i] >> 4];
+    out[i * 2 + 1] = kDigits[digest[i] & 15];
+  }
+  out[32] = '\0';
+}
+
+uint32_t otadl::crc32(const void *data, size_t len, uint32_t seed) {
+  const uint8_t *p = static_cast<const uint8_t *>(data);
+  uint32_t crc = ~seed;
+  for (size_t i = 0; i < len; i += 1) {
+    crc ^= p[i];
+    for (uint8_t b = 0; b < 8; b += 1) crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1UL)));
+  }
+  return ~crc;
+}
+
+bool otadl::checkpointValid(const Checkpoint &cp) {
+  return cp.magic == kMagic && cp.crc == crc32(&cp, offsetof(Checkpoint, crc));
+}
+
+void otadl::sealCheckpoint(Checkpoint &cp) {
+  cp.magic = kMagic;
+  cp.crc = crc32(&cp, offsetof(Checkpoint, crc));
+}
+
+bool otadl::parseContentRange(const char *value, uint32_t &first, uint32_t &last, uint32_t &total) {
+  if (!value) return false;
+  const char *p = value;
+  while (*p == ' ') p += 1;
+  if (strncmp(p, "bytes", 5) != 0) return false;
+  p += 5;
+  while (*p == ' ') p += 1;
+  if (!parseUint(p, first) || *p != '-') return false;
+  p += 1;
+  if (!parseUint(p, last) || *p != '/') return false;
+  p += 1;
+  if (!parseUint(p, total)) return false;
+  return first <= last && last < total;
+}
+
+const char *otadl::statusToString(Status s) {
+  switch (s) {
+  case Status::Running:
+    return "running";
+  case Status::Done:
+    return "done";
+  case Status::Failed:
+    return "failed";
+  default:
+    return "idle";
+  }
+}
+
+const char *otadl::errorToString(Error e) {
+  switch (e) {
+  case Error::None:
+    return "";
+  case Error::Network:
+    return "download kept failing";
+  case Error::Http:
+    return "unexpected http status";
+  case Error::BadRange:
+    return "server sent a different range";
+  case Error::NoSize:
+    return "image size unknown";
+  case Error::TooBig:
+    return "image does not fit";
+  case Error::Flash:
+    return "flash write failed";
+  case Error::Md5:
+    return "md5 mismatch";
+  default:
+    return "unknown";
+  }
+}
+
+otadl::Status otadl::Downloader::begin(Transport &t,
+                                       FlashTarget &flash,
+                                       CheckpointStore &store,
+                                       uint32_t id,
+                                       const uint8_t *expectedMd5,
+                                       uint32_t minStart,
+                                       uint32_t regionEnd) {
+  _t = &t;
+  _flash = &flash;
+  _store = &store;
+  _minStart = minStart;
+  _regionEnd = regionEnd;
+  _status = Status::Running;
+  _error = Error::None;
+  _stats = Stats();
+  _open = false;
+  _fill = 0;
+  _skip = 0;
+  _failures = 0;
+  _retryAtMs = 0;
+
+  Checkpoint saved;
+  const bool same = store.load(saved) && checkpointValid(saved) && saved.id == id &&
+                    saved.hasExpectedMd5 == (expectedMd5 ? 1 : 0) &&
+                    (!expectedMd5 || memcmp(saved.expectedMd5, expectedMd5, sizeof(saved.expectedMd5)) == 0);
+  const bool fits = same && saved.size && saved.start >= minStart && saved.start <= regionEnd &&
+                    saved.size <= regionEnd - saved.start && saved.done <= saved.size &&
+                    (saved.done == saved.size || saved.done % kSectorSize == 0);
+  if (fits && !(saved.done == saved.size && !saved.verified)) {
+    _cp = saved;
+    _stats.resumedFrom = saved.done;
+  } else {
+    _cp = Checkpoint();
+    _cp.id = id;
+    if (expectedMd5) {
+      memcpy(_cp.expectedMd5, expectedMd5, sizeof(_cp.expectedMd5));
+      _cp.hasExpectedMd5 = 1;
+    }
+    md5Init(_cp.md5);
+    store.clear();
+  }
+  _pos = _cp.done;
+  _durableAt = _cp.done;
+  return _status;
+}
+
+otadl::Status otadl::Downloader::step() {
+  if (_status != Status::Running) return _status;
+  if (_cp.size && _cp.done >= _cp.size) return finish();
+  if (!_open) {
+    if (_retryAtMs && static_cast<int32_t>(_t->nowMs() - _retryAtMs) < 0) return _status;
+    _retryAtMs = 0;
+    openRange();
+    return _status;
+  }
+
+  uint8_t *buf = reinterpret_cast<uint8_t *>(_sector);
+  size_t want = 0;
+  uint8_t *into = buf + _fill;
+  if (_skip) {
+    want = (_skip < kSectorSize) ? _skip : kSectorSize;
+    into = buf; // scratch: _fill is 0 while skipping
+  } else {
+    want = kSectorSize - _fill;
+    if (want > _rangeEnd - _pos) want = _rangeEnd - _pos;
+  }
+
+  const int n = _t->read(into, want);
+  const uint32_t now = _t->nowMs();
+  if (n < 0) {
+    retryLater(true);
+    return _status;
+  }
+  if (n == 0) {
+    if (now - _lastByteMs > kStallMs) retryLater(true);
+    return _status;
+  }
+  _lastByteMs = now;
+  _stats.bytesFetched += static_cast<uint32_t>(n);
+  if (_skip) {
+    _skip -= static_cast<uint32_t>(n);
+    _stats.skipped += static_cast<uint32_t>(n);
+    return _status;
+  }
+
+  _fill += static_cast<uint32_t>(n);
+  _pos += static_cast<uint32_t>(n);
+  if ((_fill == kSectorSize || _pos == _cp.size) && !commitSector()) return _status;
+  if (_pos >= _rangeEnd) {
+    // This range is complete; the next step asks for the next one.
+    _t->close();
+    _open = false;
+  }
+  if (_cp.done >= _cp.size) return finish();
+  return _status;
+}
+
+void otadl::Downloader::abort() {
+  if (_t) _t->close();
+  _open = false;
+  if (_status == Status::Running) _status = Status::Idle;
+}
+
+uint8_t otadl::Downloader::progress() const {
+  if (!_cp.size) return 0;
+  return static_cast<uint8_t>(static_cast<uint64_t>(_cp.done) * 100U / _cp.size);
+}
+
+otadl::Status otadl::Downloader::fail(Error e) {
+  _t->close();
+  _open = false;
+  _status = Status::Failed;
+  _error = e;
+  return _status;
+}
+
+otadl::Status otadl::Downloader::finish() {
+  _t->close();
+  _open = false;
+  uint8_t got[16];
+  md5Final(_cp.md5, got);
+  if (_cp.hasExpectedMd5 && memcmp(got, _cp.expectedMd5, sizeof(got)) != 0) {
+    _store->clear();
+    return fail(Error::Md5);
+  }
+  if (!_cp.verified) {
+    _cp.verified = 1;
+    sealCheckpoint(_cp);
+    _store->save(_cp, true);
+  }
+  _status = Status::Done;
+  return _status;
+}
+
+void otadl::Downloader::retryLater(bool drop) {
+  _t->close();
+  _open = false;
+  if (drop) _stats.drops += 1;
+  // A partial sector is fetched again; nothing of it reached flash or the MD5.
+  _pos = _cp.done;
+  _fill = 0;
+  _skip = 0;
+  _failures += 1;
+  if (_failures > kMaxRetries) {
+    fail(Error::Network);
+    return;
+  }
+  _stats.retries += 1;
+  const uint8_t shift = (_failures - 1 < 5) ? static_cast<uint8_t>(_failures - 1) : 5;
+  uint32_t waitMs = kRetryBaseMs << shift;
+  if (waitMs > kRetryMaxMs) waitMs = kRetryMaxMs;
+  _retryAtMs = _t->nowMs() + waitMs;
+  if (!_retryAtMs) _retryAtMs = 1;
+}
+
+void otadl::Downloader::restart() {
+  const uint32_t id = _cp.id;
+  const uint8_t hasMd5 = _cp.hasExpectedMd5;
+  uint8_t md5[16];
+  memcpy(md5, _cp.expectedMd5, sizeof(md5));
+  _cp = Checkpoint();
+  _cp.id = id;
+  _cp.hasExpectedMd5 = hasMd5;
+  memcpy(_cp.expectedMd5, md5, sizeof(md5));
+  md5Init(_cp.md5);
+  _store->clear();
+  _pos = 0;
+  _fill = 0;
+  _skip = 0;
+  _durableAt = 0;
+}
+
+bool otadl::Downloader::placeImage(uint32_t size) {
+  if (!size) {
+    fail(Error::NoSize);
+    return false;
+  }
+  if (_cp.size) {
+    if (size == _cp.size) return true;
+    // A different image behind the same URL: what is in flash is worthless. The next step starts over.
+    _t->close();
+    _open = false;
+    restart();
+    return false;
+  }
+  const uint32_t rounded = (size + kSectorSize - 1) & ~(kSectorSize - 1);
+  if (_regionEnd < rounded || _regionEnd - rounded < _minStart) {
+    fail(Error::TooBig);
+    return false;
+  }
+  _cp.size = size;
+  _cp.start = _regionEnd - rounded;
+  return true;
+}
+
+bool otadl::Downloader::openRange() {
+  _pos = _cp.done;
+  _fill = 0;
+  _skip = 0;
+  const uint32_t first = _pos;
+  uint32_t last = first + kRangeBytes - 1;
+  if (_cp.size && last >= _cp.size) last = _cp.size - 1;
+
+  Response r;
+  _stats.requests += 1;
+  const bool sent = _t->request(first, last, r);
+  _stats.lastStatus = r.status;
+  if (!sent || r.status <= 0) {
+    retryLater(false);
+    return false;
+  }
+
+  if (r.status == 206) {
+    uint32_t a = 0;
+    uint32_t b = 0;
+    uint32_t total = 0;
+    if (!parseContentRange(r.contentRange, a, b, total) || a != first) {
+      fail(Error::BadRange);
+      return false;
+    }
+    if (!placeImage(total)) return false;
+    _rangeEnd = b + 1;
+  } else if (r.status == 200) {
+    // Range ignored: the whole image follows, the part we already have is read past.
+    if (!placeImage(r.length)) return false;
+    _rangeEnd = _cp.size;
+    _skip = first;
+  } else if (r.status == 416 && first > 0) {
+    // Asked past the end: the image shrank. Start over.
+    _t->close();
+    restart();
+    retryLater(false);
+    return false;
+  } else if (r.status >= 500 || r.status == 408 || r.status == 429) {
+    retryLater(false);
+    return false;
+  } else {
+    fail(Error::Http);
+    return false;
+  }
+
+  _open = true;
+  _lastByteMs = _t->nowMs();
+  return true;
+}
+
+bool otadl::Downloader::commitSector() {
+  uint8_t *buf = reinterpret_cast<uint8_t *>(_sector);
+  md5Update(_cp.md5, buf, _fill);
+  if (_cp.done == 0) {
+    _cp.header = buf[0];
+    _cp.flashMode = (_fill > 2) ? buf[2] : 0;
+  }
+
+  size_t len = _fill;
+  while (len & 3U) {
+    buf[len] = 0xFF;
+    len += 1;
+  }
+  const uint32_t addr = _cp.start + _cp.done;
+  if (!_flash->eraseSector(addr) || !_flash->write(addr, buf, len, _cp.done == 0)) {
+    fail(Error::Flash);
+    return false;
+  }
+  _cp.done += _fill;
+  _fill = 0;
+  _failures = 0;
+
+  const bool durable = _cp.done >= _cp.size || _cp.done - _durableAt >= kDurableEveryBytes;
+  sealCheckpoint(_cp);
+  _store->save(_cp, durable);
+  if (durable) _durableAt = _cp.done;
+  return true;
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Resumable firmware download: the image is fetched with HTTP Range requests, one sector at a time is
+// written into the update area, and the MD5 runs along. After every sector a checkpoint records how far
+// the image got, together with the MD5 state, so a dropped connection or a reboot continues from the
+// last full sector instead of from zero.
+//
+// This module has no Arduino dependencies: the firmware supplies HTTPClient / ESP flash / RTC+LittleFS
+// hooks (OtaUpdater.cpp), the host harness POSIX sockets and a file (see tools/ota_resume.sh) against
+// tools/ota_standin.py.
+namespace otadl {
+
+constexpr uint32_t kSectorSize = 4096;
+constexpr uint32_t kRangeBytes = 64UL * 1024UL; // one request; a drop costs at most the current sector
+constexpr uint32_t kDurableEveryBytes = 64UL * 1024UL; // checkpoint also to the durable store this often
+constexpr uint32_t kStallMs = 15000;           // no body bytes this long = dropped
+constexpr uint8_t kMaxRetries = 8;             // consecutive failed requests without progress
+constexpr uint32_t kRetryBaseMs = 1000;        // doubled per retry, up to kRetryMaxMs
+constexpr uint32_t kRetryMaxMs = 30000;
+
+// Incremental MD5 (RFC 1321) whose whole state is plain data, so it can sit in a checkpoint.
+struct Md5 {
+  uint32_t state[4];
+  uint32_t bytesLo;
+  uint32_t bytesHi;
+  uint8_t buffer[64];
+};
+void md5Init(Md5 &m);
+void md5Update(Md5 &m, const uint8_t *data, size_t len);
+void md5Final(const Md5 &m, uint8_t out[16]); // leaves `m` usable
+// 32 hex digits -> 16 bytes.
+bool parseMd5Hex(const char *hex, uint8_t out[16]);
+void md5Hex(const uint8_t digest[16], char out[33]);
+
+uint32_t crc32(const void *data, size_t len, uint32_t seed = 0);
+
+// Progress of one image. `id` ties it to the image (URL, expected MD5): a different one starts over.
+struct Checkpoint {
+  uint32_t magic = 0;
+  uint32_t id = 0;
+  uint32_t size = 0;  // image bytes (0 = not known yet)
+  uint32_t start = 0; // flash address of the first byte
+  uint32_t done = 0;  // bytes written and hashed, a sector multiple until the end
+  uint8_t expectedMd5[16] = {};
+  uint8_t hasExpectedMd5 = 0;
+  uint8_t verified = 0; // the whole image is in flash and matched
+  uint8_t header = 0;   // first image byte
+  uint8_t flashMode = 0; // image byte 2 as downloaded (the flash target may patch it in flash)
+  Md5 md5 = {};
+  uint32_t crc = 0;
+};
+static_assert(sizeof(Checkpoint) == 132, "checkpoint layout is stored in RTC memory and flash");
+
+bool checkpointValid(const Checkpoint &cp);
+void sealCheckpoint(Checkpoint &cp);
+
+// "bytes 0-65535/480000" -> 0, 65535, 480000. A "*" total is rejected.
+bool parseContentRange(const char *value, uint32_t &first, uint32_t &last, uint32_t &total);
+
+struct Response {
+  int status = 0;           // HTTP status, <= 0 = no response (connect/TLS failure)
+  uint32_t length = 0;      // Content-Length, 0 = unknown
+  const char *contentRange = nullptr; // header value for 206, may be null
+};
+
+// I/O hooks.
+class Transport {
+public:
+  virtual ~Transport() = default;
+  // Sends a GET for bytes [first, last] (inclusive) of the image and reads the response headers.
+  virtual bool request(uint32_t first, uint32_t last, Response &out) = 0;
+  // Body bytes of the open response: > 0 read, 0 = none right now, < 0 = connection closed or failed.
+  virtual int read(uint8_t *buf, size_t cap) = 0;
+  virtual void close() = 0;
+  virtual uint32_t nowMs() = 0;
+};
+
+class FlashTarget {
+public:
+  virtual ~FlashTarget() = default;
+  virtual bool eraseSector(uint32_t addr) = 0;
+  // `data` is 4-byte aligned and `len` a multiple of 4. The first sector (`imageStart`) may be patched in
+  // place (the ESP8266 flash-mode byte); the MD5 has already seen the original bytes.
+  virtual bool write(uint32_t addr, uint8_t *data, size_t len, bool imageStart) = 0;
+};
+
+class CheckpointStore {
+public:
+  virtual ~CheckpointStore() = default;
+  virtual bool load(Checkpoint &out) = 0;
+  // `durable` = also to the copy that survives a power cut.
+  virtual void save(const Checkpoint &cp, bool durable) = 0;
+  virtual void clear() = 0;
+};
+
+enum class Status : uint8_t { Idle = 0, Running, Done, Failed };
+
+enum class Error : uint8_t {
+  None = 0,
+  Network,  // retries exhausted on connect/read failures
+  Http,     // unexpected HTTP status
+  BadRange, // the server answered a different range than asked
+  NoSize,   // the image size could not be learned
+  TooBig,
+  Flash,
+  Md5,
+};
+
+const char *statusToString(Status s);
+const char *errorToString(Error e);
+
+struct Stats {
+  uint32_t requests = 0;
+  uint32_t resumedFrom = 0; // offset the download picked up at (0 = fresh)
+  uint32_t drops = 0;       // connections lost mid-range
+  uint32_t retries = 0;
+  uint32_t bytesFetched = 0; // body bytes received, including re-fetched partial sectors
+  uint32_t skipped = 0;      // bytes discarded because the server ignored Range
+  int lastStatus = 0;
+};
+
+class Downloader {
+public:
+  // Image `id` with an optional expected MD5. The image has to fit in [minStart, regionEnd) and is placed
+  // at the end of that area (like the core's Updater). A matching checkpoint is picked up.
+  Status begin(Transport &t, FlashTarget &flash, CheckpointStore &store, uint32_t id, const uint8_t *expectedMd5,
+               uint32_t minStart, uint32_t regionEnd);
+  // One bounded piece of work: at most one request or one sector of body.
+  Status step();
+  void abort();
+
+  Status status() const { return _status; }
+  Error error() const { return _error; }
+  const Checkpoint &checkpoint() const { return _cp; }
+  const Stats &stats() const { return _stats; }
+  uint8_t progress() const; // percent, 0 while the size is unknown
+  uint8_t headerByte() const { return _cp.header; } // 0xE9 for ESP8266 firmware
+  // Once Done: the MD5 of what was written.
+  void digest(uint8_t out[16]) const { md5Final(_cp.md5, out); }
+
+private:
+  Status fail(Error e);
+  Status finish();
+  void retryLater(bool drop);
+  void restart();
+  bool openRange();
+  bool commitSector();
+  bool placeImage(uint32_t size);
+
+  Transport *_t = nullptr;
+  FlashTarget *_flash = nullptr;
+  CheckpointStore *_store = nullptr;
+  uint32_t _minStart = 0;
+  uint32_t _regionEnd = 0;
+
+  Status _status = Status::Idle;
+  Error _error = Error::None;
+  Checkpoint _cp;
+  Stats _stats;
+  uint32_t _durableAt = 0; // `done` at the last durable checkpoint
+
+  bool _open = false;
+  uint32_t _pos = 0;      // image offset of the next body byte
+  uint32_t _rangeEnd = 0; // image offset the open response ends at
+  uint32_t _skip = 0;     // body bytes to drop first (server ignored Range)
+  uint32_t _lastByteMs = 0;
+  uint32_t _retryAtMs = 0;
+  uint8_t _failures = 0;
+
+  uint32_t _fill = 0;
+  uint32_t _sector[kSectorSize / 4];
+};
+
+} // namespace otadl
@@ -2,15 +2,24 @@
 
 #include <ArduinoJson.h>
 #include <ESP8266HTTPClient.h>
-#include <ESP8266httpUpdate.h>
 #include <ESP8266WiFi.h>
 #include <LittleFS.h>
 #include <WiFiClientSecureBearSSL.h>
+#include <eboot_command.h>
 #include <time.h>
 
+#include <new>
+
+#include "AppLog.h"
+#include "JsonWriter.h"
+#include "OtaDownload.h"
+#include "RtcLayout.h"
+#include "SpanTrace.h"
+
 namespace {
 constexpr const char *kStatePath = "/ota_state.json";
 constexpr uint32_t kMinRetryMs = 60UL * 1000UL;
+constexpr uint8_t kMaxManifestHops = 6;
 
 bool isHttpNetworkAvailable() {
   // Allow OTA over:
@@ -34,6 +43,7 @@ String readTextFile(const char *path) {
 }
 
 bool writeTextFile(const char *path, const String &contents) {
+  spantrace::Span span(spantrace::Lane::Fs, "ota.state");
   File file = LittleFS.open(path, "w");
   if (!file) return false;
   const size_t written = file.print(contents);
@@ -67,9 +77,272 @@ String resolveRedirect(const String &baseUrl, const String &loc) {
   const String baseDir = (lastSlash >= 0) ? baseUrl.substring(0, lastSlash + 1) : (origin + "/");
   return baseDir + loc;
 }
+
+bool isRedirectCode(int code) {
+  return code == HTTP_CODE_MOVED_PERMANENTLY || code == HTTP_CODE_FOUND || code == HTTP_CODE_SEE_OTHER ||
+         code == HTTP_CODE_TEMPORARY_REDIRECT || code == 308;
+}
+
+// Firmware hooks of the resumable download (OtaDownload.h).
+
+// Clear of the eboot command written at install (RtcLayout.h).
+constexpr uint32_t kDlRtcOffsetWords = rtcmem::kOtaCheckpoint;
+static_assert(sizeof(otadl::Checkpoint) <= rtcmem::kOtaCheckpointWords * 4, "checkpoint outgrew its RTC words");
+constexpr const char *kDlCheckpointPath = "/ota_dl.bin";
+constexpr uint16_t kDlHttpTimeoutMs = 15000;
+// A download nobody stepped for this long (its job timed out) is dropped; the checkpoint stays.
+constexpr uint32_t kDlOrphanMs = 60UL * 1000UL;
+// Same for a manifest check a job started and stopped stepping.
+constexpr uint32_t kCheckOrphanMs = 60UL * 1000UL;
+// Background prefetch: time budget of one slice, and the pause after a prefetch failed.
+constexpr uint32_t kPrefetchSliceUs = 8000;
+constexpr uint32_t kPrefetchRetryMs = 15UL * 60UL * 1000UL;
+// No new connection (TCP connect + TLS handshake block the loop) this close to a relay change: applies to the
+// prefetch and to check/update jobs alike.
+constexpr int64_t kConnectHoldS = 30;
+// Manifest requests: each blocking wait (DNS, connect, a read) is cut off after this, so one hop holds the
+// loop for about the TLS handshake plus a few of these at worst.
+constexpr uint16_t kManifestHttpTimeoutMs = 1000;
+
+// One Range GET per request(). Redirects are followed by hand like the manifest fetch; the final URL is
+// reused for the next ranges. Release hosts redirect to signed URLs that expire, so a 4xx there goes back
+// to the manifest's URL once.
+//
+// A range read to its end leaves the connection open (HTTP/1.1 keep-alive), so the next range costs one
+// round trip instead of a TCP connect and TLS handshake that block the loop. A reconnect resumes the TLS
+// session. Anything else (redirect, error, a drop mid-body, another host) closes it.
+class HttpRangeTransport : public otadl::Transport {
+public:
+  explicit HttpRangeTransport(const String &url) : _url(url), _resolved(url) {}
+
+  bool request(uint32_t first, uint32_t last, otadl::Response &out) override {
+    close();
+    out = otadl::Response();
+    String url = _resolved;
+    bool fromOrigin = (url == _url);
+    for (uint8_t hop = 0; hop < kMaxManifestHops; hop += 1) {
+      if (!isHttpNetworkAvailable()) return false;
+      if (url != _keptUrl) drop();
+      const int code = get(url, first, last);
+      if (isRedirectCode(code)) {
+        String loc = _http.header("Location");
+        if (!loc.length()) loc = _http.getLocation();
+        drop();
+        url = resolveRedirect(url, loc);
+        if (!url.length()) return false;
+        continue;
+      }
+      if (code >= 400 && code < 500 && code != HTTP_CODE_RANGE_NOT_SATISFIABLE && !fromOrigin) {
+        drop();
+        url = _url;
+        fromOrigin = true;
+        continue;
+      }
+      if (code >= 200 && code < 300 && !_http10 && _http.header("Transfer-Encoding").length()) {
+        // A chunked body cannot be read raw; this server gets HTTP/1.0 (a connection per range).
+        drop();
+        _http10 = true;
+        continue;
+      }
+      out.status = code;
+      if (code < 200 || code >= 300) {
+        drop();
+        return true;
+      }
+      const int size = _http.getSize();
+      out.length = (size > 0) ? static_cast<uint32_t>(size) : 0;
+      _contentRange = _http.header("Content-Range");
+      out.contentRange = _contentRange.length() ? _contentRange.c_str() : nullptr;
+      _resolved = url;
+      _keptUrl = url;
+      _remaining = out.length;
+      _sized = out.length != 0;
+      _open = true;
+      return true;
+    }
+    drop();
+    return false;
+  }
+
+  int read(uint8_t *buf, size_t cap) override {
+    if (!_open) return -1;
+    WiFiClient *stream = _http.getStreamPtr();
+    if (!stream) return -1;
+    const int avail = stream->available();
+    if (avail <= 0) return stream->connected() ? 0 : -1;
+    size_t want = (static_cast<size_t>(avail) < cap) ? static_cast<size_t>(avail) : cap;
+    if (_remaining && want > _remaining) want = _remaining;
+    const int n = stream->read(buf, want);
+    if (n > 0 && _remaining) _remaining -= static_cast<uint32_t>(n);
+    return n;
+  }
+
+  void close() override {
+    if (!_open) return;
+    _open = false;
+    if (_remaining || !_sized || _http10) {
+      drop(); // body not read to its end (or of unknown length): the connection is out of step
+      return;
+    }
+    _http.end(); // keeps the connection for the next range
+  }
+
+  // The next request() will not have to connect (a response is open or the connection is kept).
+  bool warm() { return _open || (_keptUrl.length() && _http.connected()); }
+
+  uint32_t nowMs() override { return millis(); }
+
+private:
+  int get(const String &url, uint32_t first, uint32_t last) {
+    _http.setTimeout(kDlHttpTimeoutMs);
+    _http.setFollowRedirects(HTTPC_DISABLE_FOLLOW_REDIRECTS);
+    _http.setReuse(!_http10);
+    _http.useHTTP10(_http10);
+    _http.setUserAgent("shabat-relay/" + String(SHABAT_RELAY_VERSION));
+    WiFiClient *client = &_plain;
+    if (url.startsWith("https://")) {
+      // Same settings as the manifest fetch (see fetchManifestHop()).
+      _secure.setInsecure();
+      _secure.setBufferSizes(512, 512);
+      _secure.setCiphersLessSecure();
+      _secure.setSession(&_session);
+      client = &_secure;
+    }
+    if (!_http.begin(*client, url)) return -1;
+    const char *keys[] = {"Location", "Content-Range", "Transfer-Encoding"};
+    _http.collectHeaders(keys, 3);
+    char range[32];
+    snprintf(range, sizeof(range), "bytes=%lu-%lu", static_cast<unsigned long>(first), static_cast<unsigned long>(last));
+    _http.addHeader("Range", range);
+    return _http.GET();
+  }
+
+  void drop() {
+    _http.setReuse(false);
+    _http.end();
+    _plain.stop();
+    _secure.stop();
+    _keptUrl = "";
+    _open = false;
+    _remaining = 0;
+  }
+
+  String _url;      // from the manifest
+  String _resolved; // after redirects
+  String _keptUrl;  // the open connection talks to this URL's host, "" = none
+  HTTPClient _http;
+  WiFiClient _plain;
+  BearSSL::WiFiClientSecure _secure;
+  BearSSL::Session _session;
+  String _contentRange;
+  uint32_t _remaining = 0; // body bytes of the open response not read yet
+  bool _sized = false;     // the open response has a Content-Length
+  bool _open = false;
+  bool _http10 = false;
+};
+
+class EspFlashTarget : public otadl::FlashTarget {
+public:
+  bool eraseSector(uint32_t addr) override { return ESP.flashEraseSector(addr / otadl::kSectorSize); }
+
+  bool write(uint32_t addr, uint8_t *data, size_t len, bool imageStart) override {
+    // Like the core's Updater: an image built for another flash mode gets the one this chip runs in.
+    if (imageStart && len > 2 && data[0] == 0xE9) {
+      const FlashMode_t mode = ESP.getFlashChipMode();
+      if (ESP.magicFlashChipMode(data[2]) != mode) data[2] = static_cast<uint8_t>(mode);
+    }
+    return ESP.flashWrite(addr, reinterpret_cast<const uint32_t *>(data), len);
+  }
+};
+
+// RTC memory after every sector (survives a reset), LittleFS when asked to be durable (survives power loss).
+class RtcFlashStore : public otadl::CheckpointStore {
+public:
+  bool load(otadl::Checkpoint &out) override {
+    if (ESP.rtcUserMemoryRead(kDlRtcOffsetWords, reinterpret_cast<uint32_t *>(&out), sizeof(out)) &&
+        otadl::checkpointValid(out)) {
+      return true;
+    }
+    File file = LittleFS.open(kDlCheckpointPath, "r");
+    if (!file) return false;
+    const size_t n = file.read(reinterpret_cast<uint8_t *>(&out), sizeof(out));
+    file.close();
+    return n == sizeof(out) && otadl::checkpointValid(out);
+  }
+
+  void save(const otadl::Checkpoint &cp, bool durable) override {
+    otadl::Checkpoint tmp = cp;
+    ESP.rtcUserMemoryWrite(kDlRtcOffsetWords, reinterpret_cast<uint32_t *>(&tmp), sizeof(tmp));
+    if (!durable) return;
+    spantrace::Span span(spantrace::Lane::Fs, "ota.checkpoint");
+    File file = LittleFS.open(kDlCheckpointPath, "w");
+    if (!file) return;
+    file.write(reinterpret_cast<const uint8_t *>(&cp), sizeof(cp));
+    file.close();
+  }
+
+  void clear() override {
+    otadl::Checkpoint blank;
+    ESP.rtcUserMemoryWrite(kDlRtcOffsetWords, reinterpret_cast<uint32_t *>(&blank), sizeof(blank));
+    if (LittleFS.exists(kDlCheckpointPath)) LittleFS.remove(kDlCheckpointPath);
+  }
+};
+
+// Reads the image back and hashes it, with the original flash-mode byte, against the download's MD5.
+bool verifyInFlash(const otadl::Checkpoint &cp) {
+  otadl::Md5 md5;
+  otadl::md5Init(md5);
+  uint32_t buf[64];
+  uint8_t *bytes = reinterpret_cast<uint8_t *>(buf);
+  for (uint32_t off = 0; off < cp.size; off += sizeof(buf)) {
+    const uint32_t n = (cp.size - off < sizeof(buf)) ? cp.size - off : sizeof(buf);
+    if (!ESP.flashRead(cp.start + off, buf, (n + 3) & ~3U)) return false;
+    if (off == 0 && n > 2) bytes[2] = cp.flashMode;
+    otadl::md5Update(md5, bytes, n);
+    if ((off & 0x3FFF) == 0) yield();
+  }
+  uint8_t got[16];
+  uint8_t want[16];
+  otadl::md5Final(md5, got);
+  otadl::md5Final(cp.md5, want);
+  return memcmp(got, want, sizeof(got)) == 0;
+}
 } // namespace
 
-void OtaUpdater::begin() { loadState(); }
+struct OtaDownloadSession {
+  explicit OtaDownloadSession(const String &url) : http(url) {}
+
+  HttpRangeTransport http;
+  EspFlashTarget flash;
+  RtcFlashStore store;
+  otadl::Downloader dl;
+  uint32_t lastStepMs = 0;
+};
+
+void OtaUpdater::begin(HeapMonitor &heap) {
+  _heap = &heap;
+  _heapManifest = heap.addSource("ota/manifest");
+  _heapUpdate = heap.addSource("ota/update");
+  if (_heapManifest == HeapMonitor::kInvalidSource || _heapUpdate == HeapMonitor::kInvalidSource) {
+    applog::warn(applog::Module::Ota, "no heap source for the OTA phases");
+  }
+  loadState();
+  // A download cut short before this boot, or an image staged for install.
+  loadCheckpointState();
+}
+
+void OtaUpdater::loadCheckpointState() {
+  if (_dl) return; // the running download keeps these current
+  _dlDone = 0;
+  _dlSize = 0;
+  _dlVerified = false;
+  RtcFlashStore store;
+  otadl::Checkpoint cp;
+  if (!hasUpdateAvailable() || !store.load(cp) || cp.id != downloadId()) return;
+  _dlDone = cp.done;
+  _dlSize = cp.size;
+  _dlVerified = cp.verified && cp.done == cp.size && cp.header == 0xE9;
+}
 
 bool OtaUpdater::hasUpdateAvailable() const { return _availableVersion.length() && _availableBinUrl.length(); }
 
@@ -82,6 +355,18 @@ bool OtaUpdater::isSafeForAutoUpdate(const ScheduleStatus &st) {
   return !st.inHolyTime;
 }
 
+bool OtaUpdater::isPrefetchAllowed(const AppConfig &cfg, const ScheduleStatus &st) {
+  if (!cfg.otaPrefetch) return false;
+  // Downloading into the spare flash area changes nothing the device does; whether that is acceptable on
+  // Shabbat / Yom Tov is the operator's call. Without that, it waits like the install.
+  return cfg.otaPrefetchHolyTime || isSafeForAutoUpdate(st);
+}
+
+bool OtaUpdater::isBackgroundDownloadAllowed(const AppConfig &cfg, const ScheduleStatus &st) {
+  // Without prefetch the auto-update still downloads in slices, but only when it could install right after.
+  return isPrefetchAllowed(cfg, st) || (cfg.otaAuto && isSafeForAutoUpdate(st));
+}
+
 bool OtaUpdater::isBlockedByHolyTime(const ScheduleStatus &st) {
   if (!st.ok) return false; // if schedule unknown, don't block (manual may still proceed)
   return st.inHolyTime;
@@ -162,139 +447,164 @@ int OtaUpdater::compareVersions(const String &aRaw, const String &bRaw) {
   return aRaw < bRaw ? -1 : 1;
 }
 
-bool OtaUpdater::fetchManifest(const AppConfig &cfg,
-                              String &outVersion,
-                              String &outBinUrl,
-                              String &outMd5,
-                              String &outNotes) {
-  outVersion = "";
-  outBinUrl = "";
-  outMd5 = "";
-  outNotes = "";
-
-  const String url = cfg.otaManifestUrl;
-  if (!url.length()) {
-    _lastError = "missing manifestUrl";
-    return false;
+OtaUpdater::Hop OtaUpdater::fetchManifestHop(String &outVersion, String &outBinUrl, String &outMd5, String &outNotes) {
+  if (_checkHops >= kMaxManifestHops) {
+    _lastError = "http redirect limit";
+    return Hop::Failed;
   }
+  _checkHops += 1;
   if (!isHttpNetworkAvailable()) {
     _lastError = "network not connected";
-    return false;
+    return Hop::Failed;
   }
 
   // We intentionally implement redirects ourselves instead of relying on HTTPClient's built-in
   // follow-redirects: GitHub Releases often redirects to a different HTTPS host
   // (objects.githubusercontent.com), and reusing a single TLS client can fail on ESP8266.
-  String curUrl = url;
-  DynamicJsonDocument doc(4096);
-  bool parsed = false;
-  for (uint8_t hop = 0; hop < 6; hop += 1) {
-    HTTPClient http;
-    http.setTimeout(15000);
-    http.setFollowRedirects(HTTPC_DISABLE_FOLLOW_REDIRECTS);
-    http.setReuse(false);
-    http.useHTTP10(true);
-    http.setUserAgent("shabat-relay/" + String(SHABAT_RELAY_VERSION));
-
-    const bool https = isHttpsUrl(curUrl);
-    WiFiClient plain;
-    BearSSL::WiFiClientSecure secure;
-    WiFiClient *client = &plain;
-    if (https) {
-      secure.setInsecure(); // GitHub/raw are HTTPS; keep it simple
-      // GitHub TLS handshakes can fail on ESP8266 due to RAM pressure.
-      // Smaller buffers significantly improve success rates.
-      secure.setBufferSizes(512, 512);
-      secure.setCiphersLessSecure();
-      client = &secure;
-    }
-    if (!http.begin(*client, curUrl)) {
-      _lastError = "http begin failed";
-      return false;
-    }
-    const char *hdrKeys[] = {"Location", "location", "LOCATION"};
-    http.collectHeaders(hdrKeys, 3);
-
-    const int code = http.GET();
-    if (code == HTTP_CODE_OK) {
-      doc.clear();
-      DeserializationError err = deserializeJson(doc, http.getStream());
-      http.end();
-      if (err) {
-        _lastError = "manifest json parse failed";
-        return false;
-      }
-      parsed = true;
-      break;
+  HTTPClient http;
+  http.setTimeout(kManifestHttpTimeoutMs);
+  http.setFollowRedirects(HTTPC_DISABLE_FOLLOW_REDIRECTS);
+  http.setReuse(false);
+  http.useHTTP10(true);
+  http.setUserAgent("shabat-relay/" + String(SHABAT_RELAY_VERSION));
+
+  const bool https = isHttpsUrl(_checkUrl);
+  WiFiClient plain;
+  BearSSL::WiFiClientSecure secure;
+  WiFiClient *client = &plain;
+  if (https) {
+    secure.setInsecure(); // GitHub/raw are HTTPS; keep it simple
+    // GitHub TLS handshakes can fail on ESP8266 due to RAM pressure.
+    // Smaller buffers significantly improve success rates.
+    secure.setBufferSizes(512, 512);
+    secure.setCiphersLessSecure();
+    client = &secure;
+  }
+  if (!http.begin(*client, _checkUrl)) {
+    _lastError = "http begin failed";
+    return Hop::Failed;
+  }
+  const char *hdrKeys[] = {"Location", "location", "LOCATION"};
+  http.collectHeaders(hdrKeys, 3);
+
+  const int code = http.GET();
+  // TLS session and receive buffers are live here: this is the low point of a manifest fetch.
+  if (_heap) _heap->sample(_heapManifest, HeapMonitor::Phase::During);
+  if (code == HTTP_CODE_OK) {
+    DynamicJsonDocument doc(4096);
+    DeserializationError err = deserializeJson(doc, http.getStream());
+    http.end();
+    if (err) {
+      _lastError = "manifest json parse failed";
+      return Hop::Failed;
     }
 
-    // Follow common redirects (GitHub). Prefer absolute Location.
-    if (code == HTTP_CODE_MOVED_PERMANENTLY || code == HTTP_CODE_FOUND || code == HTTP_CODE_SEE_OTHER ||
-        code == HTTP_CODE_TEMPORARY_REDIRECT || code == 308) {
-      String loc = http.header("Location");
-      if (!loc.length()) loc = http.header("location");
-      if (!loc.length()) loc = http.header("LOCATION");
-      if (!loc.length()) loc = http.getLocation();
-      http.end();
-      if (!loc.length()) {
-        _lastError = "http " + String(code) + " redirect missing location";
-        return false;
-      }
-      const String nextUrl = resolveRedirect(curUrl, loc);
-      if (!nextUrl.length()) {
-        _lastError = "http " + String(code) + " redirect unsupported";
-        return false;
-      }
-      curUrl = nextUrl;
-      continue;
+    const String version = doc["version"] | "";
+    const String bin = doc["bin"] | doc["url"] | "";
+    const String md5 = doc["md5"] | "";
+    const String notes = doc["notes"] | doc["message"] | "";
+    if (!version.length() || !bin.length()) {
+      _lastError = "manifest missing version/bin";
+      return Hop::Failed;
     }
+    outVersion = version;
+    outBinUrl = bin;
+    outMd5 = md5;
+    outNotes = trimNotes(notes);
+    _lastError = "";
+    return Hop::Parsed;
+  }
 
-    const String errStr = http.errorToString(code);
+  // Follow common redirects (GitHub). Prefer absolute Location.
+  if (isRedirectCode(code)) {
+    String loc = http.header("Location");
+    if (!loc.length()) loc = http.header("location");
+    if (!loc.length()) loc = http.header("LOCATION");
+    if (!loc.length()) loc = http.getLocation();
     http.end();
-    if (errStr.length()) _lastError = "http " + String(code) + " " + errStr;
-    else _lastError = "http " + String(code);
-    return false;
+    if (!loc.length()) {
+      _lastError = "http " + String(code) + " redirect missing location";
+      return Hop::Failed;
+    }
+    const String nextUrl = resolveRedirect(_checkUrl, loc);
+    if (!nextUrl.length()) {
+      _lastError = "http " + String(code) + " redirect unsupported";
+      return Hop::Failed;
+    }
+    _checkUrl = nextUrl;
+    return Hop::Redirect;
   }
 
-  if (!parsed) {
-    _lastError = "http redirect limit";
+  const String errStr = http.errorToString(code);
+  http.end();
+  if (errStr.length()) _lastError = "http " + String(code) + " " + errStr;
+  else _lastError = "http " + String(code);
+  return Hop::Failed;
+}
+
+bool OtaUpdater::beginCheck(const AppConfig &cfg, OtaCheckResult &out) {
+  out = OtaCheckResult();
+  if (_checking) {
+    out.message = "check already running";
     return false;
   }
-
-  const String version = doc["version"] | "";
-  const String bin = doc["bin"] | doc["url"] | "";
-  const String md5 = doc["md5"] | "";
-  const String notes = doc["notes"] | doc["message"] | "";
-
-  if (!version.length() || !bin.length()) {
-    _lastError = "manifest missing version/bin";
+  if (!isHttpNetworkAvailable()) {
+    out.message = "network not connected";
+    return false;
+  }
+  if (!cfg.otaManifestUrl.length()) {
+    out.message = "manifestUrl not set";
     return false;
   }
 
-  outVersion = version;
-  outBinUrl = bin;
-  outMd5 = md5;
-  outNotes = trimNotes(notes);
-  _lastError = "";
+  _checking = true;
+  _autoCheck = false;
+  _checkUrl = cfg.otaManifestUrl;
+  _checkHops = 0;
+  _checkStartUs = spantrace::now();
+  _checkStepMs = millis();
+  if (_heap) _heap->sample(_heapManifest, HeapMonitor::Phase::Before);
   return true;
 }
 
-OtaCheckResult OtaUpdater::checkNow(const AppConfig &cfg) {
-  OtaCheckResult r{};
-  r.ok = false;
-  r.available = false;
-
-  if (!isHttpNetworkAvailable()) {
-    r.message = "network not connected";
-    return r;
-  }
-  if (!cfg.otaManifestUrl.length()) {
-    r.message = "manifestUrl not set";
-    return r;
+bool OtaUpdater::stepCheck(OtaCheckResult &out) {
+  if (!_checking) {
+    out = OtaCheckResult();
+    out.message = "no check running";
+    return true;
   }
-
+  _checkStepMs = millis();
+  if (_connectHold) return false; // the next hop connects: wait until the relay change is past
   String ver, bin, md5, notes;
-  if (!fetchManifest(cfg, ver, bin, md5, notes)) {
+  const Hop hop = fetchManifestHop(ver, bin, md5, notes);
+  _checkStepMs = millis();
+  if (hop == Hop::Redirect) return false;
+
+  _checking = false;
+  _checkUrl = "";
+  spantrace::complete(spantrace::Lane::Ota, "ota.manifest", _checkStartUs, hop == Hop::Parsed ? 1 : 0);
+  if (_heap) _heap->sample(_heapManifest, HeapMonitor::Phase::After);
+  out = finishCheck(hop == Hop::Parsed, ver, bin, md5, notes);
+  return true;
+}
+
+void OtaUpdater::cancelCheck() {
+  if (!_checking) return;
+  applog::warn(applog::Module::Ota, "check abandoned after %u hops", static_cast<unsigned>(_checkHops));
+  _checking = false;
+  _autoCheck = false;
+  _checkUrl = "";
+  spantrace::complete(spantrace::Lane::Ota, "ota.manifest", _checkStartUs, 0);
+  if (_heap) _heap->sample(_heapManifest, HeapMonitor::Phase::After);
+}
+
+OtaCheckResult OtaUpdater::finishCheck(bool fetched,
+                                       const String &ver,
+                                       const String &bin,
+                                       const String &md5,
+                                       const String &notes) {
+  OtaCheckResult r{};
+  if (!fetched) {
     r.message = _lastError.length() ? _lastError : "manifest fetch failed";
     saveState();
     return r;
@@ -310,6 +620,7 @@ OtaCheckResult OtaUpdater::checkNow(const AppConfig &cfg) {
 
   _lastCheckUtc = static_cast<uint32_t>(time(nullptr));
   saveState();
+  loadCheckpointState();
 
   r.ok = true;
   r.available = available;
@@ -318,88 +629,284 @@ OtaCheckResult OtaUpdater::checkNow(const AppConfig &cfg) {
   return r;
 }
 
-bool OtaUpdater::updateNow(const AppConfig &cfg) {
-  _lastAttemptUtc = static_cast<uint32_t>(time(nullptr));
-  saveState();
+uint32_t OtaUpdater::downloadId() const {
+  // The same image (URL, MD5, version) resumes; anything else starts over.
+  uint32_t id = otadl::crc32(_availableBinUrl.c_str(), _availableBinUrl.length());
+  id = otadl::crc32(_availableMd5.c_str(), _availableMd5.length(), id);
+  return otadl::crc32(_availableVersion.c_str(), _availableVersion.length(), id);
+}
 
-  if (!isHttpNetworkAvailable()) {
-    _lastError = "network not connected";
-    saveState();
+bool OtaUpdater::beginDownload(String &message) {
+  if (_dl && _dlBackground) {
+    // The prefetch has it going: the caller steps it from here on.
+    _dlBackground = false;
+    _dl->lastStepMs = millis();
+    message = "downloading";
+    return true;
+  }
+  if (_dl) {
+    message = "download already running";
     return false;
   }
-
   if (!hasUpdateAvailable()) {
-    const OtaCheckResult chk = checkNow(cfg);
-    if (!chk.ok) return false;
-    if (!chk.available) return true; // nothing to do
+    message = "no update available";
+    return false;
+  }
+  if (!isHttpNetworkAvailable()) {
+    message = "network not connected";
+    return false;
+  }
+  uint8_t md5[16];
+  const bool hasMd5 = otadl::parseMd5Hex(_availableMd5.c_str(), md5);
+  if (_availableMd5.length() && !hasMd5) {
+    message = "manifest md5 malformed";
+    return false;
+  }
+  _dl = new (std::nothrow) OtaDownloadSession(_availableBinUrl);
+  if (!_dl) {
+    message = "out of memory";
+    return false;
   }
 
-  ESPhttpUpdate.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-  ESPhttpUpdate.rebootOnUpdate(false);
-  ESPhttpUpdate.closeConnectionsOnUpdate(true);
+  _lastAttemptUtc = static_cast<uint32_t>(time(nullptr));
+  saveState();
 
-  if (cfg.statusLedGpio >= 0) {
-    ESPhttpUpdate.setLedPin(cfg.statusLedGpio, cfg.statusLedActiveLow ? LOW : HIGH);
+  // The area the core's Updater uses: the end of the free sketch space.
+  const uint32_t sketchEnd = (ESP.getSketchSize() + otadl::kSectorSize - 1) & ~(otadl::kSectorSize - 1);
+  _dl->dl.begin(_dl->http, _dl->flash, _dl->store, downloadId(), hasMd5 ? md5 : nullptr, sketchEnd,
+                sketchEnd + ESP.getFreeSketchSpace());
+  _dl->lastStepMs = millis();
+  const otadl::Checkpoint &cp = _dl->dl.checkpoint();
+  _dlResumedFrom = cp.done;
+  _dlDone = cp.done;
+  _dlSize = cp.size;
+  _dlDrops = 0;
+  _dlRetries = 0;
+  _dlVerified = false;
+  _dlSampled = false;
+  _dlStartUs = spantrace::now();
+  if (_heap) _heap->sample(_heapUpdate, HeapMonitor::Phase::Before);
+  if (cp.done) {
+    applog::info(applog::Module::Ota,
+                 "download %s resumes at %lu/%lu",
+                 _availableVersion.c_str(),
+                 static_cast<unsigned long>(cp.done),
+                 static_cast<unsigned long>(cp.size));
+  } else {
+    applog::info(applog::Module::Ota, "download %s", _availableVersion.c_str());
+  }
+  message = cp.done ? "resuming download" : "downloading";
+  return true;
+}
+
+bool OtaUpdater::stepDownload(bool &ok, String &message) {
+  ok = false;
+  if (!_dl) {
+    message = "no download running";
+    return true;
+  }
+  _dl->lastStepMs = millis();
+  if (_connectHold && !_dl->http.warm()) {
+    message = "waiting for the relay change";
+    return false;
+  }
+  const uint8_t progressBefore = downloadProgress();
+  const otadl::Status st = _dl->dl.step();
+  const otadl::Checkpoint &cp = _dl->dl.checkpoint();
+  const otadl::Stats &stats = _dl->dl.stats();
+  _dlDone = cp.done;
+  _dlSize = cp.size;
+  if (downloadProgress() != progressBefore) _version += 1;
+  _dlDrops = stats.drops;
+  _dlRetries = stats.retries;
+  if (!_dlSampled && cp.done > _dlResumedFrom) {
+    // Connected and writing flash: the TLS buffers and the sector buffer are all allocated.
+    _dlSampled = true;
+    if (_heap) _heap->sample(_heapUpdate, HeapMonitor::Phase::During);
+  }
+  if (st == otadl::Status::Running) {
+    message = "downloading";
+    return false;
   }
 
-  if (_availableMd5.length()) {
-    ESPhttpUpdate.setMD5sum(_availableMd5);
+  if (st == otadl::Status::Done && cp.header != 0xE9) {
+    message = "not a firmware image";
+    _dl->store.clear();
+  } else if (st == otadl::Status::Done) {
+    ok = true;
+    message = "downloaded";
   } else {
-    ESPhttpUpdate.setMD5sum("");
+    message = otadl::errorToString(_dl->dl.error());
+    if (_dl->dl.error() == otadl::Error::Http) message += " " + String(stats.lastStatus);
   }
+  _dlVerified = ok;
+  spantrace::complete(spantrace::Lane::Ota, "ota.download", _dlStartUs, ok ? 1 : 0);
+  if (_heap) _heap->sample(_heapUpdate, HeapMonitor::Phase::After);
+  if (ok) {
+    applog::info(applog::Module::Ota,
+                 "downloaded %lu bytes (from %lu, %lu drops, %lu retries)",
+                 static_cast<unsigned long>(cp.size),
+                 static_cast<unsigned long>(_dlResumedFrom),
+                 static_cast<unsigned long>(stats.drops),
+                 static_cast<unsigned long>(stats.retries));
+  } else {
+    applog::warn(applog::Module::Ota,
+                 "download failed at %lu/%lu: %s",
+                 static_cast<unsigned long>(cp.done),
+                 static_cast<unsigned long>(cp.size),
+                 message.c_str());
+  }
+  _lastError = ok ? "" : message;
+  saveState();
+  endDownload();
+  return true;
+}
 
-  const String url = _availableBinUrl;
-  const bool https = isHttpsUrl(url);
+void OtaUpdater::cancelDownload() {
+  if (!_dl) return;
+  applog::info(applog::Module::Ota, "download stopped at %lu", static_cast<unsigned long>(_dlDone));
+  spantrace::complete(spantrace::Lane::Ota, "ota.download", _dlStartUs, 0);
+  endDownload();
+}
 
-  t_httpUpdate_return ret = HTTP_UPDATE_FAILED;
-  if (https) {
-    BearSSL::WiFiClientSecure client;
-    client.setInsecure();
-    client.setBufferSizes(512, 512);
-    client.setCiphersLessSecure();
-    ret = ESPhttpUpdate.update(client, url);
-  } else {
-    WiFiClient client;
-    ret = ESPhttpUpdate.update(client, url);
+void OtaUpdater::endDownload() {
+  _dl->dl.abort();
+  delete _dl;
+  _dl = nullptr;
+  _dlBackground = false;
+}
+
+void OtaUpdater::prefetchSlice() {
+  if (!prefetching()) return;
+  const uint32_t startUs = micros();
+  bool ok = false;
+  String message;
+  do {
+    const uint32_t fetched = _dl->dl.stats().bytesFetched;
+    if (stepDownload(ok, message)) {
+      if (ok) {
+        applog::info(applog::Module::Ota, "%s staged for install", _availableVersion.c_str());
+      } else {
+        _prefetchRetryAtMs = millis() + kPrefetchRetryMs;
+      }
+      return;
+    }
+    // Nothing arrived (or a request / retry wait): the rest of the loop gets the CPU, lwIP the time.
+    if (_dl->dl.stats().bytesFetched == fetched) return;
+  } while (micros() - startUs < kPrefetchSliceUs);
+}
+
+void OtaUpdater::tickPrefetch(const AppConfig &cfg, const ScheduleStatus &st, bool idle) {
+  const bool allowed = idle && isBackgroundDownloadAllowed(cfg, st) && WiFi.status() == WL_CONNECTED;
+  if (prefetching()) {
+    // Stopped, not failed: the checkpoint keeps what is in flash for the next start.
+    if (!allowed) cancelDownload();
+    return;
   }
+  if (_dl || _checking) return; // a job has the download or a check runs
 
-  if (ret == HTTP_UPDATE_NO_UPDATES) {
-    _availableVersion = "";
-    _availableBinUrl = "";
-    _availableMd5 = "";
-    _availableNotes = "";
-    _lastError = "";
-    saveState();
-    return true;
+  // The first safe moment after the image is staged: the install is only the reboot.
+  if (hasStagedUpdate() && cfg.otaAuto && idle && isSafeForAutoUpdate(st)) {
+    installDownloaded();
+    return;
   }
 
-  if (ret == HTTP_UPDATE_OK) {
-    _lastError = "";
-    _availableVersion = "";
-    _availableBinUrl = "";
-    _availableMd5 = "";
-    _availableNotes = "";
+  if (!allowed || !hasUpdateAvailable() || hasStagedUpdate()) return;
+  if (_prefetchRetryAtMs && static_cast<int32_t>(millis() - _prefetchRetryAtMs) < 0) return;
+  _prefetchRetryAtMs = 0;
+  String message;
+  if (!beginDownload(message)) {
+    applog::warn(applog::Module::Ota, "prefetch not started: %s", message.c_str());
+    _prefetchRetryAtMs = millis() + kPrefetchRetryMs;
+    return;
+  }
+  _dlBackground = true;
+}
+
+uint8_t OtaUpdater::downloadProgress() const {
+  if (!_dlSize) return 0;
+  return static_cast<uint8_t>(static_cast<uint64_t>(_dlDone) * 100U / _dlSize);
+}
+
+bool OtaUpdater::installDownloaded() {
+  RtcFlashStore store;
+  otadl::Checkpoint cp;
+  if (_dl || !hasUpdateAvailable() || !store.load(cp) || cp.id != downloadId() || !cp.verified ||
+      cp.done != cp.size || cp.header != 0xE9) {
+    _lastError = "no verified image";
     saveState();
-    delay(200);
-    ESP.restart();
-    delay(1000);
-    return true;
+    loadCheckpointState();
+    return false;
+  }
+  if (!verifyInFlash(cp)) {
+    store.clear();
+    _dlDone = 0;
+    _dlSize = 0;
+    _dlVerified = false;
+    _lastError = "image in flash damaged";
+    saveState();
+    return false;
   }
 
-  _lastError = ESPhttpUpdate.getLastErrorString();
+  applog::info(applog::Module::Ota, "installing %s", _availableVersion.c_str());
+  spantrace::instant(spantrace::Lane::Ota, "ota.install", static_cast<int32_t>(cp.size));
+  store.clear();
+  _lastError = "";
+  _availableVersion = "";
+  _availableBinUrl = "";
+  _availableMd5 = "";
+  _availableNotes = "";
   saveState();
-  return false;
+
+  // What Updater::end() does: the boot loader copies the image over the sketch on the next start.
+  eboot_command ebcmd;
+  ebcmd.action = ACTION_COPY_RAW;
+  ebcmd.args[0] = cp.start;
+  ebcmd.args[1] = 0x00000;
+  ebcmd.args[2] = cp.size;
+  eboot_command_write(&ebcmd);
+
+  delay(200);
+  applog::flush();
+  ESP.restart();
+  delay(1000);
+  return true;
 }
 
-void OtaUpdater::tick(const AppConfig &cfg, const TimeKeeper &time, const ScheduleEngine &schedule) {
-  if (!cfg.otaAuto) return;
+void OtaUpdater::tick(const AppConfig &cfg, const TimeKeeper &time, const ScheduleEngine &schedule, bool idle) {
+  if (_dl && !_dlBackground && millis() - _dl->lastStepMs > kDlOrphanMs) cancelDownload();
+  if (_checking && !_autoCheck && millis() - _checkStepMs > kCheckOrphanMs) cancelCheck();
+  const ScheduleStatus &status = schedule.status();
+  _connectHold = status.nextChangeLocal > 0 && status.nextChangeLocal - status.nowLocal < kConnectHoldS;
+  tickPrefetch(cfg, status, idle);
+
+  // The periodic check goes one hop per tick, like the background jobs.
+  if (_checking && _autoCheck) {
+    OtaCheckResult chk;
+    if (!stepCheck(chk)) return;
+    if (!chk.ok) {
+      applog::warn(applog::Module::Ota, "check failed: %s", chk.message.c_str());
+      return;
+    }
+    if (!chk.available) {
+      applog::info(applog::Module::Ota, "up to date");
+      return;
+    }
+    // tickPrefetch() downloads it in slices and installs at the first safe moment (with ota.auto).
+    if (cfg.otaAuto) applog::info(applog::Module::Ota, "updating to %s", _availableVersion.c_str());
+    return;
+  }
+  if (_checking) return; // a check started through the API
+  if (_dl) return;       // the manifest is not re-read under a running download
+
+  if (!cfg.otaAuto && !cfg.otaPrefetch) return;
   if (!cfg.otaManifestUrl.length()) return;
   if (cfg.otaCheckHours == 0) return;
   if (!time.isTimeValid()) return;
   if (WiFi.status() != WL_CONNECTED) return;
 
-  const ScheduleStatus st = schedule.status();
-  if (!isSafeForAutoUpdate(st)) return;
+  const ScheduleStatus &st = schedule.status();
+  if (!isSafeForAutoUpdate(st) && !isPrefetchAllowed(cfg, st)) return;
 
   const uint32_t nowUtc = static_cast<uint32_t>(time.nowUtc());
   const uint32_t interval = static_cast<uint32_t>(cfg.otaCheckHours) * 60UL * 60UL;
@@ -409,47 +916,59 @@ void OtaUpdater::tick(const AppConfig &cfg, const TimeKeeper &time, const Schedu
   if (millis() - lastTryMs < kMinRetryMs) return;
   lastTryMs = millis();
 
-  Serial.println(F("[ota] auto check"));
-  const OtaCheckResult chk = checkNow(cfg);
-  if (!chk.ok) {
-    Serial.printf("[ota] check failed: %s\n", chk.message.c_str());
+  applog::info(applog::Module::Ota, "auto check");
+  OtaCheckResult chk;
+  if (!beginCheck(cfg, chk)) {
+    applog::warn(applog::Module::Ota, "check failed: %s", chk.message.c_str());
     return;
   }
-  if (!chk.available) {
-    Serial.println(F("[ota] up to date"));
-    return;
-  }
-
-  Serial.printf("[ota] updating to %s\n", _availableVersion.c_str());
-  updateNow(cfg);
+  _autoCheck = true;
 }
 
-String OtaUpdater::statusJson(const AppConfig &cfg, const TimeKeeper &time, const ScheduleEngine &schedule) const {
-  DynamicJsonDocument doc(1536);
-  doc["ok"] = true;
-  doc["currentVersion"] = SHABAT_RELAY_VERSION;
-
-  JsonObject c = doc.createNestedObject("config");
-  c["manifestUrl"] = cfg.otaManifestUrl;
-  c["auto"] = cfg.otaAuto;
-  c["checkHours"] = cfg.otaCheckHours;
-
-  const ScheduleStatus st = schedule.status();
-  doc["timeValid"] = time.isTimeValid();
-  doc["wifiConnected"] = (WiFi.status() == WL_CONNECTED);
-  doc["blockedByHolyTime"] = isBlockedByHolyTime(st);
-
-  JsonObject s = doc.createNestedObject("state");
-  s["lastCheckUtc"] = _lastCheckUtc;
-  s["lastAttemptUtc"] = _lastAttemptUtc;
-  s["available"] = hasUpdateAvailable();
-  s["availableVersion"] = _availableVersion;
-  s["notes"] = _availableNotes;
-  s["error"] = _lastError;
-
-  String out;
-  serializeJson(doc, out);
-  return out;
+void OtaUpdater::statusJson(JsonWriter &w,
+                            const AppConfig &cfg,
+                            const TimeKeeper &time,
+                            const ScheduleEngine &schedule) const {
+  w.beginObject();
+  w.field("ok", true);
+  w.field("currentVersion", SHABAT_RELAY_VERSION);
+
+  w.beginObject("config");
+  w.field("manifestUrl", cfg.otaManifestUrl);
+  w.field("auto", cfg.otaAuto);
+  w.field("checkHours", cfg.otaCheckHours);
+  w.field("prefetch", cfg.otaPrefetch);
+  w.field("prefetchHolyTime", cfg.otaPrefetchHolyTime);
+  w.endObject();
+
+  const ScheduleStatus &st = schedule.status();
+  w.field("timeValid", time.isTimeValid());
+  w.field("wifiConnected", WiFi.status() == WL_CONNECTED);
+  w.field("blockedByHolyTime", isBlockedByHolyTime(st));
+  w.field("prefetchAllowed", isPrefetchAllowed(cfg, st));
+
+  w.beginObject("state");
+  w.field("lastCheckUtc", _lastCheckUtc);
+  w.field("lastAttemptUtc", _lastAttemptUtc);
+  w.field("available", hasUpdateAvailable());
+  w.field("availableVersion", _availableVersion);
+  w.field("notes", _availableNotes);
+  w.field("error", _lastError);
+  w.endObject();
+
+  w.beginObject("download");
+  w.field("active", _dl != nullptr);
+  w.field("background", prefetching());
+  w.field("staged", hasStagedUpdate());
+  w.field("done", _dlDone);
+  w.field("size", _dlSize);
+  w.field("progress", downloadProgress());
+  w.field("resumedFrom", _dlResumedFrom);
+  w.field("drops", _dlDrops);
+  w.field("retries", _dlRetries);
+  w.field("verified", _dlVerified);
+  w.endObject();
+  w.endObject();
 }
 
 void OtaUpdater::loadState() {
@@ -478,7 +997,8 @@ void OtaUpdater::loadState() {
   _lastError = doc["error"] | "";
 }
 
-void OtaUpdater::saveState() const {
+void OtaUpdater::saveState() {
+  _version += 1;
   DynamicJsonDocument doc(1536);
   doc["lastCheckUtc"] = _lastCheckUtc;
   doc["lastAttemptUtc"] = _lastAttemptUtc;
@@ -500,4 +1020,5 @@ void OtaUpdater::clearAvailableState() {
   _availableNotes = "";
   _lastError = "";
   saveState();
+  loadCheckpointState();
 }
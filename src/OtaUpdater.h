@@ -3,9 +3,12 @@
 #include <Arduino.h>
 
 #include "AppConfig.h"
+#include "HeapMonitor.h"
 #include "ScheduleEngine.h"
 #include "TimeKeeper.h"
 
+struct OtaDownloadSession;
+
 struct OtaCheckResult {
   bool ok = false;
   bool available = false;
@@ -15,27 +18,71 @@ struct OtaCheckResult {
 
 class OtaUpdater {
 public:
-  void begin();
-  void tick(const AppConfig &cfg, const TimeKeeper &time, const ScheduleEngine &schedule);
+  void begin(HeapMonitor &heap);
+  // Periodic check, background download start/stop (prefetch, or the auto-update) and the deferred install.
+  // `idle` = no background job runs (they need the radio and heap); the background download only runs then.
+  void tick(const AppConfig &cfg, const TimeKeeper &time, const ScheduleEngine &schedule, bool idle);
+  // One slice of a background prefetch: download steps for a few ms, until the network has nothing more.
+  // Runs from its own low-priority task, enabled while prefetching() is true.
+  void prefetchSlice();
+  bool prefetching() const { return _dl != nullptr && _dlBackground; }
+
+  void statusJson(JsonWriter &w, const AppConfig &cfg, const TimeKeeper &time, const ScheduleEngine &schedule) const;
+  // Manifest check in steps (background jobs, the periodic check): beginCheck(), then stepCheck() until it
+  // returns true. A step is one HTTP request, i.e. one redirect hop, so the main loop runs between hops.
+  // Within 30 s of a relay change a step connects nowhere and returns false (see connectHeld()).
+  // beginCheck() returns false, with `out` filled, when no check can start (no network, no URL, or one
+  // is running already).
+  bool beginCheck(const AppConfig &cfg, OtaCheckResult &out);
+  bool stepCheck(OtaCheckResult &out);
+  bool checkActive() const { return _checking; }
+  // Drops a check nobody steps any more (its job timed out); tick() does it after a minute.
+  void cancelCheck();
 
-  String statusJson(const AppConfig &cfg, const TimeKeeper &time, const ScheduleEngine &schedule) const;
-  OtaCheckResult checkNow(const AppConfig &cfg);
-  bool updateNow(const AppConfig &cfg);
+  // Resumable download of the available update (OtaDownload.h) in steps: beginDownload(), then
+  // stepDownload() until it returns true. A step is one range request or one flash sector. `ok` = the image
+  // is in flash and verified; installDownloaded() then reboots into it. An interrupted download picks up at
+  // its checkpoint on the next beginDownload() for the same image, also after a reboot.
+  bool beginDownload(String &message);
+  bool stepDownload(bool &ok, String &message);
+  void cancelDownload();
+  bool downloadActive() const { return _dl != nullptr; }
+  // A relay change is near: check and download steps open no new connection until it is past.
+  bool connectHeld() const { return _connectHold; }
+  uint8_t downloadProgress() const;
+  // Hands the verified image to the boot loader and restarts; returns only when there is none.
+  bool installDownloaded();
+  // The available update is downloaded and verified in flash, waiting for installDownloaded().
+  bool hasStagedUpdate() const { return hasUpdateAvailable() && _dlVerified; }
 
   bool hasUpdateAvailable() const;
   String lastError() const;
   void clearAvailableState();
+  // Bumps whenever the persisted state (check/attempt times, available update, error) is saved, and when
+  // download progress moves by a percent.
+  uint32_t version() const { return _version; }
 
 private:
   static bool isSafeForAutoUpdate(const ScheduleStatus &st);
   static bool isBlockedByHolyTime(const ScheduleStatus &st);
+  static bool isPrefetchAllowed(const AppConfig &cfg, const ScheduleStatus &st);
+  static bool isBackgroundDownloadAllowed(const AppConfig &cfg, const ScheduleStatus &st);
 
   static bool isHttpsUrl(const String &url);
   static int compareVersions(const String &a, const String &b);
 
-  bool fetchManifest(const AppConfig &cfg, String &outVersion, String &outBinUrl, String &outMd5, String &outNotes);
+  enum class Hop : uint8_t { Redirect, Parsed, Failed };
+  // One request of the manifest fetch at _checkUrl: Redirect moves _checkUrl on, Parsed fills the outputs,
+  // Failed sets _lastError.
+  Hop fetchManifestHop(String &outVersion, String &outBinUrl, String &outMd5, String &outNotes);
+  OtaCheckResult finishCheck(bool fetched, const String &ver, const String &bin, const String &md5, const String &notes);
+  uint32_t downloadId() const;
+  void endDownload();
+  // Download fields of statusJson() from the saved checkpoint, when it belongs to the available update.
+  void loadCheckpointState();
+  void tickPrefetch(const AppConfig &cfg, const ScheduleStatus &st, bool idle);
   void loadState();
-  void saveState() const;
+  void saveState();
 
   String _availableVersion;
   String _availableBinUrl;
@@ -43,6 +90,34 @@ private:
   String _availableNotes;
   String _lastError;
 
+  HeapMonitor *_heap = nullptr;
+  uint8_t _heapManifest = HeapMonitor::kInvalidSource;
+  uint8_t _heapUpdate = HeapMonitor::kInvalidSource;
+
   uint32_t _lastCheckUtc = 0;
   uint32_t _lastAttemptUtc = 0;
+  uint32_t _version = 0;
+
+  bool _checking = false;
+  bool _autoCheck = false; // the running check was started by tick()
+  String _checkUrl;
+  uint8_t _checkHops = 0;
+  uint64_t _checkStartUs = 0;
+  uint32_t _checkStepMs = 0; // last beginCheck()/stepCheck()
+
+  // Allocated for the length of a download only: the sector buffer and HTTP client (~5 KB) stay off the heap
+  // the rest of the time.
+  OtaDownloadSession *_dl = nullptr;
+  uint64_t _dlStartUs = 0;
+  bool _dlSampled = false;
+  bool _dlBackground = false;     // started and stepped by the prefetch; a job that wants it takes it over
+  uint32_t _prefetchRetryAtMs = 0; // after a failed prefetch
+  bool _connectHold = false;       // a relay change is near: no new connections
+  // Last download, for statusJson().
+  uint32_t _dlDone = 0;
+  uint32_t _dlSize = 0;
+  uint32_t _dlResumedFrom = 0;
+  uint32_t _dlDrops = 0;
+  uint32_t _dlRetries = 0;
+  bool _dlVerified = false; // in flash and verified: staged for install
 };
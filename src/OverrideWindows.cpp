@@ -26,6 +26,20 @@ ActiveWindowOverride overridesFindActive(const AppConfig &cfg, uint32_t nowUtc)
   return best;
 }
 
+uint32_t overridesNextBoundary(const AppConfig &cfg, uint32_t nowUtc) {
+  uint32_t next = 0;
+  auto consider = [&](uint32_t t) {
+    if (t > nowUtc && (next == 0 || t < next)) next = t;
+  };
+  for (uint8_t i = 0; i < cfg.windowCount; i += 1) {
+    const ManualTimeWindow &w = cfg.windows[i];
+    if (!isValidWindow(w)) continue;
+    consider(w.startUtc);
+    consider(w.endUtc);
+  }
+  return next;
+}
+
 bool overridesApply(const AppConfig &cfg, uint32_t nowUtc, bool baseStateOn, bool &outStateOn, ActiveWindowOverride &outActive) {
   outActive = overridesFindActive(cfg, nowUtc);
   if (outActive.active) {
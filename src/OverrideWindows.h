@@ -14,6 +14,10 @@ struct ActiveWindowOverride {
 // Returns the active override (if any). If multiple match, picks the one with the latest startUtc.
 ActiveWindowOverride overridesFindActive(const AppConfig &cfg, uint32_t nowUtc);
 
+// Earliest window start or end after `nowUtc`, i.e. when overridesFindActive() may answer differently
+// (0 = never).
+uint32_t overridesNextBoundary(const AppConfig &cfg, uint32_t nowUtc);
+
 // Computes effective relay state given a base state.
 bool overridesApply(const AppConfig &cfg, uint32_t nowUtc, bool baseStateOn, bool &outStateOn, ActiveWindowOverride &outActive);
 
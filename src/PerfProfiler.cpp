@@ -0,0 +1,100 @@
+#include "PerfProfiler.h"
+
+void PerfProfiler::begin(ClockFn cycles, uint32_t cyclesPerUs, ClockFn micros, ClockFn millis) {
+  _cycles = cycles;
+  _cyclesPerUs = cyclesPerUs ? cyclesPerUs : 1;
+  _micros = micros;
+  _millis = millis;
+  reset();
+}
+
+uint8_t PerfProfiler::addSlot(const char *name, Kind kind) {
+  if (_count >= kMaxSlots) return kInvalidSlot;
+  Slot &s = _slots[_count];
+  s = {};
+  s.name = name ? name : "";
+  s.kind = kind;
+  const uint8_t id = _count;
+  _count += 1;
+  return id;
+}
+
+PerfProfiler::Mark PerfProfiler::start() const {
+  Mark m;
+  m.cycles = _cycles ? _cycles() : 0;
+  m.us = _micros ? _micros() : 0;
+  return m;
+}
+
+uint32_t PerfProfiler::end(uint8_t slot, const Mark &m) {
+  const uint32_t wallUs = _micros ? (_micros() - m.us) : 0;
+  uint32_t us = wallUs;
+  // Prefer cycle resolution while the counter cannot have wrapped.
+  if (_cycles && wallUs < kCycleSpanLimitUs) us = (_cycles() - m.cycles) / _cyclesPerUs;
+  record(slot, us, _millis ? _millis() : 0);
+  return us;
+}
+
+uint8_t PerfProfiler::bucketFor(uint32_t us) {
+  uint8_t b = 0;
+  uint32_t limit = 16;
+  while (b < kBuckets - 1 && us >= limit) {
+    b += 1;
+    limit <<= 2;
+  }
+  return b;
+}
+
+uint32_t PerfProfiler::bucketUpperUs(uint8_t bucket) {
+  if (bucket >= kBuckets - 1) return 0;
+  return 16UL << (2 * bucket);
+}
+
+void PerfProfiler::record(uint8_t slot, uint32_t us, uint32_t atMs) {
+  if (slot >= _count) return;
+  Slot &s = _slots[slot];
+  if (s.count == 0 || us < s.minUs) s.minUs = us;
+  if (us > s.maxUs) s.maxUs = us;
+  s.count += 1;
+  s.totalUs += us;
+  uint16_t &h = s.hist[bucketFor(us)];
+  if (h != 0xFFFF) h += 1;
+
+  // Insert into the worst-stalls list (kept sorted, longest first).
+  if (us <= _worst[kWorstStalls - 1].us) return;
+  uint8_t i = kWorstStalls - 1;
+  while (i > 0 && _worst[i - 1].us < us) {
+    _worst[i] = _worst[i - 1];
+    i -= 1;
+  }
+  _worst[i].slot = slot;
+  _worst[i].us = us;
+  _worst[i].atMs = atMs;
+}
+
+void PerfProfiler::reset() {
+  for (uint8_t i = 0; i < _count; i += 1) {
+    Slot &s = _slots[i];
+    s.count = 0;
+    s.minUs = 0;
+    s.maxUs = 0;
+    s.totalUs = 0;
+    for (uint8_t b = 0; b < kBuckets; b += 1) s.hist[b] = 0;
+  }
+  for (uint8_t i = 0; i < kWorstStalls; i += 1) _worst[i] = {};
+  _resetMs = _millis ? _millis() : 0;
+}
+
+uint8_t PerfProfiler::slotCount() const { return _count; }
+
+const PerfProfiler::Slot &PerfProfiler::slot(uint8_t id) const {
+  static const Slot kEmpty{};
+  return (id < _count) ? _slots[id] : kEmpty;
+}
+
+const PerfProfiler::Stall &PerfProfiler::stall(uint8_t i) const {
+  static const Stall kEmpty{};
+  return (i < kWorstStalls) ? _worst[i] : kEmpty;
+}
+
+uint32_t PerfProfiler::sinceResetMs() const { return _millis ? (_millis() - _resetMs) : 0; }
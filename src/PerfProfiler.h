@@ -0,0 +1,87 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Fixed-RAM latency profiler for loop passes, scheduler tasks and HTTP handlers.
+//
+// Durations come from the CPU cycle counter (exact, wraps after ~53 s at 80 MHz); spans longer
+// than kCycleSpanLimitUs fall back to the microsecond clock. Each slot keeps count/min/avg/max and
+// a base-4 log histogram; the worst stalls overall are kept with their source slot.
+// No Arduino dependencies: clocks are injected, so the host tools can drive it with virtual time.
+class PerfProfiler {
+public:
+  // loop + sdk, WebUi::kMaxRoutes routes + not-found, TaskScheduler::kMaxTasks tasks (checked in main.cpp).
+  static constexpr uint8_t kMaxSlots = 72;
+  static constexpr uint8_t kBuckets = 11; // <16us, <64us, <256us, <1ms, <4ms, <16ms, <65ms, <262ms, <1s, <4s, >=4s
+  static constexpr uint8_t kWorstStalls = 8;
+  static constexpr uint8_t kInvalidSlot = 0xFF;
+  static constexpr uint32_t kCycleSpanLimitUs = 20UL * 1000UL * 1000UL;
+
+  enum class Kind : uint8_t { Loop = 0, Task, HttpGet, HttpPost, Http };
+
+  using ClockFn = uint32_t (*)();
+
+  struct Slot {
+    const char *name = "";
+    Kind kind = Kind::Loop;
+    uint32_t count = 0;
+    uint32_t minUs = 0;
+    uint32_t maxUs = 0;
+    uint64_t totalUs = 0;
+    uint16_t hist[kBuckets] = {};
+  };
+
+  struct Stall {
+    uint8_t slot = kInvalidSlot;
+    uint32_t us = 0;
+    uint32_t atMs = 0; // uptime when the span ended
+  };
+
+  // A started measurement; pass it back to end().
+  struct Mark {
+    uint32_t cycles = 0;
+    uint32_t us = 0;
+  };
+
+  void begin(ClockFn cycles, uint32_t cyclesPerUs, ClockFn micros, ClockFn millis);
+  // `name` must outlive the profiler (string literal / static storage).
+  uint8_t addSlot(const char *name, Kind kind);
+
+  Mark start() const;
+  uint32_t end(uint8_t slot, const Mark &m);
+  void record(uint8_t slot, uint32_t us, uint32_t atMs);
+  void reset();
+
+  uint8_t slotCount() const;
+  const Slot &slot(uint8_t id) const;
+  // Sorted, longest first; entries with slot == kInvalidSlot are unused.
+  const Stall &stall(uint8_t i) const;
+  uint32_t sinceResetMs() const;
+  static uint32_t bucketUpperUs(uint8_t bucket); // 0 for the open-ended last bucket
+
+  // RAII helper for instrumenting a block.
+  class Scope {
+  public:
+    Scope(PerfProfiler &p, uint8_t slot) : _p(p), _slot(slot), _mark(p.start()) {}
+    ~Scope() { _p.end(_slot, _mark); }
+
+  private:
+    PerfProfiler &_p;
+    uint8_t _slot;
+    Mark _mark;
+  };
+
+private:
+  static uint8_t bucketFor(uint32_t us);
+
+  ClockFn _cycles = nullptr;
+  ClockFn _micros = nullptr;
+  ClockFn _millis = nullptr;
+  uint32_t _cyclesPerUs = 80;
+  uint32_t _resetMs = 0;
+
+  Slot _slots[kMaxSlots];
+  uint8_t _count = 0;
+  Stall _worst[kWorstStalls];
+};
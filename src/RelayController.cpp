@@ -26,6 +26,7 @@ void RelayController::writePin(bool on) {
 void RelayController::setOn(bool on) {
   if (_isOn == on) return;
   _isOn = on;
+  _version += 1;
   writePin(on);
 }
 
@@ -11,10 +11,13 @@ public:
 
   void setOn(bool on);
   bool isOn() const;
+  // Bumps on every state change.
+  uint32_t version() const { return _version; }
 
 private:
   int _gpio = -1;
   bool _activeLow = true;
   bool _isOn = false;
+  uint32_t _version = 0;
   void writePin(bool on);
 };
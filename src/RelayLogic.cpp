@@ -0,0 +1,60 @@
+#include "RelayLogic.h"
+
+#include "RelayState.h"
+
+relaylogic::Decision relaylogic::decide(const AppConfig &cfg,
+                                        bool scheduleHoly,
+                                        bool timeValid,
+                                        uint32_t nowUtc,
+                                        bool relayOn) {
+  Decision d{};
+
+  // "Holy mode" target (Shabbat/Hag) - independent from relay wiring.
+  d.desiredHoly = scheduleHoly;
+  if (cfg.runMode == 1) d.desiredHoly = false;     // force Chol
+  else if (cfg.runMode == 2) d.desiredHoly = true; // force Shabbat/Hag
+
+  // Map desired mode to the physical relay (NC/NO contact mapping).
+  bool baseDesired = cfg.relayHolyOnNo ? d.desiredHoly : !d.desiredHoly;
+
+  // If the clock isn't set yet, keep the last known relay state (product behavior after power loss).
+  if (!timeValid && cfg.runMode == 0) {
+    if (!bootState(cfg, timeValid, baseDesired)) baseDesired = relayOn;
+  }
+
+  d.desiredRelay = baseDesired;
+  d.overrideApplied = overridesApply(cfg, nowUtc, baseDesired, d.desiredRelay, d.override);
+  return d;
+}
+
+bool relaylogic::bootState(const AppConfig &cfg, bool timeValid, bool &outOn) {
+  if (timeValid || cfg.runMode != 0) return false;
+  if (cfg.relayBootMode != 1 && cfg.relayBootMode != 2) return false;
+  const bool holy = (cfg.relayBootMode == 2);
+  outOn = cfg.relayHolyOnNo ? holy : !holy;
+  return true;
+}
+
+const char *relaylogic::transitionMessage(const AppConfig &cfg, const Decision &d) {
+  if (d.overrideApplied && d.override.active) {
+    return d.desiredRelay ? "חלון ידני: הריליי הופעל" : "חלון ידני: הריליי כובה";
+  }
+  if (cfg.runMode == 1) return "מצב חול";
+  if (cfg.runMode == 2) return "מצב שבת/חג";
+  return d.desiredHoly ? "כניסה לשבת/חג" : "יציאה משבת/חג";
+}
+
+relaylogic::Pass relaylogic::run(const AppConfig &cfg,
+                                 ScheduleEngine &schedule,
+                                 const TimeKeeper &time,
+                                 RelayController &relay) {
+  schedule.tick(cfg, time);
+
+  Pass pass{};
+  const uint32_t nowUtc = static_cast<uint32_t>(time.nowUtc());
+  pass.decision = decide(cfg, schedule.desiredRelayOn(), time.isTimeValid(), nowUtc, relay.isOn());
+  pass.changed = (pass.decision.desiredRelay != relay.isOn());
+  relay.setOn(pass.decision.desiredRelay);
+  if (pass.changed) relaystate::save(pass.decision.desiredRelay);
+  return pass;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "AppConfig.h"
+#include "OverrideWindows.h"
+#include "RelayController.h"
+#include "ScheduleEngine.h"
+#include "TimeKeeper.h"
+
+// The relay control pass. Shared by the firmware's "relay" task and the host loop simulator
+// (tools/loop_sim.sh), so both run exactly the same decisions.
+namespace relaylogic {
+
+struct Decision {
+  bool desiredHoly = false;  // Shabbat/Hag mode after runMode
+  bool desiredRelay = false; // physical relay after contact mapping, boot mode and override windows
+  bool overrideApplied = false;
+  ActiveWindowOverride override;
+};
+
+// `relayOn` is the current physical state; it is kept while the clock is invalid (relayBootMode 0).
+Decision decide(const AppConfig &cfg, bool scheduleHoly, bool timeValid, uint32_t nowUtc, bool relayOn);
+
+// Physical state to force at boot while the clock is not valid yet (Auto mode, relayBootMode 1/2).
+// Returns false when the restored state should be kept.
+bool bootState(const AppConfig &cfg, bool timeValid, bool &outOn);
+
+// History message for a transition caused by `d`.
+const char *transitionMessage(const AppConfig &cfg, const Decision &d);
+
+struct Pass {
+  bool changed = false;
+  Decision decision;
+};
+
+// One control pass: ticks the schedule, decides, drives the relay and persists the new state on change.
+Pass run(const AppConfig &cfg, ScheduleEngine &schedule, const TimeKeeper &time, RelayController &relay);
+
+} // namespace relaylogic
@@ -2,34 +2,257 @@
 
 #include <LittleFS.h>
 
+#include "JsonWriter.h"
+#include "RtcLayout.h"
+#include "SpanTrace.h"
+
 namespace {
-constexpr const char *kRelayStatePath = "/relay_state.txt";
-} // namespace
+constexpr const char *kLegacyStatePath = "/relay_state.txt";
+constexpr const char *kJournalPath = "/relay_state.jnl";
+constexpr const char *kJournalTmpPath = "/relay_state.jnl.tmp";
 
-bool relaystate::load(bool &outRelayOn) {
-  outRelayOn = false;
-  if (!LittleFS.exists(kRelayStatePath)) return false;
-  File file = LittleFS.open(kRelayStatePath, "r");
+constexpr uint32_t kRtcOffsetWords = rtcmem::kRelayState;
+constexpr uint32_t kRtcMagic = 0x5348524C; // 'SHRL'
+constexpr uint8_t kRecordMagic = 0xA5;
+
+struct RtcRecord {
+  uint32_t magic = 0;
+  uint32_t lifetimeWrites = 0;
+  uint16_t journalRecords = 0;
+  uint8_t on = 0;
+  uint8_t flags = 0; // bit0: journaled value, bit1: journaled value is known
+  uint32_t crc = 0;
+};
+static_assert(sizeof(RtcRecord) == 16, "RTC record must stay 4 words");
+static_assert(sizeof(RtcRecord) <= rtcmem::kRelayStateWords * 4, "relay record outgrew its RTC words");
+
+struct JournalRecord {
+  uint32_t seq = 0; // lifetime write number of this record
+  uint8_t on = 0;
+  uint8_t magic = 0;
+  uint16_t check = 0; // low half of CRC32 over the first 6 bytes
+};
+static_assert(sizeof(JournalRecord) == 8, "journal record must stay 8 bytes");
+
+constexpr uint8_t kFlagJournaledOn = 1 << 0;
+constexpr uint8_t kFlagJournalKnown = 1 << 1;
+
+relaystate::Stats counters;
+RtcRecord cache;
+
+uint32_t crc32(const uint8_t *data, size_t len) {
+  uint32_t crc = 0xFFFFFFFFUL;
+  for (size_t i = 0; i < len; i += 1) {
+    crc ^= data[i];
+    for (uint8_t b = 0; b < 8; b += 1) crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1UL)));
+  }
+  return ~crc;
+}
+
+uint32_t rtcCrc(const RtcRecord &r) { return crc32(reinterpret_cast<const uint8_t *>(&r), offsetof(RtcRecord, crc)); }
+
+uint16_t recordCheck(const JournalRecord &r) {
+  return static_cast<uint16_t>(crc32(reinterpret_cast<const uint8_t *>(&r), offsetof(JournalRecord, check)));
+}
+
+bool readRtc(RtcRecord &out) {
+  RtcRecord tmp{};
+  if (!ESP.rtcUserMemoryRead(kRtcOffsetWords, reinterpret_cast<uint32_t *>(&tmp), sizeof(tmp))) return false;
+  if (tmp.magic != kRtcMagic || tmp.crc != rtcCrc(tmp)) return false;
+  out = tmp;
+  return true;
+}
+
+void writeRtc() {
+  cache.magic = kRtcMagic;
+  cache.crc = rtcCrc(cache);
+  RtcRecord tmp = cache;
+  if (ESP.rtcUserMemoryWrite(kRtcOffsetWords, reinterpret_cast<uint32_t *>(&tmp), sizeof(tmp))) {
+    counters.rtcWrites += 1;
+  }
+}
+
+// Scans the journal and returns the last intact record. A torn tail (power cut mid-append) is ignored.
+bool readJournal(JournalRecord &last, uint16_t &records) {
+  records = 0;
+  File f = LittleFS.open(kJournalPath, "r");
+  if (!f) return false;
+  bool found = false;
+  JournalRecord r{};
+  while (f.read(reinterpret_cast<uint8_t *>(&r), sizeof(r)) == sizeof(r)) {
+    records += 1;
+    if (r.magic == kRecordMagic && r.check == recordCheck(r)) {
+      last = r;
+      found = true;
+    }
+  }
+  f.close();
+  return found;
+}
+
+bool readLegacy(bool &outOn) {
+  if (!LittleFS.exists(kLegacyStatePath)) return false;
+  File file = LittleFS.open(kLegacyStatePath, "r");
   if (!file) return false;
   const int c = file.read();
   file.close();
+  if (c != '0' && c != '1') return false;
+  outOn = (c == '1');
+  return true;
+}
 
-  if (c == '1') {
-    outRelayOn = true;
-    return true;
+// Writes a fresh journal holding only `rec`. The rename replaces the old journal in one LittleFS commit,
+// so a power cut leaves either the old or the new one.
+bool rotateJournal(const JournalRecord &rec) {
+  spantrace::Span span(spantrace::Lane::Fs, "relay.rotate");
+  File out = LittleFS.open(kJournalTmpPath, "w");
+  if (!out) return false;
+  const size_t written = out.write(reinterpret_cast<const uint8_t *>(&rec), sizeof(rec));
+  out.close();
+  if (written != sizeof(rec)) {
+    LittleFS.remove(kJournalTmpPath);
+    return false;
+  }
+  if (!LittleFS.rename(kJournalTmpPath, kJournalPath)) {
+    LittleFS.remove(kJournalTmpPath);
+    return false;
+  }
+  counters.journalRotations += 1;
+  cache.journalRecords = 1;
+  return true;
+}
+
+bool appendJournal(bool on) {
+  JournalRecord rec{};
+  rec.seq = cache.lifetimeWrites + 1;
+  rec.on = on ? 1 : 0;
+  rec.magic = kRecordMagic;
+  rec.check = recordCheck(rec);
+
+  bool ok = false;
+  if (cache.journalRecords < relaystate::kJournalMaxRecords) {
+    spantrace::Span span(spantrace::Lane::Fs, "relay.append");
+    File f = LittleFS.open(kJournalPath, "a");
+    if (f) {
+      const size_t size = f.size();
+      // A torn tail would misalign every later record: start over instead of appending behind it.
+      if (size % sizeof(JournalRecord) == 0 && size / sizeof(JournalRecord) < relaystate::kJournalMaxRecords) {
+        ok = f.write(reinterpret_cast<const uint8_t *>(&rec), sizeof(rec)) == sizeof(rec);
+        if (ok) cache.journalRecords = static_cast<uint16_t>(size / sizeof(JournalRecord) + 1);
+      }
+      f.close();
+    }
+  }
+  if (!ok) ok = rotateJournal(rec);
+  if (!ok) {
+    counters.failedWrites += 1;
+    return false;
   }
-  if (c == '0') {
-    outRelayOn = false;
+
+  cache.lifetimeWrites = rec.seq;
+  cache.flags = static_cast<uint8_t>(kFlagJournalKnown | (on ? kFlagJournaledOn : 0));
+  counters.journalAppends += 1;
+  return true;
+}
+
+void syncCounters() {
+  counters.lifetimeWrites = cache.lifetimeWrites;
+  counters.journalRecords = cache.journalRecords;
+}
+} // namespace
+
+bool relaystate::load(bool &outRelayOn) {
+  outRelayOn = false;
+  counters = {};
+
+  if (readRtc(cache)) {
+    outRelayOn = cache.on != 0;
+    // The file system may have been reformatted behind our back (mount failure at boot).
+    if (!LittleFS.exists(kJournalPath)) {
+      cache.flags = 0;
+      cache.journalRecords = 0;
+    }
+    counters.loadedFrom = Source::Rtc;
+    syncCounters();
     return true;
   }
-  return false;
+
+  cache = {};
+  JournalRecord last{};
+  uint16_t records = 0;
+  bool loaded = false;
+  if (readJournal(last, records)) {
+    outRelayOn = last.on != 0;
+    cache.lifetimeWrites = last.seq;
+    cache.journalRecords = records;
+    cache.flags = static_cast<uint8_t>(kFlagJournalKnown | (outRelayOn ? kFlagJournaledOn : 0));
+    counters.loadedFrom = Source::Journal;
+    loaded = true;
+  } else {
+    cache.journalRecords = records;
+    if (readLegacy(outRelayOn)) {
+      counters.loadedFrom = Source::Legacy;
+      loaded = true;
+      if (appendJournal(outRelayOn)) LittleFS.remove(kLegacyStatePath);
+    }
+  }
+
+  cache.on = outRelayOn ? 1 : 0;
+  writeRtc();
+  syncCounters();
+  return loaded;
 }
 
 bool relaystate::save(bool relayOn) {
-  File file = LittleFS.open(kRelayStatePath, "w");
-  if (!file) return false;
-  const size_t written = file.print(relayOn ? "1\n" : "0\n");
-  file.close();
-  return written > 0;
+  cache.on = relayOn ? 1 : 0;
+  const bool known = (cache.flags & kFlagJournalKnown) != 0;
+  const bool journaledOn = (cache.flags & kFlagJournaledOn) != 0;
+
+  bool ok = true;
+  if (known && journaledOn == relayOn) {
+    counters.skippedWrites += 1;
+  } else {
+    ok = appendJournal(relayOn);
+  }
+  writeRtc();
+  syncCounters();
+  return ok;
 }
 
+void relaystate::forget() {
+  RtcRecord blank{};
+  ESP.rtcUserMemoryWrite(kRtcOffsetWords, reinterpret_cast<uint32_t *>(&blank), sizeof(blank));
+  cache = {};
+  syncCounters();
+}
+
+const relaystate::Stats &relaystate::stats() { return counters; }
+
+const char *relaystate::sourceToString(Source source) {
+  switch (source) {
+  case Source::Rtc:
+    return "rtc";
+  case Source::Journal:
+    return "journal";
+  case Source::Legacy:
+    return "legacy";
+  default:
+    return "none";
+  }
+}
+
+void relaystate::statsJson(JsonWriter &w) {
+  w.beginObject();
+  w.field("loadedFrom", sourceToString(counters.loadedFrom));
+  w.field("on", cache.on != 0);
+  w.field("lifetimeWrites", counters.lifetimeWrites);
+  w.field("journalRecords", counters.journalRecords);
+  w.field("journalMaxRecords", kJournalMaxRecords);
+  w.field("journalBytes", static_cast<uint32_t>(counters.journalRecords) * sizeof(JournalRecord));
+  w.field("rtcWrites", counters.rtcWrites);
+  w.field("journalAppends", counters.journalAppends);
+  w.field("journalRotations", counters.journalRotations);
+  w.field("skippedWrites", counters.skippedWrites);
+  w.field("failedWrites", counters.failedWrites);
+  w.endObject();
+}
@@ -1,11 +1,41 @@
 #pragma once
 
+#include <Arduino.h>
+
+class JsonWriter;
+
+// Relay state persistence, tuned for flash wear:
+// - Hot copy in RTC user memory (CRC-protected): a warm reset restores without touching LittleFS.
+// - Cold copy in an append-only journal of 8-byte records. Only actual state changes are appended;
+//   the file is rewritten (one record) only when it reaches kJournalMaxRecords.
 namespace relaystate {
-// Loads the last persisted relay state from LittleFS.
+constexpr uint16_t kJournalMaxRecords = 128;
+
+enum class Source : uint8_t { None = 0, Rtc, Journal, Legacy };
+
+struct Stats {
+  Source loadedFrom = Source::None;
+  uint32_t lifetimeWrites = 0; // journal appends since the journal was created (survives reboots)
+  uint16_t journalRecords = 0;  // records in the current journal file
+  // This boot only:
+  uint32_t rtcWrites = 0;
+  uint32_t journalAppends = 0;
+  uint32_t journalRotations = 0;
+  uint32_t skippedWrites = 0; // save() calls that matched the journaled state
+  uint32_t failedWrites = 0;
+};
+
+// Loads the last persisted relay state (RTC first, then the journal, then the legacy text file).
 // Returns true if a valid value was loaded.
 bool load(bool &outRelayOn);
 
-// Persists relay state to LittleFS. Returns true on success.
+// Persists relay state. Returns true on success (including when flash already holds this value).
 bool save(bool relayOn);
-} // namespace relaystate
 
+// Drops the RTC copy (factory reset); the journal goes away with the file system.
+void forget();
+
+const Stats &stats();
+const char *sourceToString(Source source);
+void statsJson(JsonWriter &w);
+} // namespace relaystate
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+// Who owns which word of the 128-word RTC user memory (ESP.rtcUserMemoryRead/Write offsets). Every
+// record here carries its own magic + CRC, so a region that was overwritten just reads as empty.
+//
+//   0..31    eboot command: an OTA install writes it over these words right before the restart, so
+//            nothing that has to survive an install may live here
+//   0..1     reset-sequence counter (main.cpp); losing it to an install only restarts the count
+//   32..64   OTA download checkpoint (OtaUpdater.cpp)
+//   65..80   fast-connect record: BSSID, channel, DHCP lease (FastConnect.cpp)
+//   81..84   relay state (RelayState.cpp)
+//   85..127  free
+namespace rtcmem {
+constexpr uint32_t kWords = 128;
+constexpr uint32_t kEbootWords = 32;
+
+constexpr uint32_t kResetSeq = 0;
+constexpr uint32_t kOtaCheckpoint = 32;
+constexpr uint32_t kOtaCheckpointWords = 33;
+constexpr uint32_t kFastConnect = 65;
+constexpr uint32_t kFastConnectWords = 16;
+constexpr uint32_t kRelayState = 81;
+constexpr uint32_t kRelayStateWords = 4;
+
+static_assert(kOtaCheckpoint >= kEbootWords, "the OTA checkpoint must survive the eboot command");
+static_assert(kFastConnect >= kOtaCheckpoint + kOtaCheckpointWords, "RTC regions overlap");
+static_assert(kRelayState >= kFastConnect + kFastConnectWords, "RTC regions overlap");
+static_assert(kRelayState + kRelayStateWords <= kWords, "RTC user memory is 128 words");
+} // namespace rtcmem
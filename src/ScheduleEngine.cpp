@@ -1,17 +1,25 @@
 #include "ScheduleEngine.h"
 
-#include <ArduinoJson.h>
+#include <pgmspace.h>
 #include <time.h>
 
 #include "DateMath.h"
+#include "JsonWriter.h"
+#include "SpanTrace.h"
 
 namespace {
 constexpr uint32_t kRebuildThrottleMs = 30UL * 1000UL;
 constexpr uint32_t kPeriodicRebuildMs = 6UL * 60UL * 60UL * 1000UL;
 constexpr int kLookaheadDays = 70;
 
-uint32_t fnv1a32(const uint8_t *data, size_t len) {
-  uint32_t hash = 2166136261UL;
+const char kCodeClockNotSet[] PROGMEM = "CLOCK_NOT_SET";
+const char kCodeMissingZmanim[] PROGMEM = "MISSING_ZMANIM";
+const char kCodeNone[] PROGMEM = "";
+const char kMsgClockNotSet[] PROGMEM = "clock not set";
+const char kMsgMissingZmanim[] PROGMEM = "missing zmanim data";
+const char kMsgZmanimGap[] PROGMEM = "missing zmanim around %04lu-%02lu-%02lu";
+
+uint32_t fnv1a32(const uint8_t *data, size_t len, uint32_t hash = 2166136261UL) {
   for (size_t i = 0; i < len; i += 1) {
     hash ^= data[i];
     hash *= 16777619UL;
@@ -48,6 +56,42 @@ int dstShiftMinutesForDateKey(const AppConfig &cfg, uint32_t dateKey) {
 }
 } // namespace
 
+const __FlashStringHelper *scheduleErrorCode(ScheduleError err) {
+  switch (err) {
+  case ScheduleError::ClockNotSet:
+    return reinterpret_cast<const __FlashStringHelper *>(kCodeClockNotSet);
+  case ScheduleError::MissingZmanim:
+    return reinterpret_cast<const __FlashStringHelper *>(kCodeMissingZmanim);
+  default:
+    return reinterpret_cast<const __FlashStringHelper *>(kCodeNone);
+  }
+}
+
+size_t formatScheduleError(const ScheduleStatus &st, char *buf, size_t len) {
+  if (!buf || !len) return 0;
+  buf[0] = '\0';
+  switch (st.error) {
+  case ScheduleError::ClockNotSet:
+    strncpy_P(buf, kMsgClockNotSet, len - 1);
+    break;
+  case ScheduleError::MissingZmanim:
+    strncpy_P(buf, kMsgMissingZmanim, len - 1);
+    break;
+  case ScheduleError::ZmanimGap:
+    snprintf_P(buf,
+               len,
+               kMsgZmanimGap,
+               static_cast<unsigned long>(st.errorDateKey / 10000UL),
+               static_cast<unsigned long>((st.errorDateKey / 100UL) % 100UL),
+               static_cast<unsigned long>(st.errorDateKey % 100UL));
+    break;
+  default:
+    break;
+  }
+  buf[len - 1] = '\0';
+  return strlen(buf);
+}
+
 void ScheduleEngine::begin(ZmanimDb &zmanim, HolidayDb &holidays, ParashaDb &parasha) {
   _zmanim = &zmanim;
   _holidays = &holidays;
@@ -56,13 +100,21 @@ void ScheduleEngine::begin(ZmanimDb &zmanim, HolidayDb &holidays, ParashaDb &par
   _index = 0;
   _builtForDateKey = 0;
   _lastConfigSig = 0;
-  _lastBuildMs = 0;
+  // Let the first build happen as soon as the clock is valid; the throttle only spaces out rebuilds.
+  _lastBuildMs = millis() - kRebuildThrottleMs;
   _desiredOn = false;
   _status = {};
-  _lastError = "";
+  _buildIssue = ScheduleError::None;
+  _buildIssueDateKey = 0;
+  _windowsSig = 0;
+  _publishedWindowsSig = 0;
 }
 
-void ScheduleEngine::invalidate() { _windowCount = 0; }
+void ScheduleEngine::invalidate() {
+  _windowCount = 0;
+  // Titles come from the data files too, so the next rebuild is published even if the windows match.
+  _publishedWindowsSig = 0;
+}
 
 uint32_t ScheduleEngine::configSig(const AppConfig &cfg) const {
   struct {
@@ -96,30 +148,34 @@ uint32_t ScheduleEngine::dateKeyFromLocalEpoch(time_t localEpoch) const {
 }
 
 void ScheduleEngine::tick(const AppConfig &cfg, const TimeKeeper &time) {
-  _status = {};
-  _status.hasZmanim = _zmanim && _zmanim->hasData();
-  _status.hasHolidays = _holidays && _holidays->hasData();
-  _status.errorCode = "";
-  _status.error = _lastError;
+  ScheduleStatus next{};
+  next.hasZmanim = _zmanim && _zmanim->hasData();
+  next.hasHolidays = _holidays && _holidays->hasData();
+  next.error = _buildIssue;
+  next.errorDateKey = _buildIssueDateKey;
 
   if (!time.isTimeValid()) {
     _desiredOn = false;
-    _status.ok = false;
-    _status.errorCode = "CLOCK_NOT_SET";
-    _status.error = "clock not set";
+    next.ok = false;
+    next.errorCode = ScheduleError::ClockNotSet;
+    next.error = ScheduleError::ClockNotSet;
+    next.errorDateKey = 0;
+    publish(next);
     return;
   }
 
-  if (!_status.hasZmanim) {
+  if (!next.hasZmanim) {
     _desiredOn = false;
-    _status.ok = false;
-    _status.errorCode = "MISSING_ZMANIM";
-    _status.error = "missing zmanim data";
+    next.ok = false;
+    next.errorCode = ScheduleError::MissingZmanim;
+    next.error = ScheduleError::MissingZmanim;
+    next.errorDateKey = 0;
+    publish(next);
     return;
   }
 
   const time_t nowLocalEpoch = time.nowLocal(cfg);
-  _status.nowLocal = static_cast<int64_t>(nowLocalEpoch);
+  next.nowLocal = static_cast<int64_t>(nowLocalEpoch);
 
   const uint32_t todayKey = dateKeyFromLocalEpoch(nowLocalEpoch);
   const uint32_t sig = configSig(cfg);
@@ -129,6 +185,8 @@ void ScheduleEngine::tick(const AppConfig &cfg, const TimeKeeper &time) {
 
   if (shouldRebuild && (millis() - _lastBuildMs) >= kRebuildThrottleMs) {
     rebuild(cfg, nowLocalEpoch);
+    next.error = _buildIssue;
+    next.errorDateKey = _buildIssueDateKey;
   }
 
   // Advance index
@@ -140,31 +198,49 @@ void ScheduleEngine::tick(const AppConfig &cfg, const TimeKeeper &time) {
                          nowLocalEpoch < _windows[_index].endLocal);
 
   _desiredOn = inWindow;
-  _status.ok = true;
-  _status.inHolyTime = inWindow;
+  next.ok = true;
+  next.inHolyTime = inWindow;
 
   if (_index < _windowCount) {
     if (inWindow) {
-      _status.nextChangeLocal = _windows[_index].endLocal;
-      _status.nextStateOn = false;
+      next.nextChangeLocal = _windows[_index].endLocal;
+      next.nextStateOn = false;
     } else {
-      _status.nextChangeLocal = _windows[_index].startLocal;
-      _status.nextStateOn = true;
+      next.nextChangeLocal = _windows[_index].startLocal;
+      next.nextStateOn = true;
     }
   } else {
-    _status.nextChangeLocal = 0;
-    _status.nextStateOn = false;
+    next.nextChangeLocal = 0;
+    next.nextStateOn = false;
   }
+  publish(next);
+}
+
+// Copies `next` into the snapshot; the version only moves when something a reader cares about changed.
+void ScheduleEngine::publish(const ScheduleStatus &next) {
+  _status.nowLocal = next.nowLocal;
+  const bool changed = next.ok != _status.ok || next.inHolyTime != _status.inHolyTime ||
+                       next.hasZmanim != _status.hasZmanim || next.hasHolidays != _status.hasHolidays ||
+                       next.errorCode != _status.errorCode || next.error != _status.error ||
+                       next.errorDateKey != _status.errorDateKey || next.nextChangeLocal != _status.nextChangeLocal ||
+                       next.nextStateOn != _status.nextStateOn || _windowsSig != _publishedWindowsSig;
+  if (!changed) return;
+  const uint32_t version = _status.version + 1;
+  _status = next;
+  _status.version = version;
+  _publishedWindowsSig = _windowsSig;
 }
 
 void ScheduleEngine::rebuild(const AppConfig &cfg, time_t nowLocalEpoch) {
+  spantrace::Span span(spantrace::Lane::Schedule, "rebuild");
   _windowCount = 0;
   _index = 0;
   _lastBuildMs = millis();
   _builtForDateKey = dateKeyFromLocalEpoch(nowLocalEpoch);
   _lastConfigSig = configSig(cfg);
 
-  String firstError = "";
+  ScheduleError firstIssue = ScheduleError::None;
+  uint32_t firstIssueDateKey = 0;
 
   const uint32_t startKey = datemath::addDays(_builtForDateKey, -3);
   const uint32_t endKey = datemath::addDays(_builtForDateKey, kLookaheadDays);
@@ -184,8 +260,9 @@ void ScheduleEngine::rebuild(const AppConfig &cfg, time_t nowLocalEpoch) {
       uint16_t dummy = 0;
 
       if (!_zmanim->getForDate(prevKey, candlesPrev, dummy) || !_zmanim->getForDate(dateKey, dummy, havdalah)) {
-        if (!firstError.length()) {
-          firstError = "missing zmanim around " + ZmanimDb::formatDateKey(dateKey);
+        if (firstIssue == ScheduleError::None) {
+          firstIssue = ScheduleError::ZmanimGap;
+          firstIssueDateKey = dateKey;
         }
       } else {
         // Zmanim are stored in standard time (UTC+2). Apply DST shift per date when enabled.
@@ -230,7 +307,18 @@ void ScheduleEngine::rebuild(const AppConfig &cfg, time_t nowLocalEpoch) {
 
   mergeWindows();
 
-  _lastError = firstError;
+  uint32_t sig = fnv1a32(&_windowCount, sizeof(_windowCount));
+  for (uint8_t i = 0; i < _windowCount; i += 1) {
+    const Window &w = _windows[i];
+    sig = fnv1a32(reinterpret_cast<const uint8_t *>(&w.startLocal), sizeof(w.startLocal), sig);
+    sig = fnv1a32(reinterpret_cast<const uint8_t *>(&w.endLocal), sizeof(w.endLocal), sig);
+    sig = fnv1a32(&w.kind, sizeof(w.kind), sig);
+  }
+  _windowsSig = sig;
+
+  _buildIssue = firstIssue;
+  _buildIssueDateKey = firstIssueDateKey;
+  span.setArg(_windowCount);
 }
 
 void ScheduleEngine::mergeWindows() {
@@ -264,20 +352,18 @@ void ScheduleEngine::mergeWindows() {
 
 bool ScheduleEngine::desiredRelayOn() const { return _desiredOn; }
 
-ScheduleStatus ScheduleEngine::status() const { return _status; }
+const ScheduleStatus &ScheduleEngine::status() const { return _status; }
 
-String ScheduleEngine::upcomingJson(uint16_t limit) const {
-  DynamicJsonDocument doc(4096);
-  JsonArray arr = doc.to<JsonArray>();
+void ScheduleEngine::upcomingJson(JsonWriter &w, uint16_t limit) const {
+  w.beginArray();
 
   uint16_t added = 0;
   for (uint8_t i = _index; i < _windowCount && added < limit; i += 1) {
-    JsonObject o = arr.createNestedObject();
-    o["startLocal"] = _windows[i].startLocal;
-    o["endLocal"] = _windows[i].endLocal;
-    o["kind"] = _windows[i].kind;
-    const String label = (_windows[i].kind == 1) ? "שבת" : (_windows[i].kind == 2) ? "חג" : "שבת/חג";
-    o["label"] = label;
+    w.beginObject();
+    w.field("startLocal", _windows[i].startLocal);
+    w.field("endLocal", _windows[i].endLocal);
+    w.field("kind", _windows[i].kind);
+    w.field("label", (_windows[i].kind == 1) ? "שבת" : (_windows[i].kind == 2) ? "חג" : "שבת/חג");
 
     // Add a friendly title (holiday name / parasha) for peace of mind.
     String title = "";
@@ -311,12 +397,10 @@ String ScheduleEngine::upcomingJson(uint16_t limit) const {
     }
 
     if (title.length()) {
-      o["title"] = title;
+      w.field("title", title);
     }
+    w.endObject();
     added += 1;
   }
-
-  String out;
-  serializeJson(doc, out);
-  return out;
+  w.endArray();
 }
@@ -8,19 +8,37 @@
 #include "TimeKeeper.h"
 #include "ZmanimDb.h"
 
+// Status/error ids. The code strings and messages live in flash (scheduleErrorCode / formatScheduleError),
+// so building and copying a ScheduleStatus never touches the heap.
+enum class ScheduleError : uint8_t {
+  None = 0,
+  ClockNotSet,   // CLOCK_NOT_SET
+  MissingZmanim, // MISSING_ZMANIM
+  ZmanimGap,     // build warning: no zmanim for a Shabbat/holiday around `errorDateKey`
+};
+
 struct ScheduleStatus {
   bool ok = false;
   bool inHolyTime = false;
   bool hasZmanim = false;
   bool hasHolidays = false;
-  String errorCode; // stable codes for UI (e.g., CLOCK_NOT_SET, MISSING_ZMANIM)
-  String error;
+  ScheduleError errorCode = ScheduleError::None; // fatal only: the schedule cannot be evaluated
+  ScheduleError error = ScheduleError::None;     // fatal error, or the last rebuild warning
+  uint32_t errorDateKey = 0;
 
   int64_t nowLocal = 0;
   int64_t nextChangeLocal = 0; // local epoch seconds
   bool nextStateOn = false;
+
+  // Bumps whenever anything except `nowLocal` changes, including the upcoming window list.
+  uint32_t version = 0;
 };
 
+// Stable code for UI ("" when none), e.g. CLOCK_NOT_SET, MISSING_ZMANIM.
+const __FlashStringHelper *scheduleErrorCode(ScheduleError err);
+// Human-readable message for `st.error` into `buf` ("" when none). Returns the length.
+size_t formatScheduleError(const ScheduleStatus &st, char *buf, size_t len);
+
 class ScheduleEngine {
 public:
   void begin(ZmanimDb &zmanim, HolidayDb &holidays, ParashaDb &parasha);
@@ -29,10 +47,11 @@ public:
   void invalidate();
 
   bool desiredRelayOn() const;
-  ScheduleStatus status() const;
+  // Snapshot updated by tick(); stays valid for the engine's lifetime.
+  const ScheduleStatus &status() const;
 
   // For UI: JSON array of upcoming windows (start,end,label)
-  String upcomingJson(uint16_t limit) const;
+  void upcomingJson(JsonWriter &w, uint16_t limit) const;
 
 private:
   struct Window {
@@ -52,7 +71,10 @@ private:
   uint32_t _builtForDateKey = 0;
   uint32_t _lastConfigSig = 0;
   uint32_t _lastBuildMs = 0;
-  String _lastError;
+  ScheduleError _buildIssue = ScheduleError::None;
+  uint32_t _buildIssueDateKey = 0;
+  uint32_t _windowsSig = 0;          // of _windows after the last rebuild
+  uint32_t _publishedWindowsSig = 0; // what the current _status.version covers
 
   bool _desiredOn = false;
   ScheduleStatus _status;
@@ -60,6 +82,7 @@ private:
   uint32_t configSig(const AppConfig &cfg) const;
   uint32_t dateKeyFromLocalEpoch(time_t localEpoch) const;
 
+  void publish(const ScheduleStatus &next);
   void rebuild(const AppConfig &cfg, time_t nowLocalEpoch);
   void mergeWindows();
 };
@@ -0,0 +1,121 @@
+#include "SntpServer.h"
+
+#include <sys/time.h>
+
+#include "AppLog.h"
+#include "JsonWriter.h"
+
+namespace {
+constexpr uint8_t kMaxPacketsPerTick = 2;
+constexpr uint32_t kBindRetryMs = 5000UL;
+// Per client: a burst of 4 (what iburst-style clients send at startup), then one every 2 s.
+constexpr uint8_t kClientBurst = 4;
+constexpr uint32_t kClientRefillMs = 2000UL;
+constexpr uint16_t kMaxRepliesPerSecond = 20;
+
+int64_t wallUs() {
+  timeval tv{};
+  gettimeofday(&tv, nullptr);
+  return static_cast<int64_t>(tv.tv_sec) * 1000000LL + static_cast<int64_t>(tv.tv_usec);
+}
+} // namespace
+
+void SntpServer::begin(const AppConfig &cfg) {
+  _limiter.configure(kClientBurst, kClientRefillMs, kMaxRepliesPerSecond);
+  if (!cfg.sntpServerEnabled) return;
+  _lastBindAttemptMs = millis();
+  _listening = _udp.begin(ntp::kPort) != 0;
+  applog::info(applog::Module::Sntp, "%s port=%u", _listening ? "listening" : "bind failed", static_cast<unsigned>(ntp::kPort));
+}
+
+void SntpServer::tick(const AppConfig &cfg, const TimeKeeper &time) {
+  if (!cfg.sntpServerEnabled) {
+    if (_listening) {
+      _udp.stop();
+      _listening = false;
+      applog::info(applog::Module::Sntp, "stopped");
+    }
+    return;
+  }
+  if (!_listening) {
+    if (millis() - _lastBindAttemptMs < kBindRetryMs) return;
+    begin(cfg);
+    if (!_listening) return;
+  }
+
+  for (uint8_t i = 0; i < kMaxPacketsPerTick; i += 1) {
+    if (_udp.parsePacket() <= 0) return;
+    // Receive timestamp as early as possible; everything after this only adds to the server's own delay.
+    handlePacket(time, wallUs());
+    _udp.flush();
+  }
+}
+
+void SntpServer::handlePacket(const TimeKeeper &time, int64_t rxUs) {
+  const IPAddress client = _udp.remoteIP();
+  const uint16_t clientPort = _udp.remotePort();
+
+  uint8_t req[ntp::kPacketSize];
+  const int n = _udp.read(req, sizeof(req));
+  if (n < static_cast<int>(ntp::kPacketSize)) {
+    _invalid += 1;
+    return;
+  }
+
+  ntp::ServerClock clock;
+  if (!time.serverClock(clock)) {
+    // Never hand out a bogus clock; clients will fall back to another server.
+    _unsynced += 1;
+    return;
+  }
+
+  // Validate before charging the client: a malformed packet must not spend its reply tokens.
+  uint8_t reply[ntp::kPacketSize];
+  if (ntp::buildReply(req, static_cast<size_t>(n), clock, rxUs, wallUs(), reply) != ntp::RequestError::None) {
+    _invalid += 1;
+    return;
+  }
+
+  const uint32_t key = (static_cast<uint32_t>(client[0]) << 24) | (static_cast<uint32_t>(client[1]) << 16) |
+                       (static_cast<uint32_t>(client[2]) << 8) | static_cast<uint32_t>(client[3]);
+  if (!_limiter.allow(key, millis())) {
+    _rateLimited += 1;
+    return;
+  }
+  if (!_udp.beginPacket(client, clientPort)) return;
+  _udp.write(reply, sizeof(reply));
+  if (!_udp.endPacket()) return;
+
+  _served += 1;
+  _lastClient = client;
+  _lastServedUtc = time.nowUtc();
+}
+
+bool SntpServer::listening() const { return _listening; }
+
+uint32_t SntpServer::servedCount() const { return _served; }
+
+void SntpServer::statsJson(JsonWriter &w, const AppConfig &cfg, const TimeKeeper &time) const {
+  ntp::ServerClock clock;
+  const bool synced = time.serverClock(clock);
+
+  w.beginObject();
+  w.field("ok", true);
+  w.field("enabled", cfg.sntpServerEnabled);
+  w.field("listening", _listening);
+  w.field("synced", synced);
+  w.field("stratum", synced ? clock.stratum : 16);
+  w.field("rootDispersionUs", synced ? clock.rootDispersionUs : 0);
+  w.field("served", _served);
+  w.field("rateLimited", _rateLimited);
+  w.field("unsynced", _unsynced);
+  w.field("invalid", _invalid);
+  w.key("lastClient");
+  if (_served) {
+    w.value(_lastClient);
+  } else {
+    w.value("");
+  }
+  w.field("lastServedUtc", static_cast<uint32_t>(_lastServedUtc));
+  w.endObject();
+}
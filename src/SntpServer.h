@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+
+#include "AppConfig.h"
+#include "NtpSampler.h"
+#include "TimeKeeper.h"
+
+// Answers SNTP requests on UDP 123 (STA and Hotspot interfaces) from TimeKeeper's clock.
+// tick() handles at most a couple of datagrams per loop pass so the web server is never starved.
+class SntpServer {
+public:
+  void begin(const AppConfig &cfg);
+  void tick(const AppConfig &cfg, const TimeKeeper &time);
+
+  bool listening() const;
+  uint32_t servedCount() const;
+  // JSON: {ok, enabled, listening, synced, stratum, served, rateLimited, unsynced, invalid, lastClient, ...}
+  void statsJson(JsonWriter &w, const AppConfig &cfg, const TimeKeeper &time) const;
+
+private:
+  void handlePacket(const TimeKeeper &time, int64_t rxUs);
+
+  WiFiUDP _udp;
+  bool _listening = false;
+  uint32_t _lastBindAttemptMs = 0;
+  ntp::RateLimiter _limiter;
+
+  uint32_t _served = 0;
+  uint32_t _rateLimited = 0;
+  uint32_t _unsynced = 0; // dropped because our own clock is not valid yet
+  uint32_t _invalid = 0;
+  IPAddress _lastClient;
+  time_t _lastServedUtc = 0;
+};
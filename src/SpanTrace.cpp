@@ -0,0 +1,77 @@
+#include "SpanTrace.h"
+
+namespace {
+spantrace::ClockFn clockFn = nullptr;
+spantrace::Event events[spantrace::kCapacity];
+uint16_t next = 0;   // slot the next event goes to
+uint16_t used = 0;
+uint32_t total = 0;
+
+void push(spantrace::Lane lane, const char *name, uint64_t start, uint32_t dur, int32_t arg, bool instant) {
+  spantrace::Event &e = events[next];
+  e.name = name ? name : "";
+  e.startLo = static_cast<uint32_t>(start);
+  e.startHi = static_cast<uint16_t>(start >> 32);
+  e.durUs = dur;
+  e.arg = arg;
+  e.lane = lane;
+  e.instant = instant;
+  next = static_cast<uint16_t>((next + 1) % spantrace::kCapacity);
+  if (used < spantrace::kCapacity) used += 1;
+  total += 1;
+}
+} // namespace
+
+void spantrace::begin(ClockFn micros64) { clockFn = micros64; }
+
+bool spantrace::enabled() { return clockFn != nullptr; }
+
+uint64_t spantrace::now() { return clockFn ? clockFn() : 0; }
+
+void spantrace::complete(Lane lane, const char *name, uint64_t startUs, int32_t arg) {
+  if (!clockFn) return;
+  const uint64_t end = clockFn();
+  const uint64_t dur = end > startUs ? end - startUs : 0;
+  push(lane, name, startUs, dur > 0xFFFFFFFFULL ? 0xFFFFFFFFUL : static_cast<uint32_t>(dur), arg, false);
+}
+
+void spantrace::instant(Lane lane, const char *name, int32_t arg) {
+  if (!clockFn) return;
+  push(lane, name, clockFn(), 0, arg, true);
+}
+
+void spantrace::clear() {
+  next = 0;
+  used = 0;
+  total = 0;
+}
+
+uint16_t spantrace::count() { return used; }
+
+const spantrace::Event &spantrace::at(uint16_t i) {
+  const uint16_t oldest = used < kCapacity ? 0 : next;
+  return events[(oldest + i) % kCapacity];
+}
+
+uint64_t spantrace::startUs(const Event &e) { return (static_cast<uint64_t>(e.startHi) << 32) | e.startLo; }
+
+uint32_t spantrace::recorded() { return total; }
+
+const char *spantrace::laneName(Lane lane) {
+  switch (lane) {
+  case Lane::Relay:
+    return "relay";
+  case Lane::Schedule:
+    return "schedule";
+  case Lane::Http:
+    return "http";
+  case Lane::Fs:
+    return "littlefs";
+  case Lane::Ntp:
+    return "ntp";
+  case Lane::Ota:
+    return "ota";
+  default:
+    return "?";
+  }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Fixed-RAM timeline of spans (begin + duration) and instants with microsecond timestamps, exported by
+// WebUi as Chrome trace JSON (GET /api/trace, open in about:tracing or ui.perfetto.dev). Where PerfProfiler
+// keeps aggregates, this keeps the last kCapacity events in order, so collisions are visible: a LittleFS
+// write inside an HTTP request right before a relay transition, a schedule rebuild during an NTP step...
+//
+// Module-level (like relaystate) so free functions (appcfg::save, relaystate) can record without plumbing.
+// Nothing is recorded until begin() injects the clock; the host tools never call it.
+namespace spantrace {
+constexpr uint16_t kCapacity = 128;
+
+// One timeline row each.
+enum class Lane : uint8_t { Relay = 0, Schedule, Http, Fs, Ntp, Ota, Count };
+
+using ClockFn = uint64_t (*)();
+
+struct Event {
+  const char *name = ""; // static storage (string literal / route uri)
+  uint32_t startLo = 0;  // start, low 32 bits of the 64-bit microsecond clock
+  uint32_t durUs = 0;
+  int32_t arg = 0;
+  uint16_t startHi = 0;
+  Lane lane = Lane::Relay;
+  bool instant = false;
+};
+
+void begin(ClockFn micros64);
+bool enabled();
+uint64_t now();
+
+// Records a span from `startUs` (a now() reading) to now.
+void complete(Lane lane, const char *name, uint64_t startUs, int32_t arg = 0);
+void instant(Lane lane, const char *name, int32_t arg = 0);
+void clear();
+
+uint16_t count();
+// 0 = oldest.
+const Event &at(uint16_t i);
+uint64_t startUs(const Event &e);
+uint32_t recorded(); // since boot/clear, including overwritten ones
+const char *laneName(Lane lane);
+
+// Records the enclosing block as a span.
+class Span {
+public:
+  Span(Lane lane, const char *name) : _lane(lane), _name(name), _start(now()) {}
+  ~Span() { complete(_lane, _name, _start, _arg); }
+  void setArg(int32_t arg) { _arg = arg; }
+
+private:
+  Lane _lane;
+  const char *_name;
+  uint64_t _start;
+  int32_t _arg = 0;
+};
+} // namespace spantrace
@@ -0,0 +1,126 @@
+#include "TaskScheduler.h"
+
+void TaskScheduler::setMicros(MicrosFn fn) { _micros = fn; }
+
+void TaskScheduler::setHooks(TaskHook before, TaskHook after) {
+  _before = before;
+  _after = after;
+}
+
+uint8_t TaskScheduler::add(const char *name,
+                           TaskFn fn,
+                           uint32_t periodMs,
+                           Priority priority,
+                           uint32_t nowMs,
+                           uint32_t deadlineMs,
+                           uint32_t firstDelayMs) {
+  if (_count >= kMaxTasks || !fn) return kInvalidTask;
+  Task &t = _tasks[_count];
+  t = {};
+  t.name = name ? name : "";
+  t.fn = fn;
+  t.periodMs = periodMs;
+  t.deadlineMs = deadlineMs;
+  t.priority = priority;
+  t.nextRunMs = nowMs + firstDelayMs;
+  const uint8_t id = _count;
+  _count += 1;
+  return id;
+}
+
+void TaskScheduler::setEnabled(uint8_t id, bool enabled) {
+  if (id >= _count) return;
+  _tasks[id].enabled = enabled;
+}
+
+void TaskScheduler::trigger(uint8_t id, uint32_t nowMs) {
+  if (id >= _count) return;
+  _tasks[id].nextRunMs = nowMs;
+}
+
+bool TaskScheduler::isDue(const Task &t, uint32_t nowMs) {
+  // Wrap-safe "now >= nextRun".
+  return t.enabled && static_cast<int32_t>(nowMs - t.nextRunMs) >= 0;
+}
+
+int8_t TaskScheduler::pickNext(uint32_t nowMs, const bool *ranThisPass) const {
+  int8_t best = -1;
+  for (uint8_t i = 0; i < _count; i += 1) {
+    const Task &t = _tasks[i];
+    if (ranThisPass[i] || !isDue(t, nowMs)) continue;
+    if (best < 0) {
+      best = static_cast<int8_t>(i);
+      continue;
+    }
+    const Task &b = _tasks[best];
+    if (t.priority < b.priority) {
+      best = static_cast<int8_t>(i);
+    } else if (t.priority == b.priority && static_cast<int32_t>(t.nextRunMs - b.nextRunMs) < 0) {
+      best = static_cast<int8_t>(i);
+    }
+  }
+  return best;
+}
+
+uint8_t TaskScheduler::runDue(uint32_t (*nowFn)()) {
+  bool ran[kMaxTasks] = {};
+  uint8_t runCount = 0;
+  _passes += 1;
+
+  while (runCount < _count) {
+    const uint32_t nowMs = nowFn();
+    const int8_t idx = pickNext(nowMs, ran);
+    if (idx < 0) break;
+    Task &t = _tasks[idx];
+    ran[idx] = true;
+    runCount += 1;
+
+    const uint32_t lateness = nowMs - t.nextRunMs;
+    if (lateness > t.maxLatenessMs) t.maxLatenessMs = lateness;
+    if (t.deadlineMs && lateness > t.deadlineMs) t.missed += 1;
+
+    // Fixed-rate schedule; when a task fell a whole period behind, re-anchor instead of bursting.
+    if (t.periodMs == 0 || lateness >= t.periodMs) {
+      t.nextRunMs = nowMs + t.periodMs;
+    } else {
+      t.nextRunMs += t.periodMs;
+    }
+
+    if (_before) _before(static_cast<uint8_t>(idx));
+    const uint32_t startUs = _micros ? _micros() : 0;
+    t.fn();
+    if (_micros) {
+      const uint32_t us = _micros() - startUs;
+      t.lastRunUs = us;
+      if (us > t.maxRunUs) t.maxRunUs = us;
+      t.totalRunUs += us;
+    }
+    t.runs += 1;
+    if (_after) _after(static_cast<uint8_t>(idx));
+  }
+  return runCount;
+}
+
+uint32_t TaskScheduler::msUntilNext(uint32_t nowMs) const {
+  uint32_t best = UINT32_MAX;
+  for (uint8_t i = 0; i < _count; i += 1) {
+    const Task &t = _tasks[i];
+    if (!t.enabled) continue;
+    const int32_t d = static_cast<int32_t>(t.nextRunMs - nowMs);
+    if (d <= 0) {
+      if (t.periodMs == 0) continue;
+      return 0;
+    }
+    if (static_cast<uint32_t>(d) < best) best = static_cast<uint32_t>(d);
+  }
+  return best;
+}
+
+uint8_t TaskScheduler::taskCount() const { return _count; }
+
+const TaskScheduler::Task &TaskScheduler::task(uint8_t id) const {
+  static const Task kEmpty{};
+  return (id < _count) ? _tasks[id] : kEmpty;
+}
+
+uint32_t TaskScheduler::passes() const { return _passes; }
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Cooperative, run-to-completion scheduler for the main loop.
+//
+// Tasks have a period (0 = every pass), a priority and a lateness deadline. Each call to
+// runDue() repeatedly picks the most urgent due task (priority first, then the oldest due
+// time), so a Critical task that becomes due is always served before the next Low one.
+// Every task runs at most once per pass; nothing here blocks or allocates.
+//
+// No Arduino dependencies: time comes from the caller (and an optional microsecond clock
+// for run-time statistics), so the same table can be driven on a host with virtual time.
+class TaskScheduler {
+public:
+  static constexpr uint8_t kMaxTasks = 16;
+  static constexpr uint8_t kInvalidTask = 0xFF;
+
+  enum class Priority : uint8_t {
+    Critical = 0, // relay evaluation: never waits behind anything else
+    High,
+    Normal,
+    Low, // web handling, logging
+  };
+
+  using TaskFn = void (*)();
+  using MicrosFn = uint32_t (*)();
+  using TaskHook = void (*)(uint8_t id);
+
+  struct Task {
+    const char *name = "";
+    TaskFn fn = nullptr;
+    uint32_t periodMs = 0;
+    uint32_t deadlineMs = 0; // lateness tolerated before a run counts as missed (0 = no deadline)
+    Priority priority = Priority::Normal;
+    bool enabled = true;
+
+    uint32_t nextRunMs = 0;
+    uint32_t runs = 0;
+    uint32_t missed = 0;
+    uint32_t maxLatenessMs = 0;
+    uint32_t lastRunUs = 0;
+    uint32_t maxRunUs = 0;
+    uint64_t totalRunUs = 0;
+  };
+
+  void setMicros(MicrosFn fn);
+  // Called right before / after every task run (instrumentation).
+  void setHooks(TaskHook before, TaskHook after);
+
+  // Returns the task id (or kInvalidTask when the table is full).
+  // The first run happens `firstDelayMs` after `nowMs`.
+  uint8_t add(const char *name,
+              TaskFn fn,
+              uint32_t periodMs,
+              Priority priority,
+              uint32_t nowMs,
+              uint32_t deadlineMs = 0,
+              uint32_t firstDelayMs = 0);
+  void setEnabled(uint8_t id, bool enabled);
+  // Makes the task due now (e.g. after an event that needs an immediate re-evaluation).
+  void trigger(uint8_t id, uint32_t nowMs);
+
+  // Runs the due tasks; `nowFn` is re-read after every task. Returns the number of tasks run.
+  uint8_t runDue(uint32_t (*nowFn)());
+  // Milliseconds until the next enabled task is due (0 = something is due now). Every-pass tasks
+  // (period 0) are polls and do not count once due; the caller's idle cap bounds how long they wait.
+  uint32_t msUntilNext(uint32_t nowMs) const;
+
+  uint8_t taskCount() const;
+  const Task &task(uint8_t id) const;
+  uint32_t passes() const;
+
+private:
+  static bool isDue(const Task &t, uint32_t nowMs);
+  int8_t pickNext(uint32_t nowMs, const bool *ranThisPass) const;
+
+  Task _tasks[kMaxTasks];
+  uint8_t _count = 0;
+  MicrosFn _micros = nullptr;
+  TaskHook _before = nullptr;
+  TaskHook _after = nullptr;
+  uint32_t _passes = 0;
+};
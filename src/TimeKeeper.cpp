@@ -4,11 +4,23 @@
 #include <sys/time.h>
 #include <time.h>
 
+#include "AppLog.h"
 #include "DateMath.h"
+#include "JsonWriter.h"
+#include "SpanTrace.h"
 
 namespace {
 constexpr uint32_t kNtpRetryMs = 60UL * 1000UL;
 constexpr time_t kMinValidEpoch = 1704067200; // 2024-01-01
+constexpr uint32_t kNtpReplyTimeoutMs = 600UL;
+constexpr uint32_t kNtpRoundBudgetMs = 6000UL; // blocking syncNtpNow() gives up after this
+constexpr uint32_t kNtpDnsTimeoutMs = 1000UL; // one lookup per tick, see UdpTransport::lookupNext()
+// Advertised error growth since the last sync (ESP8266 crystal, uncompensated).
+constexpr uint32_t kClockDriftPpm = 50;
+// A hand-set clock is only as good as the browser that sent it.
+constexpr uint8_t kManualStratum = 10;
+constexpr uint32_t kManualDispersionUs = 1000000UL;
+constexpr uint32_t kMaxDispersionUs = 16000000UL;
 
 uint16_t yearFromLocalEpoch(time_t localEpoch) {
   tm t{};
@@ -84,32 +96,101 @@ time_t nextDstChangeUtc(const AppConfig &cfg, time_t utc) {
 }
 } // namespace
 
+void TimeKeeper::UdpTransport::reset() {
+  if (!_open) _open = _udp.begin(0) != 0; // ephemeral local port
+  for (uint8_t i = 0; i < ntp::kMaxServers; i += 1) _looked[i] = false;
+  // Drop anything left over from a previous round.
+  while (_open && _udp.parsePacket() > 0) _udp.flush();
+}
+
+void TimeKeeper::UdpTransport::setHost(uint8_t server, const String &host) {
+  if (server >= ntp::kMaxServers || _hosts[server] == host) return;
+  _hosts[server] = host;
+  _resolved[server] = false;
+}
+
+void TimeKeeper::UdpTransport::forget(uint8_t server) {
+  if (server < ntp::kMaxServers) _resolved[server] = false;
+}
+
+bool TimeKeeper::UdpTransport::lookupNext() {
+  for (uint8_t i = 0; i < ntp::kMaxServers; i += 1) {
+    if (_resolved[i] || _looked[i] || !_hosts[i].length()) continue;
+    _looked[i] = true;
+    // Blocks up to kNtpDnsTimeoutMs; only for a new name or a server that stopped answering.
+    _resolved[i] = WiFi.hostByName(_hosts[i].c_str(), _ips[i], kNtpDnsTimeoutMs);
+    return true;
+  }
+  return false;
+}
+
+bool TimeKeeper::UdpTransport::resolve(uint8_t server) {
+  // No lookup here: lookupNext() did them, one per tick, before the sampler ran.
+  return server < ntp::kMaxServers && _resolved[server];
+}
+
+bool TimeKeeper::UdpTransport::send(uint8_t server, const uint8_t *pkt, size_t len) {
+  if (!_open || server >= ntp::kMaxServers || !_resolved[server]) return false;
+  if (!_udp.beginPacket(_ips[server], ntp::kPort)) return false;
+  _udp.write(pkt, len);
+  return _udp.endPacket() != 0;
+}
+
+size_t TimeKeeper::UdpTransport::receive(uint8_t server, uint8_t *pkt, size_t cap, int64_t &rxUs) {
+  if (!_open || server >= ntp::kMaxServers) return 0;
+  const int size = _udp.parsePacket();
+  if (size <= 0) return 0;
+  rxUs = wallUs();
+  if (_udp.remoteIP() != _ips[server] || _udp.remotePort() != ntp::kPort) {
+    _udp.flush();
+    return 0;
+  }
+  const int n = _udp.read(pkt, cap);
+  _udp.flush();
+  return (n > 0) ? static_cast<size_t>(n) : 0;
+}
+
+int64_t TimeKeeper::UdpTransport::wallUs() {
+  timeval tv{};
+  gettimeofday(&tv, nullptr);
+  return static_cast<int64_t>(tv.tv_sec) * 1000000LL + static_cast<int64_t>(tv.tv_usec);
+}
+
+uint32_t TimeKeeper::UdpTransport::monoMs() { return millis(); }
+
+uint32_t TimeKeeper::UdpTransport::refId(uint8_t server) const {
+  if (server >= ntp::kMaxServers || !_resolved[server]) return 0;
+  const IPAddress &ip = _ips[server];
+  return (static_cast<uint32_t>(ip[0]) << 24) | (static_cast<uint32_t>(ip[1]) << 16) | (static_cast<uint32_t>(ip[2]) << 8) |
+         static_cast<uint32_t>(ip[3]);
+}
+
 void TimeKeeper::begin(const AppConfig &cfg) {
-  _ntpConfigured = false;
   _lastNtpAttemptMs = 0;
   _lastNtpSyncUtc = 0;
   _lastManualSetUtc = 0;
   _lastNtpAttemptFailed = false;
+  _ntpLast = {};
   if (cfg.ntpEnabled) {
     syncNtpNow(cfg);
   }
 }
 
 void TimeKeeper::tick(const AppConfig &cfg) {
+  // Background rounds advance one packet per tick so the loop is never held waiting for replies.
+  if (_ntpSampler.active()) {
+    // Missing server addresses first, one DNS lookup per tick; the sampler runs once they are all tried.
+    if (_ntpIo.lookupNext()) return;
+    if (_ntpSampler.poll(_ntpIo, _ntpStats)) finishNtpRound();
+    return;
+  }
+
   if (!cfg.ntpEnabled) return;
   const bool valid = isTimeValid();
 
-  // SNTP can succeed asynchronously after configTime(), even if our initial wait loop timed out.
-  // When that happens, mark the first sync time and clear the "failed" flag so the status LED/UI doesn't
-  // show a persistent NTP error after time is already valid.
-  if (valid && _ntpConfigured && _lastManualSetUtc == 0 && _lastNtpSyncUtc == 0) {
-    _lastNtpSyncUtc = nowUtc();
-    _lastNtpAttemptFailed = false;
-  }
-
   if (!valid) {
     if (millis() - _lastNtpAttemptMs < kNtpRetryMs) return;
-    syncNtpNow(cfg);
+    startNtpRound(cfg);
     return;
   }
 
@@ -124,7 +205,7 @@ void TimeKeeper::tick(const AppConfig &cfg) {
   if (baseline == 0) return;
   if ((now - baseline) < interval) return;
   if (millis() - _lastNtpAttemptMs < kNtpRetryMs) return;
-  syncNtpNow(cfg);
+  startNtpRound(cfg);
 }
 
 bool TimeKeeper::isTimeValid() const {
@@ -177,43 +258,187 @@ void TimeKeeper::setManualUtc(time_t epochUtc) {
   tv.tv_sec = epochUtc;
   tv.tv_usec = 0;
   settimeofday(&tv, nullptr);
+  spantrace::instant(spantrace::Lane::Ntp, "clock.manual");
   _lastManualSetUtc = epochUtc;
   _lastNtpAttemptFailed = false;
+  _version += 1;
 }
 
-bool TimeKeeper::syncNtpNow(const AppConfig &cfg) {
+bool TimeKeeper::startNtpRound(const AppConfig &cfg) {
   _lastNtpAttemptMs = millis();
   if (WiFi.status() != WL_CONNECTED) return false;
 
-  configTime(0, 0, cfg.ntpServer.c_str());
-  _ntpConfigured = true;
-
-  bool ok = false;
-  for (int i = 0; i < 20; i += 1) {
-    if (isTimeValid()) {
-      ok = true;
-      break;
+  // Server list: primary first, then extras (deduplicated). Stats follow the host name.
+  String hosts[ntp::kMaxServers];
+  uint8_t count = 0;
+  auto addHost = [&](const String &raw) {
+    String h = raw;
+    h.trim();
+    if (!h.length() || count >= ntp::kMaxServers) return;
+    for (uint8_t i = 0; i < count; i += 1) {
+      if (hosts[i] == h) return;
     }
-    delay(250);
-    yield();
+    hosts[count] = h;
+    count += 1;
+  };
+  addHost(cfg.ntpServer);
+  for (uint8_t i = 0; i < cfg.ntpExtraServerCount && i < AppConfig::kMaxExtraNtpServers; i += 1) {
+    addHost(cfg.ntpExtraServers[i]);
+  }
+  if (count == 0) return false;
+
+  _ntpIo.reset();
+  for (uint8_t i = 0; i < ntp::kMaxServers; i += 1) {
+    const String h = (i < count) ? hosts[i] : String();
+    if (_ntpServers[i] != h) {
+      _ntpServers[i] = h;
+      _ntpStats[i] = {};
+    }
+    if (i < count) _ntpIo.setHost(i, h);
+  }
+  _ntpServerCount = count;
+
+  const uint32_t maxRttUs = static_cast<uint32_t>(cfg.ntpMaxRttMs) * 1000UL;
+  _ntpSampler.configure(count, cfg.ntpSamplesPerServer, maxRttUs, kNtpReplyTimeoutMs);
+  _ntpSampler.start(millis());
+  _ntpRoundStartMs = millis();
+  return true;
+}
+
+bool TimeKeeper::finishNtpRound() {
+  const ntp::Result &r = _ntpSampler.result();
+  const bool ok = r.ok;
+  // A server that gave nothing usable may have moved (pool rotation): look it up again next round.
+  for (uint8_t i = 0; i < _ntpServerCount; i += 1) {
+    if (_ntpStats[i].lastDelayUs == 0) _ntpIo.forget(i);
   }
-  if (!ok) ok = isTimeValid();
   if (ok) {
+    timeval tv{};
+    gettimeofday(&tv, nullptr);
+    const int64_t corrected =
+      static_cast<int64_t>(tv.tv_sec) * 1000000LL + static_cast<int64_t>(tv.tv_usec) + r.sample.offsetUs;
+    tv.tv_sec = static_cast<time_t>(corrected / 1000000LL);
+    tv.tv_usec = static_cast<suseconds_t>(corrected % 1000000LL);
+    settimeofday(&tv, nullptr);
+    spantrace::instant(spantrace::Lane::Ntp, "ntp.step", static_cast<int32_t>(r.sample.offsetUs / 1000LL));
+
+    _ntpLast = r;
+    _ntpRefId = _ntpIo.refId(r.server);
     _lastNtpSyncUtc = nowUtc();
-    Serial.printf("[ntp] synced utc=%lu server=%s\n", static_cast<unsigned long>(_lastNtpSyncUtc), cfg.ntpServer.c_str());
+    applog::info(applog::Module::Ntp, "synced utc=%lu server=%s offset=%ldms err=%lums rtt=%lums stratum=%u (%u/%u ok, %lums)",
+                  static_cast<unsigned long>(_lastNtpSyncUtc),
+                  _ntpServers[r.server].c_str(),
+                  static_cast<long>(r.sample.offsetUs / 1000LL),
+                  static_cast<unsigned long>(r.uncertaintyUs / 1000UL),
+                  static_cast<unsigned long>(r.sample.delayUs / 1000UL),
+                  static_cast<unsigned>(r.sample.stratum),
+                  static_cast<unsigned>(r.accepted),
+                  static_cast<unsigned>(_ntpServerCount),
+                  static_cast<unsigned long>(millis() - _ntpRoundStartMs));
   } else {
-    Serial.printf("[ntp] failed server=%s\n", cfg.ntpServer.c_str());
+    spantrace::instant(spantrace::Lane::Ntp, "ntp.failed");
+    applog::warn(applog::Module::Ntp, "failed servers=%u", static_cast<unsigned>(_ntpServerCount));
   }
+  if (ok || _lastNtpAttemptFailed != !ok) _version += 1;
   _lastNtpAttemptFailed = !ok;
   return ok;
 }
 
+bool TimeKeeper::syncNtpNow(const AppConfig &cfg) {
+  spantrace::Span span(spantrace::Lane::Ntp, "ntp.sync");
+  if (!startNtpRound(cfg)) {
+    _lastNtpAttemptFailed = true;
+    return false;
+  }
+  while (_ntpIo.lookupNext() || !_ntpSampler.poll(_ntpIo, _ntpStats)) {
+    if (millis() - _ntpRoundStartMs > kNtpRoundBudgetMs) {
+      _ntpSampler.finishNow(_ntpStats);
+      break;
+    }
+    delay(1);
+  }
+  return finishNtpRound();
+}
+
+bool TimeKeeper::beginSync(const AppConfig &cfg) {
+  if (_ntpSampler.active()) return true;
+  if (startNtpRound(cfg)) return true;
+  if (!_lastNtpAttemptFailed) _version += 1;
+  _lastNtpAttemptFailed = true;
+  return false;
+}
+
 time_t TimeKeeper::lastNtpSyncUtc() const { return _lastNtpSyncUtc; }
 
 time_t TimeKeeper::lastManualSetUtc() const { return _lastManualSetUtc; }
 
 bool TimeKeeper::lastNtpAttemptFailed() const { return _lastNtpAttemptFailed; }
 
+int64_t TimeKeeper::lastNtpOffsetUs() const { return _ntpLast.ok ? _ntpLast.sample.offsetUs : 0; }
+
+uint32_t TimeKeeper::ntpUncertaintyUs() const { return _ntpLast.ok ? _ntpLast.uncertaintyUs : 0; }
+
+uint8_t TimeKeeper::ntpStratum() const { return _ntpLast.ok ? _ntpLast.sample.stratum : 0; }
+
+String TimeKeeper::ntpSelectedServer() const { return _ntpLast.ok ? _ntpServers[_ntpLast.server] : String(); }
+
+void TimeKeeper::ntpStatsJson(JsonWriter &w) const {
+  w.beginObject();
+  w.field("ok", true);
+  w.field("selected", ntpSelectedServer());
+  w.field("offsetUs", lastNtpOffsetUs());
+  w.field("uncertaintyUs", ntpUncertaintyUs());
+  w.field("rttUs", _ntpLast.ok ? _ntpLast.sample.delayUs : 0);
+  w.field("stratum", ntpStratum());
+  w.field("lastSyncUtc", static_cast<uint32_t>(_lastNtpSyncUtc));
+  w.field("roundActive", _ntpSampler.active());
+  w.beginArray("servers");
+  for (uint8_t i = 0; i < _ntpServerCount && i < ntp::kMaxServers; i += 1) {
+    const ntp::ServerStats &st = _ntpStats[i];
+    w.beginObject();
+    w.field("host", _ntpServers[i]);
+    w.field("sent", st.sent);
+    w.field("received", st.received);
+    w.field("rejected", st.rejected);
+    w.field("timeouts", st.timeouts);
+    w.field("selected", st.selected);
+    w.field("lastRttUs", st.lastDelayUs);
+    w.field("minRttUs", st.minDelayUs);
+    w.field("lastOffsetUs", st.lastOffsetUs);
+    w.field("stratum", st.stratum);
+    w.field("lastError", ntp::sampleErrorToString(st.lastError));
+    w.endObject();
+  }
+  w.endArray();
+  w.endObject();
+}
+
+bool TimeKeeper::serverClock(ntp::ServerClock &out) const {
+  out = {};
+  if (!isTimeValid()) return false;
+
+  const time_t now = nowUtc();
+  const bool fromNtp = _ntpLast.ok && _lastNtpSyncUtc != 0 && _lastNtpSyncUtc >= _lastManualSetUtc;
+  const time_t ref = fromNtp ? _lastNtpSyncUtc : _lastManualSetUtc;
+  const uint32_t ageSec = (ref > 0 && now > ref) ? static_cast<uint32_t>(now - ref) : 0;
+  uint64_t dispersion = static_cast<uint64_t>(ageSec) * kClockDriftPpm;
+
+  if (fromNtp) {
+    const ntp::Sample &s = _ntpLast.sample;
+    out.stratum = static_cast<uint8_t>((s.stratum >= 15) ? 15 : s.stratum + 1);
+    out.refId = _ntpRefId;
+    out.rootDelayUs = s.rootDelayUs + s.delayUs;
+    dispersion += s.rootDispersionUs + s.delayUs / 2;
+  } else {
+    out.stratum = kManualStratum;
+    out.refId = 0x4C4F434CUL; // "LOCL"
+    dispersion += kManualDispersionUs;
+  }
+  out.rootDispersionUs = static_cast<uint32_t>((dispersion > kMaxDispersionUs) ? kMaxDispersionUs : dispersion);
+  out.refUs = static_cast<int64_t>(ref) * 1000000LL;
+  return true;
+}
+
 String TimeKeeper::timeSource() const {
   if (!isTimeValid()) return "invalid";
   if (_lastNtpSyncUtc != 0 && _lastNtpSyncUtc >= _lastManualSetUtc) return "ntp";
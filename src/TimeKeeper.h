@@ -1,9 +1,11 @@
 #pragma once
 
 #include <Arduino.h>
+#include <WiFiUdp.h>
 #include <time.h>
 
 #include "AppConfig.h"
+#include "NtpSampler.h"
 
 class TimeKeeper {
 public:
@@ -19,17 +21,73 @@ public:
   time_t nextDstChangeLocal(const AppConfig &cfg) const;
 
   void setManualUtc(time_t epochUtc);
+  // Runs a full sampling round over all configured servers (blocking, bounded by a time budget).
   bool syncNtpNow(const AppConfig &cfg);
+  // Starts a background round that tick() advances, or joins the one already running. False (and the
+  // attempt counts as failed) when no round can start: Wi-Fi down or no server configured.
+  bool beginSync(const AppConfig &cfg);
+  bool syncActive() const { return _ntpSampler.active(); }
 
   time_t lastNtpSyncUtc() const;
   time_t lastManualSetUtc() const;
   String timeSource() const; // "invalid" | "manual" | "ntp"
   bool lastNtpAttemptFailed() const;
+  // Bumps whenever the clock is set or stepped (manual set, NTP round) or a round's outcome flips.
+  // The clock ticking on its own does not count.
+  uint32_t version() const { return _version; }
+
+  // Quality of the last successful NTP round.
+  int64_t lastNtpOffsetUs() const;
+  uint32_t ntpUncertaintyUs() const;
+  uint8_t ntpStratum() const;
+  String ntpSelectedServer() const;
+  // JSON: {ok, selected, offsetUs, uncertaintyUs, stratum, servers:[...]}
+  void ntpStatsJson(JsonWriter &w) const;
+  // What the built-in SNTP server advertises (stratum/reference derived from our own sync source).
+  // Returns false while the clock is invalid.
+  bool serverClock(ntp::ServerClock &out) const;
 
  private:
-  bool _ntpConfigured = false;
+  class UdpTransport : public ntp::Transport {
+  public:
+    void reset();
+    // Addresses are kept across rounds; a changed host name or forget() looks it up again.
+    void setHost(uint8_t server, const String &host);
+    void forget(uint8_t server);
+    // Looks up one server that has no address and was not tried this round; false when none is left.
+    bool lookupNext();
+    bool resolve(uint8_t server) override;
+    bool send(uint8_t server, const uint8_t *pkt, size_t len) override;
+    size_t receive(uint8_t server, uint8_t *pkt, size_t cap, int64_t &rxUs) override;
+    int64_t wallUs() override;
+    uint32_t monoMs() override;
+    // Resolved IPv4 of `server` as an NTP reference id (0 when unresolved).
+    uint32_t refId(uint8_t server) const;
+
+  private:
+    WiFiUDP _udp;
+    bool _open = false;
+    String _hosts[ntp::kMaxServers];
+    IPAddress _ips[ntp::kMaxServers];
+    bool _resolved[ntp::kMaxServers] = {};
+    bool _looked[ntp::kMaxServers] = {}; // lookup tried this round
+  };
+
+  bool startNtpRound(const AppConfig &cfg);
+  bool finishNtpRound();
+
   uint32_t _lastNtpAttemptMs = 0;
   time_t _lastNtpSyncUtc = 0;
   time_t _lastManualSetUtc = 0;
   bool _lastNtpAttemptFailed = false;
+  uint32_t _version = 0;
+
+  UdpTransport _ntpIo;
+  ntp::Sampler _ntpSampler;
+  uint32_t _ntpRoundStartMs = 0;
+  uint8_t _ntpServerCount = 0;
+  String _ntpServers[ntp::kMaxServers];
+  ntp::ServerStats _ntpStats[ntp::kMaxServers];
+  ntp::Result _ntpLast;
+  uint32_t _ntpRefId = 0;
 };
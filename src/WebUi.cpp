@@ -4,13 +4,68 @@
 #include <ESP8266WiFi.h>
 #include <LittleFS.h>
 #include <time.h>
+#include <uri/UriBraces.h>
 
 #include "AppConfig.h"
+#include "AppLog.h"
+#include "FastConnect.h"
 #include "EmbeddedUi.h"
+#include "JsonWriter.h"
 #include "OverrideWindows.h"
+#include "RelayState.h"
 #include "DateMath.h"
+#include "SpanTrace.h"
 
 namespace {
+static_assert(HeapMonitor::kMaxSources >= 3 + WebUi::kMaxRoutes, "heap table too small for periodic, OTA and the routes");
+
+const char *methodName(HTTPMethod method) {
+  switch (method) {
+  case HTTP_GET:
+    return "GET";
+  case HTTP_HEAD:
+    return "HEAD";
+  case HTTP_POST:
+    return "POST";
+  case HTTP_PUT:
+    return "PUT";
+  case HTTP_PATCH:
+    return "PATCH";
+  case HTTP_DELETE:
+    return "DELETE";
+  case HTTP_OPTIONS:
+    return "OPTIONS";
+  default:
+    return "ANY";
+  }
+}
+
+// True when an Accept-Encoding value allows gzip ("gzip" or "*", unless given q=0).
+bool acceptsGzip(const String &acceptEncoding) {
+  int start = 0;
+  while (start < static_cast<int>(acceptEncoding.length())) {
+    int end = acceptEncoding.indexOf(',', start);
+    if (end < 0) end = acceptEncoding.length();
+    String item = acceptEncoding.substring(start, end);
+    start = end + 1;
+    String name = item;
+    String params;
+    const int semi = item.indexOf(';');
+    if (semi >= 0) {
+      name = item.substring(0, semi);
+      params = item.substring(semi + 1);
+    }
+    name.trim();
+    name.toLowerCase();
+    if (name != "gzip" && name != "*") continue;
+    params.replace(" ", "");
+    const int q = params.indexOf("q=");
+    if (q >= 0 && params.substring(q + 2).toFloat() <= 0.0f) continue;
+    return true;
+  }
+  return false;
+}
+
 String jsonError(const String &msg) {
   DynamicJsonDocument doc(256);
   doc["ok"] = false;
@@ -118,6 +173,54 @@ bool computeNextHebrewDayStart(const AppConfig &cfg,
   return true;
 }
 
+// FNV-1a, for change detection on /api/events.
+uint32_t mix(uint32_t h, uint32_t v) {
+  for (uint8_t i = 0; i < 4; i += 1) {
+    h ^= (v >> (i * 8)) & 0xFFu;
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+// Print onto a response opened with chunkedResponseModeStart(): every write() goes out as one chunk.
+class ChunkSink : public Print {
+public:
+  explicit ChunkSink(HttpServer &server) : _server(server) {}
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buf, size_t len) override {
+    _server.sendContent(reinterpret_cast<const char *>(buf), len);
+    return len;
+  }
+
+private:
+  HttpServer &_server;
+};
+
+// Print into a String, for bodies that are sent as one piece (SSE messages).
+class StringSink : public Print {
+public:
+  explicit StringSink(String &out) : _out(out) {}
+  size_t write(uint8_t c) override { return _out.concat(static_cast<char>(c)) ? 1 : 0; }
+  size_t write(const uint8_t *buf, size_t len) override {
+    return _out.concat(reinterpret_cast<const char *>(buf), len) ? len : 0;
+  }
+
+private:
+  String &_out;
+};
+
+constexpr uint32_t kFnvBasis = 2166136261UL;
+constexpr uint32_t kEventPollMs = 250;
+constexpr uint16_t kDashboardHistoryLimit = 60;
+// Job timeouts, counted from the first step. A manifest check is at most 6 hops of 15 s each.
+constexpr uint32_t kOtaCheckJobMs = 100000UL;
+// The update job's download resumes where a timed-out one stopped, so this only bounds one attempt.
+constexpr uint32_t kOtaUpdateJobMs = 600000UL;
+constexpr uint32_t kNtpJobMs = 15000UL;
+constexpr uint32_t kWifiScanJobMs = 20000UL;
+// The update job announces the install this long before the reboot, so a polling page sees it before the
+// device goes quiet.
+constexpr uint32_t kOtaFlashNoticeMs = 1500UL;
 } // namespace
 
 WebUi::WebUi(uint16_t port) : _server(port) {}
@@ -131,7 +234,13 @@ void WebUi::begin(AppConfig &cfg,
                   ScheduleEngine &schedule,
                   OtaUpdater &ota,
                   StatusIndicator &indicator,
-                  HistoryLog &history) {
+                  HistoryLog &history,
+                  SntpServer &sntp,
+                  TaskScheduler &tasks,
+                  JobQueue &jobs,
+                  PerfProfiler &perf,
+                  HeapMonitor &heap,
+                  InputTrace &trace) {
   _cfg = &cfg;
   _wifi = &wifi;
   _time = &time;
@@ -142,20 +251,516 @@ void WebUi::begin(AppConfig &cfg,
   _ota = &ota;
   _indicator = &indicator;
   _history = &history;
+  _sntp = &sntp;
+  _tasks = &tasks;
+  _jobs = &jobs;
+  _perf = &perf;
+  _heap = &heap;
+  _trace = &trace;
 
   setupRoutes();
+  _etagSalt = ESP.random();
+  // A random start, so a dashboard version kept by a page from before a reboot is not taken as current.
+  _dash.version = _etagSalt >> 8;
+  static const char *kHeaderKeys[] = {"If-None-Match", "Accept-Encoding"};
+  _server.collectHeaders(kHeaderKeys, 2);
   _server.begin();
 }
 
-void WebUi::tick() { _server.handleClient(); }
+void WebUi::tick() {
+  // Reads every open connection without waiting; handleClient() then serves at most one complete request.
+  _server.getServer().poll();
+  _server.handleClient();
+  if (millis() - _lastEventPollMs >= kEventPollMs) {
+    _lastEventPollMs = millis();
+    _events.tick(_lastEventPollMs);
+    if (_events.clientCount()) pollEvents();
+  }
+}
+
+// What the UI shows, reduced to one number per topic. Status is the render number of the cached lite body,
+// which leaves out what the page animates itself (the clock) and keeps RSSI only in 5 dB steps, so a quiet
+// device sends nothing.
+WebUi::EventMarks WebUi::currentEventMarks() {
+  EventMarks m;
+  m.status = cachedStatus(true).tag;
+
+  m.schedule = _schedule ? _schedule->status().version : 0;
+  m.history = _history ? _history->version() : 0;
+  // The OTA status also shows whether an update could run right now.
+  uint32_t h = mix(kFnvBasis, _ota ? _ota->version() : 0);
+  h = mix(h, appcfg::version());
+  h = mix(h, (_time->isTimeValid() ? 1u : 0u) | (WiFi.status() == WL_CONNECTED ? 2u : 0u) |
+               (_schedule && _schedule->status().inHolyTime ? 4u : 0u));
+  m.ota = h;
+
+  // The local day is in here because /api/time's next Hebrew day start moves at midnight.
+  const int32_t offset = _time->localOffsetSeconds(*_cfg);
+  h = mix(mix(kFnvBasis, _time->version()), static_cast<uint32_t>(offset));
+  m.time = mix(h, static_cast<uint32_t>((_time->nowUtc() + offset) / 86400));
+  return m;
+}
+
+void WebUi::advanceDashboard() {
+  const EventMarks now = currentEventMarks();
+  const uint32_t next = _dash.version + 1;
+  bool changed = false;
+  auto note = [&](uint32_t was, uint32_t is, uint32_t &changedAt) {
+    if (was == is) return;
+    changedAt = next;
+    changed = true;
+  };
+  note(_dash.marks.status, now.status, _dash.changedAt.status);
+  note(_dash.marks.time, now.time, _dash.changedAt.time);
+  note(_dash.marks.schedule, now.schedule, _dash.changedAt.schedule);
+  note(_dash.marks.history, now.history, _dash.changedAt.history);
+  note(_dash.marks.ota, now.ota, _dash.changedAt.ota);
+  _dash.marks = now;
+  if (!changed) return;
+  _dash.version = next;
+  _dash.ringVersion[_dash.ringNext] = next;
+  _dash.ringHistorySeq[_dash.ringNext] = _history ? _history->lastSeq() : 0;
+  _dash.ringNext = static_cast<uint8_t>((_dash.ringNext + 1) % Dashboard::kRing);
+}
+
+// One object with the sections that changed after `since` (all of them for 0 or a version this boot
+// did not hand out): {ok, v, full, status?, time?, schedule?, history?: {reset, seq, items}, ota?}.
+void WebUi::dashboardJson(JsonWriter &w, uint32_t since) {
+  uint32_t historySeq = 0;
+  bool known = false;
+  for (uint8_t i = 0; i < Dashboard::kRing && !known; i += 1) {
+    if (since && _dash.ringVersion[i] == since) {
+      known = true;
+      historySeq = _dash.ringHistorySeq[i];
+    }
+  }
+  auto wanted = [&](uint32_t changedAt) { return !known || changedAt > since; };
+
+  w.beginObject();
+  w.field("ok", true);
+  w.field("v", _dash.version);
+  w.field("full", !known);
+  if (wanted(_dash.changedAt.status)) {
+    const CachedJson &c = cachedStatus(true);
+    w.key("status");
+    w.raw(c.body.c_str(), c.body.length());
+  }
+  if (wanted(_dash.changedAt.time)) {
+    w.key("time");
+    timeJson(w);
+  }
+  if (_schedule && wanted(_dash.changedAt.schedule)) {
+    const CachedJson &c = cachedSchedule();
+    w.key("schedule");
+    w.raw(c.body.c_str(), c.body.length());
+  }
+  if (_history && wanted(_dash.changedAt.history)) {
+    w.key("history");
+    _history->deltaJson(w, historySeq, kDashboardHistoryLimit);
+  }
+  if (_ota && wanted(_dash.changedAt.ota)) {
+    w.key("ota");
+    _ota->statusJson(w, *_cfg, *_time, *_schedule);
+  }
+  w.endObject();
+}
+
+void WebUi::pollEvents() {
+  const EventMarks now = currentEventMarks();
+  // Status carries its payload (it is small and what the page mostly shows); the other topics only say
+  // "changed" and each page refetches that one endpoint.
+  if (now.status != _eventMarks.status) _events.broadcast("status", _statusLite.body);
+  auto ping = [this](const char *event, uint32_t was, uint32_t is) {
+    if (was == is) return;
+    char data[24];
+    snprintf(data, sizeof(data), "{\"v\":%lu}", static_cast<unsigned long>(is));
+    _events.broadcast(event, data);
+  };
+  ping("schedule", _eventMarks.schedule, now.schedule);
+  ping("history", _eventMarks.history, now.history);
+  ping("ota", _eventMarks.ota, now.ota);
+  ping("time", _eventMarks.time, now.time);
+  _eventMarks = now;
+}
 
 void WebUi::sendJson(int code, const String &json) {
   _server.sendHeader("Cache-Control", "no-store");
   _server.send(code, "application/json; charset=utf-8", json);
 }
 
+void WebUi::streamJson(int code, const JsonBody &body) {
+  _server.sendHeader("Cache-Control", "no-store");
+  if (!_server.chunkedResponseModeStart(code, "application/json; charset=utf-8")) {
+    // HTTP/1.0 client: no chunks, the body ends when the connection closes.
+    _server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server.send(code, "application/json; charset=utf-8", "");
+  }
+  ChunkSink sink(_server);
+  {
+    JsonWriter w(sink);
+    body(w);
+  }
+  _server.chunkedResponseFinalize();
+}
+
+String WebUi::renderJson(const JsonBody &body) {
+  String out;
+  renderJson(out, body);
+  return out;
+}
+
+void WebUi::renderJson(String &out, const JsonBody &body) {
+  out = "";
+  StringSink sink(out);
+  JsonWriter w(sink);
+  body(w);
+  w.flush();
+}
+
+// Everything statusJson() shows changes through one of these counters, apart from RSSI (5 dB steps here)
+// and the Wi-Fi status code; the clock-driven parts (override windows, DST) are deadlines in cachedStatus().
+uint32_t WebUi::statusKey(bool lite) {
+  const wl_status_t st = WiFi.status();
+  uint32_t h = kFnvBasis;
+  h = mix(h, _wifi->netState().version);
+  h = mix(h, static_cast<uint32_t>(st));
+  h = mix(h, st == WL_CONNECTED ? static_cast<uint32_t>(WiFi.RSSI() / 5) : 0u);
+  h = mix(h, _relay->version());
+  h = mix(h, appcfg::version());
+  h = mix(h, _schedule ? _schedule->status().version : 0);
+  // Lite has no time object, only the clock's validity matters to it (through the override lookup).
+  h = mix(h, lite ? (_time->isTimeValid() ? 1u : 0u) : _time->version());
+  return h;
+}
+
+const WebUi::CachedJson &WebUi::cachedStatus(bool lite) {
+  CachedJson &c = lite ? _statusLite : _statusFull;
+  const uint32_t key = statusKey(lite);
+  const uint32_t nowUtc = static_cast<uint32_t>(_time->nowUtc());
+  if (c.tag && c.key == key && (!c.validUntilUtc || nowUtc < c.validUntilUtc)) return c;
+
+  uint32_t until = overridesNextBoundary(*_cfg, nowUtc);
+  if (!lite) {
+    const uint32_t dst = static_cast<uint32_t>(_time->nextDstChangeUtc(*_cfg));
+    if (dst > nowUtc && (!until || dst < until)) until = dst;
+  }
+  storeJson(c, key, until, [this, lite](JsonWriter &w) { statusJson(w, lite); });
+  return c;
+}
+
+const WebUi::CachedJson &WebUi::cachedSchedule() {
+  const uint32_t key = _schedule->status().version;
+  if (_scheduleJson.tag && _scheduleJson.key == key) return _scheduleJson;
+  storeJson(_scheduleJson, key, 0, [this](JsonWriter &w) {
+    const ScheduleStatus &st = _schedule->status();
+    w.beginObject();
+    w.field("ok", true);
+    w.beginObject("status");
+    w.field("ok", st.ok);
+    w.field("inHolyTime", st.inHolyTime);
+    w.field("hasZmanim", st.hasZmanim);
+    w.field("hasHolidays", st.hasHolidays);
+    w.field("nextChangeLocal", st.nextChangeLocal);
+    w.field("nextStateOn", st.nextStateOn);
+    w.field("errorCode", scheduleErrorCode(st.errorCode));
+    char errBuf[64];
+    formatScheduleError(st, errBuf, sizeof(errBuf));
+    w.field("error", errBuf);
+    w.endObject();
+    w.key("upcoming");
+    _schedule->upcomingJson(w, 10);
+    w.endObject();
+  });
+  return _scheduleJson;
+}
+
+void WebUi::storeJson(CachedJson &c, uint32_t key, uint32_t validUntilUtc, const JsonBody &body) {
+  renderJson(c.body, body);
+  _renders += 1;
+  c.key = key;
+  c.validUntilUtc = validUntilUtc;
+  c.tag = _renders;
+  snprintf(c.etag, sizeof(c.etag), "\"%08lx%08lx\"", static_cast<unsigned long>(_etagSalt),
+           static_cast<unsigned long>(c.tag));
+}
+
+void WebUi::sendCached(const CachedJson &c) {
+  _server.sendHeader("Cache-Control", "no-cache");
+  _server.sendHeader("ETag", c.etag);
+  if (_server.header("If-None-Match") == c.etag) {
+    _server.send(304);
+    return;
+  }
+  _server.send(200, "application/json; charset=utf-8", c.body);
+}
+
+// The RAM ring as a trace file image (header + records), copied out in small chunks.
+void WebUi::sendTraceRing() {
+  const size_t used = _trace->usedBytes();
+  uint8_t chunk[256];
+  InputTrace::fileHeader(chunk);
+  _server.sendHeader("Cache-Control", "no-store");
+  _server.sendHeader("Content-Disposition", "attachment; filename=\"trace.bin\"");
+  _server.setContentLength(InputTrace::kFileHeaderBytes + used);
+  _server.send(200, "application/octet-stream", "");
+  _server.sendContent(reinterpret_cast<const char *>(chunk), InputTrace::kFileHeaderBytes);
+  size_t offset = 0;
+  while (offset < used) {
+    const size_t n = _trace->copyOut(offset, chunk, sizeof(chunk));
+    if (!n) break;
+    _server.sendContent(reinterpret_cast<const char *>(chunk), n);
+    offset += n;
+  }
+}
+
+void WebUi::sendEmbedded(const EmbeddedAsset &asset, bool immutable) {
+  // Only the gzip bytes are in flash, so a client that cannot inflate them gets a 406 instead.
+  if (!acceptsGzip(_server.header("Accept-Encoding"))) {
+    _server.sendHeader("Vary", "Accept-Encoding");
+    _server.send(406, "text/plain; charset=utf-8", "This page needs a browser that accepts gzip (Accept-Encoding: gzip).");
+    return;
+  }
+  _server.sendHeader("Cache-Control", immutable ? "public, max-age=31536000, immutable" : "no-cache");
+  _server.sendHeader("ETag", asset.etag);
+  _server.sendHeader("Vary", "Accept-Encoding");
+  if (_server.header("If-None-Match") == asset.etag) {
+    _server.send(304);
+    return;
+  }
+  _server.sendHeader("Content-Encoding", "gzip");
+  _server.send_P(200, asset.mime, reinterpret_cast<PGM_P>(asset.gz), asset.gzLen);
+}
+
+// Chrome trace JSON (about:tracing / ui.perfetto.dev), one lane per thread, written event by event as chunks so
+// the response never exists as a whole in RAM. Only the events present when the request started are sent.
+void WebUi::sendSpanTrace() {
+  const uint16_t count = spantrace::count();
+  char buf[224];
+  _server.sendHeader("Cache-Control", "no-store");
+  _server.chunkedResponseModeStart(200, "application/json; charset=utf-8");
+  _server.sendContent("{\"traceEvents\":[");
+  for (uint8_t lane = 0; lane < static_cast<uint8_t>(spantrace::Lane::Count); lane += 1) {
+    const int n = snprintf(buf, sizeof(buf),
+                           "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                           lane ? "," : "", static_cast<unsigned>(lane),
+                           spantrace::laneName(static_cast<spantrace::Lane>(lane)));
+    _server.sendContent(buf, static_cast<size_t>(n));
+  }
+  for (uint16_t i = 0; i < count; i += 1) {
+    const spantrace::Event &e = spantrace::at(i);
+    const unsigned lane = static_cast<unsigned>(e.lane);
+    const unsigned long long ts = spantrace::startUs(e);
+    int n = 0;
+    if (e.instant) {
+      // Relay transitions are drawn across every lane, so what they collided with lines up under them.
+      n = snprintf(buf, sizeof(buf),
+                   ",{\"name\":\"%.64s\",\"cat\":\"%s\",\"ph\":\"i\",\"s\":\"%s\",\"ts\":%llu,\"pid\":1,\"tid\":%u,"
+                   "\"args\":{\"v\":%ld}}",
+                   e.name, spantrace::laneName(e.lane), e.lane == spantrace::Lane::Relay ? "g" : "t", ts, lane,
+                   static_cast<long>(e.arg));
+    } else {
+      n = snprintf(buf, sizeof(buf),
+                   ",{\"name\":\"%.64s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%lu,\"pid\":1,\"tid\":%u,"
+                   "\"args\":{\"v\":%ld}}",
+                   e.name, spantrace::laneName(e.lane), ts, static_cast<unsigned long>(e.durUs), lane,
+                   static_cast<long>(e.arg));
+    }
+    if (n > 0) _server.sendContent(buf, static_cast<size_t>(n) < sizeof(buf) ? static_cast<size_t>(n) : sizeof(buf) - 1);
+  }
+  const int n = snprintf(buf, sizeof(buf),
+                         "],\"displayTimeUnit\":\"ms\",\"otherData\":{\"events\":%u,\"recorded\":%lu,\"capacity\":%u}}",
+                         static_cast<unsigned>(count), static_cast<unsigned long>(spantrace::recorded()),
+                         static_cast<unsigned>(spantrace::kCapacity));
+  _server.sendContent(buf, static_cast<size_t>(n));
+  _server.chunkedResponseFinalize();
+}
+
+void WebUi::route(const char *uri, HTTPMethod method, HttpServer::THandlerFunction handler) {
+  const PerfProfiler::Kind kind = (method == HTTP_GET)    ? PerfProfiler::Kind::HttpGet
+                                  : (method == HTTP_POST) ? PerfProfiler::Kind::HttpPost
+                                                          : PerfProfiler::Kind::Http;
+  const uint8_t slot = _perf->addSlot(uri, kind);
+  if (slot == PerfProfiler::kInvalidSlot) applog::warn(applog::Module::Web, "no profiler slot for %s", uri);
+  const uint8_t heapSource = _heap->addSource(uri);
+  if (heapSource == HeapMonitor::kInvalidSource) applog::warn(applog::Module::Web, "no heap source for %s", uri);
+  const char *methodStr = methodName(method);
+  auto wrapped = [this, slot, heapSource, handler, methodStr, uri]() {
+    _trace->http(methodStr, uri);
+    spantrace::Span span(spantrace::Lane::Http, uri);
+    _heap->sample(heapSource, HeapMonitor::Phase::Before);
+    {
+      PerfProfiler::Scope perfScope(*_perf, slot);
+      handler();
+    }
+    _heap->sample(heapSource, HeapMonitor::Phase::After);
+  };
+  if (strchr(uri, '{')) {
+    _server.on(UriBraces(uri), method, wrapped);
+  } else {
+    _server.on(uri, method, wrapped);
+  }
+}
+
+void WebUi::sendJobAccepted(uint32_t id) {
+  if (!id) {
+    sendJson(503, jsonError("job queue full"));
+    return;
+  }
+  const String path = "/api/jobs/" + String(id);
+  _server.sendHeader("Location", path);
+  sendJson(202, "{\"ok\":true,\"job\":" + String(id) + ",\"state\":\"queued\",\"href\":\"" + path + "\"}");
+}
+
+void WebUi::addUpdateHistory(const String &msg) {
+  if (!_history) return;
+  const uint32_t t = _time && _time->isTimeValid() ? static_cast<uint32_t>(_time->nowLocal(*_cfg)) : 0;
+  _history->add(t, HistoryKind::Update, msg);
+}
+
+void WebUi::finishOtaCheckJob(JobQueue::Job &job, const OtaCheckResult &r) {
+  job.ok = r.ok;
+  job.message = r.message.length() ? r.message : (r.ok ? "" : "check failed");
+  job.result = renderJson([&r](JsonWriter &w) {
+    w.beginObject();
+    w.field("ok", r.ok);
+    w.field("available", r.available);
+    w.field("availableVersion", r.availableVersion);
+    w.field("message", r.message);
+    if (!r.ok && r.message.length()) w.field("error", r.message); // UI expects `error` on failures
+    w.endObject();
+  });
+  if (r.ok) {
+    addUpdateHistory(r.available ? ("נמצא עדכון: " + r.availableVersion) : "בדיקת עדכונים: אין עדכון");
+  } else {
+    addUpdateHistory(r.message.length() ? ("בדיקת עדכונים נכשלה: " + r.message) : "בדיקת עדכונים נכשלה");
+  }
+}
+
+void WebUi::statusJson(JsonWriter &w, bool lite) {
+  w.beginObject();
+  w.field("ok", true);
+  w.field("version", SHABAT_RELAY_VERSION);
+
+  const bool apMode = _wifi->isApMode();
+  const wl_status_t staStatus = WiFi.status();
+  w.beginObject("wifi");
+  w.field("mac", WiFi.macAddress());
+  w.field("apMac", WiFi.softAPmacAddress());
+  w.field("apMode", apMode);
+  w.field("apSsid", _wifi->apSsid());
+  w.key("apIp");
+  if (apMode) {
+    w.value(WiFi.softAPIP());
+  } else {
+    w.value("");
+  }
+  w.field("apClients", apMode ? WiFi.softAPgetStationNum() : 0);
+  w.field("staSsid", _wifi->staSsid());
+  const IPAddress staIp = WiFi.localIP();
+  const bool hasStaIp = !(staIp[0] == 0 && staIp[1] == 0 && staIp[2] == 0 && staIp[3] == 0);
+  w.key("staIp");
+  if (hasStaIp) {
+    w.value(staIp);
+  } else {
+    w.value("");
+  }
+  w.field("rssi", (staStatus == WL_CONNECTED) ? WiFi.RSSI() : 0);
+  w.field("staStatus", wifiStatusToString(staStatus));
+  w.field("staStatusCode", static_cast<int>(staStatus));
+  w.field("ip", _wifi->ipString());
+  w.field("hostName", _wifi->hostName());
+  w.field("staDhcp", _wifi->staDhcp());
+  w.field("staStaticIp", _wifi->staStaticIpString());
+  w.endObject();
+
+  if (!lite) {
+    w.beginObject("time");
+    // No utc/local: this body is cached, the clock comes from /api/time (local = utc + tzOffsetSeconds).
+    w.field("valid", _time->isTimeValid());
+    w.field("tzOffsetSeconds", _time->localOffsetSeconds(*_cfg));
+    w.field("source", _time->timeSource());
+    w.field("lastNtpSyncUtc", static_cast<uint32_t>(_time->lastNtpSyncUtc()));
+    w.field("lastManualSetUtc", static_cast<uint32_t>(_time->lastManualSetUtc()));
+    w.field("ntpResyncMinutes", _cfg->ntpResyncMinutes);
+    w.field("ntpServer", _cfg->ntpServer);
+    w.field("ntpSelectedServer", _time->ntpSelectedServer());
+    w.field("ntpUncertaintyUs", _time->ntpUncertaintyUs());
+    w.field("ntpStratum", _time->ntpStratum());
+    w.field("tzOffsetMinutes", _cfg->tzOffsetMinutes);
+    w.field("dstMode", _cfg->dstMode);
+    w.field("dstActive", _time->dstActive(*_cfg));
+    w.field("nextDstChangeLocal", static_cast<uint32_t>(_time->nextDstChangeLocal(*_cfg)));
+    w.endObject();
+  }
+
+  w.beginObject("relay");
+  const bool coilOn = _relay->isOn();
+  w.field("on", coilOn);
+  w.field("connected", _cfg->relayHolyOnNo ? coilOn : !coilOn);
+  w.field("gpio", _cfg->relayGpio);
+  w.field("activeLow", _cfg->relayActiveLow);
+  w.endObject();
+
+  w.beginObject("operation");
+  w.field("runMode", _cfg->runMode);
+  const uint32_t nowUtc = static_cast<uint32_t>(_time->nowUtc());
+  const ActiveWindowOverride ov = overridesFindActive(*_cfg, nowUtc);
+  w.field("overrideActive", ov.active);
+  w.field("overrideStateOn", ov.stateOn);
+  w.field("overrideEndUtc", ov.active ? ov.endUtc : 0);
+  w.endObject();
+
+  if (_schedule) {
+    const ScheduleStatus &st = _schedule->status();
+    w.beginObject("schedule");
+    w.field("ok", st.ok);
+    w.field("inHolyTime", st.inHolyTime);
+    w.field("hasZmanim", st.hasZmanim);
+    w.field("hasHolidays", st.hasHolidays);
+    w.field("nextChangeLocal", st.nextChangeLocal);
+    w.field("nextStateOn", st.nextStateOn);
+    w.field("errorCode", scheduleErrorCode(st.errorCode));
+    char errBuf[64];
+    formatScheduleError(st, errBuf, sizeof(errBuf));
+    w.field("error", errBuf);
+    w.endObject();
+  }
+  w.endObject();
+}
+
+void WebUi::timeJson(JsonWriter &w) {
+  const time_t nowLocalEpoch = _time->nowLocal(*_cfg);
+  w.beginObject();
+  w.field("ok", true);
+  w.field("valid", _time->isTimeValid());
+  w.field("utc", static_cast<uint32_t>(_time->nowUtc()));
+  w.field("local", static_cast<uint32_t>(nowLocalEpoch));
+  w.field("tzOffsetSeconds", _time->localOffsetSeconds(*_cfg));
+  w.field("source", _time->timeSource());
+  w.field("lastNtpSyncUtc", static_cast<uint32_t>(_time->lastNtpSyncUtc()));
+  w.field("lastManualSetUtc", static_cast<uint32_t>(_time->lastManualSetUtc()));
+  w.field("ntpResyncMinutes", _cfg->ntpResyncMinutes);
+  w.field("ntpServer", _cfg->ntpServer);
+  w.field("ntpSelectedServer", _time->ntpSelectedServer());
+  w.field("ntpOffsetUs", _time->lastNtpOffsetUs());
+  w.field("ntpUncertaintyUs", _time->ntpUncertaintyUs());
+  w.field("ntpStratum", _time->ntpStratum());
+  w.field("tzOffsetMinutes", _cfg->tzOffsetMinutes);
+  w.field("dstMode", _cfg->dstMode);
+  w.field("dstActive", _time->dstActive(*_cfg));
+  w.field("nextDstChangeLocal", static_cast<uint32_t>(_time->nextDstChangeLocal(*_cfg)));
+  time_t nextHebrewDayStart = 0;
+  uint32_t nextHebrewDateKey = 0;
+  const bool hasNextHebrewDay = _zmanim && _zmanim->hasData() &&
+                                computeNextHebrewDayStart(*_cfg, *_zmanim, nowLocalEpoch, nextHebrewDayStart, nextHebrewDateKey);
+  w.field("nextHebrewDateStartLocal", hasNextHebrewDay ? static_cast<uint32_t>(nextHebrewDayStart) : 0);
+  w.field("nextHebrewDateKey", hasNextHebrewDay ? nextHebrewDateKey : 0);
+  w.field("afterHebrewSunset", hasNextHebrewDay && nextHebrewDayStart > 0 && (nowLocalEpoch >= nextHebrewDayStart));
+  w.endObject();
+}
+
 void WebUi::setupRoutes() {
-  _server.on("/status.txt", HTTP_GET, [this]() {
+  route("/status.txt", HTTP_GET, [this]() {
     String status = "OK";
     if (!_time->isTimeValid()) {
       status = "TIME_INVALID";
@@ -173,111 +778,69 @@ void WebUi::setupRoutes() {
     _server.send(200, "text/plain; charset=utf-8", status + "\n");
   });
 
-  _server.on("/api/status", HTTP_GET, [this]() {
-    DynamicJsonDocument doc(2560);
-    doc["ok"] = true;
-    doc["version"] = SHABAT_RELAY_VERSION;
+  route("/api/status", HTTP_GET, [this]() {
     const bool lite = _server.hasArg("lite") && _server.arg("lite") == "1";
+    sendCached(cachedStatus(lite));
+  });
 
-    JsonObject wifi = doc.createNestedObject("wifi");
-    wifi["mac"] = WiFi.macAddress();
-    wifi["apMac"] = WiFi.softAPmacAddress();
-    wifi["apMode"] = _wifi->isApMode();
-    wifi["apSsid"] = _wifi->apSsid();
-    wifi["apIp"] = _wifi->isApMode() ? WiFi.softAPIP().toString() : "";
-    wifi["apClients"] = _wifi->isApMode() ? WiFi.softAPgetStationNum() : 0;
-    wifi["staSsid"] = _wifi->staSsid();
-    const IPAddress staIp = WiFi.localIP();
-    const bool hasStaIp = !(staIp[0] == 0 && staIp[1] == 0 && staIp[2] == 0 && staIp[3] == 0);
-    wifi["staIp"] = hasStaIp ? staIp.toString() : "";
-    wifi["rssi"] = (WiFi.status() == WL_CONNECTED) ? WiFi.RSSI() : 0;
-    wifi["staStatus"] = wifiStatusToString(WiFi.status());
-    wifi["staStatusCode"] = static_cast<int>(WiFi.status());
-    wifi["ip"] = _wifi->ipString();
-    wifi["hostName"] = _wifi->hostName();
-    wifi["staDhcp"] = _wifi->staDhcp();
-    wifi["staStaticIp"] = _wifi->staStaticIpString();
-
-    if (!lite) {
-      JsonObject time = doc.createNestedObject("time");
-      time["valid"] = _time->isTimeValid();
-      time["utc"] = static_cast<uint32_t>(_time->nowUtc());
-      time["local"] = static_cast<uint32_t>(_time->nowLocal(*_cfg));
-      time["tzOffsetSeconds"] = _time->localOffsetSeconds(*_cfg);
-      time["source"] = _time->timeSource();
-      time["lastNtpSyncUtc"] = static_cast<uint32_t>(_time->lastNtpSyncUtc());
-      time["lastManualSetUtc"] = static_cast<uint32_t>(_time->lastManualSetUtc());
-      time["ntpResyncMinutes"] = _cfg->ntpResyncMinutes;
-      time["ntpServer"] = _cfg->ntpServer;
-      time["tzOffsetMinutes"] = _cfg->tzOffsetMinutes;
-      time["dstMode"] = _cfg->dstMode;
-      time["dstActive"] = _time->dstActive(*_cfg);
-      time["nextDstChangeLocal"] = static_cast<uint32_t>(_time->nextDstChangeLocal(*_cfg));
-    }
-
-    JsonObject relay = doc.createNestedObject("relay");
-    const bool coilOn = _relay->isOn();
-    relay["on"] = coilOn;
-    relay["connected"] = _cfg->relayHolyOnNo ? coilOn : !coilOn;
-    relay["gpio"] = _cfg->relayGpio;
-    relay["activeLow"] = _cfg->relayActiveLow;
-
-    JsonObject op = doc.createNestedObject("operation");
-    op["runMode"] = _cfg->runMode;
-    const uint32_t nowUtc = static_cast<uint32_t>(_time->nowUtc());
-    const ActiveWindowOverride ov = overridesFindActive(*_cfg, nowUtc);
-    op["overrideActive"] = ov.active;
-    op["overrideStateOn"] = ov.stateOn;
-    op["overrideEndUtc"] = ov.active ? ov.endUtc : 0;
+  // Server-Sent Events: "hello" and "status" right away, then status / schedule / history / ota / time
+  // whenever they change (see pollEvents()).
+  route("/api/events", HTTP_GET, [this]() {
+    if (!_events.clientCount()) _eventMarks = currentEventMarks();
+    if (!_events.add(_server.client(), millis())) return;
+    _events.sendLatest("hello", "{\"ok\":true}");
+    _events.sendLatest("status", cachedStatus(true).body);
+  });
 
-    if (_schedule) {
-      const ScheduleStatus st = _schedule->status();
-      JsonObject sched = doc.createNestedObject("schedule");
-      sched["ok"] = st.ok;
-      sched["inHolyTime"] = st.inHolyTime;
-      sched["hasZmanim"] = st.hasZmanim;
-      sched["hasHolidays"] = st.hasHolidays;
-      sched["nextChangeLocal"] = st.nextChangeLocal;
-      sched["nextStateOn"] = st.nextStateOn;
-      sched["errorCode"] = st.errorCode;
-      sched["error"] = st.error;
-    }
+  route("/api/http", HTTP_GET, [this]() {
+    streamJson(200, [this](JsonWriter &w) {
+      const HttpMuxServer &mux = _server.getServer();
+      const HttpMuxServer::Stats &s = mux.stats();
+      w.beginObject();
+      w.field("ok", true);
+      w.field("open", mux.open());
+      w.field("maxConnections", HttpMuxServer::kMaxConnections);
+      w.field("maxOpen", s.maxOpen);
+      w.field("accepted", s.accepted);
+      w.field("served", s.served);
+      w.field("rejected", s.rejected);
+      w.field("timedOut", s.timedOut);
+      w.field("closedEarly", s.closedEarly);
+      w.field("oversize", s.oversize);
+      w.field("maxWaitMs", s.maxWaitMs);
+      w.field("requestTimeoutMs", HttpMuxServer::kRequestTimeoutMs);
+      w.field("writeTimeoutMs", HttpMuxClient::kWriteTimeoutMs);
+      w.endObject();
+    });
+  });
 
-    String out;
-    serializeJson(doc, out);
-    sendJson(200, out);
+  route("/api/events/stats", HTTP_GET, [this]() {
+    streamJson(200, [this](JsonWriter &w) {
+      const EventStream::Stats &s = _events.stats();
+      w.beginObject();
+      w.field("ok", true);
+      w.field("clients", _events.clientCount());
+      w.field("maxClients", EventStream::kMaxClients);
+      w.field("accepted", s.accepted);
+      w.field("events", s.events);
+      w.field("sent", s.sent);
+      w.field("bytes", s.bytes);
+      w.field("dropped", s.dropped);
+      w.field("evicted", s.evicted);
+      w.endObject();
+    });
   });
 
-  _server.on("/api/time", HTTP_GET, [this]() {
-    DynamicJsonDocument doc(768);
-    const time_t nowLocalEpoch = _time->nowLocal(*_cfg);
-    doc["ok"] = true;
-    doc["valid"] = _time->isTimeValid();
-    doc["utc"] = static_cast<uint32_t>(_time->nowUtc());
-    doc["local"] = static_cast<uint32_t>(nowLocalEpoch);
-    doc["tzOffsetSeconds"] = _time->localOffsetSeconds(*_cfg);
-    doc["source"] = _time->timeSource();
-    doc["lastNtpSyncUtc"] = static_cast<uint32_t>(_time->lastNtpSyncUtc());
-    doc["lastManualSetUtc"] = static_cast<uint32_t>(_time->lastManualSetUtc());
-    doc["ntpResyncMinutes"] = _cfg->ntpResyncMinutes;
-    doc["ntpServer"] = _cfg->ntpServer;
-    doc["tzOffsetMinutes"] = _cfg->tzOffsetMinutes;
-    doc["dstMode"] = _cfg->dstMode;
-    doc["dstActive"] = _time->dstActive(*_cfg);
-    doc["nextDstChangeLocal"] = static_cast<uint32_t>(_time->nextDstChangeLocal(*_cfg));
-    time_t nextHebrewDayStart = 0;
-    uint32_t nextHebrewDateKey = 0;
-    const bool hasNextHebrewDay = _zmanim && _zmanim->hasData() &&
-                                  computeNextHebrewDayStart(*_cfg, *_zmanim, nowLocalEpoch, nextHebrewDayStart, nextHebrewDateKey);
-    doc["nextHebrewDateStartLocal"] = hasNextHebrewDay ? static_cast<uint32_t>(nextHebrewDayStart) : 0;
-    doc["nextHebrewDateKey"] = hasNextHebrewDay ? nextHebrewDateKey : 0;
-    doc["afterHebrewSunset"] = hasNextHebrewDay && nextHebrewDayStart > 0 && (nowLocalEpoch >= nextHebrewDayStart);
-    String out;
-    serializeJson(doc, out);
-    sendJson(200, out);
+  route("/api/time", HTTP_GET, [this]() { streamJson(200, [this](JsonWriter &w) { timeJson(w); }); });
+
+  // Everything the dashboard shows in one request; see dashboardJson().
+  route("/api/dashboard", HTTP_GET, [this]() {
+    const uint32_t since = _server.hasArg("since") ? strtoul(_server.arg("since").c_str(), nullptr, 10) : 0;
+    advanceDashboard();
+    streamJson(200, [this, since](JsonWriter &w) { dashboardJson(w, since); });
   });
 
-  _server.on("/api/history", HTTP_GET, [this]() {
+  route("/api/history", HTTP_GET, [this]() {
     uint16_t limit = 40;
     if (_server.hasArg("limit")) {
       const int v = _server.arg("limit").toInt();
@@ -287,41 +850,27 @@ void WebUi::setupRoutes() {
       sendJson(200, "{\"ok\":true,\"items\":[]}");
       return;
     }
-    sendJson(200, _history->toJson(limit));
+    streamJson(200, [this, limit](JsonWriter &w) { _history->toJson(w, limit); });
   });
 
-  _server.on("/api/history/clear", HTTP_POST, [this]() {
+  route("/api/history/clear", HTTP_POST, [this]() {
     if (_history) _history->clear();
     sendJson(200, "{\"ok\":true}");
   });
 
-  _server.on("/api/schedule", HTTP_GET, [this]() {
+  route("/api/schedule", HTTP_GET, [this]() {
     if (!_schedule) {
       sendJson(500, jsonError("schedule not initialized"));
       return;
     }
-    const ScheduleStatus st = _schedule->status();
-    DynamicJsonDocument doc(4096);
-    doc["ok"] = true;
-    JsonObject s = doc.createNestedObject("status");
-    s["ok"] = st.ok;
-    s["inHolyTime"] = st.inHolyTime;
-    s["hasZmanim"] = st.hasZmanim;
-    s["hasHolidays"] = st.hasHolidays;
-    s["nowLocal"] = st.nowLocal;
-    s["nextChangeLocal"] = st.nextChangeLocal;
-    s["nextStateOn"] = st.nextStateOn;
-    s["errorCode"] = st.errorCode;
-    s["error"] = st.error;
-    doc["upcoming"] = serialized(_schedule->upcomingJson(10));
-    String out;
-    serializeJson(doc, out);
-    sendJson(200, out);
+    sendCached(cachedSchedule());
   });
 
-  _server.on("/api/config", HTTP_GET, [this]() { sendJson(200, appcfg::toJson(*_cfg)); });
+  route("/api/config", HTTP_GET, [this]() {
+    streamJson(200, [this](JsonWriter &w) { appcfg::toJson(w, *_cfg); });
+  });
 
-	  _server.on("/api/config", HTTP_POST, [this]() {
+  route("/api/config", HTTP_POST, [this]() {
 	    if (!_server.hasArg("plain")) {
 	      sendJson(400, jsonError("missing body"));
 	      return;
@@ -349,6 +898,9 @@ void WebUi::setupRoutes() {
 
 	    *_cfg = next;
     appcfg::save(*_cfg);
+    _trace->setMode(static_cast<InputTrace::Mode>(_cfg->traceMode));
+    _trace->config(*_cfg);
+    applog::setLevels(_cfg->logLevels);
     _relay->applyConfig(*_cfg);
     if (_indicator) _indicator->applyConfig(*_cfg);
     if (_schedule) _schedule->invalidate();
@@ -363,11 +915,12 @@ void WebUi::setupRoutes() {
 	    sendJson(200, networkChanged ? "{\"ok\":true,\"reboot\":true}" : "{\"ok\":true}");
 	    if (networkChanged) {
 	      delay(500);
+	      applog::flush();
 	      ESP.restart();
 	    }
 	  });
 
-  _server.on("/api/time", HTTP_POST, [this]() {
+  route("/api/time", HTTP_POST, [this]() {
     if (!_server.hasArg("plain")) {
       sendJson(400, jsonError("missing body"));
       return;
@@ -387,50 +940,249 @@ void WebUi::setupRoutes() {
     sendJson(200, "{\"ok\":true}");
   });
 
-  _server.on("/api/ntp/sync", HTTP_POST, [this]() {
-    const bool ok = _time->syncNtpNow(*_cfg);
-    sendJson(ok ? 200 : 503, ok ? "{\"ok\":true}" : jsonError("ntp failed"));
+  // The round itself is advanced by TimeKeeper::tick(); the job only starts it and waits for the outcome.
+  route("/api/ntp/sync", HTTP_POST, [this]() {
+    bool started = false;
+    auto step = [this, started](JobQueue::Job &job) mutable {
+      if (!started) {
+        started = true;
+        if (!_time->beginSync(*_cfg)) {
+          job.message = "ntp failed";
+          return true;
+        }
+        job.message = "sampling";
+        return false;
+      }
+      if (_time->syncActive()) return false;
+      job.ok = !_time->lastNtpAttemptFailed();
+      job.message = job.ok ? "synced" : "ntp failed";
+      if (job.ok) job.result = "{\"utc\":" + String(static_cast<uint32_t>(_time->lastNtpSyncUtc())) + "}";
+      return true;
+    };
+    sendJobAccepted(_jobs->enqueue("ntp.sync", kNtpJobMs, step, millis()));
+  });
+
+  route("/api/jobs", HTTP_GET, [this]() {
+    const uint32_t nowMs = millis();
+    streamJson(200, [this, nowMs](JsonWriter &w) { _jobs->listJson(w, nowMs); });
+  });
+
+  route("/api/jobs/{}", HTTP_GET, [this]() {
+    const JobQueue::Job *job = _jobs->find(strtoul(_server.pathArg(0).c_str(), nullptr, 10));
+    if (!job) {
+      sendJson(404, jsonError("unknown job"));
+      return;
+    }
+    const uint32_t nowMs = millis();
+    streamJson(200, [job, nowMs](JsonWriter &w) { JobQueue::jobJson(w, *job, nowMs); });
+  });
+
+  route("/api/ntp/servers", HTTP_GET, [this]() {
+    streamJson(200, [this](JsonWriter &w) { _time->ntpStatsJson(w); });
+  });
+
+  route("/api/sntp", HTTP_GET, [this]() {
+    streamJson(200, [this](JsonWriter &w) { _sntp->statsJson(w, *_cfg, *_time); });
+  });
+
+  route("/api/tasks", HTTP_GET, [this]() {
+    streamJson(200, [this](JsonWriter &w) {
+      static const char *const kPriorityNames[] = {"critical", "high", "normal", "low"};
+      const uint32_t nowMs = millis();
+      w.beginObject();
+      w.field("ok", true);
+      w.field("passes", _tasks->passes());
+      w.field("uptimeMs", nowMs);
+      w.beginArray("tasks");
+      for (uint8_t i = 0; i < _tasks->taskCount(); i += 1) {
+        const TaskScheduler::Task &t = _tasks->task(i);
+        w.beginObject();
+        w.field("name", t.name);
+        w.field("priority", kPriorityNames[static_cast<uint8_t>(t.priority) & 0x03]);
+        w.field("periodMs", t.periodMs);
+        w.field("deadlineMs", t.deadlineMs);
+        w.field("enabled", t.enabled);
+        w.field("runs", t.runs);
+        w.field("missed", t.missed);
+        w.field("maxLatenessMs", t.maxLatenessMs);
+        w.field("lastRunUs", t.lastRunUs);
+        w.field("maxRunUs", t.maxRunUs);
+        w.field("avgRunUs", t.runs ? static_cast<uint32_t>(t.totalRunUs / t.runs) : 0);
+        const int32_t dueIn = static_cast<int32_t>(t.nextRunMs - nowMs);
+        w.field("dueInMs", (dueIn > 0) ? dueIn : 0);
+        w.endObject();
+      }
+      w.endArray();
+      w.endObject();
+    });
+  });
+
+  route("/api/perf", HTTP_GET, [this]() {
+    streamJson(200, [this](JsonWriter &w) {
+      static const char *const kKindNames[] = {"loop", "task", "GET", "POST", "http"};
+      w.beginObject();
+      w.field("ok", true);
+      w.field("windowMs", _perf->sinceResetMs());
+      w.field("cpuMHz", ESP.getCpuFreqMHz());
+      w.beginArray("bucketUpperUs");
+      for (uint8_t b = 0; b < PerfProfiler::kBuckets; b += 1) w.value(PerfProfiler::bucketUpperUs(b));
+      w.endArray();
+
+      w.beginArray("slots");
+      for (uint8_t i = 0; i < _perf->slotCount(); i += 1) {
+        const PerfProfiler::Slot &s = _perf->slot(i);
+        if (!s.count) continue;
+        w.beginObject();
+        w.field("name", s.name);
+        w.field("kind", kKindNames[static_cast<uint8_t>(s.kind) % 5]);
+        w.field("count", s.count);
+        w.field("minUs", s.minUs);
+        w.field("avgUs", static_cast<uint32_t>(s.totalUs / s.count));
+        w.field("maxUs", s.maxUs);
+        // Histogram as "n0,n1,..." (the format the UI parses).
+        char hist[PerfProfiler::kBuckets * 6 + 1];
+        size_t len = 0;
+        for (uint8_t b = 0; b < PerfProfiler::kBuckets; b += 1) {
+          len += snprintf(hist + len, sizeof(hist) - len, b ? ",%u" : "%u", static_cast<unsigned>(s.hist[b]));
+        }
+        w.field("hist", hist);
+        w.endObject();
+      }
+      w.endArray();
+
+      w.beginArray("worst");
+      for (uint8_t i = 0; i < PerfProfiler::kWorstStalls; i += 1) {
+        const PerfProfiler::Stall &st = _perf->stall(i);
+        if (st.slot == PerfProfiler::kInvalidSlot) break;
+        w.beginObject();
+        w.field("source", _perf->slot(st.slot).name);
+        w.field("kind", kKindNames[static_cast<uint8_t>(_perf->slot(st.slot).kind) % 5]);
+        w.field("us", st.us);
+        w.field("atMs", st.atMs);
+        w.endObject();
+      }
+      w.endArray();
+      w.endObject();
+    });
+  });
+
+  route("/api/relay/persist", HTTP_GET, [this]() { streamJson(200, [](JsonWriter &w) { relaystate::statsJson(w); }); });
+
+  route("/api/record/status", HTTP_GET, [this]() {
+    streamJson(200, [this](JsonWriter &w) {
+      static const char *const kModeNames[] = {"off", "ram", "flash"};
+      const InputTrace::Stats &s = _trace->stats();
+      const uint32_t cyclesPerUs = _trace->cyclesPerUs();
+      w.beginObject();
+      w.field("ok", true);
+      w.field("mode", kModeNames[static_cast<uint8_t>(_trace->mode()) % 3]);
+      w.field("ringBytes", InputTrace::kRingBytes);
+      w.field("usedBytes", _trace->usedBytes());
+      w.field("ringRecords", _trace->ringRecords());
+      w.field("records", s.records);
+      w.field("bytes", s.bytes);
+      w.field("dropped", s.dropped);
+      w.field("recordAvgNs", s.records ? static_cast<uint32_t>(s.recordCycles * 1000ULL / cyclesPerUs / s.records) : 0);
+      w.field("recordMaxNs", static_cast<uint32_t>(static_cast<uint64_t>(s.maxRecordCycles) * 1000ULL / cyclesPerUs));
+      w.field("recordTotalUs", static_cast<uint32_t>(s.recordCycles / cyclesPerUs));
+      w.beginObject("file");
+      w.field("bytes", _trace->fileBytes());
+      w.field("oldBytes", _trace->oldFileBytes());
+      w.field("maxBytes", InputTrace::kFileMaxBytes);
+      w.field("flushes", s.flushes);
+      w.field("failures", s.flushFailures);
+      w.field("flushedBytes", s.flushedBytes);
+      w.field("lostBytes", s.lostBytes);
+      w.field("maxFlushUs", s.maxFlushUs);
+      w.endObject();
+      w.endObject();
+    });
+  });
+
+  // ?source=file|old serves the LittleFS copies (Flash mode); the default is the RAM ring.
+  route("/api/record.bin", HTTP_GET, [this]() {
+    const String source = _server.arg("source");
+    if (source != "file" && source != "old") {
+      sendTraceRing();
+      return;
+    }
+    if (source == "file") _trace->flush();
+    File f = LittleFS.open(source == "old" ? InputTrace::kOldFilePath : InputTrace::kFilePath, "r");
+    if (!f) {
+      sendJson(404, jsonError("no trace file"));
+      return;
+    }
+    _server.sendHeader("Cache-Control", "no-store");
+    _server.streamFile(f, "application/octet-stream");
+    f.close();
+  });
+
+  route("/api/record/clear", HTTP_POST, [this]() {
+    _trace->clear();
+    sendJson(200, "{\"ok\":true}");
+  });
+
+  route("/api/log", HTTP_GET, [this]() { streamJson(200, [](JsonWriter &w) { applog::statsJson(w); }); });
+
+  route("/api/trace", HTTP_GET, [this]() { sendSpanTrace(); });
+
+  route("/api/trace/clear", HTTP_POST, [this]() {
+    spantrace::clear();
+    sendJson(200, "{\"ok\":true}");
+  });
+
+  route("/api/heap", HTTP_GET, [this]() { streamJson(200, [this](JsonWriter &w) { _heap->summaryJson(w); }); });
+
+  route("/api/heap/samples", HTTP_GET, [this]() {
+    streamJson(200, [this](JsonWriter &w) { _heap->samplesJson(w); });
   });
 
-  _server.on("/api/ota/status", HTTP_GET, [this]() {
+  route("/api/perf/reset", HTTP_POST, [this]() {
+    _perf->reset();
+    sendJson(200, "{\"ok\":true}");
+  });
+
+  route("/api/ota/status", HTTP_GET, [this]() {
     if (!_ota) {
       sendJson(500, jsonError("ota not initialized"));
       return;
     }
-    sendJson(200, _ota->statusJson(*_cfg, *_time, *_schedule));
+    streamJson(200, [this](JsonWriter &w) { _ota->statusJson(w, *_cfg, *_time, *_schedule); });
   });
 
-  _server.on("/api/ota/check", HTTP_POST, [this]() {
+  // One manifest request (redirect hop) per step.
+  route("/api/ota/check", HTTP_POST, [this]() {
     if (!_ota) {
       sendJson(500, jsonError("ota not initialized"));
       return;
     }
-    const OtaCheckResult r = _ota->checkNow(*_cfg);
-    DynamicJsonDocument doc(768);
-    doc["ok"] = r.ok;
-    doc["available"] = r.available;
-    doc["availableVersion"] = r.availableVersion;
-    doc["message"] = r.message;
-    if (!r.ok && r.message.length()) doc["error"] = r.message; // UI expects `error` on failures
-    String out;
-    serializeJson(doc, out);
-    if (_history) {
-      const uint32_t t = _time && _time->isTimeValid() ? static_cast<uint32_t>(_time->nowLocal(*_cfg)) : 0;
-      if (r.ok) {
-        const String msg = r.available ? ("נמצא עדכון: " + r.availableVersion) : "בדיקת עדכונים: אין עדכון";
-        _history->add(t, HistoryKind::Update, msg);
-      } else {
-        const String msg = r.message.length() ? ("בדיקת עדכונים נכשלה: " + r.message) : "בדיקת עדכונים נכשלה";
-        _history->add(t, HistoryKind::Update, msg);
+    bool started = false;
+    auto step = [this, started](JobQueue::Job &job) mutable {
+      OtaCheckResult r;
+      if (!started) {
+        if (_ota->checkActive()) {
+          job.message = "waiting for the running check";
+          return false;
+        }
+        started = true;
+        if (_ota->beginCheck(*_cfg, r)) {
+          job.message = "fetching manifest";
+          return false;
+        }
+      } else if (!_ota->stepCheck(r)) {
+        job.message = _ota->connectHeld() ? "waiting for the relay change" : "following redirect";
+        return false;
       }
-    }
-    sendJson(r.ok ? 200 : 503, out);
+      finishOtaCheckJob(job, r);
+      return true;
+    };
+    sendJobAccepted(_jobs->enqueue("ota.check", kOtaCheckJobMs, step, millis()));
   });
 
   // Dev helper: set manifest URL to the requester's IP (useful when connected to the device Hotspot).
   // Example: run `python3 -m http.server 8000` on your laptop, then call:
   // POST /api/ota/manifest_from_client {"port":8000,"path":"/ota.json"}
-  _server.on("/api/ota/manifest_from_client", HTTP_POST, [this]() {
+  route("/api/ota/manifest_from_client", HTTP_POST, [this]() {
     uint16_t port = 8000;
     String path = "/ota.json";
 
@@ -463,93 +1215,208 @@ void WebUi::setupRoutes() {
     sendJson(200, out);
   });
 
-  _server.on("/api/ota/update", HTTP_POST, [this]() {
+  // Checks first when no update is known (one hop per step), then downloads the image into flash one range
+  // request or sector per step, resuming an earlier partial download, and reboots into it once verified.
+  route("/api/ota/update", HTTP_POST, [this]() {
     if (!_ota) {
       sendJson(500, jsonError("ota not initialized"));
       return;
     }
 
     if (_schedule) {
-      const ScheduleStatus st = _schedule->status();
+      const ScheduleStatus &st = _schedule->status();
       if (st.ok && st.inHolyTime) {
         sendJson(403, jsonError("blocked by holy time"));
         return;
       }
     }
 
-    // Ensure we have a fresh "available" state before trying to update.
-    // This also provides clearer errors in the UI when the manifest can't be reached.
-    if (!_ota->hasUpdateAvailable()) {
-      const OtaCheckResult chk = _ota->checkNow(*_cfg);
-      if (!chk.ok) {
-        sendJson(503, jsonError(chk.message.length() ? chk.message : "check failed"));
-        return;
+    enum class Stage : uint8_t { Start, Checking, Notice, Download, Install };
+    Stage stage = Stage::Start;
+    uint32_t noticeMs = 0;
+    auto step = [this, stage, noticeMs](JobQueue::Job &job) mutable {
+      OtaCheckResult chk;
+      switch (stage) {
+      case Stage::Start:
+        // Ensure we have a fresh "available" state before trying to update.
+        // This also provides clearer errors in the UI when the manifest can't be reached.
+        if (_ota->hasUpdateAvailable()) {
+          stage = Stage::Notice;
+          return false;
+        }
+        if (_ota->checkActive()) {
+          job.message = "waiting for the running check";
+          return false;
+        }
+        if (!_ota->beginCheck(*_cfg, chk)) {
+          job.message = chk.message.length() ? chk.message : "check failed";
+          return true;
+        }
+        stage = Stage::Checking;
+        job.message = "fetching manifest";
+        return false;
+      case Stage::Checking:
+        if (!_ota->stepCheck(chk)) {
+          job.message = _ota->connectHeld() ? "waiting for the relay change" : "fetching manifest";
+          return false;
+        }
+        if (!chk.ok) {
+          job.message = chk.message.length() ? chk.message : "check failed";
+          return true;
+        }
+        if (!chk.available) {
+          job.ok = true;
+          job.message = "no update available";
+          job.result = "{\"started\":false}";
+          return true;
+        }
+        stage = Stage::Notice;
+        return false;
+      case Stage::Notice:
+        if (_schedule) {
+          const ScheduleStatus &st = _schedule->status();
+          if (st.ok && st.inHolyTime) {
+            job.message = "blocked by holy time";
+            return true;
+          }
+        }
+        // If the manifest URL was set to a temporary local server for a one-off update,
+        // revert it immediately to the built-in default so future checks use the normal path.
+        if (_cfg->otaManifestUrl.startsWith("http://") &&
+            _cfg->otaManifestUrl != String(SHABAT_RELAY_DEFAULT_OTA_URL)) {
+          _cfg->otaManifestUrl = SHABAT_RELAY_DEFAULT_OTA_URL;
+          appcfg::save(*_cfg);
+          addUpdateHistory("קישור העדכון הוחזר לברירת מחדל");
+        }
+        {
+          String message;
+          if (!_ota->beginDownload(message)) {
+            job.message = message;
+            job.result = "{\"started\":false}";
+            return true;
+          }
+          job.message = message;
+        }
+        addUpdateHistory("מתחיל עדכון תוכנה");
+        stage = Stage::Download;
+        job.progress = 5;
+        job.result = "{\"started\":true}";
+        return false;
+      case Stage::Download: {
+        bool ok = false;
+        String message;
+        const bool finished = _ota->stepDownload(ok, message);
+        job.progress = static_cast<uint8_t>(5 + _ota->downloadProgress() * 90 / 100);
+        job.message = message;
+        if (!finished) return false;
+        if (!ok) {
+          job.result = "{\"started\":false}";
+          return true;
+        }
+        stage = Stage::Install;
+        noticeMs = millis();
+        job.progress = 95;
+        job.message = "installing";
+        job.result = "{\"started\":true,\"installing\":true}";
+        return false;
       }
-      if (!chk.available) {
-        sendJson(200, "{\"ok\":true,\"started\":false,\"message\":\"no update available\"}");
-        return;
+      case Stage::Install:
+      default:
+        if (millis() - noticeMs < kOtaFlashNoticeMs) return false;
+        // Only returns when there was nothing to install.
+        job.ok = _ota->installDownloaded();
+        job.message = _ota->lastError();
+        job.result = "{\"started\":false}";
+        return true;
       }
-    }
+    };
+    sendJobAccepted(_jobs->enqueue("ota.update", kOtaUpdateJobMs, step, millis()));
+  });
 
-    // If the manifest URL was set to a temporary local server for a one-off update,
-    // revert it immediately to the built-in default so future checks use the normal path.
-    if (_cfg->otaManifestUrl.startsWith("http://") && _cfg->otaManifestUrl != String(SHABAT_RELAY_DEFAULT_OTA_URL)) {
-      _cfg->otaManifestUrl = SHABAT_RELAY_DEFAULT_OTA_URL;
-      appcfg::save(*_cfg);
-      if (_history) {
-        const uint32_t t = _time && _time->isTimeValid() ? static_cast<uint32_t>(_time->nowLocal(*_cfg)) : 0;
-        _history->add(t, HistoryKind::Update, "קישור העדכון הוחזר לברירת מחדל");
+  route("/api/wifi/status", HTTP_GET, [this]() {
+    streamJson(200, [this](JsonWriter &w) {
+      const bool apMode = _wifi->isApMode();
+      const wl_status_t staStatus = WiFi.status();
+      w.beginObject();
+      w.field("ok", true);
+      w.field("apMode", apMode);
+      w.field("apSsid", _wifi->apSsid());
+      w.key("apIp");
+      if (apMode) {
+        w.value(WiFi.softAPIP());
+      } else {
+        w.value("");
       }
-    }
-
-    sendJson(200, "{\"ok\":true,\"started\":true}");
-    delay(250);
-    if (_history) {
-      const uint32_t t = _time && _time->isTimeValid() ? static_cast<uint32_t>(_time->nowLocal(*_cfg)) : 0;
-      _history->add(t, HistoryKind::Update, "מתחיל עדכון תוכנה");
-    }
-    _ota->updateNow(*_cfg);
-  });
-
-  _server.on("/api/wifi/status", HTTP_GET, [this]() {
-    DynamicJsonDocument doc(640);
-    doc["ok"] = true;
-    doc["apMode"] = _wifi->isApMode();
-    doc["apSsid"] = _wifi->apSsid();
-    doc["apIp"] = _wifi->isApMode() ? WiFi.softAPIP().toString() : "";
-    doc["apClients"] = _wifi->isApMode() ? WiFi.softAPgetStationNum() : 0;
-    doc["apChannel"] = _wifi->apChannel();
-    doc["staSsid"] = _wifi->staSsid();
-    const IPAddress staIp = WiFi.localIP();
-    const bool hasStaIp = !(staIp[0] == 0 && staIp[1] == 0 && staIp[2] == 0 && staIp[3] == 0);
-    doc["staIp"] = hasStaIp ? staIp.toString() : "";
-    doc["rssi"] = (WiFi.status() == WL_CONNECTED) ? WiFi.RSSI() : 0;
-    doc["staStatus"] = wifiStatusToString(WiFi.status());
-    doc["staStatusCode"] = static_cast<int>(WiFi.status());
-    doc["discReason"] = _wifi->lastStaDisconnectReason();
-    doc["discReasonRaw"] = _wifi->lastStaDisconnectReasonRaw();
-    doc["discExpected"] = _wifi->lastStaDisconnectWasExpected();
-    doc["sdkStaStatus"] = _wifi->sdkStationStatusCode();
-    doc["sdkStaStatusText"] = sdkStaStatusToString(_wifi->sdkStationStatusCode());
-    doc["connecting"] = _wifi->connectInProgress();
-    doc["targetSsid"] = _wifi->connectTargetSsid();
-    doc["connectStage"] = _wifi->connectStageCode();
-    doc["targetChannel"] = _wifi->connectTargetChannel();
-    doc["connectSimple"] = _wifi->connectSimpleStaOnly();
-    doc["lastFailCode"] = _wifi->lastConnectFailCode();
-    doc["ip"] = _wifi->ipString();
-    String out;
-    serializeJson(doc, out);
-    sendJson(200, out);
+      w.field("apClients", apMode ? WiFi.softAPgetStationNum() : 0);
+      w.field("apChannel", _wifi->apChannel());
+      w.field("staSsid", _wifi->staSsid());
+      const IPAddress staIp = WiFi.localIP();
+      const bool hasStaIp = !(staIp[0] == 0 && staIp[1] == 0 && staIp[2] == 0 && staIp[3] == 0);
+      w.key("staIp");
+      if (hasStaIp) {
+        w.value(staIp);
+      } else {
+        w.value("");
+      }
+      w.field("rssi", (staStatus == WL_CONNECTED) ? WiFi.RSSI() : 0);
+      w.field("staStatus", wifiStatusToString(staStatus));
+      w.field("staStatusCode", static_cast<int>(staStatus));
+      w.field("discReason", _wifi->lastStaDisconnectReason());
+      w.field("discReasonRaw", _wifi->lastStaDisconnectReasonRaw());
+      w.field("discExpected", _wifi->lastStaDisconnectWasExpected());
+      w.field("sdkStaStatus", _wifi->sdkStationStatusCode());
+      w.field("sdkStaStatusText", sdkStaStatusToString(_wifi->sdkStationStatusCode()));
+      w.field("connecting", _wifi->connectInProgress());
+      w.field("targetSsid", _wifi->connectTargetSsid());
+      w.field("connectStage", _wifi->connectStageCode());
+      w.field("targetChannel", _wifi->connectTargetChannel());
+      w.field("connectSimple", _wifi->connectSimpleStaOnly());
+      w.field("lastFailCode", _wifi->lastConnectFailCode());
+      w.field("ip", _wifi->ipString());
+      w.key("boot"); // this boot's first connection: fast path taken, time to IP / valid clock
+      fastconnect::statsJson(w);
+      w.endObject();
+    });
   });
 
-  _server.on("/api/wifi/log", HTTP_GET, [this]() { sendJson(200, _wifi->logJson()); });
+  route("/api/wifi/log", HTTP_GET, [this]() { streamJson(200, [this](JsonWriter &w) { _wifi->logJson(w); }); });
 
-  _server.on("/api/wifi/scan", HTTP_GET, [this]() { sendJson(200, _wifi->scanJson()); });
+  route("/api/wifi/stats", HTTP_GET, [this]() { streamJson(200, [this](JsonWriter &w) { _wifi->linkStatsJson(w); }); });
 
-  _server.on("/api/wifi/saved", HTTP_GET, [this]() { sendJson(200, _wifi->savedJson()); });
+  // A fresh cached survey is answered at once (?cached=1: whatever the cache holds, never scans). Otherwise,
+  // or with ?refresh=1, a job runs a scan (or joins the one running) and returns the new cache.
+  route("/api/wifi/scan", HTTP_GET, [this]() {
+    const bool refresh = _server.arg("refresh") == "1";
+    if (_server.arg("cached") == "1" || (!refresh && _wifi->scanAgeMs() < WifiController::kScanFreshMs)) {
+      streamJson(200, [this](JsonWriter &w) { _wifi->scanJson(w); });
+      return;
+    }
+    bool started = false;
+    uint32_t seq = 0;
+    auto step = [this, started, seq](JobQueue::Job &job) mutable {
+      if (!started) {
+        started = true;
+        seq = _wifi->scanSeq();
+        _wifi->startScan();
+        job.message = "scanning";
+        return false;
+      }
+      if (_wifi->scanSeq() == seq) {
+        if (_wifi->scanRunning()) return false;
+        job.message = "scan failed";
+        return true;
+      }
+      job.result = renderJson([this](JsonWriter &w) { _wifi->scanJson(w); });
+      job.ok = true;
+      job.message = "";
+      return true;
+    };
+    sendJobAccepted(_jobs->enqueue("wifi.scan", kWifiScanJobMs, step, millis()));
+  });
 
-  _server.on("/api/wifi/save", HTTP_POST, [this]() {
+  route("/api/wifi/saved", HTTP_GET, [this]() { streamJson(200, [this](JsonWriter &w) { _wifi->savedJson(w); }); });
+
+  route("/api/wifi/save", HTTP_POST, [this]() {
     if (!_server.hasArg("plain")) {
       sendJson(400, jsonError("missing body"));
       return;
@@ -592,7 +1459,7 @@ void WebUi::setupRoutes() {
     sendJson(200, out);
   });
 
-  _server.on("/api/wifi/forget", HTTP_POST, [this]() {
+  route("/api/wifi/forget", HTTP_POST, [this]() {
     if (!_server.hasArg("plain")) {
       sendJson(400, jsonError("missing body"));
       return;
@@ -612,7 +1479,7 @@ void WebUi::setupRoutes() {
     sendJson(ok ? 200 : 404, ok ? "{\"ok\":true}" : jsonError("not found"));
   });
 
-  _server.on("/api/wifi/connect", HTTP_POST, [this]() {
+  route("/api/wifi/connect", HTTP_POST, [this]() {
     if (!_server.hasArg("plain")) {
       sendJson(400, jsonError("missing body"));
       return;
@@ -667,7 +1534,7 @@ void WebUi::setupRoutes() {
     sendJson(200, out);
   });
 
-  _server.on("/api/wifi/reset", HTTP_POST, [this]() {
+  route("/api/wifi/reset", HTTP_POST, [this]() {
     if (_history) {
       const uint32_t t = _time && _time->isTimeValid() ? static_cast<uint32_t>(_time->nowLocal(*_cfg)) : 0;
       _history->add(t, HistoryKind::Network, "איפוס Wi‑Fi");
@@ -677,41 +1544,41 @@ void WebUi::setupRoutes() {
     _wifi->resetAndReboot();
   });
 
-  _server.on("/api/factory_reset", HTTP_POST, [this]() {
+  route("/api/factory_reset", HTTP_POST, [this]() {
     sendJson(200, "{\"ok\":true,\"reboot\":true}");
     delay(250);
 
-    Serial.println(F("[reset] factory reset"));
+    applog::info(applog::Module::Reset, "factory reset");
 
     // Wipe user data in LittleFS (config, wifi list, history, OTA state, relay state, etc.)
     LittleFS.format();
+    relaystate::forget();
+    fastconnect::forget();
 
     // Also wipe SDK Wi‑Fi credentials.
     WiFi.disconnect(true);
     ESP.eraseConfig();
     delay(250);
+    applog::flush();
     ESP.restart();
   });
 
-  // Static UI (ESP8266WebServer::serveStatic returns void in this core)
-  _server.on("/", HTTP_GET, [this]() {
-    _server.sendHeader("Cache-Control", "no-store");
-    _server.send_P(200, "text/html; charset=utf-8", kEmbeddedIndexHtml);
-  });
-
-  _server.on("/styles.css", HTTP_GET, [this]() {
-    _server.sendHeader("Cache-Control", "no-store");
-    _server.send_P(200, "text/css; charset=utf-8", kEmbeddedStylesCss);
-  });
-
-  _server.on("/app.js", HTTP_GET, [this]() {
-    _server.sendHeader("Cache-Control", "no-store");
-    _server.send_P(200, "application/javascript; charset=utf-8", kEmbeddedAppJs);
-  });
-
-  _server.on("/favicon.ico", HTTP_GET, [this]() { _server.send(204); });
-
-  _server.onNotFound([this]() {
+  // Static UI (ESP8266WebServer::serveStatic returns void in this core). The page is revalidated on every
+  // load (usually a 304); the CSS/JS it references have the content hash in the URL and are cached for good.
+  route("/", HTTP_GET, [this]() { sendEmbedded(kEmbeddedIndexHtml, false); });
+  route(kEmbeddedStylesCss.path, HTTP_GET, [this]() { sendEmbedded(kEmbeddedStylesCss, true); });
+  route(kEmbeddedAppJs.path, HTTP_GET, [this]() { sendEmbedded(kEmbeddedAppJs, true); });
+  // Unhashed names, for pages cached before the hashed URLs existed.
+  route("/styles.css", HTTP_GET, [this]() { sendEmbedded(kEmbeddedStylesCss, false); });
+  route("/app.js", HTTP_GET, [this]() { sendEmbedded(kEmbeddedAppJs, false); });
+
+  route("/favicon.ico", HTTP_GET, [this]() { _server.send(204); });
+
+  const uint8_t notFoundSlot = _perf->addSlot("(not found)", PerfProfiler::Kind::Http);
+  _server.onNotFound([this, notFoundSlot]() {
+    _trace->http(methodName(_server.method()), _server.uri().c_str());
+    spantrace::Span span(spantrace::Lane::Http, "(not found)");
+    PerfProfiler::Scope perfScope(*_perf, notFoundSlot);
     if (_server.uri().startsWith("/api/")) {
       sendJson(404, jsonError("not found"));
       return;
@@ -3,19 +3,38 @@
 #include <Arduino.h>
 #include <ESP8266WebServer.h>
 
+#include <functional>
+
 #include "AppConfig.h"
+#include "EventStream.h"
+#include "HttpMux.h"
 #include "RelayController.h"
 #include "ScheduleEngine.h"
+#include "SntpServer.h"
+#include "TaskScheduler.h"
 #include "TimeKeeper.h"
 #include "WifiController.h"
 #include "HolidayDb.h"
+#include "HeapMonitor.h"
 #include "HistoryLog.h"
+#include "InputTrace.h"
+#include "JobQueue.h"
 #include "OtaUpdater.h"
+#include "PerfProfiler.h"
 #include "StatusIndicator.h"
 #include "ZmanimDb.h"
 
+struct EmbeddedAsset;
+class JsonWriter;
+
+// The stock request handling, fed by HttpMuxServer (complete requests only, several connections at once).
+using HttpServer = esp8266webserver::ESP8266WebServerTemplate<HttpMuxServer>;
+
 class WebUi {
 public:
+  // route() calls in setupRoutes() (50), with a little room; the profiler and heap tables are sized from it.
+  static constexpr uint8_t kMaxRoutes = 52;
+
   explicit WebUi(uint16_t port = 80);
 
   void begin(AppConfig &cfg,
@@ -27,11 +46,18 @@ public:
              ScheduleEngine &schedule,
              OtaUpdater &ota,
              StatusIndicator &indicator,
-             HistoryLog &history);
+             HistoryLog &history,
+             SntpServer &sntp,
+             TaskScheduler &tasks,
+             JobQueue &jobs,
+             PerfProfiler &perf,
+             HeapMonitor &heap,
+             InputTrace &trace);
   void tick();
 
 private:
-  ESP8266WebServer _server;
+  HttpServer _server;
+  EventStream _events;
 
   AppConfig *_cfg = nullptr;
   WifiController *_wifi = nullptr;
@@ -43,7 +69,89 @@ private:
   OtaUpdater *_ota = nullptr;
   StatusIndicator *_indicator = nullptr;
   HistoryLog *_history = nullptr;
+  SntpServer *_sntp = nullptr;
+  TaskScheduler *_tasks = nullptr;
+  JobQueue *_jobs = nullptr;
+  PerfProfiler *_perf = nullptr;
+  HeapMonitor *_heap = nullptr;
+  InputTrace *_trace = nullptr;
+
+  // Last values pushed on /api/events, per topic (see pollEvents()).
+  struct EventMarks {
+    uint32_t status = 0;
+    uint32_t schedule = 0;
+    uint32_t history = 0;
+    uint32_t ota = 0;
+    uint32_t time = 0;
+  };
+  EventMarks _eventMarks;
+  uint32_t _lastEventPollMs = 0;
+
+  // A rendered GET body, served again (or answered 304) until the subsystem versions it was built from
+  // move or its deadline passes. See cachedStatus().
+  struct CachedJson {
+    uint32_t key = 0;
+    uint32_t validUntilUtc = 0; // 0 = no deadline
+    uint32_t tag = 0;           // render number, 0 = never rendered
+    String body;
+    char etag[20] = "";
+  };
+  CachedJson _statusFull;
+  CachedJson _statusLite;
+  CachedJson _scheduleJson;
+  uint32_t _etagSalt = 0; // per boot, so a tag from before a reboot never matches
+  uint32_t _renders = 0;
+
+  // /api/dashboard?since=<version>: the version moves whenever one of the EventMarks does, and each
+  // section remembers the version it last changed at. The ring maps recent versions to the history
+  // cursor handed out with them, so `since` alone is enough to send only the new history entries.
+  struct Dashboard {
+    static constexpr uint8_t kRing = 8;
+    uint32_t version = 0;
+    EventMarks marks;
+    EventMarks changedAt; // per topic: the version it last changed at
+    uint32_t ringVersion[kRing] = {};
+    uint32_t ringHistorySeq[kRing] = {};
+    uint8_t ringNext = 0;
+  };
+  Dashboard _dash;
 
   void setupRoutes();
+  // Registers a handler wrapped in a PerfProfiler scope and HeapMonitor before/after samples
+  // (one slot/source per uri+method); the request line goes to the input trace. A uri with "{}" matches
+  // any path segment there, read back with _server.pathArg().
+  void route(const char *uri, HTTPMethod method, HttpServer::THandlerFunction handler);
+  using JsonBody = std::function<void(JsonWriter &)>;
+
   void sendJson(int code, const String &json);
+  // Chunked response written by `body` through a JsonWriter, so no document or body String is built.
+  void streamJson(int code, const JsonBody &body);
+  // `body` as a String (SSE messages go out in one piece).
+  static String renderJson(const JsonBody &body);
+  // Same, into `out` (its capacity is kept).
+  static void renderJson(String &out, const JsonBody &body);
+  // 202 {ok, job, state} + Location of the job, or 503 when enqueue() returned 0.
+  void sendJobAccepted(uint32_t id);
+  void addUpdateHistory(const String &msg);
+  // Ends an OTA check job: result body, message and the history entry.
+  void finishOtaCheckJob(JobQueue::Job &job, const OtaCheckResult &r);
+  void sendTraceRing();
+  void sendSpanTrace();
+  void statusJson(JsonWriter &w, bool lite);
+  // Combined change counters of what statusJson() reads.
+  uint32_t statusKey(bool lite);
+  const CachedJson &cachedStatus(bool lite);
+  const CachedJson &cachedSchedule();
+  void storeJson(CachedJson &c, uint32_t key, uint32_t validUntilUtc, const JsonBody &body);
+  // ETag + no-cache; 304 when the browser's If-None-Match matches.
+  void sendCached(const CachedJson &c);
+  EventMarks currentEventMarks();
+  void timeJson(JsonWriter &w);
+  // Moves the dashboard version if anything changed since the last request.
+  void advanceDashboard();
+  void dashboardJson(JsonWriter &w, uint32_t since);
+  // Pushes what changed since the last call to the /api/events clients.
+  void pollEvents();
+  // Gzipped bytes with their ETag; 304 when the browser already has them. `immutable` for hashed URLs.
+  void sendEmbedded(const EmbeddedAsset &asset, bool immutable);
 };
@@ -3,11 +3,17 @@
 #include <ArduinoJson.h>
 #include <ESP8266WiFi.h>
 #include <LittleFS.h>
+#include <lwip/dhcp.h>
+#include <lwip/netif.h>
+#include <utility>
 
 extern "C" {
 #include "user_interface.h"
 }
 
+#include "AppLog.h"
+#include "JsonWriter.h"
+
 namespace {
 constexpr uint32_t kStaConnectTimeoutMs = 15UL * 1000UL;
 constexpr uint32_t kPerSavedNetworkTimeoutMs = 12UL * 1000UL;
@@ -16,9 +22,22 @@ constexpr uint32_t kStopApAfterNoClientsMs = 30UL * 1000UL;
 constexpr uint32_t kPendingConnectTimeoutMs = 90UL * 1000UL;
 constexpr uint32_t kConnectDeferMs = 900UL;
 constexpr uint32_t kConnectScanTimeoutMs = 8000UL;
+constexpr uint32_t kFastConnectTimeoutMs = 4000UL;
+constexpr uint32_t kScanTimeoutMs = 15000UL; // a scan that never reports back is given up
+// requestConnect() takes channel/BSSID hints from cache entries up to this old instead of scanning.
+constexpr uint32_t kConnectHintMaxAgeMs = 120UL * 1000UL;
 constexpr uint32_t kConnectRetryAfterMs = 9000UL;
 constexpr uint32_t kSdkStaPollMs = 350UL;
+constexpr uint32_t kBootScanMs = 4000UL;         // boot waits this long to see what is in range
+constexpr uint32_t kReconnectEveryMs = 30UL * 1000UL;
+constexpr uint32_t kStatsFlushMs = 60UL * 60UL * 1000UL; // history-only changes reach flash at most hourly
+constexpr uint32_t kRssiSampleMs = 5000UL;
+constexpr int32_t kRoamRssiDbm = -75;
+constexpr uint32_t kRoamLowForMs = 60UL * 1000UL;
+constexpr uint32_t kRoamCheckEveryMs = 10UL * 60UL * 1000UL;
+constexpr int32_t kRoamHysteresisDb = 8; // a candidate must beat the current link by this much
 constexpr const char *kWifiStorePath = "/wifi.json";
+constexpr uint32_t kLeaseRefreshMs = 60UL * 1000UL; // RTC lease age; RTC writes cost no flash wear
 
 const char *wifiStatusToString(wl_status_t st) {
   switch (st) {
@@ -58,6 +77,19 @@ String defaultSuffix4() {
 }
 
 bool isZeroIp(const IPAddress &ip) { return ip[0] == 0 && ip[1] == 0 && ip[2] == 0 && ip[3] == 0; }
+
+// Length and age of the lease the station's DHCP client holds; false while it holds none (static
+// config, or DHCP still negotiating). The soft AP runs no DHCP client, so the first bound netif is ours.
+bool stationDhcpLease(uint32_t &leaseS, uint32_t &ageS) {
+  for (netif *n = netif_list; n; n = n->next) {
+    if (!netif_dhcp_data(n) || !dhcp_supplied_address(n)) continue;
+    const dhcp *d = netif_dhcp_data(n);
+    leaseS = d->offered_t0_lease;
+    ageS = (static_cast<uint32_t>(d->lease_used) + 1) * DHCP_COARSE_TIMER_SECS; // counted in whole ticks
+    return true;
+  }
+  return false;
+}
 } // namespace
 
 int WifiController::findSavedIndex(const String &ssid) const {
@@ -75,7 +107,7 @@ void WifiController::loadSaved() {
   File file = LittleFS.open(kWifiStorePath, "r");
   if (!file) return;
 
-  DynamicJsonDocument doc(2048);
+  DynamicJsonDocument doc(3072);
   DeserializationError err = deserializeJson(doc, file);
   file.close();
   if (err) return;
@@ -89,22 +121,44 @@ void WifiController::loadSaved() {
     const String ssid = n["ssid"] | "";
     const String password = n["password"] | "";
     if (!ssid.length()) continue;
-    _saved[_savedCount].ssid = ssid;
-    _saved[_savedCount].password = password;
+    SavedNetwork &net = _saved[_savedCount];
+    net = SavedNetwork();
+    net.ssid = ssid;
+    net.password = password;
+    JsonObject st = n["stats"];
+    if (!st.isNull()) {
+      net.attempts = st["attempts"] | 0;
+      net.successes = st["successes"] | 0;
+      net.drops = st["drops"] | 0;
+      net.roams = st["roams"] | 0;
+      net.connectedS = st["upS"] | 0;
+      net.avgRssi = st["rssi"] | 0;
+    }
     _savedCount += 1;
   }
 }
 
-bool WifiController::saveSaved() const {
-  DynamicJsonDocument doc(2048);
+bool WifiController::saveSaved() {
+  foldLinkTime(millis());
+  DynamicJsonDocument doc(3072);
   doc["last"] = _lastSavedSsid;
   JsonArray nets = doc.createNestedArray("nets");
   for (uint8_t i = 0; i < _savedCount; i += 1) {
+    const SavedNetwork &net = _saved[i];
     JsonObject n = nets.createNestedObject();
-    n["ssid"] = _saved[i].ssid;
-    n["password"] = _saved[i].password;
+    n["ssid"] = net.ssid;
+    n["password"] = net.password;
+    JsonObject st = n.createNestedObject("stats");
+    st["attempts"] = net.attempts;
+    st["successes"] = net.successes;
+    st["drops"] = net.drops;
+    st["roams"] = net.roams;
+    st["upS"] = net.connectedS;
+    st["rssi"] = net.avgRssi;
   }
 
+  _statsDirty = false;
+  _statsSavedMs = millis();
   File file = LittleFS.open(kWifiStorePath, "w");
   if (!file) return false;
   const size_t written = serializeJson(doc, file);
@@ -112,6 +166,177 @@ bool WifiController::saveSaved() const {
   return written > 0;
 }
 
+int32_t WifiController::savedScore(uint8_t idx, int32_t rssi) const {
+  const SavedNetwork &net = _saved[idx];
+  // Laplace-smoothed success rate in percent: an unknown network starts at 50 (no bonus).
+  const uint32_t successes = (net.successes < net.attempts) ? net.successes : net.attempts;
+  const int32_t rate = static_cast<int32_t>((successes + 1) * 100 / (net.attempts + 2U));
+  return rssi + (rate - 50) / 5;
+}
+
+void WifiController::rankSaved(uint8_t *order) const {
+  int32_t scores[kMaxSavedNetworks];
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < _savedCount; i += 1) {
+    const ScanEntry *seen = findScan(_saved[i].ssid, kScanFreshMs);
+    if (!seen) continue;
+    const int32_t score = savedScore(i, seen->rssi);
+    uint8_t j = n;
+    for (; j > 0 && scores[j - 1] < score; j -= 1) {
+      scores[j] = scores[j - 1];
+      order[j] = order[j - 1];
+    }
+    scores[j] = score;
+    order[j] = i;
+    n += 1;
+  }
+  // Not heard (hidden SSID, out of range, or no fresh scan): last successful first, then list order.
+  const int last = findSavedIndex(_lastSavedSsid);
+  if (last >= 0 && !findScan(_lastSavedSsid, kScanFreshMs)) {
+    order[n] = static_cast<uint8_t>(last);
+    n += 1;
+  }
+  for (uint8_t i = 0; i < _savedCount; i += 1) {
+    if (static_cast<int>(i) == last || findScan(_saved[i].ssid, kScanFreshMs)) continue;
+    order[n] = i;
+    n += 1;
+  }
+}
+
+void WifiController::beginSaved(uint8_t idx, const ScanEntry *seen) {
+  const SavedNetwork &net = _saved[idx];
+  WiFi.hostname(_hostName);
+  if (_staDhcp) {
+    WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+  } else if (!isZeroIp(_staIp) && !isZeroIp(_staGateway) && !isZeroIp(_staSubnet)) {
+    WiFi.config(_staIp, _staGateway, _staSubnet, _staDns1, _staDns2);
+  }
+  if (seen && seen->channel > 0) {
+    WiFi.begin(net.ssid.c_str(), net.password.c_str(), seen->channel, seen->bssid);
+  } else {
+    WiFi.begin(net.ssid.c_str(), net.password.c_str());
+  }
+  noteAttempt(idx);
+  _attemptSsid = net.ssid;
+}
+
+void WifiController::noteAttempt(uint8_t idx) {
+  SavedNetwork &net = _saved[idx];
+  net.attempts += 1;
+  if (net.attempts >= kHistoryWindow) {
+    net.attempts /= 2;
+    net.successes /= 2;
+  }
+  _statsDirty = true;
+}
+
+void WifiController::trackLink(uint32_t nowMs) {
+  if (_net.staConnected && !_linkSsid.length()) {
+    _linkSsid = WiFi.SSID();
+    _linkSinceMs = nowMs;
+    _linkRssi = 0;
+    _rssiSampleMs = 0;
+    _lowRssiSinceMs = 0;
+    _roamScanning = false;
+    const int idx = findSavedIndex(_linkSsid);
+    if (idx >= 0) {
+      // A connect we did not start (SDK auto-reconnect) still counts as an attempt that worked.
+      if (_attemptSsid != _linkSsid) noteAttempt(static_cast<uint8_t>(idx));
+      _saved[idx].successes += 1;
+      _statsDirty = true;
+    }
+    _attemptSsid = "";
+  } else if (!_net.staConnected && _linkSsid.length()) {
+    foldLinkTime(nowMs);
+    const int idx = findSavedIndex(_linkSsid);
+    if (idx >= 0 && !_lastStaDiscExpected) {
+      _saved[idx].drops += 1;
+      _statsDirty = true;
+    }
+    _linkSsid = "";
+  }
+}
+
+void WifiController::foldLinkTime(uint32_t nowMs) {
+  if (!_linkSsid.length()) return;
+  const uint32_t secs = (nowMs - _linkSinceMs) / 1000UL;
+  if (!secs) return;
+  _linkSinceMs += secs * 1000UL;
+  const int idx = findSavedIndex(_linkSsid);
+  if (idx < 0) return;
+  _saved[idx].connectedS += secs;
+  _statsDirty = true;
+}
+
+void WifiController::tickRoam(uint32_t nowMs) {
+  if (_rssiSampleMs && nowMs - _rssiSampleMs < kRssiSampleMs) return;
+  _rssiSampleMs = nowMs;
+  const int32_t rssi = WiFi.RSSI();
+  if (rssi >= 0) return; // 31 = no reading
+  _linkRssi = _linkRssi ? (_linkRssi * 3 + rssi) / 4 : rssi;
+  const int idx = findSavedIndex(_linkSsid);
+  if (idx >= 0) {
+    SavedNetwork &net = _saved[idx];
+    net.avgRssi = static_cast<int8_t>(net.avgRssi ? (net.avgRssi * 7 + rssi) / 8 : rssi);
+  }
+
+  if (_linkRssi >= kRoamRssiDbm) {
+    _lowRssiSinceMs = 0;
+    _roamScanning = false;
+    return;
+  }
+  if (!_lowRssiSinceMs) _lowRssiSinceMs = nowMs;
+  if (nowMs - _lowRssiSinceMs < kRoamLowForMs) return;
+  if (_roamCheckMs && nowMs - _roamCheckMs < kRoamCheckEveryMs) return;
+  // Moving would change the channel under anyone on the setup hotspot.
+  if (_apMode && WiFi.softAPgetStationNum() > 0) return;
+
+  if (!_roamScanning) {
+    _roamScanning = true;
+    _roamScanSeq = _scanSeq;
+    if (!_scanRunning) startScan();
+    return;
+  }
+  if (_scanSeq == _roamScanSeq && _scanRunning) return;
+  _roamScanning = false;
+  _roamCheckMs = nowMs;
+  if (_scanSeq == _roamScanSeq) return; // the scan was lost; look again next time
+
+  const uint8_t *cur = WiFi.BSSID();
+  int best = -1;
+  int32_t bestScore = 0;
+  const ScanEntry *bestSeen = nullptr;
+  for (uint8_t i = 0; i < _savedCount; i += 1) {
+    const ScanEntry *seen = findScan(_saved[i].ssid, kScanFreshMs);
+    if (!seen) continue;
+    // The cache keeps the strongest BSSID per SSID; when that is our own AP there is nothing better here.
+    if (seen->ssid == _linkSsid && cur && memcmp(seen->bssid, cur, sizeof(seen->bssid)) == 0) continue;
+    const int32_t score = savedScore(i, seen->rssi);
+    if (best < 0 || score > bestScore) {
+      best = static_cast<int>(i);
+      bestScore = score;
+      bestSeen = seen;
+    }
+  }
+  const int32_t current = (idx >= 0) ? savedScore(static_cast<uint8_t>(idx), _linkRssi) : _linkRssi;
+  if (best < 0 || bestScore < current + kRoamHysteresisDb) {
+    applog::debug(applog::Module::Net, "roam check: staying on ssid=%s rssi=%ld", _linkSsid.c_str(),
+                  static_cast<long>(_linkRssi));
+    return;
+  }
+
+  applog::info(applog::Module::Net, "roam ssid=%s rssi=%ld -> ssid=%s ch=%ld rssi=%ld", _linkSsid.c_str(),
+               static_cast<long>(_linkRssi), bestSeen->ssid.c_str(), static_cast<long>(bestSeen->channel),
+               static_cast<long>(bestSeen->rssi));
+  if (idx >= 0) _saved[idx].roams += 1;
+  _roamCount += 1;
+  _lastRoamMs = nowMs;
+  _lowRssiSinceMs = 0;
+  _lastReconnectAttemptMs = nowMs;
+  expectStaDisconnect();
+  beginSaved(static_cast<uint8_t>(best), bestSeen);
+}
+
 void WifiController::rememberOnSuccess(const String &ssid, const String &password) {
   if (!ssid.length()) return;
   int idx = findSavedIndex(ssid);
@@ -127,6 +352,7 @@ void WifiController::rememberOnSuccess(const String &ssid, const String &passwor
     }
   }
 
+  if (_saved[idx].ssid != ssid) _saved[idx] = SavedNetwork();
   _saved[idx].ssid = ssid;
   _saved[idx].password = password;
   _lastSavedSsid = ssid;
@@ -169,47 +395,58 @@ void WifiController::begin(const AppConfig &cfg) {
   _lastReconnectAttemptMs = millis();
 
   loadSaved();
-  Serial.printf("[net] savedNetworks=%u\n", static_cast<unsigned>(_savedCount));
+  applog::info(applog::Module::Net, "savedNetworks=%u", static_cast<unsigned>(_savedCount));
 
-  // Track disconnect reason codes for debugging (much more informative than wl_status_t alone).
-  _staDiscHandler = WiFi.onStationModeDisconnected([this](const WiFiEventStationModeDisconnected &evt) {
-    const uint16_t reason = static_cast<uint16_t>(evt.reason);
-    const bool expected = (_staDiscExpectedCount > 0) && (reason == 8 /*ASSOC_LEAVE*/ || reason == 3 /*AUTH_LEAVE*/);
-    if (expected) _staDiscExpectedCount -= 1;
+  registerEventHandlers();
 
-    _lastStaDiscReason = reason;
-    _lastStaDiscExpected = expected;
-    if (!expected) _lastStaDiscReasonReal = reason;
-    _lastStaDiscReasonMs = millis();
-    Serial.printf("[net] sta disconnected reason=%u%s\n", static_cast<unsigned>(reason), expected ? " (expected)" : "");
-    logWifiEvent();
-  });
+  fastconnect::Lease lease;
+  const fastconnect::Source leaseFrom = fastconnect::load(lease);
 
   // Prefer our saved list; if empty, fall back to SDK-stored creds (WiFi.begin()).
   if (_savedCount > 0) {
     bool apStarted = false;
     const uint32_t totalStart = millis();
-    // Try last successful SSID first.
+    // The last successful SSID gets the remembered-link fast path.
     int startIdx = findSavedIndex(_lastSavedSsid);
+    if (startIdx >= 0 && leaseFrom != fastconnect::Source::None &&
+        lease.ssidHash == fastconnect::ssidHash(_saved[startIdx].ssid)) {
+      const SavedNetwork &net = _saved[startIdx];
+      if (tryFastConnect(net.ssid, net.password, lease, leaseFrom == fastconnect::Source::Rtc)) return;
+    }
+    // With more than one candidate, look before choosing: the strongest network with a good history
+    // goes first.
+    if (_savedCount > 1 && startScan()) {
+      while (_scanRunning && (millis() - _scanStartMs) < kBootScanMs) {
+        delay(50);
+        pollScan();
+      }
+      if (_scanRunning) {
+        applog::warn(applog::Module::Net, "boot scan took too long");
+        WiFi.scanDelete();
+        _scanRunning = false;
+      }
+    }
+    uint8_t order[kMaxSavedNetworks];
+    rankSaved(order);
     for (uint8_t pass = 0; pass < _savedCount; pass += 1) {
-      const uint8_t i = (startIdx >= 0) ? static_cast<uint8_t>((startIdx + pass) % _savedCount) : pass;
+      const uint8_t i = order[pass];
       const String ssid = _saved[i].ssid;
-      const String password = _saved[i].password;
       if (!ssid.length()) continue;
+      const ScanEntry *seen = findScan(ssid, kScanFreshMs);
 
       // If we already started the AP for setup, keep it running during retries.
       WiFi.mode(apStarted ? WIFI_AP_STA : WIFI_STA);
       expectStaDisconnect();
       WiFi.disconnect();
       delay(40);
-      WiFi.hostname(_hostName);
-      if (_staDhcp) {
-        WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
-      } else if (!isZeroIp(_staIp) && !isZeroIp(_staGateway) && !isZeroIp(_staSubnet)) {
-        WiFi.config(_staIp, _staGateway, _staSubnet, _staDns1, _staDns2);
+      beginSaved(i, seen);
+      if (seen) {
+        applog::info(applog::Module::Net, "trying ssid=%s ch=%ld rssi=%ld score=%ld", ssid.c_str(),
+                     static_cast<long>(seen->channel), static_cast<long>(seen->rssi),
+                     static_cast<long>(savedScore(i, seen->rssi)));
+      } else {
+        applog::info(applog::Module::Net, "trying ssid=%s", ssid.c_str());
       }
-      WiFi.begin(ssid.c_str(), password.c_str());
-      Serial.printf("[net] trying ssid=%s\n", ssid.c_str());
 
       const uint32_t start = millis();
       while (WiFi.status() != WL_CONNECTED && (millis() - start) < kPerSavedNetworkTimeoutMs) {
@@ -224,16 +461,17 @@ void WifiController::begin(const AppConfig &cfg) {
 
       if (WiFi.status() == WL_CONNECTED) {
         _lastStaOkMs = millis();
+        fastconnect::notePath(fastconnect::Path::Full);
         _lastSavedSsid = ssid;
         saveSaved();
-        Serial.printf("[net] connected ssid=%s ip=%s rssi=%d\n",
+        applog::info(applog::Module::Net, "connected ssid=%s ip=%s rssi=%d",
                       WiFi.SSID().c_str(),
                       WiFi.localIP().toString().c_str(),
                       WiFi.RSSI());
         return;
       }
 
-      Serial.printf("[net] failed ssid=%s status=%s(%d)\n",
+      applog::warn(applog::Module::Net, "failed ssid=%s status=%s(%d)",
                     ssid.c_str(),
                     wifiStatusToString(WiFi.status()),
                     static_cast<int>(WiFi.status()));
@@ -241,22 +479,12 @@ void WifiController::begin(const AppConfig &cfg) {
 
     if (!apStarted) startAp();
 
-    // Keep trying the last known-good SSID in the background (auto-reconnect),
-    // so if the router appears later we still have a good target.
-    const int lastIdx = findSavedIndex(_lastSavedSsid);
-    if (lastIdx >= 0) {
-      const String ssid = _saved[lastIdx].ssid;
-      const String password = _saved[lastIdx].password;
-      if (ssid.length()) {
-        WiFi.hostname(_hostName);
-        if (_staDhcp) {
-          WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
-        } else if (!isZeroIp(_staIp) && !isZeroIp(_staGateway) && !isZeroIp(_staSubnet)) {
-          WiFi.config(_staIp, _staGateway, _staSubnet, _staDns1, _staDns2);
-        }
-        WiFi.begin(ssid.c_str(), password.c_str());
-        Serial.printf("[net] background retry ssid=%s\n", ssid.c_str());
-      }
+    // Keep trying the best candidate (the last known-good SSID when nothing was heard) in the
+    // background (auto-reconnect), so if the router appears later we still have a good target.
+    const uint8_t first = order[0];
+    if (_saved[first].ssid.length()) {
+      beginSaved(first, findScan(_saved[first].ssid, kScanFreshMs));
+      applog::info(applog::Module::Net, "background retry ssid=%s", _saved[first].ssid.c_str());
     }
   } else {
     WiFi.hostname(_hostName);
@@ -278,8 +506,9 @@ void WifiController::begin(const AppConfig &cfg) {
     }
     if (WiFi.status() == WL_CONNECTED) {
       _apMode = false;
+      noteApState();
       _lastStaOkMs = millis();
-      Serial.printf("[net] connected(ssdk) ssid=%s ip=%s rssi=%d\n",
+      applog::info(applog::Module::Net, "connected(ssdk) ssid=%s ip=%s rssi=%d",
                     WiFi.SSID().c_str(),
                     WiFi.localIP().toString().c_str(),
                     WiFi.RSSI());
@@ -290,6 +519,85 @@ void WifiController::begin(const AppConfig &cfg) {
   startAp();
 }
 
+void WifiController::registerEventHandlers() {
+  // Track disconnect reason codes for debugging (much more informative than wl_status_t alone).
+  _staDiscHandler = WiFi.onStationModeDisconnected([this](const WiFiEventStationModeDisconnected &evt) {
+    const uint16_t reason = static_cast<uint16_t>(evt.reason);
+    const bool expected = (_staDiscExpectedCount > 0) && (reason == 8 /*ASSOC_LEAVE*/ || reason == 3 /*AUTH_LEAVE*/);
+    if (expected) _staDiscExpectedCount -= 1;
+
+    _lastStaDiscReason = reason;
+    _lastStaDiscExpected = expected;
+    if (!expected) _lastStaDiscReasonReal = reason;
+    _lastStaDiscReasonMs = millis();
+    applog::info(applog::Module::Net, "sta disconnected reason=%u%s", static_cast<unsigned>(reason), expected ? " (expected)" : "");
+    logWifiEvent();
+
+    _net.lastDisconnectReason = reason;
+    // The SDK repeats this event while it retries; only the first one is a state change.
+    const bool wasUp = _net.staConnected || _net.staIp != IPAddress(0, 0, 0, 0);
+    _link.noteDisconnect(millis(), reason, expected, wasUp);
+    if (wasUp) {
+      _net.staConnected = false;
+      _net.staIp = IPAddress(0, 0, 0, 0);
+      markNetChange(kNetStaDown);
+    }
+  });
+
+  _staConnHandler = WiFi.onStationModeConnected([this](const WiFiEventStationModeConnected &evt) {
+    strncpy(_net.staSsid, evt.ssid.c_str(), sizeof(_net.staSsid) - 1);
+    _net.staSsid[sizeof(_net.staSsid) - 1] = '\0';
+    memcpy(_net.staBssid, evt.bssid, sizeof(_net.staBssid));
+    _net.staChannel = evt.channel;
+    // "Up" is reported once DHCP (or the static config) delivers an address.
+  });
+
+  _staGotIpHandler = WiFi.onStationModeGotIP([this](const WiFiEventStationModeGotIP &evt) {
+    const bool wasUp = _net.staConnected;
+    const bool ipChanged = (_net.staIp != evt.ip);
+    _net.staConnected = true;
+    _net.staIp = evt.ip;
+    fastconnect::noteIp(millis());
+    _link.noteUp(millis(), _net.staChannel, _net.staBssid);
+    markNetChange((wasUp ? 0 : kNetStaUp) | (ipChanged ? kNetStaIp : 0));
+  });
+
+  _apStaConnHandler = WiFi.onSoftAPModeStationConnected([this](const WiFiEventSoftAPModeStationConnected &) {
+    if (_net.apClients < 255) _net.apClients += 1;
+    markNetChange(kNetApClients);
+  });
+
+  _apStaDiscHandler = WiFi.onSoftAPModeStationDisconnected([this](const WiFiEventSoftAPModeStationDisconnected &) {
+    if (_net.apClients > 0) _net.apClients -= 1;
+    markNetChange(kNetApClients);
+  });
+}
+
+void WifiController::markNetChange(uint8_t bits) {
+  if (!bits) return;
+  _netChanges |= bits;
+  _net.version += 1;
+}
+
+// AP start/stop is driven by this class, so it is recorded here rather than from an SDK event.
+void WifiController::noteApState() {
+  const IPAddress apIp = _apMode ? WiFi.softAPIP() : IPAddress(0, 0, 0, 0);
+  if (_apMode == _net.apActive && apIp == _net.apIp) return;
+  const bool wasActive = _net.apActive;
+  _net.apActive = _apMode;
+  _net.apIp = apIp;
+  if (!_apMode) _net.apClients = 0;
+  markNetChange((_apMode && !wasActive) ? kNetApUp : (!_apMode && wasActive) ? kNetApDown : kNetApClients);
+}
+
+const NetState &WifiController::netState() const { return _net; }
+
+uint8_t WifiController::takeNetChanges() {
+  const uint8_t bits = _netChanges;
+  _netChanges = 0;
+  return bits;
+}
+
 bool WifiController::isApMode() const { return _apMode; }
 
 String WifiController::apSsid() const { return _apSsid; }
@@ -315,31 +623,176 @@ String WifiController::staStaticIpString() const {
   return _staIp.toString();
 }
 
-String WifiController::scanJson() {
-  int n = WiFi.scanNetworks();
-  String json = "[";
-  for (int i = 0; i < n; i += 1) {
-    if (i) json += ",";
-    json += "{\"ssid\":";
-    json += "\"";
-    json += WiFi.SSID(i);
-    json += "\"";
-    json += ",\"bssid\":\"";
-    json += WiFi.BSSIDstr(i);
-    json += "\"";
-    json += ",\"ch\":";
-    json += WiFi.channel(i);
-    json += ",\"rssi\":";
-    json += WiFi.RSSI(i);
-    json += ",\"secure\":";
-    json += (WiFi.encryptionType(i) == ENC_TYPE_NONE) ? "false" : "true";
-    json += ",\"enc\":";
-    json += WiFi.encryptionType(i);
-    json += "}";
+bool WifiController::startScan() {
+  if (_scanRunning) return false;
+  WiFi.scanDelete();
+  _scanRunning = true;
+  _scanStartMs = millis();
+  _scanResult = -1;
+  // The callback runs in the SDK's context: only hand the count over, tick() copies the results.
+  WiFi.scanNetworksAsync([this](int count) { _scanResult = static_cast<int16_t>(count < 0 ? 0 : count); },
+                         false /*show_hidden*/);
+  applog::debug(applog::Module::Net, "scan start");
+  return true;
+}
+
+void WifiController::harvestScan(int count) {
+  _scanCount = 0;
+  uint8_t aps = 0;
+  for (int i = 0; i < count; i += 1) {
+    const String ssid = WiFi.SSID(i);
+    if (!ssid.length()) continue;
+    aps += 1;
+    const int32_t rssi = WiFi.RSSI(i);
+
+    ScanEntry *e = nullptr;
+    for (uint8_t j = 0; j < _scanCount; j += 1) {
+      if (_scan[j].ssid == ssid) e = &_scan[j];
+    }
+    if (e) {
+      if (e->aps < 255) e->aps += 1;
+      if (rssi <= e->rssi) continue;
+    } else {
+      if (_scanCount >= kMaxScanEntries) {
+        // Full: a new SSID only displaces the weakest one.
+        uint8_t weakest = 0;
+        for (uint8_t j = 1; j < _scanCount; j += 1) {
+          if (_scan[j].rssi < _scan[weakest].rssi) weakest = j;
+        }
+        if (rssi <= _scan[weakest].rssi) continue;
+        e = &_scan[weakest];
+      } else {
+        e = &_scan[_scanCount];
+        _scanCount += 1;
+      }
+      e->ssid = ssid;
+      e->aps = 1;
+    }
+    e->rssi = rssi;
+    e->channel = WiFi.channel(i);
+    e->enc = WiFi.encryptionType(i);
+    const uint8_t *b = WiFi.BSSID(i);
+    for (uint8_t j = 0; j < 6; j += 1) e->bssid[j] = b ? b[j] : 0;
   }
-  json += "]";
   WiFi.scanDelete();
-  return json;
+
+  // Strongest first (insertion sort, at most kMaxScanEntries).
+  for (uint8_t i = 1; i < _scanCount; i += 1) {
+    for (uint8_t j = i; j > 0 && _scan[j].rssi > _scan[j - 1].rssi; j -= 1) std::swap(_scan[j], _scan[j - 1]);
+  }
+  for (uint8_t i = _scanCount; i < kMaxScanEntries; i += 1) _scan[i].ssid = "";
+
+  _scanAtMs = millis();
+  _scanSeq += 1;
+  _scanRunning = false;
+  applog::debug(applog::Module::Net, "scan done aps=%u ssids=%u in %lums", static_cast<unsigned>(aps),
+                static_cast<unsigned>(_scanCount), static_cast<unsigned long>(_scanAtMs - _scanStartMs));
+}
+
+uint32_t WifiController::scanAgeMs() const { return _scanSeq ? millis() - _scanAtMs : UINT32_MAX; }
+
+const WifiController::ScanEntry *WifiController::findScan(const String &ssid, uint32_t maxAgeMs) const {
+  if (!ssid.length() || scanAgeMs() > maxAgeMs) return nullptr;
+  for (uint8_t i = 0; i < _scanCount; i += 1) {
+    if (_scan[i].ssid == ssid) return &_scan[i];
+  }
+  return nullptr;
+}
+
+void WifiController::scanJson(JsonWriter &w) const {
+  w.beginObject();
+  w.field("ok", true);
+  w.field("scanning", _scanRunning);
+  w.key("ageMs");
+  if (_scanSeq) {
+    w.value(scanAgeMs());
+  } else {
+    w.null();
+  }
+  w.field("seq", _scanSeq);
+  w.beginArray("networks");
+  for (uint8_t i = 0; i < _scanCount; i += 1) {
+    const ScanEntry &e = _scan[i];
+    const uint8_t *b = e.bssid;
+    char bssid[18];
+    snprintf(bssid, sizeof(bssid), "%02X:%02X:%02X:%02X:%02X:%02X", b[0], b[1], b[2], b[3], b[4], b[5]);
+    w.beginObject();
+    w.field("ssid", e.ssid);
+    w.field("bssid", bssid);
+    w.field("ch", e.channel);
+    w.field("rssi", e.rssi);
+    w.field("secure", e.enc != ENC_TYPE_NONE);
+    w.field("enc", e.enc);
+    w.field("aps", e.aps);
+    w.endObject();
+  }
+  w.endArray();
+  w.endObject();
+}
+
+bool WifiController::tryFastConnect(const String &ssid,
+                                    const String &password,
+                                    const fastconnect::Lease &lease,
+                                    bool allowStatic) {
+  if (lease.channel < 1 || lease.channel > 13) return false;
+  const bool useStatic = allowStatic && _staDhcp && !isZeroIp(lease.ip) && !isZeroIp(lease.gateway) &&
+                         !isZeroIp(lease.subnet);
+
+  WiFi.mode(WIFI_STA);
+  WiFi.hostname(_hostName);
+  if (useStatic) {
+    WiFi.config(lease.ip, lease.gateway, lease.subnet, lease.dns1, lease.dns2);
+  } else if (_staDhcp) {
+    WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+  } else if (!isZeroIp(_staIp) && !isZeroIp(_staGateway) && !isZeroIp(_staSubnet)) {
+    WiFi.config(_staIp, _staGateway, _staSubnet, _staDns1, _staDns2);
+  }
+  WiFi.begin(ssid.c_str(), password.c_str(), lease.channel, lease.bssid, true);
+  applog::info(applog::Module::Net, "fast connect ssid=%s ch=%u%s", ssid.c_str(), static_cast<unsigned>(lease.channel),
+               useStatic ? " static" : "");
+
+  const uint32_t start = millis();
+  while (WiFi.status() != WL_CONNECTED && (millis() - start) < kFastConnectTimeoutMs) {
+    delay(20);
+  }
+  if (WiFi.status() == WL_CONNECTED) {
+    _lastStaOkMs = millis();
+    _fastStatic = useStatic;
+    fastconnect::notePath(useStatic ? fastconnect::Path::Static : fastconnect::Path::Hinted);
+    applog::info(applog::Module::Net, "connected ssid=%s ip=%s rssi=%d in %lums (fast)", WiFi.SSID().c_str(),
+                 WiFi.localIP().toString().c_str(), WiFi.RSSI(), static_cast<unsigned long>(millis() - start));
+    return true;
+  }
+
+  // The AP moved or the lease is no longer ours: the next boot goes through DHCP (hints are kept).
+  applog::warn(applog::Module::Net, "fast connect failed ssid=%s status=%s", ssid.c_str(), wifiStatusToString(WiFi.status()));
+  if (useStatic) {
+    fastconnect::dropLease();
+    fastconnect::noteStaticFallback();
+  }
+  expectStaDisconnect();
+  WiFi.disconnect();
+  delay(40);
+  return false;
+}
+
+void WifiController::rememberLink() {
+  fastconnect::Lease lease;
+  lease.ssidHash = fastconnect::ssidHash(WiFi.SSID());
+  const uint8_t *b = WiFi.BSSID();
+  if (b) memcpy(lease.bssid, b, sizeof(lease.bssid));
+  lease.channel = static_cast<uint8_t>(WiFi.channel());
+  // A configured static address is already known at boot; only a lease the DHCP server actually handed
+  // out is worth remembering (not the remembered one still in use as a static config).
+  if (_staDhcp && stationDhcpLease(lease.leaseS, lease.ageS)) {
+    lease.ip = WiFi.localIP();
+    lease.gateway = WiFi.gatewayIP();
+    lease.subnet = WiFi.subnetMask();
+    lease.dns1 = WiFi.dnsIP(0);
+    lease.dns2 = WiFi.dnsIP(1);
+  }
+  fastconnect::save(lease);
+  _leaseSavedMs = millis();
 }
 
 bool WifiController::saveNetwork(const String &ssid, const String &password, bool makeLast) {
@@ -357,6 +810,7 @@ bool WifiController::saveNetwork(const String &ssid, const String &password, boo
     }
   }
 
+  if (_saved[idx].ssid != ssid) _saved[idx] = SavedNetwork();
   _saved[static_cast<uint8_t>(idx)].ssid = ssid;
   _saved[static_cast<uint8_t>(idx)].password = password;
   if (makeLast) _lastSavedSsid = ssid;
@@ -389,11 +843,11 @@ bool WifiController::connectTo(const String &ssid, const String &password, uint3
   _pendingSsid = ssid;
   _pendingPassword = password;
   _pendingStartMs = millis();
-  Serial.printf("[net] connecting ssid=%s (timeout=%lums)\n", ssid.c_str(), static_cast<unsigned long>(timeoutMs));
+  applog::info(applog::Module::Net, "connecting ssid=%s (timeout=%lums)", ssid.c_str(), static_cast<unsigned long>(timeoutMs));
 
   const uint32_t start = millis();
   wl_status_t lastSt = WiFi.status();
-  Serial.printf("[net] connect status=%s(%d)\n", wifiStatusToString(lastSt), static_cast<int>(lastSt));
+  applog::debug(applog::Module::Net, "connect status=%s(%d)", wifiStatusToString(lastSt), static_cast<int>(lastSt));
   while (WiFi.status() != WL_CONNECTED && (millis() - start) < timeoutMs) {
     delay(150);
     yield();
@@ -401,12 +855,12 @@ bool WifiController::connectTo(const String &ssid, const String &password, uint3
     const wl_status_t st = WiFi.status();
     if (st != lastSt) {
       lastSt = st;
-      Serial.printf("[net] connect status=%s(%d)\n", wifiStatusToString(st), static_cast<int>(st));
+      applog::debug(applog::Module::Net, "connect status=%s(%d)", wifiStatusToString(st), static_cast<int>(st));
     }
   }
 
   if (WiFi.status() != WL_CONNECTED) {
-    Serial.printf("[net] connect failed ssid=%s status=%s(%d)\n",
+    applog::warn(applog::Module::Net, "connect failed ssid=%s status=%s(%d)",
                   ssid.c_str(),
                   wifiStatusToString(WiFi.status()),
                   static_cast<int>(WiFi.status()));
@@ -423,7 +877,7 @@ bool WifiController::connectTo(const String &ssid, const String &password, uint3
   _pendingPassword = "";
   _pendingStartMs = 0;
   _pendingSimpleStaOnly = false;
-  Serial.printf("[net] connected ssid=%s ip=%s rssi=%d\n", WiFi.SSID().c_str(), WiFi.localIP().toString().c_str(), WiFi.RSSI());
+  applog::info(applog::Module::Net, "connected ssid=%s ip=%s rssi=%d", WiFi.SSID().c_str(), WiFi.localIP().toString().c_str(), WiFi.RSSI());
   // Don't stop AP here: this HTTP request likely came through the AP, and stopping it
   // would abort the response. `tick()` will stop it shortly after we return.
   return true;
@@ -454,7 +908,7 @@ bool WifiController::beginConnect(const String &ssid, const String &password) {
   _pendingSsid = ssid;
   _pendingPassword = password;
   _pendingStartMs = millis();
-  Serial.printf("[net] connect start ssid=%s\n", ssid.c_str());
+  applog::debug(applog::Module::Net, "connect start ssid=%s", ssid.c_str());
   return true;
 }
 
@@ -482,6 +936,17 @@ bool WifiController::requestConnect(const String &ssid,
   if (_pendingHasBssid) {
     for (int i = 0; i < 6; i += 1) _pendingTargetBssid[i] = bssidHint[i];
   }
+  if (!_pendingTargetChannel) {
+    // A recent scan already knows the channel (and strongest BSSID): skip the Scanning stage.
+    const ScanEntry *seen = findScan(ssid, kConnectHintMaxAgeMs);
+    if (seen && seen->channel >= 1 && seen->channel <= 13) {
+      _pendingTargetChannel = seen->channel;
+      _pendingHasBssid = true;
+      for (int i = 0; i < 6; i += 1) _pendingTargetBssid[i] = seen->bssid[i];
+      applog::debug(applog::Module::Net, "connect hints from scan cache ssid=%s ch=%ld age=%lums", ssid.c_str(),
+                    static_cast<long>(seen->channel), static_cast<unsigned long>(scanAgeMs()));
+    }
+  }
   _pendingSimpleStaOnly = simpleStaOnly;
   _lastConnectFailCode = 0;
   _sdkStaStatusLastLogged = -1;
@@ -493,7 +958,7 @@ bool WifiController::requestConnect(const String &ssid,
   _connectVariant = 0;
   _connectLastBeginMs = 0;
 
-  Serial.printf("[net] connect requested ssid=%s%s\n", ssid.c_str(), _pendingSimpleStaOnly ? " (simple)" : "");
+  applog::info(applog::Module::Net, "connect requested ssid=%s%s", ssid.c_str(), _pendingSimpleStaOnly ? " (simple)" : "");
   logWifiEvent();
   return true;
 }
@@ -520,47 +985,97 @@ int32_t WifiController::sdkStationStatusCode() const { return _sdkStaStatus; }
 
 bool WifiController::connectSimpleStaOnly() const { return _pendingSimpleStaOnly; }
 
-String WifiController::logJson() const {
-  DynamicJsonDocument doc(2048);
-  doc["ok"] = true;
-  JsonArray arr = doc.createNestedArray("events");
+void WifiController::logJson(JsonWriter &w) const {
+  w.beginObject();
+  w.field("ok", true);
+  w.beginArray("events");
   // Oldest -> newest
   for (uint8_t i = 0; i < kWifiLogSize; i += 1) {
     const uint8_t idx = static_cast<uint8_t>((_wifiLogHead + i) % kWifiLogSize);
     const WifiLogEntry &e = _wifiLog[idx];
     if (e.ms == 0) continue;
-    JsonObject o = arr.createNestedObject();
-    o["ms"] = e.ms;
-    o["attempt"] = e.attemptId;
-    o["stage"] = e.stage;
-    o["variant"] = e.variant;
-    o["sta"] = e.staStatus;
-    o["fail"] = e.lastFail;
-    o["apCh"] = e.apCh;
-    o["targetCh"] = e.targetCh;
-    o["disc"] = e.discReason;
-    o["discExp"] = e.discExpected;
-    o["sdk"] = e.sdkSta;
+    w.beginObject();
+    w.field("ms", e.ms);
+    w.field("attempt", e.attemptId);
+    w.field("stage", e.stage);
+    w.field("variant", e.variant);
+    w.field("sta", e.staStatus);
+    w.field("fail", e.lastFail);
+    w.field("apCh", e.apCh);
+    w.field("targetCh", e.targetCh);
+    w.field("disc", e.discReason);
+    w.field("discExp", e.discExpected);
+    w.field("sdk", e.sdkSta);
+    w.endObject();
   }
-  String out;
-  serializeJson(doc, out);
-  return out;
+  w.endArray();
+  w.endObject();
 }
 
-String WifiController::savedJson() const {
-  DynamicJsonDocument doc(1024);
-  doc["ok"] = true;
-  doc["count"] = _savedCount;
-  doc["last"] = _lastSavedSsid;
-  JsonArray nets = doc.createNestedArray("nets");
+void WifiController::linkStatsJson(JsonWriter &w) const { _link.statsJson(w, millis()); }
+
+void WifiController::savedJson(JsonWriter &w) const {
+  w.beginObject();
+  w.field("ok", true);
+  w.field("count", _savedCount);
+  w.field("last", _lastSavedSsid);
+  const uint32_t nowMs = millis();
+  w.beginArray("nets");
   for (uint8_t i = 0; i < _savedCount; i += 1) {
-    JsonObject n = nets.createNestedObject();
-    n["ssid"] = _saved[i].ssid;
-    n["last"] = (_saved[i].ssid == _lastSavedSsid);
+    const SavedNetwork &net = _saved[i];
+    const ScanEntry *seen = findScan(net.ssid, kScanFreshMs);
+    const bool linked = net.ssid == _linkSsid;
+    w.beginObject();
+    w.field("ssid", net.ssid);
+    w.field("last", net.ssid == _lastSavedSsid);
+    w.field("connected", linked);
+    w.field("attempts", net.attempts);
+    w.field("successes", net.successes);
+    w.field("drops", net.drops);
+    w.field("roams", net.roams);
+    w.field("connectedS", net.connectedS + (linked ? (nowMs - _linkSinceMs) / 1000UL : 0));
+    w.key("avgRssi");
+    if (net.avgRssi) {
+      w.value(net.avgRssi);
+    } else {
+      w.null();
+    }
+    // From the scan cache: null when the network was not heard in the last kScanFreshMs.
+    w.key("rssi");
+    if (seen) {
+      w.value(seen->rssi);
+    } else {
+      w.null();
+    }
+    w.key("score");
+    if (seen) {
+      w.value(savedScore(i, seen->rssi));
+    } else {
+      w.null();
+    }
+    w.endObject();
   }
-  String out;
-  serializeJson(doc, out);
-  return out;
+  w.endArray();
+  w.beginObject("roam");
+  w.field("thresholdDbm", kRoamRssiDbm);
+  w.field("lowForS", kRoamLowForMs / 1000UL);
+  w.field("hysteresisDb", kRoamHysteresisDb);
+  w.key("linkRssi");
+  if (_linkSsid.length() && _linkRssi) {
+    w.value(_linkRssi);
+  } else {
+    w.null();
+  }
+  w.field("lowMs", _lowRssiSinceMs ? nowMs - _lowRssiSinceMs : 0);
+  w.field("roams", _roamCount);
+  w.key("lastRoamAgoS");
+  if (_lastRoamMs) {
+    w.value((nowMs - _lastRoamMs) / 1000UL);
+  } else {
+    w.null();
+  }
+  w.endObject();
+  w.endObject();
 }
 
 bool WifiController::forgetSaved(const String &ssid) {
@@ -579,10 +1094,12 @@ uint8_t WifiController::savedCount() const { return _savedCount; }
 
 void WifiController::resetAndReboot() {
   LittleFS.remove(kWifiStorePath);
+  fastconnect::forget();
   expectStaDisconnect();
   WiFi.disconnect(true);
   ESP.eraseConfig();
   delay(250);
+  applog::flush();
   ESP.restart();
 }
 
@@ -621,7 +1138,7 @@ void WifiController::beginPendingStaConnect() {
   }
 
   WiFi.begin(_pendingSsid.c_str(), _pendingPassword.c_str(), ch, bssid, true);
-  Serial.printf("[net] connect begin ssid=%s variant=%u ch=%ld bssid=%s\n",
+  applog::debug(applog::Module::Net, "connect begin ssid=%s variant=%u ch=%ld bssid=%s",
                 _pendingSsid.c_str(),
                 static_cast<unsigned>(_connectVariant),
                 static_cast<long>(ch),
@@ -664,7 +1181,7 @@ void WifiController::startApOnChannel(int32_t channel) {
     ok = WiFi.softAP(_apSsid.c_str(), nullptr, static_cast<int>(channel));
   }
   if (!ok) {
-    Serial.printf("[net] ap start failed ssid=%s ch=%ld\n", _apSsid.c_str(), static_cast<long>(channel));
+    applog::warn(applog::Module::Net, "ap start failed ssid=%s ch=%ld", _apSsid.c_str(), static_cast<long>(channel));
   }
   delay(100);
   const uint8_t curCh = wifi_get_channel();
@@ -672,15 +1189,16 @@ void WifiController::startApOnChannel(int32_t channel) {
 
   _dns.start(53, "*", WiFi.softAPIP());
   _apClientLastSeenMs = millis();
+  noteApState();
 
   if (!wasAp) {
-    Serial.printf("[net] ap started ssid=%s ip=%s ch=%ld%s\n",
+    applog::info(applog::Module::Net, "ap started ssid=%s ip=%s ch=%ld%s",
                   _apSsid.c_str(),
                   WiFi.softAPIP().toString().c_str(),
                   static_cast<long>(channel),
                   ok ? "" : " (FAILED)");
   } else {
-    Serial.printf("[net] ap restarted ssid=%s ch=%ld%s\n",
+    applog::info(applog::Module::Net, "ap restarted ssid=%s ch=%ld%s",
                   _apSsid.c_str(),
                   static_cast<long>(channel),
                   ok ? "" : " (FAILED)");
@@ -707,7 +1225,7 @@ void WifiController::startAp() {
     ok = WiFi.softAP(_apSsid.c_str());
   }
   if (!ok) {
-    Serial.printf("[net] ap start failed ssid=%s\n", _apSsid.c_str());
+    applog::warn(applog::Module::Net, "ap start failed ssid=%s", _apSsid.c_str());
   }
   delay(100);
   const uint8_t curCh = wifi_get_channel();
@@ -715,9 +1233,10 @@ void WifiController::startAp() {
 
   _dns.start(53, "*", WiFi.softAPIP());
   _apClientLastSeenMs = millis();
+  noteApState();
 
   if (!wasAp) {
-    Serial.printf("[net] ap started ssid=%s ip=%s%s\n",
+    applog::info(applog::Module::Net, "ap started ssid=%s ip=%s%s",
                   _apSsid.c_str(),
                   WiFi.softAPIP().toString().c_str(),
                   ok ? "" : " (FAILED)");
@@ -731,10 +1250,54 @@ void WifiController::stopAp() {
   _apMode = false;
   _apChannel = 0;
   _apClientLastSeenMs = 0;
-  Serial.println(F("[net] ap stopped"));
+  noteApState();
+  applog::info(applog::Module::Net, "ap stopped");
+}
+
+void WifiController::pollScan() {
+  if (!_scanRunning) return;
+  const int16_t found = _scanResult;
+  if (found >= 0) {
+    _scanResult = -1;
+    harvestScan(found);
+  } else if (millis() - _scanStartMs > kScanTimeoutMs) {
+    applog::warn(applog::Module::Net, "scan timeout");
+    WiFi.scanDelete();
+    _scanRunning = false;
+  }
 }
 
 void WifiController::tick() {
+  if (_net.version != _rememberedNetVersion) {
+    _rememberedNetVersion = _net.version;
+    trackLink(millis());
+    if (_net.staConnected && WiFi.status() == WL_CONNECTED) {
+      if (_fastStatic) {
+        // The remembered lease got us through boot. Hand the address back to the DHCP client right away,
+        // so the lease is renewed; the address stays in use until the server answers, and a server
+        // offers a client the address it already holds.
+        _fastStatic = false;
+        if (_staDhcp) WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+        applog::info(applog::Module::Net, "dhcp takes over the remembered lease");
+      }
+      rememberLink();
+    } else if (_fastStatic && !_net.staConnected) {
+      // Dropped before DHCP took over: reconnects ask DHCP.
+      _fastStatic = false;
+      if (_staDhcp) WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+    }
+  } else if (_net.staConnected && _staDhcp && millis() - _leaseSavedMs >= kLeaseRefreshMs) {
+    rememberLink(); // the lease age (and a renewal) for the next warm boot
+  }
+  pollScan();
+  const uint32_t nowTick = millis();
+  if (_link.due(nowTick)) {
+    const bool up = _net.staConnected;
+    _link.sample(nowTick, up, up ? WiFi.RSSI() : 0, up ? static_cast<uint8_t>(WiFi.channel()) : 0,
+                 static_cast<uint8_t>(WiFi.getPhyMode()));
+  }
+  if (_statsDirty && (millis() - _statsSavedMs) > kStatsFlushMs) saveSaved();
+
   // Poll the SDK station connect status (more granular than wl_status_t).
   const uint32_t nowPoll = millis();
   if (static_cast<int32_t>(nowPoll - _sdkStaStatusLastPollMs) >= static_cast<int32_t>(kSdkStaPollMs)) {
@@ -754,7 +1317,7 @@ void WifiController::tick() {
       if (!(ip[0] == 0 && ip[1] == 0 && ip[2] == 0 && ip[3] == 0)) {
         _lastStaOkMs = millis();
         rememberOnSuccess(_pendingSsid, _pendingPassword);
-        Serial.printf("[net] connect completed ssid=%s ip=%s rssi=%d\n",
+        applog::info(applog::Module::Net, "connect completed ssid=%s ip=%s rssi=%d",
                       WiFi.SSID().c_str(),
                       ip.toString().c_str(),
                       WiFi.RSSI());
@@ -769,7 +1332,7 @@ void WifiController::tick() {
 		    } else if (st == WL_WRONG_PASSWORD) {
 	      // Wrong password is definitive and won't recover without user action.
 	      _lastConnectFailCode = static_cast<int32_t>(st);
-      Serial.printf("[net] connect failed ssid=%s status=%s(%d)\n",
+      applog::warn(applog::Module::Net, "connect failed ssid=%s status=%s(%d)",
                     _pendingSsid.c_str(),
                     wifiStatusToString(st),
                     static_cast<int>(st));
@@ -783,7 +1346,7 @@ void WifiController::tick() {
 		      logWifiEvent();
 		    } else if ((st == WL_CONNECT_FAILED || st == WL_NO_SSID_AVAIL) && (millis() - _pendingStartMs) > 20000UL) {
 	      _lastConnectFailCode = static_cast<int32_t>(st);
-	      Serial.printf("[net] connect failed ssid=%s status=%s(%d)\n",
+	      applog::warn(applog::Module::Net, "connect failed ssid=%s status=%s(%d)",
 	                    _pendingSsid.c_str(),
 	                    wifiStatusToString(st),
 	                    static_cast<int>(st));
@@ -798,7 +1361,7 @@ void WifiController::tick() {
 		    } else if ((_sdkStaStatus == STATION_WRONG_PASSWORD)) {
 	      // SDK knows the precise failure even if wl_status_t stays DISCONNECTED.
 	      _lastConnectFailCode = static_cast<int32_t>(WL_WRONG_PASSWORD);
-	      Serial.printf("[net] connect failed ssid=%s sdk=WRONG_PASSWORD\n", _pendingSsid.c_str());
+	      applog::warn(applog::Module::Net, "connect failed ssid=%s sdk=WRONG_PASSWORD", _pendingSsid.c_str());
 		      _pendingActive = false;
 		      _pendingSsid = "";
 		      _pendingPassword = "";
@@ -809,7 +1372,7 @@ void WifiController::tick() {
 		      logWifiEvent();
 		    } else if ((_sdkStaStatus == STATION_NO_AP_FOUND) && (millis() - _pendingStartMs) > 6000UL) {
 	      _lastConnectFailCode = static_cast<int32_t>(WL_NO_SSID_AVAIL);
-	      Serial.printf("[net] connect failed ssid=%s sdk=NO_AP_FOUND\n", _pendingSsid.c_str());
+	      applog::warn(applog::Module::Net, "connect failed ssid=%s sdk=NO_AP_FOUND", _pendingSsid.c_str());
 		      _pendingActive = false;
 		      _pendingSsid = "";
 		      _pendingPassword = "";
@@ -820,7 +1383,7 @@ void WifiController::tick() {
 		      logWifiEvent();
 		    } else if ((_sdkStaStatus == STATION_CONNECT_FAIL) && (millis() - _pendingStartMs) > 20000UL) {
 	      _lastConnectFailCode = static_cast<int32_t>(WL_CONNECT_FAILED);
-	      Serial.printf("[net] connect failed ssid=%s sdk=CONNECT_FAIL\n", _pendingSsid.c_str());
+	      applog::warn(applog::Module::Net, "connect failed ssid=%s sdk=CONNECT_FAIL", _pendingSsid.c_str());
 		      _pendingActive = false;
 		      _pendingSsid = "";
 		      _pendingPassword = "";
@@ -832,11 +1395,11 @@ void WifiController::tick() {
 		    } else if ((st == WL_DISCONNECTED || st == WL_IDLE_STATUS) && _connectLastBeginMs != 0 &&
 	               (millis() - _connectLastBeginMs) > kConnectRetryAfterMs && _connectVariant < 2) {
 	      _connectVariant += 1;
-	      Serial.printf("[net] connect retry ssid=%s variant=%u\n", _pendingSsid.c_str(), static_cast<unsigned>(_connectVariant));
+	      applog::info(applog::Module::Net, "connect retry ssid=%s variant=%u", _pendingSsid.c_str(), static_cast<unsigned>(_connectVariant));
 	      beginPendingStaConnect();
 	    } else if ((millis() - _pendingStartMs) > kPendingConnectTimeoutMs) {
 	      _lastConnectFailCode = static_cast<int32_t>(WiFi.status());
-	      Serial.printf("[net] connect timeout ssid=%s\n", _pendingSsid.c_str());
+	      applog::warn(applog::Module::Net, "connect timeout ssid=%s", _pendingSsid.c_str());
 	      _pendingActive = false;
 	      _pendingSsid = "";
 		      _pendingPassword = "";
@@ -881,62 +1444,36 @@ void WifiController::tick() {
 
 	    if (_pendingStage == PendingStage::Scanning) {
 	      if (_pendingScanStartMs == 0) {
+	        // Uses (or joins) the cached site survey, so its results also serve /api/wifi/scan.
 	        _pendingScanStartMs = now;
-	        WiFi.scanDelete();
-	        WiFi.scanNetworks(true /*async*/,
-	                          false /*show_hidden*/,
-	                          0 /*channel*/,
-	                          reinterpret_cast<uint8_t *>(const_cast<char *>(_pendingSsid.c_str())));
-	        Serial.printf("[net] connect scan start ssid=%s\n", _pendingSsid.c_str());
+	        _pendingScanSeq = _scanSeq;
+	        startScan();
+	        applog::debug(applog::Module::Net, "connect scan start ssid=%s", _pendingSsid.c_str());
 	        logWifiEvent();
 	        if (_apMode) _dns.processNextRequest();
 	        return;
 	      }
 
-	      const int8_t done = WiFi.scanComplete();
-	      if (done == -2) { // running
-	        if ((now - _pendingScanStartMs) > kConnectScanTimeoutMs) {
-	          Serial.printf("[net] connect scan timeout ssid=%s\n", _pendingSsid.c_str());
-	          WiFi.scanDelete();
-	          _pendingScanStartMs = 0;
-	          _pendingStage = PendingStage::StartingSta;
-	          logWifiEvent();
-	        } else {
+	      if (_scanSeq == _pendingScanSeq) { // running
+	        if (_scanRunning && (now - _pendingScanStartMs) <= kConnectScanTimeoutMs) {
 	          if (_apMode) _dns.processNextRequest();
 	          return;
 	        }
+	        applog::warn(applog::Module::Net, "connect scan timeout ssid=%s", _pendingSsid.c_str());
+	        _pendingScanStartMs = 0;
+	        _pendingStage = PendingStage::StartingSta;
+	        logWifiEvent();
 	      } else {
-	        int32_t ch = 0;
-	        int32_t bestRssi = -9999;
-	        bool bestHasBssid = false;
-	        uint8_t bestBssid[6] = {0, 0, 0, 0, 0, 0};
-	        if (done > 0) {
-	          for (int i = 0; i < done; i += 1) {
-	            if (WiFi.SSID(i) == _pendingSsid) {
-	              const int32_t rssi = WiFi.RSSI(i);
-	              if (rssi > bestRssi) {
-	                bestRssi = rssi;
-	                ch = WiFi.channel(i);
-	                const uint8_t *bssid = WiFi.BSSID(i);
-	                if (bssid != nullptr) {
-	                  for (int j = 0; j < 6; j += 1) bestBssid[j] = bssid[j];
-	                  bestHasBssid = true;
-	                } else {
-	                  bestHasBssid = false;
-	                }
-	              }
-	            }
-	          }
-	        }
-	        WiFi.scanDelete();
+	        const ScanEntry *seen = findScan(_pendingSsid, UINT32_MAX);
+	        const int32_t ch = seen ? seen->channel : 0;
 	        _pendingScanStartMs = 0;
 	        _pendingTargetChannel = ch;
-	        _pendingHasBssid = bestHasBssid;
-	        if (_pendingHasBssid) for (int j = 0; j < 6; j += 1) _pendingTargetBssid[j] = bestBssid[j];
+	        _pendingHasBssid = (seen != nullptr);
+	        if (_pendingHasBssid) for (int j = 0; j < 6; j += 1) _pendingTargetBssid[j] = seen->bssid[j];
 	        if (ch > 0) {
-	          Serial.printf("[net] connect target channel ssid=%s ch=%ld\n", _pendingSsid.c_str(), static_cast<long>(ch));
+	          applog::debug(applog::Module::Net, "connect target channel ssid=%s ch=%ld", _pendingSsid.c_str(), static_cast<long>(ch));
 	        } else {
-	          Serial.printf("[net] connect target channel unknown ssid=%s\n", _pendingSsid.c_str());
+	          applog::debug(applog::Module::Net, "connect target channel unknown ssid=%s", _pendingSsid.c_str());
 	        }
 
 	        if (_apMode && ch > 0 && _apChannel != ch) {
@@ -967,7 +1504,7 @@ void WifiController::tick() {
 		      }
 		      beginPendingStaConnect();
 		      _pendingStage = PendingStage::Connecting;
-		      Serial.printf("[net] connect start ssid=%s\n", _pendingSsid.c_str());
+		      applog::debug(applog::Module::Net, "connect start ssid=%s", _pendingSsid.c_str());
 		    }
 	  }
 
@@ -980,6 +1517,7 @@ void WifiController::tick() {
 
   if (WiFi.status() == WL_CONNECTED) {
     _lastStaOkMs = millis();
+    tickRoam(_lastStaOkMs);
     if (_apMode) {
       const int clients = WiFi.softAPgetStationNum();
       if (clients > 0) {
@@ -996,31 +1534,27 @@ void WifiController::tick() {
 
   // Periodic reconnect attempts (helps after router reboot / power loss).
   const uint32_t nowMs = millis();
-  if ((nowMs - _lastReconnectAttemptMs) > 30000UL) {
-    _lastReconnectAttemptMs = nowMs;
-    if (_savedCount > 0) {
-      int idx = findSavedIndex(_lastSavedSsid);
-      if (idx < 0) idx = 0;
-      if (idx >= 0 && idx < _savedCount) {
-        const String ssid = _saved[idx].ssid;
-        const String password = _saved[idx].password;
-        if (ssid.length()) {
-          WiFi.mode(_apMode ? WIFI_AP_STA : WIFI_STA);
-          WiFi.setAutoReconnect(true);
-          WiFi.hostname(_hostName);
-          if (_staDhcp) {
-            WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
-          } else if (!isZeroIp(_staIp) && !isZeroIp(_staGateway) && !isZeroIp(_staSubnet)) {
-            WiFi.config(_staIp, _staGateway, _staSubnet, _staDns1, _staDns2);
-          }
-          WiFi.begin(ssid.c_str(), password.c_str());
-          Serial.printf("[net] reconnect ssid=%s\n", ssid.c_str());
-        } else {
-          WiFi.reconnect();
-        }
+  if ((nowMs - _lastReconnectAttemptMs) > kReconnectEveryMs) {
+    if (_savedCount > 1 && !_reconnectScan && scanAgeMs() > kScanFreshMs) {
+      // Choose with a current picture of what is in range; the attempt follows when the scan lands.
+      _reconnectScan = true;
+      if (!_scanRunning) startScan();
+    } else if (!_scanRunning) {
+      _reconnectScan = false;
+      _lastReconnectAttemptMs = nowMs;
+      if (_savedCount > 0) {
+        uint8_t order[kMaxSavedNetworks];
+        rankSaved(order);
+        const uint8_t idx = order[0];
+        const ScanEntry *seen = findScan(_saved[idx].ssid, kScanFreshMs);
+        WiFi.mode(_apMode ? WIFI_AP_STA : WIFI_STA);
+        WiFi.setAutoReconnect(true);
+        beginSaved(idx, seen);
+        applog::info(applog::Module::Net, "reconnect ssid=%s rssi=%ld", _saved[idx].ssid.c_str(),
+                     static_cast<long>(seen ? seen->rssi : 0));
+      } else {
+        WiFi.reconnect();
       }
-    } else {
-      WiFi.reconnect();
     }
   }
 
@@ -5,6 +5,32 @@
 #include <ESP8266WiFi.h>
 
 #include "AppConfig.h"
+#include "FastConnect.h"
+#include "LinkStats.h"
+
+// Network state maintained from SDK events (no polling, no heap). `version` bumps on every change;
+// consumers compare it with the last version they handled.
+struct NetState {
+  uint32_t version = 0;
+  bool staConnected = false; // associated and has an IP
+  bool apActive = false;
+  uint8_t apClients = 0;
+  IPAddress staIp = IPAddress(0, 0, 0, 0);
+  IPAddress apIp = IPAddress(0, 0, 0, 0);
+  char staSsid[33] = {};
+  uint8_t staBssid[6] = {0, 0, 0, 0, 0, 0};
+  uint8_t staChannel = 0;
+  uint16_t lastDisconnectReason = 0;
+};
+
+enum NetChange : uint8_t {
+  kNetStaUp = 1 << 0,
+  kNetStaDown = 1 << 1,
+  kNetStaIp = 1 << 2,
+  kNetApUp = 1 << 3,
+  kNetApDown = 1 << 4,
+  kNetApClients = 1 << 5,
+};
 
 class WifiController {
 public:
@@ -19,7 +45,30 @@ public:
   bool staDhcp() const;
   String staStaticIpString() const;
 
-  String scanJson();
+  // Cached site survey. startScan() runs WiFi.scanNetworksAsync() (false while a scan is running, the
+  // caller can wait for that one); tick() folds the results into the cache, one entry per SSID with its
+  // strongest BSSID, and frees the SDK's copy. Readers never trigger or wait for a scan.
+  struct ScanEntry {
+    String ssid;
+    uint8_t bssid[6] = {0, 0, 0, 0, 0, 0};
+    int32_t channel = 0;
+    int32_t rssi = 0;
+    uint8_t enc = 0;
+    uint8_t aps = 0; // BSSIDs seen with this SSID
+  };
+  static constexpr uint8_t kMaxScanEntries = 20;
+  // Cached results younger than this are served without scanning again.
+  static constexpr uint32_t kScanFreshMs = 30UL * 1000UL;
+
+  bool startScan();
+  bool scanRunning() const { return _scanRunning; }
+  // Completed scans since boot; moves when the cache is replaced.
+  uint32_t scanSeq() const { return _scanSeq; }
+  uint32_t scanAgeMs() const; // UINT32_MAX before the first scan
+  // The cached entry for `ssid`, if the cache is at most `maxAgeMs` old.
+  const ScanEntry *findScan(const String &ssid, uint32_t maxAgeMs) const;
+  // {ok, scanning, ageMs, seq, networks:[{ssid, bssid, ch, rssi, secure, enc, aps}]}, strongest first.
+  void scanJson(JsonWriter &w) const;
   bool connectTo(const String &ssid, const String &password, uint32_t timeoutMs);
   // Non-blocking connect (keeps AP active during attempt). Results are visible in /api/wifi/status.
   bool beginConnect(const String &ssid, const String &password);
@@ -27,7 +76,8 @@ public:
   // it defers the actual WiFi.begin() to allow the HTTP response to flush, then
   // scans for the target SSID and restarts the AP on the target channel (AP+STA
   // can only operate on a single channel), and only then starts the STA connect.
-  // If `channelHint` / `bssidHint` are provided (e.g. from a recent scan), scanning is skipped.
+  // If `channelHint` / `bssidHint` are provided (e.g. from a recent scan), scanning is skipped; without them
+  // a scan cache entry for the SSID up to 2 minutes old supplies them.
   // If `simpleStaOnly` is true, the controller will temporarily stop the AP and attempt a plain STA connection.
   // If it fails, the AP is restored so the user isn't locked out.
   bool requestConnect(const String &ssid,
@@ -46,8 +96,14 @@ public:
   bool lastStaDisconnectWasExpected() const;
   int32_t sdkStationStatusCode() const;
   bool connectSimpleStaOnly() const;
-  String logJson() const;
-  String savedJson() const;
+  const NetState &netState() const;
+  // Returns the NetChange bits accumulated since the previous call and clears them.
+  uint8_t takeNetChanges();
+
+  void logJson(JsonWriter &w) const;
+  // Link-quality telemetry (see LinkStats).
+  void linkStatsJson(JsonWriter &w) const;
+  void savedJson(JsonWriter &w) const;
   bool forgetSaved(const String &ssid);
   bool saveNetwork(const String &ssid, const String &password, bool makeLast = true);
   uint8_t savedCount() const;
@@ -59,9 +115,29 @@ private:
   void startApOnChannel(int32_t channel);
   void stopAp();
   void loadSaved();
-  bool saveSaved() const;
+  bool saveSaved();
   void rememberOnSuccess(const String &ssid, const String &password);
   int findSavedIndex(const String &ssid) const;
+  // Selection score of saved network `idx` heard at `rssi`: the RSSI plus up to +/-10 dB for its
+  // connection history.
+  int32_t savedScore(uint8_t idx, int32_t rssi) const;
+  // Saved networks in the order to try them: those in a fresh scan by score, then the rest (the last
+  // successful one first). Fills `order` with all _savedCount indices.
+  void rankSaved(uint8_t *order) const;
+  // WiFi.begin() for saved network `idx` with the configured IP settings, on `seen`'s channel/BSSID when
+  // given, and counts the attempt.
+  void beginSaved(uint8_t idx, const ScanEntry *seen);
+  void noteAttempt(uint8_t idx);
+  // Per-network accounting when the station link comes up or goes down.
+  void trackLink(uint32_t nowMs);
+  void foldLinkTime(uint32_t nowMs);
+  // Samples the link RSSI and, after a sustained weak spell, scans for a clearly better saved network.
+  void tickRoam(uint32_t nowMs);
+  // Boot fast path: associate straight to the remembered BSSID/channel, with the remembered lease as a
+  // static config when `allowStatic`. Gives up after kFastConnectTimeoutMs.
+  bool tryFastConnect(const String &ssid, const String &password, const fastconnect::Lease &lease, bool allowStatic);
+  // Records the current AP, channel and DHCP lease (with its length and age) for the next boot.
+  void rememberLink();
 
   bool _apMode = false;
   DNSServer _dns;
@@ -79,15 +155,45 @@ private:
   uint32_t _lastStaOkMs = 0;
   uint32_t _apClientLastSeenMs = 0;
   uint32_t _lastReconnectAttemptMs = 0;
+  bool _fastStatic = false;         // connected on a remembered lease; DHCP takes over once it is up
+  uint32_t _rememberedNetVersion = 0; // NetState version rememberLink() last ran for
+  uint32_t _leaseSavedMs = 0;         // last rememberLink()
 
   struct SavedNetwork {
     String ssid;
     String password;
+    // Connection history, stored with the network. attempts/successes are halved when attempts reaches
+    // kHistoryWindow, so the success rate follows recent behaviour.
+    uint16_t attempts = 0;
+    uint16_t successes = 0;
+    uint16_t drops = 0; // unexpected disconnects while on it
+    uint16_t roams = 0; // times we left it for a stronger network
+    uint32_t connectedS = 0;
+    int8_t avgRssi = 0; // average link RSSI while connected, 0 = never sampled
   };
   static constexpr uint8_t kMaxSavedNetworks = 5;
+  static constexpr uint16_t kHistoryWindow = 32;
   SavedNetwork _saved[kMaxSavedNetworks];
   uint8_t _savedCount = 0;
   String _lastSavedSsid;
+  bool _statsDirty = false; // history changed since the last save
+  uint32_t _statsSavedMs = 0;
+
+  String _attemptSsid; // saved network our last WiFi.begin() targeted, until it connects
+  String _linkSsid;    // the station link being accounted ("" = down)
+  uint32_t _linkSinceMs = 0;
+  bool _reconnectScan = false; // periodic reconnect waits for this scan before choosing
+
+  // Roaming: the link RSSI (smoothed) has to stay under kRoamRssiDbm for kRoamLowForMs before a scan
+  // looks for a better saved network; one look per kRoamCheckEveryMs.
+  int32_t _linkRssi = 0; // 0 = no sample yet
+  uint32_t _rssiSampleMs = 0;
+  uint32_t _lowRssiSinceMs = 0;
+  uint32_t _roamCheckMs = 0;
+  bool _roamScanning = false;
+  uint32_t _roamScanSeq = 0;
+  uint32_t _roamCount = 0;
+  uint32_t _lastRoamMs = 0;
 
   // Pending connect attempt (for robust UX: connect may complete after the HTTP request returns)
   bool _pendingActive = false;
@@ -119,6 +225,12 @@ private:
   uint16_t _lastStaDiscReasonReal = 0;
   uint32_t _lastStaDiscReasonMs = 0;
   WiFiEventHandler _staDiscHandler;
+  WiFiEventHandler _staConnHandler;
+  WiFiEventHandler _staGotIpHandler;
+  WiFiEventHandler _apStaConnHandler;
+  WiFiEventHandler _apStaDiscHandler;
+  NetState _net;
+  uint8_t _netChanges = 0;
   uint8_t _staDiscExpectedCount = 0;
   bool _lastStaDiscExpected = false;
   int32_t _sdkStaStatus = 0;
@@ -145,7 +257,22 @@ private:
   static constexpr uint8_t kWifiLogSize = 20;
   WifiLogEntry _wifiLog[kWifiLogSize];
   uint8_t _wifiLogHead = 0;
+  LinkStats _link;
+
+  ScanEntry _scan[kMaxScanEntries];
+  uint8_t _scanCount = 0;
+  uint32_t _scanSeq = 0;
+  uint32_t _scanAtMs = 0;
+  uint32_t _scanStartMs = 0;
+  bool _scanRunning = false;
+  volatile int16_t _scanResult = -1; // set by the scan callback, >= 0 until tick() harvests it
+  uint32_t _pendingScanSeq = 0;       // connect flow: the cache it waits to see replaced
 
+  void harvestScan(int count);
+  void pollScan();
+  void registerEventHandlers();
+  void markNetChange(uint8_t bits);
+  void noteApState();
   void logWifiEvent();
   void beginPendingStaConnect();
   void expectStaDisconnect(uint8_t count = 1);
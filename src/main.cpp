@@ -2,21 +2,32 @@
 #include <ESP8266WiFi.h>
 
 #include <LittleFS.h>
+#include <WiFiUdp.h>
 #include <user_interface.h>
 
 #include "AppConfig.h"
+#include "AppLog.h"
+#include "FastConnect.h"
 #include "RelayController.h"
 #include "TimeKeeper.h"
 #include "WebUi.h"
 #include "WifiController.h"
 #include "HolidayDb.h"
+#include "HeapMonitor.h"
 #include "HistoryLog.h"
+#include "InputTrace.h"
+#include "JobQueue.h"
 #include "OtaUpdater.h"
-#include "OverrideWindows.h"
 #include "ParashaDb.h"
+#include "PerfProfiler.h"
+#include "RelayLogic.h"
 #include "RelayState.h"
+#include "RtcLayout.h"
 #include "ScheduleEngine.h"
+#include "SntpServer.h"
+#include "SpanTrace.h"
 #include "StatusIndicator.h"
+#include "TaskScheduler.h"
 #include "ZmanimDb.h"
 
 namespace {
@@ -32,9 +43,25 @@ ScheduleEngine schedule;
 StatusIndicator indicator;
 OtaUpdater ota;
 HistoryLog history;
+SntpServer sntp;
+TaskScheduler tasks;
+JobQueue jobs;
+uint8_t resetSeqTask = TaskScheduler::kInvalidTask;
+uint8_t prefetchTask = TaskScheduler::kInvalidTask;
+PerfProfiler perf;
+HeapMonitor heap;
+InputTrace trace;
+uint8_t perfTaskSlots[TaskScheduler::kMaxTasks];
+uint8_t perfLoopSlot = PerfProfiler::kInvalidSlot;
+uint8_t perfGapSlot = PerfProfiler::kInvalidSlot;
+PerfProfiler::Mark perfTaskMark;
+static_assert(PerfProfiler::kMaxSlots >= 2 + WebUi::kMaxRoutes + 1 + TaskScheduler::kMaxTasks,
+              "profiler table too small for loop/sdk, the routes and the tasks");
 } // namespace
 
 namespace {
+// Longest idle sleep per loop pass: bounds the latency of the every-pass tasks (Wi-Fi, NTP, SNTP, HTTP).
+constexpr uint32_t kLoopIdleMaxMs = 5;
 constexpr int kWifiLedGpio = 2; // Blue LED on many ESP-12 modules
 constexpr bool kWifiLedActiveLow = true;
 
@@ -50,8 +77,9 @@ void writeWifiLed(bool on) {
 }
 
 WifiLedMode wifiLedModeNow(const WifiController &w) {
-  if (WiFi.status() == WL_CONNECTED) return WifiLedMode::Connected;
-  if (w.isApMode()) return WifiLedMode::ApMode;
+  const NetState &ns = w.netState();
+  if (ns.staConnected) return WifiLedMode::Connected;
+  if (ns.apActive) return WifiLedMode::ApMode;
   return WifiLedMode::Connecting;
 }
 
@@ -105,8 +133,8 @@ const char *wifiStatusToString(wl_status_t st) {
 }
 
 void printBootInfo() {
-  Serial.printf("[boot] SmartShabat v%s\n", SHABAT_RELAY_VERSION);
-  Serial.printf("[boot] mac=%s chipId=%06x\n", WiFi.macAddress().c_str(), ESP.getChipId());
+  applog::info(applog::Module::Boot, "SmartShabat v%s", SHABAT_RELAY_VERSION);
+  applog::info(applog::Module::Boot, "mac=%s chipId=%06x", WiFi.macAddress().c_str(), ESP.getChipId());
 }
 
 struct ResetSeqState {
@@ -115,7 +143,7 @@ struct ResetSeqState {
 };
 
 constexpr uint32_t kResetSeqMagic = 0x53485253; // 'SHRS'
-constexpr uint32_t kResetSeqRtcOffsetWords = 0; // 0..127, word offset
+constexpr uint32_t kResetSeqRtcOffsetWords = rtcmem::kResetSeq; // word offset, see RtcLayout.h
 constexpr uint32_t kHardResetPresses = 5;
 constexpr uint32_t kHardResetWindowMs = 15000;
 
@@ -139,12 +167,15 @@ bool isExternalReset() {
 }
 
 void doFactoryResetNow() {
-  Serial.println(F("[reset] factory reset (button sequence)"));
+  applog::info(applog::Module::Reset, "factory reset (button sequence)");
   delay(100);
   LittleFS.format();
+  relaystate::forget();
+  fastconnect::forget();
   WiFi.disconnect(true);
   ESP.eraseConfig();
   delay(250);
+  applog::flush();
   ESP.restart();
 }
 
@@ -154,7 +185,7 @@ void printWifiInfo(const WifiController &w) {
     const String apIp = WiFi.softAPIP().toString();
     const int clients = WiFi.softAPgetStationNum();
     if (st == WL_CONNECTED) {
-      Serial.printf("[net] ap ssid=%s apIp=%s clients=%d | sta ssid=%s staIp=%s rssi=%d\n",
+      applog::info(applog::Module::Net, "ap ssid=%s apIp=%s clients=%d | sta ssid=%s staIp=%s rssi=%d",
                     w.apSsid().c_str(),
                     apIp.c_str(),
                     clients,
@@ -163,16 +194,264 @@ void printWifiInfo(const WifiController &w) {
                     WiFi.RSSI());
       return;
     }
-    Serial.printf("[net] ap ssid=%s apIp=%s clients=%d | sta=%s(%d)\n",
+    applog::info(applog::Module::Net, "ap ssid=%s apIp=%s clients=%d | sta=%s(%d)",
                   w.apSsid().c_str(),
                   apIp.c_str(),
                   clients,
                   wifiStatusToString(st),
                   static_cast<int>(st));
   } else if (st == WL_CONNECTED) {
-    Serial.printf("[net] sta ssid=%s ip=%s rssi=%d\n", WiFi.SSID().c_str(), WiFi.localIP().toString().c_str(), WiFi.RSSI());
+    applog::info(applog::Module::Net, "sta ssid=%s ip=%s rssi=%d", WiFi.SSID().c_str(), WiFi.localIP().toString().c_str(), WiFi.RSSI());
   } else {
-    Serial.printf("[net] sta=%s(%d)\n", wifiStatusToString(st), static_cast<int>(st));
+    applog::info(applog::Module::Net, "sta=%s(%d)", wifiStatusToString(st), static_cast<int>(st));
+  }
+}
+} // namespace
+
+namespace {
+uint32_t nowMs() { return millis(); }
+uint32_t nowUs() { return micros(); }
+uint32_t nowCycles() { return ESP.getCycleCount(); }
+uint64_t nowUs64() { return micros64(); }
+
+void perfTaskBefore(uint8_t) { perfTaskMark = perf.start(); }
+
+void perfTaskAfter(uint8_t id) {
+  if (id < TaskScheduler::kMaxTasks) perf.end(perfTaskSlots[id], perfTaskMark);
+}
+
+uint8_t addTask(const char *name,
+                TaskScheduler::TaskFn fn,
+                uint32_t periodMs,
+                TaskScheduler::Priority priority,
+                uint32_t deadlineMs = 0,
+                uint32_t firstDelayMs = 0) {
+  const uint8_t id = tasks.add(name, fn, periodMs, priority, millis(), deadlineMs, firstDelayMs);
+  if (id < TaskScheduler::kMaxTasks) perfTaskSlots[id] = perf.addSlot(name, PerfProfiler::Kind::Task);
+  if (id < TaskScheduler::kMaxTasks && perfTaskSlots[id] == PerfProfiler::kInvalidSlot) {
+    applog::warn(applog::Module::Boot, "no profiler slot for task %s", name);
+  }
+  return id;
+}
+
+// --- Main-loop tasks (see the table in setup()) ---
+
+void taskResetSeqWindow() {
+  // Clear the reset-sequence counter after the device has been up for a bit.
+  // This forms the "time window" for the multi-press reset sequence.
+  ResetSeqState st{};
+  if (rtcReadResetSeq(st) && st.magic == kResetSeqMagic && st.count != 0) {
+    st.count = 0;
+    rtcWriteResetSeq(st);
+  }
+  tasks.setEnabled(resetSeqTask, false);
+}
+
+void taskWifi() { wifi.tick(); }
+
+void taskTime() { timeKeeper.tick(cfg); }
+
+void taskSntp() { sntp.tick(cfg, timeKeeper); }
+
+void taskOta() {
+  // Idle: no background job (a user's OTA update, scan, sync) is running.
+  ota.tick(cfg, timeKeeper, schedule, !jobs.busy());
+  tasks.setEnabled(prefetchTask, ota.prefetching());
+}
+
+void taskPrefetch() { ota.prefetchSlice(); }
+
+void taskWeb() { web.tick(); }
+
+void taskJobs() { jobs.tick(millis()); }
+
+void taskHeap() { heap.tick(); }
+
+void taskTrace() { trace.flush(); }
+
+// Log copy over UDP, one datagram per line (`nc -ulk <port>` to watch). A line that cannot be sent
+// stays queued; if the ring wraps first it is skipped and counted, Serial is never held back.
+WiFiUDP logUdp;
+
+bool sendLogLine(const char *line, size_t len) {
+  if (WiFi.status() != WL_CONNECTED) return false;
+  IPAddress target;
+  if (!cfg.logUdpHost.length() || !target.fromString(cfg.logUdpHost)) {
+    target = IPAddress(static_cast<uint32_t>(WiFi.localIP()) | ~static_cast<uint32_t>(WiFi.subnetMask()));
+  }
+  if (!logUdp.beginPacket(target, cfg.logUdpPort)) return false;
+  logUdp.write(reinterpret_cast<const uint8_t *>(line), len);
+  return logUdp.endPacket() != 0;
+}
+
+void taskLogNet() {
+  static bool active = false;
+  if ((cfg.logUdpPort != 0) != active) {
+    active = cfg.logUdpPort != 0;
+    applog::setRemoteSink(active ? sendLogLine : nullptr);
+  }
+  applog::pumpRemote(4);
+}
+
+void taskRelay() {
+  // The clock reading the pass is about to use (recorded only on steps and keyframes).
+  timeval tv{};
+  gettimeofday(&tv, nullptr);
+  trace.clock(static_cast<int64_t>(tv.tv_sec) * 1000000LL + tv.tv_usec, cfg, relay.isOn());
+
+  const relaylogic::Pass pass = relaylogic::run(cfg, schedule, timeKeeper, relay);
+  if (pass.changed) {
+    const bool valid = timeKeeper.isTimeValid();
+    const uint32_t t = valid ? static_cast<uint32_t>(timeKeeper.nowLocal(cfg)) : 0;
+    spantrace::instant(spantrace::Lane::Relay, pass.decision.desiredRelay ? "relay.on" : "relay.off");
+    history.add(t, HistoryKind::Relay, relaylogic::transitionMessage(cfg, pass.decision));
+
+    using Cause = InputTrace::RelayCause;
+    InputTrace::RelayRecord r{};
+    r.on = pass.decision.desiredRelay;
+    r.holy = pass.decision.desiredHoly;
+    r.cause = (pass.decision.overrideApplied && pass.decision.override.active) ? Cause::Override
+              : cfg.runMode != 0                                                ? Cause::RunMode
+              : !valid                                                          ? Cause::NoClock
+                                                                                : Cause::Schedule;
+    trace.relay(r);
+  }
+}
+
+// Heartbeat log (so you can connect a monitor any time and still see status)
+void taskHeartbeat() {
+  const ScheduleStatus &st = schedule.status();
+  const time_t nowLocal = timeKeeper.isTimeValid() ? timeKeeper.nowLocal(cfg) : 0;
+  tm t{};
+  char buf[64] = "---- -- -- --:--";
+  if (nowLocal) {
+    gmtime_r(&nowLocal, &t);
+    snprintf(buf, sizeof(buf), "%04d-%02d-%02d %02d:%02d", t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min);
+  }
+
+  char nextBuf[64] = "—";
+  if (st.ok && st.nextChangeLocal) {
+    const time_t nextLocal = static_cast<time_t>(st.nextChangeLocal);
+    tm nt{};
+    gmtime_r(&nextLocal, &nt);
+    snprintf(nextBuf, sizeof(nextBuf), "%04d-%02d-%02d %02d:%02d", nt.tm_year + 1900, nt.tm_mon + 1, nt.tm_mday, nt.tm_hour, nt.tm_min);
+  }
+
+  const PerfProfiler::Slot &lp = perf.slot(perfLoopSlot);
+  const PerfProfiler::Stall &worst = perf.stall(0);
+  char perfBuf[64] = "-";
+  if (worst.slot != PerfProfiler::kInvalidSlot) {
+    snprintf(perfBuf, sizeof(perfBuf), "%s:%lums", perf.slot(worst.slot).name, static_cast<unsigned long>(worst.us / 1000UL));
+  }
+
+  const String net = wifi.staSsid().length() ? ("WiFi:" + wifi.staSsid()) : (wifi.isApMode() ? ("AP:" + wifi.apSsid()) : "offline");
+  applog::info(applog::Module::State, "%s | %s ip=%s relay=%s holy=%s next=%s(%s) loop=%lu/%luus stall=%s",
+                buf,
+                net.c_str(),
+                wifi.ipString().c_str(),
+                relay.isOn() ? "ON" : "OFF",
+                (st.ok && st.inHolyTime) ? "yes" : "no",
+                nextBuf,
+                (st.ok && st.nextStateOn) ? "ON" : "OFF",
+                static_cast<unsigned long>(lp.count ? lp.totalUs / lp.count : 0),
+                static_cast<unsigned long>(lp.maxUs),
+                perfBuf);
+}
+
+// Log network changes. WifiController bumps NetState::version from SDK events, so an idle pass
+// is one integer compare.
+void taskNetWatch() {
+  static uint32_t seenVersion = 0;
+  const NetState &ns = wifi.netState();
+  if (ns.version == seenVersion) return;
+  seenVersion = ns.version;
+  const uint8_t changes = wifi.takeNetChanges();
+
+  InputTrace::WifiRecord r{};
+  r.changes = changes;
+  r.staConnected = ns.staConnected;
+  r.apActive = ns.apActive;
+  r.apClients = ns.apClients;
+  r.channel = ns.staChannel;
+  r.disconnectReason = ns.lastDisconnectReason;
+  r.staIp = ns.staIp.v4();
+  trace.wifi(r);
+
+  printWifiInfo(wifi);
+  const uint32_t t = timeKeeper.isTimeValid() ? static_cast<uint32_t>(timeKeeper.nowLocal(cfg)) : 0;
+  if (changes & kNetStaUp) {
+    history.add(t, HistoryKind::Network, String("מחובר ל‑Wi‑Fi: ") + ns.staSsid);
+    if (cfg.ntpEnabled && !timeKeeper.isTimeValid()) {
+      timeKeeper.beginSync(cfg);
+    }
+  } else if (changes & kNetStaDown) {
+    history.add(t, HistoryKind::Network, "מנותק מ‑Wi‑Fi");
+  }
+  if (changes & kNetApUp) {
+    history.add(t, HistoryKind::Network, "Hotspot פעיל: " + wifi.apSsid());
+  }
+}
+
+void taskClockStatus() {
+  // Outside-UI indication via status LED (error code = number of blinks)
+  uint8_t indicatorError = 0;
+  const bool timeValid = timeKeeper.isTimeValid();
+  if (timeValid && !fastconnect::stats().clockMs) {
+    fastconnect::noteClock(millis());
+    const fastconnect::Stats &fc = fastconnect::stats();
+    applog::info(applog::Module::Boot, "clock valid after %lums (ip after %lums, wifi path=%s)",
+                 static_cast<unsigned long>(fc.clockMs), static_cast<unsigned long>(fc.ipMs),
+                 fastconnect::pathToString(fc.path));
+  }
+  if (!timeValid) {
+    indicatorError = StatusIndicator::kTimeInvalidCode;
+  } else if (cfg.ntpEnabled) {
+    const time_t lastSync = timeKeeper.lastNtpSyncUtc();
+    const time_t nowUtc = timeKeeper.nowUtc();
+    const bool stale =
+      (cfg.ntpResyncMinutes > 0) && lastSync > 0 &&
+      (nowUtc - lastSync) >= static_cast<time_t>(cfg.ntpResyncMinutes) * 60;
+    if (stale) {
+      indicatorError = 2;
+    } else if (timeKeeper.lastNtpAttemptFailed()) {
+      indicatorError = 3;
+    }
+  }
+
+  // History: time source changes
+  static time_t lastNtp = 0;
+  static time_t lastManual = 0;
+  if (timeKeeper.lastNtpSyncUtc() != 0 && timeKeeper.lastNtpSyncUtc() != lastNtp) {
+    lastNtp = timeKeeper.lastNtpSyncUtc();
+    const uint32_t t = timeKeeper.isTimeValid() ? static_cast<uint32_t>(timeKeeper.nowLocal(cfg)) : 0;
+    history.add(t, HistoryKind::Clock, "סנכרון שעה אוטומטי");
+  }
+  if (timeKeeper.lastManualSetUtc() != 0 && timeKeeper.lastManualSetUtc() != lastManual) {
+    lastManual = timeKeeper.lastManualSetUtc();
+    const uint32_t t = timeKeeper.isTimeValid() ? static_cast<uint32_t>(timeKeeper.nowLocal(cfg)) : 0;
+    history.add(t, HistoryKind::Clock, "השעון עודכן ידנית");
+  }
+
+  indicator.setErrorCode(static_cast<uint8_t>(indicatorError));
+}
+
+void taskLeds() {
+  indicator.tick();
+
+  // Wi‑Fi LED (outside UI)
+  static WifiLedMode lastWifiMode = WifiLedMode::Connecting;
+  static uint32_t wifiCycleStartMs = 0;
+  static bool wifiLedOn = false;
+  const WifiLedMode curWifiMode = wifiLedModeNow(wifi);
+  if (curWifiMode != lastWifiMode) {
+    lastWifiMode = curWifiMode;
+    wifiCycleStartMs = millis();
+  }
+  const uint32_t wifiElapsed = millis() - wifiCycleStartMs;
+  const bool shouldWifiOn = wifiLedPatternOn(curWifiMode, wifiElapsed);
+  if (shouldWifiOn != wifiLedOn) {
+    wifiLedOn = shouldWifiOn;
+    writeWifiLed(shouldWifiOn);
   }
 }
 } // namespace
@@ -182,24 +461,26 @@ void setup() {
   delay(50);
   Serial.println();
   Serial.println(F("SmartShabat boot"));
+  spantrace::begin(nowUs64);
 
   // Wi‑Fi status LED (blue LED on ESP module)
   pinMode(kWifiLedGpio, OUTPUT);
   writeWifiLed(false);
 
   if (!LittleFS.begin()) {
-    Serial.println(F("[fs] mount failed; formatting..."));
+    applog::warn(applog::Module::Fs, "mount failed; formatting...");
     LittleFS.format();
     if (!LittleFS.begin()) {
-      Serial.println(F("[fs] mount failed after format"));
+      applog::error(applog::Module::Fs, "mount failed after format");
     }
   } else {
-    Serial.println(F("[fs] mounted"));
+    applog::info(applog::Module::Fs, "mounted");
   }
 
   if (!appcfg::load(cfg)) {
     appcfg::save(cfg);
   }
+  applog::setLevels(cfg.logLevels);
 
   // Migration: ensure OTA manifest has a sensible default so the product works out of the box,
   // even if an older config exists on LittleFS.
@@ -211,7 +492,7 @@ void setup() {
   // Product behavior: treat HTTP manifest URLs as temporary/local overrides.
   // After any reboot, revert to the built-in default OTA URL so the device is always configured normally.
   if (cfg.otaManifestUrl.startsWith("http://") && cfg.otaManifestUrl != String(SHABAT_RELAY_DEFAULT_OTA_URL)) {
-    Serial.println(F("[ota] temporary manifest override detected; reverting to default"));
+    applog::info(applog::Module::Ota, "temporary manifest override detected; reverting to default");
     cfg.otaManifestUrl = SHABAT_RELAY_DEFAULT_OTA_URL;
     appcfg::save(cfg);
   }
@@ -223,15 +504,15 @@ void setup() {
   }
 
   printBootInfo();
-  Serial.printf("[led] wifiGpio=%d clockGpio=%d\n", kWifiLedGpio, cfg.statusLedGpio);
-  Serial.printf("[cfg] tz=UTC%+d:%02d dstMode=%u ntp=%s server=%s resync=%umin\n",
+  applog::info(applog::Module::Cfg, "led wifiGpio=%d clockGpio=%d", kWifiLedGpio, cfg.statusLedGpio);
+  applog::info(applog::Module::Cfg, "tz=UTC%+d:%02d dstMode=%u ntp=%s server=%s resync=%umin",
                 cfg.tzOffsetMinutes / 60,
                 abs(cfg.tzOffsetMinutes % 60),
                 static_cast<unsigned>(cfg.dstMode),
                 cfg.ntpEnabled ? "on" : "off",
                 cfg.ntpServer.c_str(),
                 static_cast<unsigned>(cfg.ntpResyncMinutes));
-  Serial.printf("[cfg] offsets beforeShkia=%d afterMotzai=%d runMode=%u\n",
+  applog::info(applog::Module::Cfg, "offsets beforeShkia=%d afterMotzai=%d runMode=%u",
                 cfg.minutesBeforeShkia,
                 cfg.minutesAfterTzeit,
                 static_cast<unsigned>(cfg.runMode));
@@ -240,7 +521,11 @@ void setup() {
   bool lastRelayOn = false;
   const bool restored = relaystate::load(lastRelayOn);
   relay.begin(cfg, lastRelayOn);
-  Serial.printf("[relay] restored=%s%s\n", lastRelayOn ? "ON" : "OFF", restored ? "" : " (default)");
+  applog::info(applog::Module::Relay, "restored=%s%s from=%s flashWrites=%lu",
+                lastRelayOn ? "ON" : "OFF",
+                restored ? "" : " (default)",
+                relaystate::sourceToString(relaystate::stats().loadedFrom),
+                static_cast<unsigned long>(relaystate::stats().lifetimeWrites));
 
   // "Hard reset" using the physical RESET button:
   // ESP8266 can't measure a long-press of RESET (CPU is held in reset), so we implement a safe sequence:
@@ -262,7 +547,7 @@ void setup() {
     rtcWriteResetSeq(st);
 
     if (st.count > 0) {
-      Serial.printf("[reset] extResetCount=%lu/%lu\n",
+      applog::info(applog::Module::Reset, "extResetCount=%lu/%lu",
                     static_cast<unsigned long>(st.count),
                     static_cast<unsigned long>(kHardResetPresses));
     }
@@ -285,14 +570,25 @@ void setup() {
 
   // If the clock isn't valid yet, optionally force a deterministic boot relay mode.
   // This runs only in Auto run-mode; explicit "Chol"/"Shabbat" run-modes already override behavior.
-  if (!timeKeeper.isTimeValid() && cfg.runMode == 0) {
-    if (cfg.relayBootMode == 1 || cfg.relayBootMode == 2) {
-      const bool desiredHoly = (cfg.relayBootMode == 2);
-      const bool desiredPhysical = cfg.relayHolyOnNo ? desiredHoly : !desiredHoly;
-      relay.setOn(desiredPhysical);
-      relaystate::save(desiredPhysical);
-      Serial.printf("[relay] bootMode=%u applied\n", static_cast<unsigned>(cfg.relayBootMode));
-    }
+  bool bootRelayOn = false;
+  if (relaylogic::bootState(cfg, timeKeeper.isTimeValid(), bootRelayOn)) {
+    relay.setOn(bootRelayOn);
+    relaystate::save(bootRelayOn);
+    applog::info(applog::Module::Relay, "bootMode=%u applied", static_cast<unsigned>(cfg.relayBootMode));
+  }
+
+  // Input trace: the config snapshot first, so a replay boots with the settings this boot used.
+  trace.begin(nowCycles, ESP.getCpuFreqMHz(), nowMs);
+  trace.setMode(static_cast<InputTrace::Mode>(cfg.traceMode));
+  trace.config(cfg);
+  {
+    const rst_info *info = ESP.getResetInfoPtr();
+    InputTrace::BootRecord r{};
+    r.reason = info ? static_cast<uint8_t>(info->reason) : 0;
+    r.restoredOn = lastRelayOn;
+    r.source = static_cast<uint8_t>(relaystate::stats().loadedFrom);
+    r.relayOn = relay.isOn();
+    trace.boot(r);
   }
 
   history.begin();
@@ -302,195 +598,63 @@ void setup() {
   holidays.begin();
   parasha.begin();
   schedule.begin(zmanim, holidays, parasha);
-  ota.begin();
+  heap.begin();
+  ota.begin(heap);
 
   wifi.begin(cfg);
   printWifiInfo(wifi);
   timeKeeper.begin(cfg);
-
-  web.begin(cfg, wifi, timeKeeper, relay, zmanim, holidays, schedule, ota, indicator, history);
-  Serial.printf("[web] url=http://%s/\n", wifi.ipString().c_str());
+  sntp.begin(cfg);
+
+  perf.begin(nowCycles, ESP.getCpuFreqMHz(), nowUs, nowMs);
+  perfLoopSlot = perf.addSlot("loop", PerfProfiler::Kind::Loop);
+  perfGapSlot = perf.addSlot("sdk", PerfProfiler::Kind::Loop); // between passes: core/Wi‑Fi stack work
+
+  jobs.begin(ESP.random() & 0xFFFFFF);
+  web.begin(cfg, wifi, timeKeeper, relay, zmanim, holidays, schedule, ota, indicator, history, sntp, tasks, jobs, perf, heap, trace);
+  applog::info(applog::Module::Web, "url=http://%s/", wifi.ipString().c_str());
+
+  // Task table: period (0 = every pass), priority, deadline (allowed lateness), first-run delay.
+  // Relay evaluation is Critical so a slow HTTP request can only delay it until the request returns;
+  // long operations (OTA, NTP sync, Wi-Fi scan) are background jobs that take one short step per run.
+  using P = TaskScheduler::Priority;
+  tasks.setMicros(nowUs);
+  tasks.setHooks(perfTaskBefore, perfTaskAfter);
+  addTask("relay", taskRelay, 250, P::Critical, 250);
+  addTask("wifi", taskWifi, 0, P::High);
+  addTask("time", taskTime, 0, P::High);
+  addTask("sntp", taskSntp, 0, P::High);
+  addTask("netwatch", taskNetWatch, 50, P::Normal);
+  addTask("clock", taskClockStatus, 1000, P::Normal);
+  addTask("leds", taskLeds, 20, P::Normal);
+  addTask("ota", taskOta, 1000, P::Low);
+  addTask("web", taskWeb, 0, P::Low);
+  addTask("jobs", taskJobs, 20, P::Low);
+  addTask("heap", taskHeap, 10000UL, P::Low);
+  addTask("trace", taskTrace, 30000UL, P::Low, 0, 30000UL);
+  addTask("lognet", taskLogNet, 50, P::Low);
+  addTask("heartbeat", taskHeartbeat, 300000UL, P::Low, 0, 300000UL);
+  resetSeqTask = addTask("resetseq", taskResetSeqWindow, 0, P::Low, 0, kHardResetWindowMs);
+  // Background OTA download slices; the "ota" task switches it on while a prefetch runs.
+  prefetchTask = addTask("prefetch", taskPrefetch, 20, P::Low);
+  tasks.setEnabled(prefetchTask, false);
 }
 
 void loop() {
-  // Clear the reset-sequence counter after the device has been up for a bit.
-  // This forms the "time window" for the multi-press reset sequence.
-  static bool resetSeqCleared = false;
-  static uint32_t resetSeqStartMs = millis();
-  if (!resetSeqCleared && (millis() - resetSeqStartMs) > kHardResetWindowMs) {
-    ResetSeqState st{};
-    if (rtcReadResetSeq(st) && st.magic == kResetSeqMagic && st.count != 0) {
-      st.count = 0;
-      rtcWriteResetSeq(st);
-    }
-    resetSeqCleared = true;
-  }
-
-  wifi.tick();
-  timeKeeper.tick(cfg);
-
-  schedule.tick(cfg, timeKeeper);
-  ota.tick(cfg, timeKeeper, schedule);
-  const bool timeValid = timeKeeper.isTimeValid();
-
-  // "Holy mode" target (Shabbat/Hag) - independent from relay wiring.
-  bool desiredHoly = schedule.desiredRelayOn();
-  if (cfg.runMode == 1) desiredHoly = false;     // force Chol
-  else if (cfg.runMode == 2) desiredHoly = true; // force Shabbat/Hag
-
-  // Map desired mode to the physical relay (NC/NO contact mapping).
-  bool baseDesired = cfg.relayHolyOnNo ? desiredHoly : !desiredHoly;
-
-  // If the clock isn't set yet, keep the last known relay state (product behavior after power loss).
-  if (!timeValid && cfg.runMode == 0) {
-    if (cfg.relayBootMode == 1) {
-      const bool cholHoly = false;
-      baseDesired = cfg.relayHolyOnNo ? cholHoly : !cholHoly;
-    } else if (cfg.relayBootMode == 2) {
-      const bool shabatHoly = true;
-      baseDesired = cfg.relayHolyOnNo ? shabatHoly : !shabatHoly;
-    } else {
-      baseDesired = relay.isOn();
-    }
-  }
-
-  const uint32_t nowUtc = static_cast<uint32_t>(timeKeeper.nowUtc());
-  bool desiredRelay = baseDesired;
-  ActiveWindowOverride activeOv{};
-  const bool windowOverrideApplied = overridesApply(cfg, nowUtc, baseDesired, desiredRelay, activeOv);
-
-  const bool relayChanged = (desiredRelay != relay.isOn());
-  if (relayChanged) {
-    const uint32_t t = timeValid ? static_cast<uint32_t>(timeKeeper.nowLocal(cfg)) : 0;
-    if (windowOverrideApplied && activeOv.active) {
-      history.add(t, HistoryKind::Relay, desiredRelay ? "חלון ידני: הריליי הופעל" : "חלון ידני: הריליי כובה");
-    } else if (cfg.runMode == 1) {
-      history.add(t, HistoryKind::Relay, "מצב חול");
-    } else if (cfg.runMode == 2) {
-      history.add(t, HistoryKind::Relay, "מצב שבת/חג");
-    } else {
-      history.add(t, HistoryKind::Relay, desiredHoly ? "כניסה לשבת/חג" : "יציאה משבת/חג");
-    }
-  }
-  relay.setOn(desiredRelay);
-  if (relayChanged) {
-    relaystate::save(desiredRelay);
-  }
-
-  // Heartbeat log (so you can connect a monitor any time and still see status)
-  static uint32_t lastHbMs = 0;
-  if (millis() - lastHbMs > 300000UL) { // 5 minutes
-    lastHbMs = millis();
-    const ScheduleStatus st = schedule.status();
-    const time_t nowLocal = timeKeeper.isTimeValid() ? timeKeeper.nowLocal(cfg) : 0;
-    tm t{};
-    char buf[64] = "---- -- -- --:--";
-    if (nowLocal) {
-      gmtime_r(&nowLocal, &t);
-      snprintf(buf, sizeof(buf), "%04d-%02d-%02d %02d:%02d", t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min);
-    }
-
-    char nextBuf[64] = "—";
-    if (st.ok && st.nextChangeLocal) {
-      const time_t nextLocal = static_cast<time_t>(st.nextChangeLocal);
-      tm nt{};
-      gmtime_r(&nextLocal, &nt);
-      snprintf(nextBuf, sizeof(nextBuf), "%04d-%02d-%02d %02d:%02d", nt.tm_year + 1900, nt.tm_mon + 1, nt.tm_mday, nt.tm_hour, nt.tm_min);
-    }
-
-    const String net = wifi.staSsid().length() ? ("WiFi:" + wifi.staSsid()) : (wifi.isApMode() ? ("AP:" + wifi.apSsid()) : "offline");
-    Serial.printf("[state] %s | %s ip=%s relay=%s holy=%s next=%s(%s)\n",
-                  buf,
-                  net.c_str(),
-                  wifi.ipString().c_str(),
-                  relay.isOn() ? "ON" : "OFF",
-                  (st.ok && st.inHolyTime) ? "yes" : "no",
-                  nextBuf,
-                  (st.ok && st.nextStateOn) ? "ON" : "OFF");
-  }
-
-  // Log network changes (only when something meaningful changes)
-  static wl_status_t lastStaStatus = WL_IDLE_STATUS;
-  static bool lastApMode = false;
-  static String lastIp;
-  static String lastSta;
-  static String lastApSsid;
-  const wl_status_t staStatus = WiFi.status();
-  const bool ap = wifi.isApMode();
-  const String ip = wifi.ipString();
-  const String sta = wifi.staSsid();
-  const String apSsid = wifi.apSsid();
-  if (staStatus != lastStaStatus || ap != lastApMode || ip != lastIp || sta != lastSta || apSsid != lastApSsid) {
-    printWifiInfo(wifi);
-    const uint32_t t = timeKeeper.isTimeValid() ? static_cast<uint32_t>(timeKeeper.nowLocal(cfg)) : 0;
-    if (staStatus == WL_CONNECTED && lastStaStatus != WL_CONNECTED) {
-      history.add(t, HistoryKind::Network, "מחובר ל‑Wi‑Fi: " + WiFi.SSID());
-      if (cfg.ntpEnabled && !timeKeeper.isTimeValid()) {
-        timeKeeper.syncNtpNow(cfg);
-      }
-    } else if (lastStaStatus == WL_CONNECTED && staStatus != WL_CONNECTED) {
-      history.add(t, HistoryKind::Network, "מנותק מ‑Wi‑Fi");
-    }
-    if (ap && !lastApMode) {
-      history.add(t, HistoryKind::Network, "Hotspot פעיל: " + apSsid);
-    }
-    lastStaStatus = staStatus;
-    lastApMode = ap;
-    lastIp = ip;
-    lastSta = sta;
-    lastApSsid = apSsid;
-  }
-
-  // Outside-UI indication via status LED (error code = number of blinks)
-  uint8_t indicatorError = 0;
-  if (!timeKeeper.isTimeValid()) {
-    indicatorError = StatusIndicator::kTimeInvalidCode;
-  } else if (cfg.ntpEnabled) {
-    const time_t lastSync = timeKeeper.lastNtpSyncUtc();
-    const time_t nowUtc = timeKeeper.nowUtc();
-    const bool stale =
-      (cfg.ntpResyncMinutes > 0) && lastSync > 0 &&
-      (nowUtc - lastSync) >= static_cast<time_t>(cfg.ntpResyncMinutes) * 60;
-    if (stale) {
-      indicatorError = 2;
-    } else if (timeKeeper.lastNtpAttemptFailed()) {
-      indicatorError = 3;
-    }
-  }
-
-  // History: time source changes
-  static time_t lastNtp = 0;
-  static time_t lastManual = 0;
-  if (timeKeeper.lastNtpSyncUtc() != 0 && timeKeeper.lastNtpSyncUtc() != lastNtp) {
-    lastNtp = timeKeeper.lastNtpSyncUtc();
-    const uint32_t t = timeKeeper.isTimeValid() ? static_cast<uint32_t>(timeKeeper.nowLocal(cfg)) : 0;
-    history.add(t, HistoryKind::Clock, "סנכרון שעה אוטומטי");
-  }
-  if (timeKeeper.lastManualSetUtc() != 0 && timeKeeper.lastManualSetUtc() != lastManual) {
-    lastManual = timeKeeper.lastManualSetUtc();
-    const uint32_t t = timeKeeper.isTimeValid() ? static_cast<uint32_t>(timeKeeper.nowLocal(cfg)) : 0;
-    history.add(t, HistoryKind::Clock, "השעון עודכן ידנית");
-  }
-
-  indicator.setErrorCode(static_cast<uint8_t>(indicatorError));
-  indicator.tick();
-
-  // Wi‑Fi LED (outside UI)
-  static WifiLedMode lastWifiMode = WifiLedMode::Connecting;
-  static uint32_t wifiCycleStartMs = 0;
-  static bool wifiLedOn = false;
-  const WifiLedMode curWifiMode = wifiLedModeNow(wifi);
-  if (curWifiMode != lastWifiMode) {
-    lastWifiMode = curWifiMode;
-    wifiCycleStartMs = millis();
-  }
-  const uint32_t wifiElapsed = millis() - wifiCycleStartMs;
-  const bool shouldWifiOn = wifiLedPatternOn(curWifiMode, wifiElapsed);
-  if (shouldWifiOn != wifiLedOn) {
-    wifiLedOn = shouldWifiOn;
-    writeWifiLed(shouldWifiOn);
-  }
-
-  web.tick();
-  delay(5);
+  static PerfProfiler::Mark gapMark;
+  static bool gapStarted = false;
+  if (gapStarted) perf.end(perfGapSlot, gapMark);
+
+  const PerfProfiler::Mark passMark = perf.start();
+  tasks.runDue(nowMs);
+  perf.end(perfLoopSlot, passMark);
+  applog::drain();
+
+  // Sleep until the next timed task instead of spinning; delay() also lets the Wi-Fi stack run.
+  // Kept outside the "sdk" gap so idle time does not show up as a stall.
+  const uint32_t idleMs = tasks.msUntilNext(millis());
+  if (idleMs) delay(idleMs < kLoopIdleMaxMs ? idleMs : kLoopIdleMaxMs);
+
+  gapMark = perf.start();
+  gapStarted = true;
 }
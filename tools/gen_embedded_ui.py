@@ -1,6 +1,9 @@
 #!/usr/bin/env python3
 from __future__ import annotations
 
+import gzip
+import hashlib
+import re
 from pathlib import Path
 
 
@@ -8,53 +11,128 @@ ROOT = Path(__file__).resolve().parents[1]
 DATA_DIR = ROOT / "data"
 OUT = ROOT / "src" / "EmbeddedUi.h"
 
+# Rough 802.11b goodput on the device hotspot with a phone at range, for the page-load estimate.
+HOTSPOT_BYTES_PER_SEC = 150_000
+
 
 def read_utf8(path: Path) -> str:
     return path.read_text(encoding="utf-8")
 
 
-def choose_delim(contents: str, base: str) -> str:
-    delim = base
-    i = 0
-    while f'){delim}"' in contents:
-        i += 1
-        delim = f"{base}_{i}"
-    return delim
+# Conservative minifiers: whitespace and comments only, line structure kept where it matters
+# (JS keeps its newlines so automatic semicolon insertion is untouched). gzip does the rest.
+def minify_html(text: str) -> str:
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line)
+
+
+def minify_css(text: str) -> str:
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{};,])\s*", r"\1", text)
+    text = re.sub(r":\s+", ":", text)
+    text = text.replace(";}", "}")
+    return text.strip()
 
 
-def raw_literal(var_name: str, mime_comment: str, contents: str, base_delim: str) -> str:
-    delim = choose_delim(contents, base_delim)
+def minify_js(text: str) -> str:
+    out = []
+    for line in text.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        out.append(line)
+    return "\n".join(out)
+
+
+class Asset:
+    def __init__(self, var: str, path: str, mime: str, source: str, text: str) -> None:
+        self.var = var
+        self.path = path
+        self.mime = mime
+        self.source_bytes = len(source.encode("utf-8"))
+        self.minified = text.encode("utf-8")
+        # mtime=0 keeps the output (and the hash) reproducible.
+        self.gz = gzip.compress(self.minified, compresslevel=9, mtime=0)
+        self.hash = hashlib.sha256(self.minified).hexdigest()[:10]
+
+    def hashed_path(self) -> str:
+        stem, dot, ext = self.path.rpartition(".")
+        return f"{stem}.{self.hash}.{ext}"
+
+
+def c_bytes(data: bytes) -> str:
+    rows = []
+    for i in range(0, len(data), 20):
+        rows.append("  " + ", ".join(f"0x{b:02x}" for b in data[i : i + 20]) + ",")
+    return "\n".join(rows)
+
+
+def emit(asset: Asset, url: str) -> str:
     return (
-        f"// {mime_comment}\n"
-        f"static const char {var_name}[] PROGMEM = R\"{delim}(\n"
-        f"{contents}\n"
-        f"){delim}\";\n"
+        f"// {asset.path} ({asset.mime}): {asset.source_bytes} B source, {len(asset.minified)} B minified, "
+        f"{len(asset.gz)} B gzip\n"
+        f"static const uint8_t {asset.var}Gz[] PROGMEM = {{\n{c_bytes(asset.gz)}\n}};\n"
+        f"static const EmbeddedAsset {asset.var} = {{\"{url}\", \"{asset.mime}\", \"\\\"{asset.hash}\\\"\", "
+        f"{asset.var}Gz, sizeof({asset.var}Gz)}};\n"
     )
 
 
 def main() -> None:
-    index_html = read_utf8(DATA_DIR / "index.html").rstrip("\n")
-    styles_css = read_utf8(DATA_DIR / "styles.css").rstrip("\n")
-    app_js = read_utf8(DATA_DIR / "app.js").rstrip("\n")
+    index_src = read_utf8(DATA_DIR / "index.html")
+    styles_src = read_utf8(DATA_DIR / "styles.css")
+    app_src = read_utf8(DATA_DIR / "app.js")
+
+    styles = Asset("kEmbeddedStylesCss", "/styles.css", "text/css; charset=utf-8", styles_src, minify_css(styles_src))
+    app = Asset("kEmbeddedAppJs", "/app.js", "application/javascript; charset=utf-8", app_src, minify_js(app_src))
+
+    # The page references the hashed URLs, which can then be cached forever.
+    index_min = minify_html(index_src)
+    for a in (styles, app):
+        ref = f'"{a.path}"'
+        if ref not in index_min:
+            raise SystemExit(f"index.html does not reference {a.path}")
+        index_min = index_min.replace(ref, f'"{a.hashed_path()}"')
+    index = Asset("kEmbeddedIndexHtml", "/", "text/html; charset=utf-8", index_src, index_min)
 
     out = []
     out.append("#pragma once\n")
     out.append("\n")
     out.append("#include <pgmspace.h>\n")
+    out.append("#include <stddef.h>\n")
+    out.append("#include <stdint.h>\n")
     out.append("\n")
-    out.append("// Embedded UI assets (served directly from flash).\n")
-    out.append("// Generated by tools/gen_embedded_ui.py from /data.\n")
-    out.append("\n")
-
-    out.append(raw_literal("kEmbeddedIndexHtml", "text/html", index_html, "SMARTSHABAT_HTML"))
-    out.append("\n")
-    out.append(raw_literal("kEmbeddedStylesCss", "text/css", styles_css, "SMARTSHABAT_CSS"))
-    out.append("\n")
-    out.append(raw_literal("kEmbeddedAppJs", "application/javascript", app_js, "SMARTSHABAT_JS"))
+    out.append("// Embedded UI assets, minified and gzipped (served as-is with Content-Encoding: gzip).\n")
+    out.append("// Generated by tools/gen_embedded_ui.py from /data; `etag` is a hash of the minified content,\n")
+    out.append("// and the CSS/JS `path` carries it so those URLs never change content.\n")
+    out.append("struct EmbeddedAsset {\n")
+    out.append("  const char *path;\n")
+    out.append("  const char *mime;\n")
+    out.append("  const char *etag;\n")
+    out.append("  const uint8_t *gz;\n")
+    out.append("  size_t gzLen;\n")
+    out.append("};\n")
+    for a, url in ((index, "/"), (styles, styles.hashed_path()), (app, app.hashed_path())):
+        out.append("\n")
+        out.append(emit(a, url))
 
     OUT.write_text("".join(out), encoding="utf-8")
 
+    assets = (index, styles, app)
+    source = sum(a.source_bytes for a in assets)
+    packed = sum(len(a.gz) for a in assets)
+    print(f"{'asset':<12} {'source':>8} {'minified':>9} {'gzip':>7}")
+    for a in assets:
+        print(f"{a.path:<12} {a.source_bytes:>8} {len(a.minified):>9} {len(a.gz):>7}")
+    print(f"{'total':<12} {source:>8} {sum(len(a.minified) for a in assets):>9} {packed:>7}")
+    print(f"flash saved: {source - packed} B ({100 * (source - packed) / source:.0f}%)")
+    print(
+        f"first page load at ~{HOTSPOT_BYTES_PER_SEC // 1000} kB/s: "
+        f"{1000 * source / HOTSPOT_BYTES_PER_SEC:.0f} ms -> {1000 * packed / HOTSPOT_BYTES_PER_SEC:.0f} ms; "
+        f"repeat loads: index only ({len(index.gz)} B, or a 304)"
+    )
+
 
 if __name__ == "__main__":
     main()
-
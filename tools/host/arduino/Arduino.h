@@ -0,0 +1,229 @@
+#pragma once
+
+// Minimal Arduino/ESP8266 core for host builds of the firmware's logic modules (see HostRuntime.h).
+// Only what the portable parts of src/ touch is provided; networking is inert and time is virtual.
+
+#include <ctype.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include "pgmspace.h"
+
+#ifndef SHABAT_RELAY_VERSION
+#define SHABAT_RELAY_VERSION "host"
+#endif
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper *>(p))
+#define PSTR(s) (s)
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+template <class T> const T &min(const T &a, const T &b) { return a < b ? a : b; }
+template <class T> const T &max(const T &a, const T &b) { return a > b ? a : b; }
+template <class T> T constrain(T v, T lo, T hi) { return v < lo ? lo : (v > hi ? hi : v); }
+
+// Heap-backed like the core's String; every (re)allocation is counted by HostRuntime.
+class String {
+public:
+  String(const char *s = "");
+  String(const String &other);
+  String(String &&other) noexcept;
+  String(const __FlashStringHelper *s);
+  explicit String(char c);
+  String(int v, unsigned char base = 10);
+  String(unsigned v, unsigned char base = 10);
+  String(long v, unsigned char base = 10);
+  String(unsigned long v, unsigned char base = 10);
+  String(long long v);
+  String(unsigned long long v);
+  String(double v, unsigned char decimals = 2);
+  ~String();
+
+  String &operator=(const String &other);
+  String &operator=(String &&other) noexcept;
+  String &operator=(const char *s);
+  String &operator=(const __FlashStringHelper *s);
+
+  bool concat(const char *s, unsigned len);
+  bool concat(const char *s) { return concat(s, s ? strlen(s) : 0); }
+  bool concat(const String &s) { return concat(s.c_str(), s.length()); }
+  bool concat(char c) { return concat(&c, 1); }
+  String &operator+=(const String &s) { concat(s); return *this; }
+  String &operator+=(const char *s) { concat(s); return *this; }
+  String &operator+=(const __FlashStringHelper *s) { concat(reinterpret_cast<const char *>(s)); return *this; }
+  String &operator+=(char c) { concat(c); return *this; }
+  String &operator+=(int v) { return *this += String(v); }
+  String &operator+=(unsigned v) { return *this += String(v); }
+  String &operator+=(long v) { return *this += String(v); }
+  String &operator+=(unsigned long v) { return *this += String(v); }
+  String &operator+=(long long v) { return *this += String(v); }
+  String &operator+=(unsigned long long v) { return *this += String(v); }
+  String &operator+=(double v) { return *this += String(v); }
+
+  friend String operator+(const String &a, const String &b) { String r(a); r += b; return r; }
+  friend String operator+(const String &a, const char *b) { String r(a); r += b; return r; }
+  friend String operator+(const char *a, const String &b) { String r(a); r += b; return r; }
+  friend String operator+(const String &a, char b) { String r(a); r += b; return r; }
+
+  bool operator==(const String &o) const { return _len == o._len && memcmp(c_str(), o.c_str(), _len) == 0; }
+  bool operator==(const char *s) const { return strcmp(c_str(), s ? s : "") == 0; }
+  bool operator!=(const String &o) const { return !(*this == o); }
+  bool operator!=(const char *s) const { return !(*this == s); }
+  bool operator<(const String &o) const { return strcmp(c_str(), o.c_str()) < 0; }
+  explicit operator bool() const { return true; }
+
+  char operator[](unsigned i) const { return i < _len ? _buf[i] : '\0'; }
+  char &operator[](unsigned i);
+  char charAt(unsigned i) const { return (*this)[i]; }
+
+  unsigned length() const { return _len; }
+  bool isEmpty() const { return _len == 0; }
+  const char *c_str() const { return _buf ? _buf : ""; }
+  char *begin() { return _buf; }
+  const char *begin() const { return c_str(); }
+  bool reserve(unsigned cap);
+
+  bool startsWith(const String &p) const;
+  bool endsWith(const String &s) const;
+  bool equalsIgnoreCase(const String &o) const;
+  int indexOf(char c, unsigned from = 0) const;
+  int indexOf(const char *s, unsigned from = 0) const;
+  int indexOf(const String &s, unsigned from = 0) const { return indexOf(s.c_str(), from); }
+  int lastIndexOf(char c) const;
+  String substring(unsigned from) const { return substring(from, _len); }
+  String substring(unsigned from, unsigned to) const;
+
+  void trim();
+  void toLowerCase();
+  void toUpperCase();
+  void replace(char from, char to);
+  void replace(const String &from, const String &to);
+  void remove(unsigned index) { remove(index, _len > index ? _len - index : 0); }
+  void remove(unsigned index, unsigned count);
+  long toInt() const { return atol(c_str()); }
+  float toFloat() const { return static_cast<float>(atof(c_str())); }
+
+private:
+  char *_buf = nullptr;
+  unsigned _len = 0;
+  unsigned _cap = 0;
+
+  void assign(const char *s, unsigned len);
+};
+
+class Print {
+public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buf, size_t len);
+  size_t write(const char *s) { return write(reinterpret_cast<const uint8_t *>(s), strlen(s)); }
+  size_t write(const char *s, size_t len) { return write(reinterpret_cast<const uint8_t *>(s), len); }
+  size_t print(const String &s) { return write(s.c_str(), s.length()); }
+  size_t print(const char *s) { return write(s); }
+  size_t print(const __FlashStringHelper *s) { return write(reinterpret_cast<const char *>(s)); }
+  size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+  size_t print(int v) { return printf("%d", v); }
+  size_t print(unsigned v) { return printf("%u", v); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t print(unsigned long v) { return printf("%lu", v); }
+  size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+  size_t println() { return write("\r\n"); }
+  template <class T> size_t println(const T &v) { return print(v) + println(); }
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+  size_t printf_P(const char *fmt, ...);
+  virtual int availableForWrite() { return 256; }
+  virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  size_t readBytes(char *buf, size_t len);
+  size_t readBytes(uint8_t *buf, size_t len) { return readBytes(reinterpret_cast<char *>(buf), len); }
+  void setTimeout(unsigned long) {}
+};
+
+// Echoes to stdout unless muted with hostrt::setSerialEcho(false).
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buf, size_t len) override;
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void setDebugOutput(bool) {}
+};
+
+extern HardwareSerial Serial;
+
+#include "IPAddress.h"
+
+struct rst_info {
+  uint32_t reason;
+  uint32_t exccause;
+  uint32_t epc1, epc2, epc3, excvaddr, depc;
+};
+
+enum {
+  REASON_DEFAULT_RST = 0,
+  REASON_WDT_RST,
+  REASON_EXCEPTION_RST,
+  REASON_SOFT_WDT_RST,
+  REASON_SOFT_RESTART,
+  REASON_DEEP_SLEEP_AWAKE,
+  REASON_EXT_SYS_RST,
+};
+
+// RTC user memory survives hostrt::warmReset() and is cleared by hostrt::powerLoss().
+class EspClass {
+public:
+  uint32_t getChipId() { return 0x00C0FFEE; }
+  bool rtcUserMemoryRead(uint32_t offset, uint32_t *data, size_t size);
+  bool rtcUserMemoryWrite(uint32_t offset, uint32_t *data, size_t size);
+  rst_info *getResetInfoPtr();
+  String getResetReason();
+  uint32_t getFreeHeap() { return 40000; }
+  uint16_t getMaxFreeBlockSize() { return 32000; }
+  uint8_t getHeapFragmentation() { return 5; }
+  void getHeapStats(uint32_t *hfree, uint16_t *hmax, uint8_t *hfrag);
+  uint32_t getFreeContStack() { return 3000; }
+  void resetFreeContStack() {}
+  uint32_t getCycleCount();
+  uint8_t getCpuFreqMHz() { return 80; }
+  void restart();
+};
+
+extern EspClass ESP;
@@ -0,0 +1,29 @@
+#pragma once
+
+// Inert radio: never connects and never resolves, so network paths stay idle on the host.
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL,
+  WL_SCAN_COMPLETED,
+  WL_CONNECTED,
+  WL_CONNECT_FAILED,
+  WL_CONNECTION_LOST,
+  WL_WRONG_PASSWORD,
+  WL_DISCONNECTED,
+} wl_status_t;
+
+class ESP8266WiFiClass {
+public:
+  wl_status_t status() { return WL_DISCONNECTED; }
+  int hostByName(const char *, IPAddress &) { return 0; }
+  int hostByName(const char *, IPAddress &, uint32_t) { return 0; }
+  IPAddress localIP() { return IPAddress(); }
+};
+
+extern ESP8266WiFiClass WiFi;
+
+#include "WiFiUdp.h"
@@ -0,0 +1,43 @@
+#pragma once
+
+// Control surface of the host Arduino shim (tools/host/arduino).
+//
+// Time is virtual: millis()/micros() follow a monotonic counter that only moves when a tool calls
+// advanceUs(), and time()/gettimeofday()/settimeofday() are redirected to a virtual wall clock
+// (link with -Wl,--wrap=time,--wrap=gettimeofday,--wrap=settimeofday). Like the ESP8266, a restart
+// zeroes both clocks; RTC user memory survives a warm reset but not a power loss; LittleFS survives both.
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace hostrt {
+
+void advanceUs(uint64_t us);
+uint64_t monoUs();
+int64_t wallUs();
+void setWallUs(int64_t us);
+
+// Chip restart. `reason` is what ESP.getResetInfoPtr() reports afterwards (REASON_*).
+void warmReset(uint32_t reason);
+void powerLoss();
+// Set by ESP.restart(); the tool decides when to perform the reset.
+bool takeRestartRequest();
+
+int pinLevel(uint8_t pin);
+void setSerialEcho(bool on);
+
+// Heap allocations made through String plus anything the tool routes through countAllocation().
+void countAllocation();
+uint64_t allocationCount();
+
+struct FsStats {
+  uint32_t opensForWrite = 0; // "w" opens (truncate + rewrite)
+  uint32_t opensForAppend = 0;
+  uint32_t removes = 0;
+  uint32_t renames = 0;
+  uint64_t bytesWritten = 0;
+};
+const FsStats &fsStats();
+void formatFs();
+
+} // namespace hostrt
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+class String;
+
+class IPAddress {
+public:
+  IPAddress() = default;
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _b{a, b, c, d} {}
+  IPAddress(uint32_t v) { *this = fromV4(v); }
+
+  uint8_t operator[](int i) const { return _b[i & 3]; }
+  uint8_t &operator[](int i) { return _b[i & 3]; }
+  bool operator==(const IPAddress &o) const { return v4() == o.v4(); }
+  bool operator!=(const IPAddress &o) const { return v4() != o.v4(); }
+  operator uint32_t() const { return v4(); }
+
+  // Network byte order in memory, like lwIP.
+  uint32_t v4() const {
+    return static_cast<uint32_t>(_b[0]) | (static_cast<uint32_t>(_b[1]) << 8) | (static_cast<uint32_t>(_b[2]) << 16) |
+           (static_cast<uint32_t>(_b[3]) << 24);
+  }
+  bool isSet() const { return v4() != 0; }
+  bool fromString(const char *s) {
+    unsigned a, b, c, d;
+    char tail;
+    if (!s || sscanf(s, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+      return false;
+    }
+    *this = IPAddress(a, b, c, d);
+    return true;
+  }
+  bool fromString(const String &s);
+  String toString() const;
+
+private:
+  uint8_t _b[4] = {0, 0, 0, 0};
+
+  static IPAddress fromV4(uint32_t v) {
+    return IPAddress(v & 0xFF, (v >> 8) & 0xFF, (v >> 16) & 0xFF, (v >> 24) & 0xFF);
+  }
+};
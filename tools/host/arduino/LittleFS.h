@@ -0,0 +1,70 @@
+#pragma once
+
+// In-memory file system. Contents survive hostrt::warmReset() and hostrt::powerLoss() like flash does;
+// hostrt::formatFs() wipes them.
+
+#include "Arduino.h"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+struct HostFile;
+
+class File : public Stream {
+public:
+  File() = default;
+  File(HostFile *file, bool append, bool writable);
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buf, size_t len) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  size_t read(uint8_t *buf, size_t len);
+  int peek() override;
+  bool seek(uint32_t pos, SeekMode mode = SeekSet);
+  size_t position() const { return _pos; }
+  size_t size() const;
+  void close() { _file = nullptr; }
+  explicit operator bool() const { return _file != nullptr; }
+
+private:
+  HostFile *_file = nullptr;
+  size_t _pos = 0;
+  bool _writable = false;
+};
+
+struct FSInfo {
+  size_t totalBytes;
+  size_t usedBytes;
+  size_t blockSize;
+  size_t pageSize;
+  size_t maxOpenFiles;
+  size_t maxPathLength;
+};
+
+class FS {
+public:
+  bool begin() { return true; }
+  void end() {}
+  bool format();
+  File open(const char *path, const char *mode);
+  File open(const String &path, const char *mode) { return open(path.c_str(), mode); }
+  bool exists(const char *path);
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path);
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool rename(const char *from, const char *to);
+  bool info(FSInfo &info);
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::FSInfo;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::SeekSet;
+
+extern fs::FS LittleFS;
@@ -0,0 +1,508 @@
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include <LittleFS.h>
+#include <stdarg.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "HostRuntime.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+ESP8266WiFiClass WiFi;
+fs::FS LittleFS;
+
+namespace {
+constexpr size_t kRtcUserWords = 128; // 512 bytes
+
+uint64_t gMonoUs = 0;
+int64_t gWallUs = 0;
+uint32_t gRtc[kRtcUserWords] = {};
+rst_info gResetInfo = {};
+bool gRestartRequested = false;
+int gPins[17] = {};
+bool gSerialEcho = true;
+uint64_t gAllocations = 0;
+hostrt::FsStats gFsStats;
+} // namespace
+
+namespace fs {
+struct HostFile {
+  std::vector<uint8_t> data;
+};
+} // namespace fs
+
+namespace {
+std::map<std::string, fs::HostFile> &files() {
+  static std::map<std::string, fs::HostFile> table;
+  return table;
+}
+} // namespace
+
+// --- Runtime control ---------------------------------------------------------
+
+namespace hostrt {
+void advanceUs(uint64_t us) {
+  gMonoUs += us;
+  gWallUs += static_cast<int64_t>(us);
+}
+uint64_t monoUs() { return gMonoUs; }
+int64_t wallUs() { return gWallUs; }
+void setWallUs(int64_t us) { gWallUs = us; }
+
+void warmReset(uint32_t reason) {
+  gMonoUs = 0;
+  gWallUs = 0;
+  gResetInfo = {};
+  gResetInfo.reason = reason;
+  gRestartRequested = false;
+  for (int &p : gPins) p = LOW;
+}
+
+void powerLoss() {
+  warmReset(REASON_DEFAULT_RST);
+  memset(gRtc, 0, sizeof(gRtc));
+}
+
+bool takeRestartRequest() {
+  const bool r = gRestartRequested;
+  gRestartRequested = false;
+  return r;
+}
+
+int pinLevel(uint8_t pin) { return pin < 17 ? gPins[pin] : LOW; }
+void setSerialEcho(bool on) { gSerialEcho = on; }
+void countAllocation() { gAllocations += 1; }
+uint64_t allocationCount() { return gAllocations; }
+const FsStats &fsStats() { return gFsStats; }
+void formatFs() { files().clear(); }
+} // namespace hostrt
+
+// --- Clocks (see HostRuntime.h for the link flags) ---------------------------
+
+extern "C" {
+time_t __wrap_time(time_t *out) {
+  const time_t t = static_cast<time_t>(gWallUs / 1000000LL);
+  if (out) *out = t;
+  return t;
+}
+
+int __wrap_gettimeofday(struct timeval *tv, void *) {
+  if (tv) {
+    tv->tv_sec = static_cast<time_t>(gWallUs / 1000000LL);
+    tv->tv_usec = static_cast<suseconds_t>(gWallUs % 1000000LL);
+  }
+  return 0;
+}
+
+int __wrap_settimeofday(const struct timeval *tv, const struct timezone *) {
+  if (tv) gWallUs = static_cast<int64_t>(tv->tv_sec) * 1000000LL + tv->tv_usec;
+  return 0;
+}
+}
+
+unsigned long millis() { return static_cast<unsigned long>(static_cast<uint32_t>(gMonoUs / 1000ULL)); }
+unsigned long micros() { return static_cast<unsigned long>(static_cast<uint32_t>(gMonoUs)); }
+void delay(unsigned long ms) { hostrt::advanceUs(static_cast<uint64_t>(ms) * 1000ULL); }
+void delayMicroseconds(unsigned int us) { hostrt::advanceUs(us); }
+void yield() {}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (pin < 17) gPins[pin] = val ? HIGH : LOW;
+}
+int digitalRead(uint8_t pin) { return hostrt::pinLevel(pin); }
+
+// --- ESP ---------------------------------------------------------------------
+
+bool EspClass::rtcUserMemoryRead(uint32_t offset, uint32_t *data, size_t size) {
+  if (offset >= kRtcUserWords || size > (kRtcUserWords - offset) * 4) return false;
+  memcpy(data, &gRtc[offset], size);
+  return true;
+}
+
+bool EspClass::rtcUserMemoryWrite(uint32_t offset, uint32_t *data, size_t size) {
+  if (offset >= kRtcUserWords || size > (kRtcUserWords - offset) * 4) return false;
+  memcpy(&gRtc[offset], data, size);
+  return true;
+}
+
+rst_info *EspClass::getResetInfoPtr() { return &gResetInfo; }
+
+String EspClass::getResetReason() {
+  switch (gResetInfo.reason) {
+  case REASON_DEFAULT_RST:
+    return "Power On";
+  case REASON_SOFT_RESTART:
+    return "Software/System restart";
+  case REASON_EXT_SYS_RST:
+    return "External System";
+  default:
+    return "Exception";
+  }
+}
+
+void EspClass::getHeapStats(uint32_t *hfree, uint16_t *hmax, uint8_t *hfrag) {
+  if (hfree) *hfree = getFreeHeap();
+  if (hmax) *hmax = getMaxFreeBlockSize();
+  if (hfrag) *hfrag = getHeapFragmentation();
+}
+
+uint32_t EspClass::getCycleCount() { return static_cast<uint32_t>(gMonoUs * 80ULL); }
+void EspClass::restart() { gRestartRequested = true; }
+
+// --- Print / Serial ----------------------------------------------------------
+
+size_t Print::write(const uint8_t *buf, size_t len) {
+  size_t n = 0;
+  while (n < len && write(buf[n])) n += 1;
+  return n;
+}
+
+size_t Print::printf(const char *fmt, ...) {
+  char buf[512];
+  va_list ap;
+  va_start(ap, fmt);
+  const int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n <= 0) return 0;
+  return write(buf, static_cast<size_t>(n) < sizeof(buf) ? static_cast<size_t>(n) : sizeof(buf) - 1);
+}
+
+size_t Print::printf_P(const char *fmt, ...) {
+  char buf[512];
+  va_list ap;
+  va_start(ap, fmt);
+  const int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n <= 0) return 0;
+  return write(buf, static_cast<size_t>(n) < sizeof(buf) ? static_cast<size_t>(n) : sizeof(buf) - 1);
+}
+
+size_t Stream::readBytes(char *buf, size_t len) {
+  size_t n = 0;
+  while (n < len) {
+    const int c = read();
+    if (c < 0) break;
+    buf[n++] = static_cast<char>(c);
+  }
+  return n;
+}
+
+size_t HardwareSerial::write(uint8_t c) { return write(&c, 1); }
+
+size_t HardwareSerial::write(const uint8_t *buf, size_t len) {
+  if (gSerialEcho) fwrite(buf, 1, len, stdout);
+  return len;
+}
+
+// --- String ------------------------------------------------------------------
+
+String::String(const char *s) { assign(s ? s : "", s ? strlen(s) : 0); }
+String::String(const String &other) { assign(other.c_str(), other._len); }
+String::String(String &&other) noexcept : _buf(other._buf), _len(other._len), _cap(other._cap) {
+  other._buf = nullptr;
+  other._len = other._cap = 0;
+}
+String::String(const __FlashStringHelper *s) : String(reinterpret_cast<const char *>(s)) {}
+String::String(char c) { assign(&c, 1); }
+
+namespace {
+String fromInteger(unsigned long long v, bool negative, unsigned char base) {
+  char buf[72];
+  char *p = buf + sizeof(buf) - 1;
+  *p = '\0';
+  if (base < 2 || base > 36) base = 10;
+  do {
+    const unsigned d = static_cast<unsigned>(v % base);
+    *--p = static_cast<char>(d < 10 ? '0' + d : 'a' + d - 10);
+    v /= base;
+  } while (v);
+  if (negative) *--p = '-';
+  return String(p);
+}
+
+unsigned long long magnitude(long long v) {
+  return v < 0 ? static_cast<unsigned long long>(-(v + 1)) + 1ULL : static_cast<unsigned long long>(v);
+}
+} // namespace
+
+String::String(int v, unsigned char base) : String(fromInteger(magnitude(v), base == 10 && v < 0, base)) {}
+String::String(unsigned v, unsigned char base) : String(fromInteger(v, false, base)) {}
+String::String(long v, unsigned char base) : String(fromInteger(magnitude(v), base == 10 && v < 0, base)) {}
+String::String(unsigned long v, unsigned char base) : String(fromInteger(v, false, base)) {}
+String::String(long long v) : String(fromInteger(magnitude(v), v < 0, 10)) {}
+String::String(unsigned long long v) : String(fromInteger(v, false, 10)) {}
+
+String::String(double v, unsigned char decimals) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+  assign(buf, strlen(buf));
+}
+
+String::~String() { free(_buf); }
+
+String &String::operator=(const String &other) {
+  if (this != &other) assign(other.c_str(), other._len);
+  return *this;
+}
+
+String &String::operator=(String &&other) noexcept {
+  if (this != &other) {
+    free(_buf);
+    _buf = other._buf;
+    _len = other._len;
+    _cap = other._cap;
+    other._buf = nullptr;
+    other._len = other._cap = 0;
+  }
+  return *this;
+}
+
+String &String::operator=(const char *s) {
+  assign(s ? s : "", s ? strlen(s) : 0);
+  return *this;
+}
+
+String &String::operator=(const __FlashStringHelper *s) { return *this = reinterpret_cast<const char *>(s); }
+
+bool String::reserve(unsigned cap) {
+  if (_buf && cap <= _cap) return true;
+  // Like the core, an empty String owns no buffer: only real contents cost an allocation.
+  if (cap == 0 && !_buf) return true;
+  char *next = static_cast<char *>(realloc(_buf, cap + 1));
+  if (!next) return false;
+  hostrt::countAllocation();
+  if (!_buf) next[0] = '\0';
+  _buf = next;
+  _cap = cap;
+  return true;
+}
+
+void String::assign(const char *s, unsigned len) {
+  if (len == 0) {
+    if (_buf) _buf[0] = '\0';
+    _len = 0;
+    return;
+  }
+  if (!reserve(len)) return;
+  memmove(_buf, s, len);
+  _buf[len] = '\0';
+  _len = len;
+}
+
+bool String::concat(const char *s, unsigned len) {
+  if (!len) return true;
+  if (!reserve(_len + len)) return false;
+  memmove(_buf + _len, s, len);
+  _len += len;
+  _buf[_len] = '\0';
+  return true;
+}
+
+char &String::operator[](unsigned i) {
+  static char dummy;
+  if (i >= _len) {
+    dummy = '\0';
+    return dummy;
+  }
+  return _buf[i];
+}
+
+bool String::startsWith(const String &p) const { return p._len <= _len && memcmp(c_str(), p.c_str(), p._len) == 0; }
+
+bool String::endsWith(const String &s) const {
+  return s._len <= _len && memcmp(c_str() + _len - s._len, s.c_str(), s._len) == 0;
+}
+
+bool String::equalsIgnoreCase(const String &o) const { return _len == o._len && strcasecmp(c_str(), o.c_str()) == 0; }
+
+int String::indexOf(char c, unsigned from) const {
+  if (from >= _len) return -1;
+  const char *p = strchr(c_str() + from, c);
+  return p ? static_cast<int>(p - c_str()) : -1;
+}
+
+int String::indexOf(const char *s, unsigned from) const {
+  if (from > _len) return -1;
+  const char *p = strstr(c_str() + from, s ? s : "");
+  return p ? static_cast<int>(p - c_str()) : -1;
+}
+
+int String::lastIndexOf(char c) const {
+  const char *p = strrchr(c_str(), c);
+  return p ? static_cast<int>(p - c_str()) : -1;
+}
+
+String String::substring(unsigned from, unsigned to) const {
+  if (from > to) {
+    const unsigned t = from;
+    from = to;
+    to = t;
+  }
+  if (from >= _len) return String();
+  if (to > _len) to = _len;
+  String out;
+  out.assign(c_str() + from, to - from);
+  return out;
+}
+
+void String::trim() {
+  if (!_len) return;
+  unsigned b = 0;
+  unsigned e = _len;
+  while (b < e && isspace(static_cast<unsigned char>(_buf[b]))) b += 1;
+  while (e > b && isspace(static_cast<unsigned char>(_buf[e - 1]))) e -= 1;
+  _len = e - b;
+  memmove(_buf, _buf + b, _len);
+  _buf[_len] = '\0';
+}
+
+void String::toLowerCase() {
+  for (unsigned i = 0; i < _len; i += 1) _buf[i] = static_cast<char>(tolower(static_cast<unsigned char>(_buf[i])));
+}
+
+void String::toUpperCase() {
+  for (unsigned i = 0; i < _len; i += 1) _buf[i] = static_cast<char>(toupper(static_cast<unsigned char>(_buf[i])));
+}
+
+void String::replace(char from, char to) {
+  for (unsigned i = 0; i < _len; i += 1) {
+    if (_buf[i] == from) _buf[i] = to;
+  }
+}
+
+void String::replace(const String &from, const String &to) {
+  if (!from._len) return;
+  String out;
+  unsigned i = 0;
+  while (i < _len) {
+    if (i + from._len <= _len && memcmp(_buf + i, from.c_str(), from._len) == 0) {
+      out += to;
+      i += from._len;
+    } else {
+      out += _buf[i];
+      i += 1;
+    }
+  }
+  *this = static_cast<String &&>(out);
+}
+
+void String::remove(unsigned index, unsigned count) {
+  if (index >= _len) return;
+  if (count > _len - index) count = _len - index;
+  memmove(_buf + index, _buf + index + count, _len - index - count + 1);
+  _len -= count;
+}
+
+// --- IPAddress ---------------------------------------------------------------
+
+bool IPAddress::fromString(const String &s) { return fromString(s.c_str()); }
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _b[0], _b[1], _b[2], _b[3]);
+  return String(buf);
+}
+
+// --- LittleFS ----------------------------------------------------------------
+
+namespace fs {
+File::File(HostFile *file, bool append, bool writable)
+    : _file(file), _pos(append ? file->data.size() : 0), _writable(writable) {}
+
+size_t File::write(const uint8_t *buf, size_t len) {
+  if (!_file || !_writable) return 0;
+  if (_pos + len > _file->data.size()) _file->data.resize(_pos + len);
+  memcpy(_file->data.data() + _pos, buf, len);
+  _pos += len;
+  gFsStats.bytesWritten += len;
+  return len;
+}
+
+int File::available() { return _file ? static_cast<int>(_file->data.size() - _pos) : 0; }
+
+int File::read() {
+  if (!_file || _pos >= _file->data.size()) return -1;
+  return _file->data[_pos++];
+}
+
+size_t File::read(uint8_t *buf, size_t len) {
+  if (!_file) return 0;
+  const size_t n = min(len, _file->data.size() - _pos);
+  memcpy(buf, _file->data.data() + _pos, n);
+  _pos += n;
+  return n;
+}
+
+int File::peek() { return (_file && _pos < _file->data.size()) ? _file->data[_pos] : -1; }
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+  if (!_file) return false;
+  size_t base = 0;
+  if (mode == SeekCur) base = _pos;
+  if (mode == SeekEnd) base = _file->data.size();
+  if (base + pos > _file->data.size()) return false;
+  _pos = base + pos;
+  return true;
+}
+
+size_t File::size() const { return _file ? _file->data.size() : 0; }
+
+bool FS::format() {
+  hostrt::formatFs();
+  return true;
+}
+
+File FS::open(const char *path, const char *mode) {
+  auto &table = files();
+  const bool write = mode && mode[0] == 'w';
+  const bool append = mode && mode[0] == 'a';
+  if (write || append) {
+    HostFile &f = table[path];
+    if (write) {
+      f.data.clear();
+      gFsStats.opensForWrite += 1;
+    } else {
+      gFsStats.opensForAppend += 1;
+    }
+    return File(&f, append, true);
+  }
+  auto it = table.find(path);
+  if (it == table.end()) return File();
+  return File(&it->second, false, mode && strchr(mode, '+'));
+}
+
+bool FS::exists(const char *path) { return files().count(path) != 0; }
+
+bool FS::remove(const char *path) {
+  gFsStats.removes += 1;
+  return files().erase(path) != 0;
+}
+
+bool FS::rename(const char *from, const char *to) {
+  auto &table = files();
+  auto it = table.find(from);
+  if (it == table.end()) return false;
+  HostFile moved = it->second;
+  table.erase(it);
+  table[to] = moved;
+  gFsStats.renames += 1;
+  return true;
+}
+
+bool FS::info(FSInfo &info) {
+  size_t used = 0;
+  for (const auto &kv : files()) used += kv.second.data.size();
+  info = {};
+  info.totalBytes = 1024 * 1024;
+  info.usedBytes = used;
+  info.blockSize = 8192;
+  info.pageSize = 256;
+  info.maxOpenFiles = 5;
+  info.maxPathLength = 32;
+  return true;
+}
+} // namespace fs
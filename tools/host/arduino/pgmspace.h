@@ -0,0 +1,24 @@
+#pragma once
+
+// Flash and RAM are the same address space on the host.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+
+inline void *memcpy_P(void *dst, const void *src, size_t n) { return memcpy(dst, src, n); }
+inline size_t strlen_P(const char *s) { return strlen(s); }
+inline int strcmp_P(const char *a, const char *b) { return strcmp(a, b); }
+inline int strncmp_P(const char *a, const char *b, size_t n) { return strncmp(a, b, n); }
+inline char *strncpy_P(char *dst, const char *src, size_t n) { return strncpy(dst, src, n); }
+inline uint8_t pgm_read_byte(const void *p) { return *static_cast<const uint8_t *>(p); }
+inline uint16_t pgm_read_word(const void *p) { return *static_cast<const uint16_t *>(p); }
+inline uint32_t pgm_read_dword(const void *p) { return *static_cast<const uint32_t *>(p); }
+inline const void *pgm_read_ptr(const void *p) { return *static_cast<const void *const *>(p); }
+
+#define snprintf_P snprintf
+#define sprintf_P sprintf
+#define vsnprintf_P vsnprintf
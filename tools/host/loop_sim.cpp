@@ -0,0 +1,770 @@
+// Deterministic virtual-time simulator of the relay control loop.
+//
+// Runs the firmware's own boot path and relay pass (relaylogic::run: ScheduleEngine + TimeKeeper offsets +
+// runMode/relayBootMode + override windows + contact mapping + relaystate) on the 250 ms task grid, against a
+// virtual clock that jumps between the moments where something can change. Power cuts and warm resets are
+// scripted from a seed; after each boot the clock stays invalid until a simulated NTP sync.
+//
+// Every relay transition is checked against an independent expectation built straight from the zmanim and
+// holiday tables: the tables are in standard time, so the expected edges in UTC do not depend on DST at all.
+//
+// Usage: loop_sim [--years N] [--start YYYY-MM-DD] [--seed N] [--log] [--matrix]
+//                 [--run-mode 0|1|2] [--boot-mode 0|1|2] [--holy-on-no 0|1] [--active-low 0|1]
+//                 [--before MIN] [--after MIN] [--dst-mode 0|1|2]
+//                 [--window YYYY-MM-DDTHH:MM,YYYY-MM-DDTHH:MM,on|off] (UTC, repeatable)
+//                 [--outages-per-year N] [--warm-resets-per-year N] [--no-dst-outages]
+//                 [--outage-max-min N] [--resync-s N] [--max-step-s N] [--tolerance-ms N]
+// Exit status is 1 when any check failed.
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "AppConfig.h"
+#include "DateMath.h"
+#include "HolidayDb.h"
+#include "HostRuntime.h"
+#include "ParashaDb.h"
+#include "RelayController.h"
+#include "RelayLogic.h"
+#include "RelayState.h"
+#include "ScheduleEngine.h"
+#include "TimeKeeper.h"
+#include "ZmanimDb.h"
+
+namespace {
+constexpr int64_t kUs = 1000000LL;
+constexpr int64_t kPassUs = 250000LL; // "relay" task period (main.cpp)
+constexpr int64_t kDenseAfterBootUs = 35LL * kUs; // covers the schedule's 30 s rebuild throttle
+constexpr size_t kMaxReported = 10;
+
+struct Options {
+  uint32_t years = 10;
+  int64_t startUtc = 0;
+  uint32_t seed = 1;
+  bool log = false;
+  bool matrix = false;
+
+  uint8_t runMode = 0;
+  uint8_t bootMode = 2;
+  bool holyOnNo = true;
+  bool activeLow = false;
+  int before = 30;
+  int after = 30;
+  uint8_t dstMode = 1;
+  ManualTimeWindow windows[AppConfig::kMaxWindows] = {};
+  uint8_t windowCount = 0;
+
+  uint32_t outagesPerYear = 12;
+  uint32_t warmResetsPerYear = 12;
+  bool dstOutages = true;
+  uint32_t outageMaxMin = 720;
+  int32_t resyncS = 20; // < 0: the clock never comes back
+  uint32_t maxStepS = 60;
+  uint32_t toleranceMs = 1000;
+};
+
+struct Result {
+  uint64_t passes = 0;
+  uint32_t boots = 0;
+  uint32_t outages = 0;
+  uint32_t warmResets = 0;
+  uint32_t transitions = 0;
+  uint32_t expectedEdges = 0;
+  uint32_t scheduleTransitions = 0;
+  uint32_t resyncTransitions = 0;
+  int64_t maxDevUs = 0;
+  int64_t sumDevUs = 0;
+  uint32_t dstEdges = 0;
+  int64_t dstMaxDevUs = 0;
+  uint32_t lateTransitions = 0;
+  uint32_t stateMismatches = 0;
+  uint32_t bootViolations = 0;
+  uint32_t pinMismatches = 0;
+  double wallMs = 0;
+
+  uint32_t failures() const { return lateTransitions + stateMismatches + bootViolations + pinMismatches; }
+};
+
+// xorshift32: identical scripts for identical seeds on every host.
+struct Rng {
+  uint32_t s;
+  uint32_t next() {
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+  }
+  uint64_t next64() { return (static_cast<uint64_t>(next()) << 32) | next(); }
+  int64_t range(int64_t lo, int64_t hi) { return lo + static_cast<int64_t>(next64() % static_cast<uint64_t>(hi - lo + 1)); }
+};
+
+void formatUtc(int64_t us, char *buf, size_t len) {
+  const time_t s = static_cast<time_t>(us / kUs);
+  tm t{};
+  gmtime_r(&s, &t);
+  snprintf(buf,
+           len,
+           "%04d-%02d-%02d %02d:%02d:%02d.%03dZ",
+           t.tm_year + 1900,
+           t.tm_mon + 1,
+           t.tm_mday,
+           t.tm_hour,
+           t.tm_min,
+           t.tm_sec,
+           static_cast<int>((us % kUs) / 1000));
+}
+
+uint32_t lastSunday(int year, unsigned month) {
+  uint32_t key = datemath::dateKeyFromYmd(year, month, 31);
+  while (datemath::weekday(key) != 0) key = datemath::addDays(key, -1);
+  return key;
+}
+
+// Israel DST instants (UTC), written out independently of TimeKeeper: Friday before the last Sunday of
+// March at 02:00 standard time, last Sunday of October at 02:00 daylight time.
+void israelDst(int year, int64_t &startUtc, int64_t &endUtc) {
+  const uint32_t start = datemath::addDays(lastSunday(year, 3), -2);
+  const uint32_t end = lastSunday(year, 10);
+  startUtc = datemath::localEpochFromDateKeyMinutes(start, 0) + 2 * 3600 - 2 * 3600;
+  endUtc = datemath::localEpochFromDateKeyMinutes(end, 0) + 2 * 3600 - 3 * 3600;
+}
+
+// What the relay should be doing, from the tables alone.
+class Oracle {
+public:
+  struct Edge {
+    int64_t utc;
+    bool relayOn;
+  };
+
+  void build(const AppConfig &cfg, const ZmanimDb &zmanim, const HolidayDb &holidays, int64_t fromUtc, int64_t toUtc) {
+    _cfg = &cfg;
+    _windows.clear();
+    _edges.clear();
+
+    const int64_t tzS = static_cast<int64_t>(cfg.tzOffsetMinutes) * 60;
+    const uint32_t firstKey = dateKeyAt(fromUtc - 3 * 86400);
+    const uint32_t lastKey = dateKeyAt(toUtc + 3 * 86400);
+    for (uint32_t key = firstKey; key <= lastKey; key = datemath::addDays(key, 1)) {
+      if (datemath::weekday(key) != 6 && !(holidays.hasData() && holidays.isYomTovDate(key))) continue;
+      const uint32_t prev = datemath::addDays(key, -1);
+      uint16_t candles = 0;
+      uint16_t havdalah = 0;
+      uint16_t unused = 0;
+      if (!zmanim.getForDate(prev, candles, unused) || !zmanim.getForDate(key, unused, havdalah)) continue;
+      Span w{};
+      w.start = datemath::localEpochFromDateKeyMinutes(prev, 0) + (candles - cfg.minutesBeforeShkia) * 60LL - tzS;
+      w.end = datemath::localEpochFromDateKeyMinutes(key, 0) + (havdalah + cfg.minutesAfterTzeit) * 60LL - tzS;
+      if (w.end > w.start) _windows.push_back(w);
+    }
+    std::sort(_windows.begin(), _windows.end(), [](const Span &a, const Span &b) { return a.start < b.start; });
+    std::vector<Span> merged;
+    for (const Span &w : _windows) {
+      if (!merged.empty() && w.start <= merged.back().end) {
+        merged.back().end = std::max(merged.back().end, w.end);
+      } else {
+        merged.push_back(w);
+      }
+    }
+    _windows.swap(merged);
+
+    std::vector<int64_t> candidates;
+    for (const Span &w : _windows) {
+      candidates.push_back(w.start);
+      candidates.push_back(w.end);
+    }
+    for (uint8_t i = 0; i < cfg.windowCount; i += 1) {
+      candidates.push_back(cfg.windows[i].startUtc);
+      candidates.push_back(cfg.windows[i].endUtc);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    for (int64_t c : candidates) {
+      if (c < fromUtc || c > toUtc) continue;
+      const bool now = relayAt(c * kUs);
+      if (now != relayAt((c - 1) * kUs)) _edges.push_back({c * kUs, now});
+    }
+  }
+
+  bool holyAt(int64_t us) const {
+    const int64_t s = us / kUs;
+    auto it = std::upper_bound(_windows.begin(), _windows.end(), s, [](int64_t v, const Span &w) { return v < w.start; });
+    if (it == _windows.begin()) return false;
+    --it;
+    return s < it->end;
+  }
+
+  bool relayAt(int64_t us) const {
+    const AppConfig &cfg = *_cfg;
+    const int64_t s = us / kUs;
+    bool holy = holyAt(us);
+    if (cfg.runMode == 1) holy = false;
+    if (cfg.runMode == 2) holy = true;
+    bool on = cfg.relayHolyOnNo ? holy : !holy;
+    uint32_t bestStart = 0;
+    bool found = false;
+    for (uint8_t i = 0; i < cfg.windowCount; i += 1) {
+      const ManualTimeWindow &w = cfg.windows[i];
+      if (!w.startUtc || w.endUtc <= w.startUtc) continue;
+      if (s < w.startUtc || s >= w.endUtc) continue;
+      if (!found || w.startUtc >= bestStart) {
+        found = true;
+        bestStart = w.startUtc;
+        on = w.on;
+      }
+    }
+    return on;
+  }
+
+  // First edge strictly after `us` (nullptr when none).
+  const Edge *nextEdge(int64_t us) const {
+    auto it = std::upper_bound(_edges.begin(), _edges.end(), us, [](int64_t v, const Edge &e) { return v < e.utc; });
+    return it == _edges.end() ? nullptr : &*it;
+  }
+
+  // Last edge at or before `us`.
+  const Edge *lastEdge(int64_t us) const {
+    auto it = std::upper_bound(_edges.begin(), _edges.end(), us, [](int64_t v, const Edge &e) { return v < e.utc; });
+    return it == _edges.begin() ? nullptr : &*(it - 1);
+  }
+
+  size_t edgeCount() const { return _edges.size(); }
+
+private:
+  struct Span {
+    int64_t start;
+    int64_t end;
+  };
+
+  const AppConfig *_cfg = nullptr;
+  std::vector<Span> _windows;
+  std::vector<Edge> _edges;
+
+  static uint32_t dateKeyAt(int64_t utc) {
+    int y;
+    unsigned m, d;
+    datemath::civilFromDays(utc / 86400, y, m, d);
+    return datemath::dateKeyFromYmd(y, m, d);
+  }
+};
+
+struct Event {
+  enum Kind : uint8_t { PowerOff, PowerOn, WarmReset };
+  int64_t utc;
+  Kind kind;
+};
+
+class Sim {
+public:
+  Sim(const Options &opt, ZmanimDb &zmanim, HolidayDb &holidays, ParashaDb &parasha)
+      : _opt(opt), _zmanim(zmanim), _holidays(holidays), _parasha(parasha) {}
+
+  Result run() {
+    configure();
+    const int64_t startUs = _opt.startUtc * kUs;
+    const int64_t endUs = startUs + static_cast<int64_t>(_opt.years) * 365LL * 86400LL * kUs + 2LL * 86400LL * kUs;
+    _oracle.build(_cfg, _zmanim, _holidays, _opt.startUtc, endUs / kUs);
+    _r.expectedEdges = static_cast<uint32_t>(_oracle.edgeCount());
+    buildScript(startUs, endUs);
+
+    hostrt::formatFs();
+    hostrt::powerLoss();
+    _now = startUs;
+    _physBeforeCut = false; // factory-fresh: nothing persisted yet
+    boot(REASON_DEFAULT_RST);
+
+    size_t nextEvent = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    while (_now < endUs) {
+      const int64_t eventAt = nextEvent < _script.size() ? _script[nextEvent].utc : INT64_MAX;
+      const int64_t resyncAt = (_powered && _resyncAt >= 0) ? _resyncAt : INT64_MAX;
+      const int64_t passAt = _powered ? _nextPass : INT64_MAX;
+      const int64_t at = std::min(std::min(eventAt, resyncAt), std::min(passAt, endUs));
+      advanceTo(at);
+      if (at == endUs) break;
+
+      if (at == eventAt) {
+        handle(_script[nextEvent]);
+        nextEvent += 1;
+      } else if (at == resyncAt) {
+        // NTP lands on a whole second, so the device clock equals true time from here on.
+        _time.setManualUtc(static_cast<time_t>(_now / kUs));
+        _resyncAt = -1;
+        _validSince = _now;
+      } else {
+        pass();
+      }
+    }
+    _r.wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    return _r;
+  }
+
+private:
+  const Options &_opt;
+  ZmanimDb &_zmanim;
+  HolidayDb &_holidays;
+  ParashaDb &_parasha;
+
+  AppConfig _cfg;
+  TimeKeeper _time;
+  ScheduleEngine _schedule;
+  RelayController _relay;
+  Oracle _oracle;
+  std::vector<Event> _script;
+  std::vector<int64_t> _dstInstants; // UTC us
+  Result _r;
+
+  int64_t _now = 0;
+  bool _powered = false;
+  int64_t _bootAt = 0;
+  int64_t _nextPass = 0;
+  int64_t _resyncAt = -1;
+  int64_t _validSince = -1;
+  bool _physBeforeCut = false;
+  size_t _reported = 0;
+
+  void configure() {
+    _cfg = AppConfig();
+    _cfg.ntpEnabled = false;
+    _cfg.runMode = _opt.runMode;
+    _cfg.relayBootMode = _opt.bootMode;
+    _cfg.relayHolyOnNo = _opt.holyOnNo;
+    _cfg.relayActiveLow = _opt.activeLow;
+    _cfg.minutesBeforeShkia = _opt.before;
+    _cfg.minutesAfterTzeit = _opt.after;
+    _cfg.dstMode = _opt.dstMode;
+    _cfg.windowCount = _opt.windowCount;
+    for (uint8_t i = 0; i < _opt.windowCount; i += 1) _cfg.windows[i] = _opt.windows[i];
+  }
+
+  void buildScript(int64_t startUs, int64_t endUs) {
+    Rng rng{_opt.seed ? _opt.seed : 1};
+    std::vector<Event> cuts;
+    const uint32_t outages = _opt.outagesPerYear * _opt.years;
+    for (uint32_t i = 0; i < outages; i += 1) {
+      const int64_t at = rng.range(startUs, endUs - 1);
+      const int64_t len = rng.range(60, static_cast<int64_t>(_opt.outageMaxMin) * 60) * kUs + rng.range(0, 999) * 1000;
+      cuts.push_back({at, Event::PowerOff});
+      cuts.push_back({at + len, Event::PowerOn});
+    }
+    _dstInstants.clear();
+    for (int64_t y = yearOf(startUs); y <= yearOf(endUs); y += 1) {
+      int64_t a = 0;
+      int64_t b = 0;
+      israelDst(static_cast<int>(y), a, b);
+      _dstInstants.push_back(a * kUs);
+      _dstInstants.push_back(b * kUs);
+      if (!_opt.dstOutages) continue;
+      // Power is out across the DST switch itself.
+      for (int64_t t : {a, b}) {
+        if (t * kUs <= startUs || t * kUs >= endUs) continue;
+        cuts.push_back({(t - 10 * 60) * kUs, Event::PowerOff});
+        cuts.push_back({(t + 20 * 60) * kUs + 123000, Event::PowerOn});
+      }
+    }
+
+    // Keep outages disjoint: drop any that start before the previous one ended.
+    std::vector<std::pair<int64_t, int64_t>> spans;
+    for (size_t i = 0; i + 1 < cuts.size(); i += 2) spans.push_back({cuts[i].utc, cuts[i + 1].utc});
+    std::sort(spans.begin(), spans.end());
+    _script.clear();
+    int64_t lastEnd = startUs;
+    for (const auto &s : spans) {
+      if (s.first <= lastEnd + kDenseAfterBootUs || s.second >= endUs) continue;
+      _script.push_back({s.first, Event::PowerOff});
+      _script.push_back({s.second, Event::PowerOn});
+      lastEnd = s.second;
+    }
+    const uint32_t warm = _opt.warmResetsPerYear * _opt.years;
+    for (uint32_t i = 0; i < warm; i += 1) {
+      const int64_t at = rng.range(startUs, endUs - 1);
+      bool inside = false;
+      for (const auto &s : spans) inside = inside || (at >= s.first - kDenseAfterBootUs && at <= s.second + kDenseAfterBootUs);
+      if (!inside) _script.push_back({at, Event::WarmReset});
+    }
+    std::sort(_script.begin(), _script.end(), [](const Event &a, const Event &b) { return a.utc < b.utc; });
+  }
+
+  static int64_t yearOf(int64_t us) {
+    int y;
+    unsigned m, d;
+    datemath::civilFromDays(us / kUs / 86400, y, m, d);
+    return y;
+  }
+
+  void advanceTo(int64_t at) {
+    if (at <= _now) return;
+    if (_powered) hostrt::advanceUs(static_cast<uint64_t>(at - _now));
+    _now = at;
+  }
+
+  // Mirrors setup(): restore the relay, apply the boot mode, then bring up the schedule and the clock.
+  void boot(uint32_t reason) {
+    if (reason == REASON_DEFAULT_RST) {
+      hostrt::powerLoss();
+    } else {
+      hostrt::warmReset(reason);
+    }
+    _powered = true;
+    _bootAt = _now;
+    _time = TimeKeeper();
+    _schedule = ScheduleEngine();
+    _r.boots += 1;
+
+    bool lastOn = false;
+    relaystate::load(lastOn);
+    _relay = RelayController();
+    _relay.begin(_cfg, lastOn);
+    bool forced = false;
+    if (relaylogic::bootState(_cfg, _time.isTimeValid(), forced)) {
+      _relay.setOn(forced);
+      relaystate::save(forced);
+    }
+    _schedule.begin(_zmanim, _holidays, _parasha);
+    _time.begin(_cfg);
+
+    // Boot-mode contract while the clock is unknown.
+    bool expected = _physBeforeCut;
+    if (_cfg.runMode == 0 && (_cfg.relayBootMode == 1 || _cfg.relayBootMode == 2)) {
+      const bool holy = _cfg.relayBootMode == 2;
+      expected = _cfg.relayHolyOnNo ? holy : !holy;
+    }
+    if (_relay.isOn() != expected) {
+      _r.bootViolations += 1;
+      report("boot", "relay=%s expected=%s source=%s", onOff(_relay.isOn()), onOff(expected),
+             relaystate::sourceToString(relaystate::stats().loadedFrom));
+    }
+    if (_opt.log) {
+      char when[80];
+      formatUtc(_now, when, sizeof(when));
+      printf("%s boot reason=%u relay=%s source=%s\n", when, reason, onOff(_relay.isOn()),
+             relaystate::sourceToString(relaystate::stats().loadedFrom));
+    }
+
+    _validSince = -1;
+    _resyncAt = _opt.resyncS < 0 ? -1 : ((_now + _opt.resyncS * kUs + kUs - 1) / kUs) * kUs;
+    _nextPass = _now + kPassUs;
+  }
+
+  void handle(const Event &e) {
+    switch (e.kind) {
+    case Event::PowerOff:
+      _physBeforeCut = _relay.isOn();
+      _powered = false;
+      _r.outages += 1;
+      if (_opt.log) logEvent("power off");
+      break;
+    case Event::PowerOn:
+      if (_opt.log) logEvent("power on");
+      boot(REASON_DEFAULT_RST);
+      break;
+    case Event::WarmReset:
+      if (!_powered) break;
+      _physBeforeCut = _relay.isOn();
+      _r.warmResets += 1;
+      boot(REASON_SOFT_RESTART);
+      break;
+    }
+  }
+
+  void pass() {
+    const relaylogic::Pass p = relaylogic::run(_cfg, _schedule, _time, _relay);
+    _r.passes += 1;
+
+    const int level = hostrt::pinLevel(static_cast<uint8_t>(_cfg.relayGpio));
+    if ((level == HIGH) != (_relay.isOn() != _cfg.relayActiveLow)) _r.pinMismatches += 1;
+
+    const bool valid = _time.isTimeValid();
+    const int64_t tol = static_cast<int64_t>(_opt.toleranceMs) * 1000;
+    if (p.changed) {
+      _r.transitions += 1;
+      checkTransition(p, valid, tol);
+    }
+    if (valid && _validSince >= 0 && _now - _validSince > tol) {
+      const Oracle::Edge *last = _oracle.lastEdge(_now);
+      const bool settling = last && (_now - last->utc) <= tol;
+      if (!settling && _relay.isOn() != _oracle.relayAt(_now)) {
+        _r.stateMismatches += 1;
+        report("state", "relay=%s expected=%s", onOff(_relay.isOn()), onOff(_oracle.relayAt(_now)));
+      }
+    }
+    _nextPass = alignToGrid(nextWake(valid, tol));
+  }
+
+  void checkTransition(const relaylogic::Pass &p, bool valid, int64_t tol) {
+    const bool on = p.decision.desiredRelay;
+    const char *cause = !valid ? "noclock" : (p.decision.overrideApplied ? "override" : "schedule");
+    int64_t dev = 0;
+    const Oracle::Edge *edge = nullptr;
+    if (valid && _validSince >= 0 && _now - _validSince <= tol) {
+      cause = "resync";
+      _r.resyncTransitions += 1;
+    } else if (valid) {
+      _r.scheduleTransitions += 1;
+      edge = _oracle.lastEdge(_now);
+      const Oracle::Edge *next = _oracle.nextEdge(_now);
+      if (next && next->relayOn == on && (!edge || edge->relayOn != on || next->utc - _now < _now - edge->utc)) edge = next;
+      if (!edge || edge->relayOn != on) {
+        _r.lateTransitions += 1;
+        report("transition", "relay=%s with no matching expected edge", onOff(on));
+      } else {
+        dev = _now - edge->utc;
+        const int64_t absDev = dev < 0 ? -dev : dev;
+        _r.maxDevUs = std::max(_r.maxDevUs, absDev);
+        _r.sumDevUs += absDev;
+        if (nearDst(edge->utc)) {
+          _r.dstEdges += 1;
+          _r.dstMaxDevUs = std::max(_r.dstMaxDevUs, absDev);
+        }
+        if (dev < 0 || dev > tol) {
+          _r.lateTransitions += 1;
+          report("transition", "relay=%s deviation=%+.3fs", onOff(on), static_cast<double>(dev) / kUs);
+        }
+      }
+    }
+    if (!_opt.log) return;
+    char when[80];
+    formatUtc(_now, when, sizeof(when));
+    char expected[80] = "-";
+    if (edge) formatUtc(edge->utc, expected, sizeof(expected));
+    const ScheduleStatus &st = _schedule.status();
+    tm local{};
+    const time_t nowLocal = static_cast<time_t>(st.nowLocal);
+    gmtime_r(&nowLocal, &local);
+    printf("%s relay=%s holy=%d cause=%s local=%02d:%02d dst=%d expected=%s dev=%+.3fs\n",
+           when,
+           onOff(on),
+           p.decision.desiredHoly ? 1 : 0,
+           cause,
+           local.tm_hour,
+           local.tm_min,
+           valid && _time.dstActive(_cfg) ? 1 : 0,
+           expected,
+           static_cast<double>(dev) / kUs);
+  }
+
+  // The earliest moment the device could change its mind (or the oracle expects it to), capped by max-step.
+  int64_t nextWake(bool valid, int64_t tol) const {
+    int64_t wake = _now + static_cast<int64_t>(_opt.maxStepS) * kUs;
+    if (_now - _bootAt < kDenseAfterBootUs || (_validSince >= 0 && _now - _validSince < kDenseAfterBootUs)) {
+      return _now + kPassUs;
+    }
+    if (!valid) return wake;
+
+    const ScheduleStatus &st = _schedule.status();
+    const int64_t deviceUtcUs = hostrt::wallUs();
+    const int64_t trueMinusDevice = _now - deviceUtcUs;
+    auto consider = [&](int64_t deviceUtcS) {
+      const int64_t t = deviceUtcS * kUs + trueMinusDevice;
+      if (t > _now && t < wake) wake = t;
+    };
+    if (st.nextChangeLocal) consider(deviceUtcUs / kUs + (st.nextChangeLocal - st.nowLocal));
+    const int64_t localDay = st.nowLocal - (st.nowLocal % 86400);
+    consider(deviceUtcUs / kUs + (localDay + 86400 - st.nowLocal));
+    const time_t dst = _time.nextDstChangeUtc(_cfg);
+    if (dst) consider(static_cast<int64_t>(dst));
+    for (uint8_t i = 0; i < _cfg.windowCount; i += 1) {
+      consider(_cfg.windows[i].startUtc);
+      consider(_cfg.windows[i].endUtc);
+    }
+    if (const Oracle::Edge *e = _oracle.nextEdge(_now)) {
+      if (e->utc < wake) wake = e->utc;
+    }
+    if (const Oracle::Edge *e = _oracle.lastEdge(_now)) {
+      if (e->utc + tol + 1 > _now && e->utc + tol + 1 < wake) wake = e->utc + tol + 1;
+    }
+    return wake;
+  }
+
+  int64_t alignToGrid(int64_t t) const {
+    if (t <= _now) t = _now + 1;
+    const int64_t k = (t - _bootAt + kPassUs - 1) / kPassUs;
+    return _bootAt + k * kPassUs;
+  }
+
+  bool nearDst(int64_t us) const {
+    for (int64_t d : _dstInstants) {
+      const int64_t delta = us - d;
+      if (delta > -3 * 86400LL * kUs && delta < 3 * 86400LL * kUs) return true;
+    }
+    return false;
+  }
+
+  static const char *onOff(bool on) { return on ? "ON" : "OFF"; }
+
+  void logEvent(const char *what) const {
+    char when[80];
+    formatUtc(_now, when, sizeof(when));
+    printf("%s %s\n", when, what);
+  }
+
+  void report(const char *kind, const char *fmt, ...) __attribute__((format(printf, 3, 4))) {
+    if (_reported >= kMaxReported) return;
+    _reported += 1;
+    char when[80];
+    formatUtc(_now, when, sizeof(when));
+    char msg[160];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(msg, sizeof(msg), fmt, ap);
+    va_end(ap);
+    printf("FAIL %s %s %s\n", when, kind, msg);
+  }
+};
+
+bool parseDate(const char *s, int64_t &out) {
+  int y;
+  unsigned m, d;
+  if (sscanf(s, "%d-%u-%u", &y, &m, &d) != 3) return false;
+  out = datemath::daysFromCivil(y, m, d) * 86400LL;
+  return true;
+}
+
+bool parseWindow(const char *s, ManualTimeWindow &out) {
+  int y1, y2;
+  unsigned mo1, d1, h1, mi1, mo2, d2, h2, mi2;
+  char state[8] = {};
+  if (sscanf(s, "%d-%u-%uT%u:%u,%d-%u-%uT%u:%u,%7s", &y1, &mo1, &d1, &h1, &mi1, &y2, &mo2, &d2, &h2, &mi2, state) != 11) {
+    return false;
+  }
+  out.startUtc = static_cast<uint32_t>(datemath::daysFromCivil(y1, mo1, d1) * 86400LL + h1 * 3600 + mi1 * 60);
+  out.endUtc = static_cast<uint32_t>(datemath::daysFromCivil(y2, mo2, d2) * 86400LL + h2 * 3600 + mi2 * 60);
+  out.on = !strcmp(state, "on");
+  return out.endUtc > out.startUtc && (out.on || !strcmp(state, "off"));
+}
+
+void usage() {
+  fprintf(stderr,
+          "usage: loop_sim [--years N] [--start YYYY-MM-DD] [--seed N] [--log] [--matrix]\n"
+          "                [--run-mode 0|1|2] [--boot-mode 0|1|2] [--holy-on-no 0|1] [--active-low 0|1]\n"
+          "                [--before MIN] [--after MIN] [--dst-mode 0|1|2] [--window START,END,on|off]\n"
+          "                [--outages-per-year N] [--warm-resets-per-year N] [--no-dst-outages]\n"
+          "                [--outage-max-min N] [--resync-s N] [--max-step-s N] [--tolerance-ms N]\n");
+}
+
+void printResult(const Options &o, const Result &r) {
+  printf("config runMode=%u bootMode=%u holyOnNo=%d activeLow=%d before=%d after=%d dstMode=%u windows=%u\n",
+         o.runMode, o.bootMode, o.holyOnNo ? 1 : 0, o.activeLow ? 1 : 0, o.before, o.after, o.dstMode, o.windowCount);
+  printf("years=%u boots=%u outages=%u warmResets=%u passes=%llu\n", o.years, r.boots, r.outages, r.warmResets,
+         static_cast<unsigned long long>(r.passes));
+  printf("transitions=%u schedule=%u resync=%u expectedEdges=%u\n", r.transitions, r.scheduleTransitions,
+         r.resyncTransitions, r.expectedEdges);
+  printf("deviation max=%.3fs avg=%.3fs dstEdges=%u dstMax=%.3fs\n",
+         static_cast<double>(r.maxDevUs) / kUs,
+         r.scheduleTransitions ? static_cast<double>(r.sumDevUs) / kUs / r.scheduleTransitions : 0.0,
+         r.dstEdges,
+         static_cast<double>(r.dstMaxDevUs) / kUs);
+  printf("failures late=%u state=%u boot=%u pin=%u\n", r.lateTransitions, r.stateMismatches, r.bootViolations,
+         r.pinMismatches);
+  const double simulatedS = static_cast<double>(o.years) * 365.0 * 86400.0;
+  printf("wallMs=%.0f passesPerSec=%.0f speedup=%.0fx\n", r.wallMs, r.passes / (r.wallMs / 1000.0),
+         simulatedS / (r.wallMs / 1000.0));
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  Options opt;
+  parseDate("2026-01-01", opt.startUtc);
+  for (int i = 1; i < argc; i += 1) {
+    const char *a = argv[i];
+    const bool hasValue = i + 1 < argc;
+    if (!strcmp(a, "--log")) {
+      opt.log = true;
+    } else if (!strcmp(a, "--matrix")) {
+      opt.matrix = true;
+    } else if (!strcmp(a, "--no-dst-outages")) {
+      opt.dstOutages = false;
+    } else if (!hasValue) {
+      usage();
+      return 2;
+    } else if (!strcmp(a, "--years")) {
+      opt.years = static_cast<uint32_t>(atoi(argv[++i]));
+    } else if (!strcmp(a, "--start")) {
+      if (!parseDate(argv[++i], opt.startUtc)) {
+        usage();
+        return 2;
+      }
+    } else if (!strcmp(a, "--seed")) {
+      opt.seed = static_cast<uint32_t>(atoi(argv[++i]));
+    } else if (!strcmp(a, "--run-mode")) {
+      opt.runMode = static_cast<uint8_t>(atoi(argv[++i]));
+    } else if (!strcmp(a, "--boot-mode")) {
+      opt.bootMode = static_cast<uint8_t>(atoi(argv[++i]));
+    } else if (!strcmp(a, "--holy-on-no")) {
+      opt.holyOnNo = atoi(argv[++i]) != 0;
+    } else if (!strcmp(a, "--active-low")) {
+      opt.activeLow = atoi(argv[++i]) != 0;
+    } else if (!strcmp(a, "--before")) {
+      opt.before = atoi(argv[++i]);
+    } else if (!strcmp(a, "--after")) {
+      opt.after = atoi(argv[++i]);
+    } else if (!strcmp(a, "--dst-mode")) {
+      opt.dstMode = static_cast<uint8_t>(atoi(argv[++i]));
+    } else if (!strcmp(a, "--window")) {
+      if (opt.windowCount >= AppConfig::kMaxWindows || !parseWindow(argv[++i], opt.windows[opt.windowCount])) {
+        usage();
+        return 2;
+      }
+      opt.windowCount += 1;
+    } else if (!strcmp(a, "--outages-per-year")) {
+      opt.outagesPerYear = static_cast<uint32_t>(atoi(argv[++i]));
+    } else if (!strcmp(a, "--warm-resets-per-year")) {
+      opt.warmResetsPerYear = static_cast<uint32_t>(atoi(argv[++i]));
+    } else if (!strcmp(a, "--outage-max-min")) {
+      opt.outageMaxMin = static_cast<uint32_t>(atoi(argv[++i]));
+    } else if (!strcmp(a, "--resync-s")) {
+      opt.resyncS = atoi(argv[++i]);
+    } else if (!strcmp(a, "--max-step-s")) {
+      opt.maxStepS = static_cast<uint32_t>(atoi(argv[++i]));
+    } else if (!strcmp(a, "--tolerance-ms")) {
+      opt.toleranceMs = static_cast<uint32_t>(atoi(argv[++i]));
+    } else {
+      usage();
+      return 2;
+    }
+  }
+  if (!opt.years || !opt.maxStepS || opt.outageMaxMin < 1) {
+    usage();
+    return 2;
+  }
+
+  hostrt::setSerialEcho(false);
+  ZmanimDb zmanim;
+  HolidayDb holidays;
+  ParashaDb parasha;
+  zmanim.begin();
+  holidays.begin();
+  parasha.begin();
+
+  uint32_t failures = 0;
+  if (!opt.matrix) {
+    Sim sim(opt, zmanim, holidays, parasha);
+    const Result r = sim.run();
+    printResult(opt, r);
+    failures = r.failures();
+  } else {
+    // Every runMode x relayBootMode x contact mapping, same script.
+    for (uint8_t run = 0; run < 3; run += 1) {
+      for (uint8_t bootMode = 0; bootMode < 3; bootMode += 1) {
+        for (uint8_t holyOnNo = 0; holyOnNo < 2; holyOnNo += 1) {
+          Options o = opt;
+          o.log = false;
+          o.runMode = run;
+          o.bootMode = bootMode;
+          o.holyOnNo = holyOnNo != 0;
+          Sim sim(o, zmanim, holidays, parasha);
+          const Result r = sim.run();
+          printf("runMode=%u bootMode=%u holyOnNo=%u transitions=%u maxDev=%.3fs failures=%u wallMs=%.0f\n",
+                 run, bootMode, holyOnNo, r.transitions, static_cast<double>(r.maxDevUs) / kUs, r.failures(), r.wallMs);
+          failures += r.failures();
+        }
+      }
+    }
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,154 @@
+// Host-side driver for src/NtpSampler.cpp: runs one sampling round over POSIX UDP sockets
+// and prints per-server quality stats plus the selected offset/uncertainty.
+//
+// Usage: ntp_probe [--samples N] [--max-rtt-ms MS] [--timeout-ms MS] HOST:PORT [HOST:PORT ...]
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "NtpSampler.h"
+
+namespace {
+class PosixTransport : public ntp::Transport {
+public:
+  bool open() {
+    _fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (_fd < 0) return false;
+    timeval tv{};
+    tv.tv_usec = 1000; // keep receive() effectively non-blocking
+    setsockopt(_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    return true;
+  }
+
+  bool add(uint8_t idx, const char *spec) {
+    char host[128];
+    const char *colon = strrchr(spec, ':');
+    const size_t hostLen = colon ? static_cast<size_t>(colon - spec) : strlen(spec);
+    if (hostLen == 0 || hostLen >= sizeof(host)) return false;
+    memcpy(host, spec, hostLen);
+    host[hostLen] = '\0';
+    const int port = colon ? atoi(colon + 1) : ntp::kPort;
+
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo *res = nullptr;
+    if (getaddrinfo(host, nullptr, &hints, &res) != 0 || !res) return false;
+    _addrs[idx] = *reinterpret_cast<sockaddr_in *>(res->ai_addr);
+    _addrs[idx].sin_port = htons(static_cast<uint16_t>(port));
+    freeaddrinfo(res);
+    return true;
+  }
+
+  bool send(uint8_t server, const uint8_t *pkt, size_t len) override {
+    const ssize_t n = sendto(_fd, pkt, len, 0, reinterpret_cast<const sockaddr *>(&_addrs[server]), sizeof(_addrs[server]));
+    return n == static_cast<ssize_t>(len);
+  }
+
+  size_t receive(uint8_t server, uint8_t *pkt, size_t cap, int64_t &rxUs) override {
+    sockaddr_in from{};
+    socklen_t fromLen = sizeof(from);
+    const ssize_t n = recvfrom(_fd, pkt, cap, 0, reinterpret_cast<sockaddr *>(&from), &fromLen);
+    if (n <= 0) return 0;
+    rxUs = wallUs();
+    if (from.sin_addr.s_addr != _addrs[server].sin_addr.s_addr || from.sin_port != _addrs[server].sin_port) return 0;
+    return static_cast<size_t>(n);
+  }
+
+  int64_t wallUs() override {
+    timeval tv{};
+    gettimeofday(&tv, nullptr);
+    return static_cast<int64_t>(tv.tv_sec) * 1000000LL + tv.tv_usec;
+  }
+
+  uint32_t monoMs() override {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint32_t>(ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000ULL);
+  }
+
+private:
+  int _fd = -1;
+  sockaddr_in _addrs[ntp::kMaxServers] = {};
+};
+} // namespace
+
+int main(int argc, char **argv) {
+  unsigned samples = 4;
+  unsigned maxRttMs = 400;
+  unsigned timeoutMs = 600;
+  const char *specs[ntp::kMaxServers];
+  uint8_t count = 0;
+
+  for (int i = 1; i < argc; i += 1) {
+    if (!strcmp(argv[i], "--samples") && i + 1 < argc) {
+      samples = static_cast<unsigned>(atoi(argv[++i]));
+    } else if (!strcmp(argv[i], "--max-rtt-ms") && i + 1 < argc) {
+      maxRttMs = static_cast<unsigned>(atoi(argv[++i]));
+    } else if (!strcmp(argv[i], "--timeout-ms") && i + 1 < argc) {
+      timeoutMs = static_cast<unsigned>(atoi(argv[++i]));
+    } else if (count < ntp::kMaxServers) {
+      specs[count++] = argv[i];
+    }
+  }
+  if (count == 0) {
+    fprintf(stderr, "usage: %s [--samples N] [--max-rtt-ms MS] [--timeout-ms MS] HOST:PORT...\n", argv[0]);
+    return 2;
+  }
+
+  PosixTransport io;
+  if (!io.open()) {
+    perror("socket");
+    return 1;
+  }
+  for (uint8_t i = 0; i < count; i += 1) {
+    if (!io.add(i, specs[i])) fprintf(stderr, "[probe] cannot resolve %s\n", specs[i]);
+  }
+
+  ntp::ServerStats stats[ntp::kMaxServers];
+  ntp::Sampler sampler;
+  sampler.configure(count, static_cast<uint8_t>(samples), maxRttMs * 1000U, timeoutMs);
+  const uint32_t startMs = io.monoMs();
+  sampler.start(startMs);
+  while (!sampler.poll(io, stats)) {
+  }
+  const uint32_t elapsedMs = io.monoMs() - startMs;
+
+  for (uint8_t i = 0; i < count; i += 1) {
+    const ntp::ServerStats &st = stats[i];
+    printf("[server] %-22s sent=%u recv=%u rejected=%u timeouts=%u rtt=%.3fms offset=%+.3fms stratum=%u%s%s\n",
+           specs[i],
+           st.sent,
+           st.received,
+           st.rejected,
+           st.timeouts,
+           st.lastDelayUs / 1000.0,
+           st.lastOffsetUs / 1000.0,
+           st.stratum,
+           st.lastError != ntp::SampleError::None ? " last=" : "",
+           ntp::sampleErrorToString(st.lastError));
+  }
+
+  const ntp::Result &r = sampler.result();
+  if (!r.ok) {
+    printf("[result] no usable sample (%ums)\n", elapsedMs);
+    return 1;
+  }
+  printf("[result] server=%s offset=%+.3fms uncertainty=%.3fms rtt=%.3fms stratum=%u accepted=%u/%u round=%ums\n",
+         specs[r.server],
+         r.sample.offsetUs / 1000.0,
+         r.uncertaintyUs / 1000.0,
+         r.sample.delayUs / 1000.0,
+         r.sample.stratum,
+         r.accepted,
+         count,
+         elapsedMs);
+  return 0;
+}
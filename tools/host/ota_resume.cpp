@@ -0,0 +1,369 @@
+// Host-side driver for src/OtaDownload.cpp: downloads an image over plain HTTP with Range requests into a
+// simulated flash area, optionally "rebooting" (fresh Downloader, connection gone) every few sectors and
+// losing the RTC checkpoint copy on some of those, then checks what ended up in flash.
+//
+// Usage: ota_resume [--md5 HEX] [--expect FILE] [--region BYTES] [--reboot-every SECTORS] [--power-cut]
+//                   [--timeout-s S] http://HOST:PORT/PATH
+//
+// Point it at tools/ota_standin.py with --drop-after / --drop-pct / --fail-pct to exercise resumes.
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netdb.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <vector>
+
+#include "OtaDownload.h"
+
+namespace {
+uint32_t monoMs() {
+  timespec ts{};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint32_t>(ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000ULL);
+}
+
+class PosixHttpTransport : public otadl::Transport {
+public:
+  bool parseUrl(const char *url) {
+    if (strncmp(url, "http://", 7) != 0) return false;
+    const char *host = url + 7;
+    const char *slash = strchr(host, '/');
+    const char *hostEnd = slash ? slash : host + strlen(host);
+    const char *colon = static_cast<const char *>(memchr(host, ':', static_cast<size_t>(hostEnd - host)));
+    const size_t hostLen = static_cast<size_t>((colon ? colon : hostEnd) - host);
+    if (hostLen == 0 || hostLen >= sizeof(_host)) return false;
+    memcpy(_host, host, hostLen);
+    _host[hostLen] = '\0';
+    _port = colon ? atoi(colon + 1) : 80;
+    snprintf(_path, sizeof(_path), "%s", slash ? slash : "/");
+    return true;
+  }
+
+  bool request(uint32_t first, uint32_t last, otadl::Response &out) override {
+    close();
+    out = otadl::Response();
+    if (!connectServer()) return false;
+    char req[512];
+    const int len = snprintf(req, sizeof(req), "GET %s HTTP/1.0\r\nHost: %s\r\nRange: bytes=%u-%u\r\n\r\n", _path,
+                             _host, static_cast<unsigned>(first), static_cast<unsigned>(last));
+    if (send(_fd, req, static_cast<size_t>(len), MSG_NOSIGNAL) != len) return false;
+    if (!readHeaders(out)) return false;
+    return true;
+  }
+
+  int read(uint8_t *buf, size_t cap) override {
+    if (_pendingLen) {
+      const size_t n = (_pendingLen < cap) ? _pendingLen : cap;
+      memcpy(buf, _pending + _pendingPos, n);
+      _pendingPos += n;
+      _pendingLen -= n;
+      return static_cast<int>(n);
+    }
+    if (_fd < 0) return -1;
+    pollfd p{_fd, POLLIN, 0};
+    if (poll(&p, 1, 10) <= 0) return 0;
+    const ssize_t n = recv(_fd, buf, cap, 0);
+    if (n == 0) return -1; // closed: only a drop gets here, the downloader stops at the range end
+    if (n < 0) return (errno == EAGAIN || errno == EINTR) ? 0 : -1;
+    return static_cast<int>(n);
+  }
+
+  void close() override {
+    if (_fd >= 0) ::close(_fd);
+    _fd = -1;
+    _pendingLen = 0;
+    _pendingPos = 0;
+  }
+
+  uint32_t nowMs() override { return monoMs(); }
+
+private:
+  bool connectServer() {
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo *res = nullptr;
+    char port[8];
+    snprintf(port, sizeof(port), "%d", _port);
+    if (getaddrinfo(_host, port, &hints, &res) != 0 || !res) return false;
+    _fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    const bool ok = _fd >= 0 && connect(_fd, res->ai_addr, res->ai_addrlen) == 0;
+    freeaddrinfo(res);
+    if (!ok) close();
+    return ok;
+  }
+
+  // Reads up to the blank line; body bytes that came along are kept for read().
+  bool readHeaders(otadl::Response &out) {
+    size_t used = 0;
+    char *end = nullptr;
+    const uint32_t startMs = monoMs();
+    while (!end) {
+      if (used + 1 >= sizeof(_head) || monoMs() - startMs > otadl::kStallMs) return false;
+      pollfd p{_fd, POLLIN, 0};
+      if (poll(&p, 1, 100) <= 0) continue;
+      const ssize_t n = recv(_fd, _head + used, sizeof(_head) - 1 - used, 0);
+      if (n <= 0) return false;
+      used += static_cast<size_t>(n);
+      _head[used] = '\0';
+      end = strstr(_head, "\r\n\r\n");
+    }
+    const size_t headLen = static_cast<size_t>(end - _head) + 4;
+    _pendingLen = used - headLen;
+    _pendingPos = 0;
+    memcpy(_pending, _head + headLen, _pendingLen);
+    *end = '\0';
+
+    if (sscanf(_head, "HTTP/%*s %d", &out.status) != 1) return false;
+    for (char *line = strstr(_head, "\r\n"); line; line = strstr(line, "\r\n")) {
+      line += 2;
+      if (!strncasecmp(line, "Content-Length:", 15)) {
+        out.length = static_cast<uint32_t>(strtoul(line + 15, nullptr, 10));
+      } else if (!strncasecmp(line, "Content-Range:", 14)) {
+        char *v = line + 14;
+        while (*v == ' ') v += 1;
+        char *eol = strstr(v, "\r\n");
+        const size_t n = eol ? static_cast<size_t>(eol - v) : strlen(v);
+        snprintf(_contentRange, sizeof(_contentRange), "%.*s", static_cast<int>(n), v);
+        out.contentRange = _contentRange;
+      }
+    }
+    return true;
+  }
+
+  char _host[128] = {};
+  int _port = 80;
+  char _path[512] = {};
+  int _fd = -1;
+  char _head[4096] = {};
+  uint8_t _pending[4096] = {};
+  size_t _pendingLen = 0;
+  size_t _pendingPos = 0;
+  char _contentRange[96] = {};
+};
+
+// NOR flash semantics: erase sets 0xFF, writes can only clear bits.
+class MemFlash : public otadl::FlashTarget {
+public:
+  explicit MemFlash(uint32_t size) : bytes(size, 0x00) {}
+
+  bool eraseSector(uint32_t addr) override {
+    if (addr % otadl::kSectorSize || addr + otadl::kSectorSize > bytes.size()) return false;
+    memset(bytes.data() + addr, 0xFF, otadl::kSectorSize);
+    erases += 1;
+    return true;
+  }
+
+  bool write(uint32_t addr, uint8_t *data, size_t len, bool) override {
+    if (addr % 4 || len % 4 || addr + len > bytes.size()) return false;
+    for (size_t i = 0; i < len; i += 1) bytes[addr + i] &= data[i];
+    return true;
+  }
+
+  std::vector<uint8_t> bytes;
+  uint32_t erases = 0;
+};
+
+// `rtc` stands for RTC user memory (lost on power cut), `durable` for the LittleFS copy.
+class MemStore : public otadl::CheckpointStore {
+public:
+  bool load(otadl::Checkpoint &out) override {
+    if (hasRtc && otadl::checkpointValid(rtc)) {
+      out = rtc;
+      return true;
+    }
+    if (hasDurable) {
+      out = durable;
+      return true;
+    }
+    return false;
+  }
+
+  void save(const otadl::Checkpoint &cp, bool isDurable) override {
+    rtc = cp;
+    hasRtc = true;
+    saves += 1;
+    if (isDurable) {
+      durable = cp;
+      hasDurable = true;
+      durableSaves += 1;
+    }
+  }
+
+  void clear() override {
+    hasRtc = false;
+    hasDurable = false;
+  }
+
+  void powerCut() { hasRtc = false; }
+
+  otadl::Checkpoint rtc;
+  otadl::Checkpoint durable;
+  bool hasRtc = false;
+  bool hasDurable = false;
+  uint32_t saves = 0;
+  uint32_t durableSaves = 0;
+};
+
+bool readFile(const char *path, std::vector<uint8_t> &out) {
+  FILE *f = fopen(path, "rb");
+  if (!f) return false;
+  uint8_t buf[4096];
+  size_t n = 0;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+  fclose(f);
+  return true;
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  const char *md5Hex = nullptr;
+  const char *expectPath = nullptr;
+  const char *url = nullptr;
+  uint32_t region = 1024UL * 1024UL;
+  unsigned rebootEvery = 0;
+  bool powerCut = false;
+  unsigned timeoutS = 600;
+
+  for (int i = 1; i < argc; i += 1) {
+    if (!strcmp(argv[i], "--md5") && i + 1 < argc) {
+      md5Hex = argv[++i];
+    } else if (!strcmp(argv[i], "--expect") && i + 1 < argc) {
+      expectPath = argv[++i];
+    } else if (!strcmp(argv[i], "--region") && i + 1 < argc) {
+      region = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 0));
+    } else if (!strcmp(argv[i], "--reboot-every") && i + 1 < argc) {
+      rebootEvery = static_cast<unsigned>(atoi(argv[++i]));
+    } else if (!strcmp(argv[i], "--power-cut")) {
+      powerCut = true;
+    } else if (!strcmp(argv[i], "--timeout-s") && i + 1 < argc) {
+      timeoutS = static_cast<unsigned>(atoi(argv[++i]));
+    } else {
+      url = argv[i];
+    }
+  }
+  uint8_t expectedMd5[16];
+  if (!url || (md5Hex && !otadl::parseMd5Hex(md5Hex, expectedMd5))) {
+    fprintf(stderr,
+            "usage: %s [--md5 HEX] [--expect FILE] [--region BYTES] [--reboot-every SECTORS] [--power-cut] "
+            "[--timeout-s S] http://HOST:PORT/PATH\n",
+            argv[0]);
+    return 2;
+  }
+
+  PosixHttpTransport http;
+  if (!http.parseUrl(url)) {
+    fprintf(stderr, "[resume] only http://host[:port]/path URLs\n");
+    return 2;
+  }
+  MemFlash flash(region);
+  MemStore store;
+  const uint32_t id = otadl::crc32(url, strlen(url));
+
+  otadl::Stats total;
+  unsigned boots = 0;
+  unsigned powerCuts = 0;
+  otadl::Status st = otadl::Status::Idle;
+  otadl::Error err = otadl::Error::None;
+  otadl::Checkpoint cp;
+  uint8_t digest[16] = {};
+  const uint32_t startMs = monoMs();
+
+  // One "boot" per iteration: a new Downloader picks up whatever checkpoint survived.
+  while (true) {
+    otadl::Downloader dl;
+    boots += 1;
+    dl.begin(http, flash, store, id, md5Hex ? expectedMd5 : nullptr, 0, region);
+    if (boots > 1) printf("[boot] #%u resumes at %u\n", boots, static_cast<unsigned>(dl.stats().resumedFrom));
+    uint32_t sectorsAtBoot = dl.checkpoint().done / otadl::kSectorSize;
+    bool rebooted = false;
+    while ((st = dl.step()) == otadl::Status::Running) {
+      if (monoMs() - startMs > timeoutS * 1000U) {
+        dl.abort();
+        st = otadl::Status::Failed;
+        break;
+      }
+      const uint32_t sectors = dl.checkpoint().done / otadl::kSectorSize;
+      if (rebootEvery && sectors - sectorsAtBoot >= rebootEvery) {
+        rebooted = true;
+        break;
+      }
+    }
+    const otadl::Stats &s = dl.stats();
+    total.requests += s.requests;
+    total.drops += s.drops;
+    total.retries += s.retries;
+    total.bytesFetched += s.bytesFetched;
+    total.skipped += s.skipped;
+    total.lastStatus = s.lastStatus;
+    cp = dl.checkpoint();
+    err = dl.error();
+    if (st == otadl::Status::Done) dl.digest(digest);
+    if (!rebooted) break;
+
+    http.close();
+    if (powerCut && boots % 2 == 0) {
+      store.powerCut();
+      powerCuts += 1;
+    }
+  }
+  const uint32_t elapsedMs = monoMs() - startMs;
+
+  printf("[stats] requests=%u drops=%u retries=%u fetched=%u skipped=%u lastStatus=%d boots=%u powerCuts=%u "
+         "saves=%u durable=%u erases=%u\n",
+         static_cast<unsigned>(total.requests),
+         static_cast<unsigned>(total.drops),
+         static_cast<unsigned>(total.retries),
+         static_cast<unsigned>(total.bytesFetched),
+         static_cast<unsigned>(total.skipped),
+         total.lastStatus,
+         boots,
+         powerCuts,
+         static_cast<unsigned>(store.saves),
+         static_cast<unsigned>(store.durableSaves),
+         static_cast<unsigned>(flash.erases));
+  if (st != otadl::Status::Done) {
+    printf("[result] %s: %s at %u/%u (%ums)\n",
+           otadl::statusToString(st),
+           otadl::errorToString(err),
+           static_cast<unsigned>(cp.done),
+           static_cast<unsigned>(cp.size),
+           static_cast<unsigned>(elapsedMs));
+    return 1;
+  }
+
+  char hex[33];
+  otadl::md5Hex(digest, hex);
+  // The running MD5 only saw bytes on their way in; hash what is actually in flash as well.
+  otadl::Md5 check;
+  otadl::md5Init(check);
+  otadl::md5Update(check, flash.bytes.data() + cp.start, cp.size);
+  uint8_t flashDigest[16];
+  otadl::md5Final(check, flashDigest);
+  bool ok = memcmp(flashDigest, digest, sizeof(digest)) == 0;
+  if (expectPath) {
+    std::vector<uint8_t> expect;
+    if (!readFile(expectPath, expect)) {
+      fprintf(stderr, "[resume] cannot read %s\n", expectPath);
+      return 1;
+    }
+    ok = ok && expect.size() == cp.size && memcmp(expect.data(), flash.bytes.data() + cp.start, cp.size) == 0;
+  }
+  printf("[result] %s size=%u start=0x%x md5=%s header=0x%02x flash=%s (%ums)\n",
+         ok ? "done" : "MISMATCH",
+         static_cast<unsigned>(cp.size),
+         static_cast<unsigned>(cp.start),
+         hex,
+         static_cast<unsigned>(cp.header),
+         ok ? "match" : "differs",
+         static_cast<unsigned>(elapsedMs));
+  return ok ? 0 : 1;
+}
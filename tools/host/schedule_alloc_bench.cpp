@@ -0,0 +1,147 @@
+// Host benchmark for the schedule hot path: advances virtual time in loop-sized steps and counts heap
+// allocations made by ScheduleEngine::tick() and by reading its status (the relay task and the
+// status/UI handlers do both on every pass). The steady state should allocate nothing.
+//
+// Usage: schedule_alloc_bench [--days N] [--tick-ms MS] [--start YYYY-MM-DD]
+// Exit status is 1 when any tick allocated.
+
+#include <Arduino.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <new>
+
+#include "AppConfig.h"
+#include "HolidayDb.h"
+#include "HostRuntime.h"
+#include "ParashaDb.h"
+#include "ScheduleEngine.h"
+#include "TimeKeeper.h"
+#include "ZmanimDb.h"
+
+// Every C++ allocation counts, not only String's.
+void *operator new(size_t size) {
+  hostrt::countAllocation();
+  void *p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+namespace {
+bool parseDate(const char *s, time_t &out) {
+  unsigned y, m, d;
+  if (sscanf(s, "%u-%u-%u", &y, &m, &d) != 3) return false;
+  tm t{};
+  t.tm_year = static_cast<int>(y) - 1900;
+  t.tm_mon = static_cast<int>(m) - 1;
+  t.tm_mday = static_cast<int>(d);
+  out = timegm(&t);
+  return true;
+}
+
+void usage() { fprintf(stderr, "usage: schedule_alloc_bench [--days N] [--tick-ms MS] [--start YYYY-MM-DD]\n"); }
+} // namespace
+
+int main(int argc, char **argv) {
+  uint32_t days = 60;
+  uint32_t tickMs = 250;
+  time_t startUtc = 0;
+  parseDate("2026-01-01", startUtc);
+
+  for (int i = 1; i < argc; i += 1) {
+    const bool hasValue = i + 1 < argc;
+    if (!strcmp(argv[i], "--days") && hasValue) {
+      days = static_cast<uint32_t>(atoi(argv[++i]));
+    } else if (!strcmp(argv[i], "--tick-ms") && hasValue) {
+      tickMs = static_cast<uint32_t>(atoi(argv[++i]));
+    } else if (!strcmp(argv[i], "--start") && hasValue) {
+      if (!parseDate(argv[++i], startUtc)) {
+        usage();
+        return 2;
+      }
+    } else {
+      usage();
+      return 2;
+    }
+  }
+  if (!days || !tickMs) {
+    usage();
+    return 2;
+  }
+
+  hostrt::setSerialEcho(false);
+
+  AppConfig cfg;
+  cfg.ntpEnabled = false;
+
+  ZmanimDb zmanim;
+  HolidayDb holidays;
+  ParashaDb parasha;
+  zmanim.begin();
+  holidays.begin();
+  parasha.begin();
+
+  TimeKeeper time;
+  time.begin(cfg);
+  time.setManualUtc(startUtc);
+
+  ScheduleEngine schedule;
+  schedule.begin(zmanim, holidays, parasha);
+
+  // Warm-up: the first tick builds the window table.
+  schedule.tick(cfg, time);
+  if (!schedule.status().ok) {
+    char err[64];
+    formatScheduleError(schedule.status(), err, sizeof(err));
+    fprintf(stderr, "schedule not ok after warm-up: %s\n", err);
+    return 2;
+  }
+
+  const uint64_t ticks = static_cast<uint64_t>(days) * 86400000ULL / tickMs;
+  uint64_t allocTicks = 0;
+  uint64_t allocs = 0;
+  uint64_t versionChanges = 0;
+  uint64_t holyTicks = 0;
+  uint32_t lastVersion = schedule.status().version;
+  char err[64];
+
+  const auto t0 = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < ticks; i += 1) {
+    hostrt::advanceUs(static_cast<uint64_t>(tickMs) * 1000ULL);
+    time.tick(cfg);
+
+    const uint64_t before = hostrt::allocationCount();
+    schedule.tick(cfg, time);
+    const ScheduleStatus &st = schedule.status();
+    if (st.version != lastVersion) {
+      versionChanges += 1;
+      lastVersion = st.version;
+      formatScheduleError(st, err, sizeof(err));
+    }
+    if (schedule.desiredRelayOn()) holyTicks += 1;
+    const uint64_t used = hostrt::allocationCount() - before;
+
+    if (used) {
+      allocTicks += 1;
+      allocs += used;
+    }
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+
+  printf("ticks=%llu tickMs=%u days=%u\n", static_cast<unsigned long long>(ticks), tickMs, days);
+  printf("allocations=%llu ticksWithAllocations=%llu perTick=%.6f\n",
+         static_cast<unsigned long long>(allocs),
+         static_cast<unsigned long long>(allocTicks),
+         static_cast<double>(allocs) / static_cast<double>(ticks));
+  printf("statusVersions=%llu holyTicks=%llu nsPerTick=%.1f\n",
+         static_cast<unsigned long long>(versionChanges),
+         static_cast<unsigned long long>(holyTicks),
+         ns / static_cast<double>(ticks));
+  return allocs ? 1 : 0;
+}
@@ -0,0 +1,493 @@
+// Replays a recorded input trace (InputTrace, fetched from GET /api/record.bin) through the firmware's own
+// boot path and relay pass (relaylogic::run: ScheduleEngine + TimeKeeper + override windows + relaystate)
+// in virtual time, and checks that the replay makes the same decisions the device made.
+//
+// Time follows the recording: every boot restarts the uptime clock, every recorded clock reading sets the
+// virtual wall clock at the uptime it was taken, and the 250 ms relay pass grid is re-phased at each of those
+// readings (they are taken inside the pass). Between readings the wall clock runs with uptime, as it does on
+// the device when nothing steps it. The replay starts at the first boot record, or at the first keyframe when
+// the ring no longer holds one.
+//
+// Checks: relay transitions (same state, same boot, within --tolerance-ms), the restored/boot-mode relay state
+// of every boot and the relay state written with every keyframe.
+//
+// Usage: trace_replay [--log] [--tolerance-ms N] FILE...   (several files are concatenated: oldest first,
+//        e.g. trace.old.bin trace.bin). Exit status is 1 when the replay diverged, 2 on bad input.
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "AppConfig.h"
+#include "HolidayDb.h"
+#include "HostRuntime.h"
+#include "InputTrace.h"
+#include "ParashaDb.h"
+#include "RelayController.h"
+#include "RelayLogic.h"
+#include "RelayState.h"
+#include "ScheduleEngine.h"
+#include "TimeKeeper.h"
+#include "ZmanimDb.h"
+
+namespace {
+constexpr int64_t kUs = 1000000LL;
+constexpr int64_t kPassMs = 250; // "relay" task period (main.cpp)
+constexpr int64_t kValidEpochUs = 1577836800LL * kUs; // 2020-01-01, what TimeKeeper treats as a set clock
+constexpr size_t kMaxReported = 10;
+
+struct Options {
+  bool log = false;
+  uint32_t toleranceMs = 300;
+  std::vector<const char *> files;
+};
+
+struct Transition {
+  int32_t boot;
+  uint32_t ms;
+  bool on;
+  InputTrace::RelayCause cause;
+  bool matched;
+};
+
+struct Result {
+  uint32_t records = 0;
+  uint32_t byType[8] = {};
+  uint32_t boots = 0;
+  uint64_t passes = 0;
+  uint32_t clockSets = 0; // invalid -> valid
+  uint32_t steps = 0;     // valid -> valid
+  int64_t maxStepUs = 0;
+  uint32_t configChanges = 0;
+  uint32_t bootMismatches = 0;
+  uint32_t syncChecks = 0;
+  uint32_t syncMismatches = 0;
+  uint32_t unmatchedRecorded = 0;
+  uint32_t unmatchedReplayed = 0;
+  uint32_t matched = 0;
+  int64_t maxOffsetMs = 0;
+  double passNs = 0;
+  std::map<std::string, uint32_t> http;
+
+  uint32_t failures() const {
+    return bootMismatches + syncMismatches + unmatchedRecorded + unmatchedReplayed;
+  }
+};
+
+bool readFile(const char *path, std::vector<uint8_t> &out) {
+  FILE *f = fopen(path, "rb");
+  if (!f) return false;
+  uint8_t buf[4096];
+  size_t n = 0;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+  fclose(f);
+  return true;
+}
+
+void formatWall(int64_t us, char *buf, size_t len) {
+  if (us < kValidEpochUs) {
+    snprintf(buf, len, "(unset %+.3fs)", static_cast<double>(us) / kUs);
+    return;
+  }
+  const time_t s = static_cast<time_t>(us / kUs);
+  tm t{};
+  gmtime_r(&s, &t);
+  snprintf(buf,
+           len,
+           "%04d-%02d-%02d %02d:%02d:%02d.%03dZ",
+           t.tm_year + 1900,
+           t.tm_mon + 1,
+           t.tm_mday,
+           t.tm_hour,
+           t.tm_min,
+           t.tm_sec,
+           static_cast<int>((us % kUs) / 1000));
+}
+
+const char *onOff(bool on) { return on ? "ON" : "OFF"; }
+
+class Replay {
+public:
+  Replay(const Options &opt, ZmanimDb &zmanim, HolidayDb &holidays, ParashaDb &parasha)
+      : _opt(opt), _zmanim(zmanim), _holidays(holidays), _parasha(parasha) {}
+
+  Result run(const std::vector<InputTrace::Record> &records) {
+    hostrt::formatFs();
+    hostrt::powerLoss();
+    for (const InputTrace::Record &r : records) {
+      _r.records += 1;
+      _r.byType[static_cast<uint8_t>(r.type) & 7] += 1;
+      // Passes that ran before this record, then the record itself at its uptime. A boot record starts a
+      // new uptime (and the config snapshot written just before it already belongs to the new boot);
+      // whatever the device did between the last record and the reset is unknown.
+      const bool nextBoot = r.type == InputTrace::Type::Boot || r.ms < _nowMs;
+      if (_attached && !nextBoot) {
+        while (_nextPassMs >= 0 && _nextPassMs < static_cast<int64_t>(r.ms)) {
+          advanceTo(static_cast<uint32_t>(_nextPassMs));
+          pass();
+          _nextPassMs += kPassMs;
+        }
+        advanceTo(r.ms);
+      }
+      handle(r);
+    }
+    match();
+    _r.passNs = _r.passes ? _passNsTotal / static_cast<double>(_r.passes) : 0;
+    return _r;
+  }
+
+private:
+  const Options &_opt;
+  ZmanimDb &_zmanim;
+  HolidayDb &_holidays;
+  ParashaDb &_parasha;
+
+  AppConfig _cfg;
+  TimeKeeper _time;
+  ScheduleEngine _schedule;
+  RelayController _relay;
+  Result _r;
+
+  bool _attached = false;
+  int32_t _boot = -1; // boot index of the current segment (0 = the one the replay attached to)
+  uint32_t _nowMs = 0;
+  int64_t _nextPassMs = -1; // -1: waiting for the first clock reading after boot
+  uint32_t _keyframeMs = UINT32_MAX;
+  bool _seedScratch = false;
+  std::vector<uint8_t> _lastConfig;
+  std::vector<Transition> _recorded;
+  std::vector<Transition> _replayed;
+  double _passNsTotal = 0;
+  size_t _reported = 0;
+
+  void advanceTo(uint32_t ms) {
+    if (ms < _nowMs) return;
+    hostrt::advanceUs(static_cast<uint64_t>(ms - _nowMs) * 1000ULL);
+    _nowMs = ms;
+  }
+
+  void handle(const InputTrace::Record &r) {
+    switch (r.type) {
+    case InputTrace::Type::Config:
+      applyConfig(r);
+      break;
+    case InputTrace::Type::Boot: {
+      InputTrace::BootRecord b{};
+      InputTrace::decode(r, b);
+      boot(r.ms, b);
+      break;
+    }
+    case InputTrace::Type::Sync: {
+      InputTrace::SyncRecord s{};
+      InputTrace::decode(r, s);
+      if (!_attached) {
+        attach(r.ms, s.relayOn);
+      } else {
+        _r.syncChecks += 1;
+        if (_relay.isOn() != s.relayOn) {
+          _r.syncMismatches += 1;
+          report(r.ms, "keyframe", "replayed relay=%s recorded=%s", onOff(_relay.isOn()), onOff(s.relayOn));
+        }
+      }
+      break;
+    }
+    case InputTrace::Type::Clock: {
+      InputTrace::ClockRecord c{};
+      InputTrace::decode(r, c);
+      const int64_t step = c.wallUs - hostrt::wallUs();
+      const bool keyframe = _nextPassMs < 0 || _keyframeMs == r.ms;
+      if (_attached && !keyframe) {
+        if (hostrt::wallUs() < kValidEpochUs) {
+          _r.clockSets += 1;
+        } else {
+          _r.steps += 1;
+          _r.maxStepUs = std::max(_r.maxStepUs, step < 0 ? -step : step);
+        }
+      }
+      hostrt::setWallUs(c.wallUs);
+      if (_opt.log) {
+        char wall[48];
+        formatWall(c.wallUs, wall, sizeof(wall));
+        line(r.ms, "clock %s%s", wall, keyframe ? " (keyframe)" : "");
+        if (!keyframe) printf(" step=%+.3fs", static_cast<double>(step) / kUs);
+        printf("\n");
+      }
+      if (_attached) {
+        pass();
+        _nextPassMs = static_cast<int64_t>(r.ms) + kPassMs;
+      }
+      break;
+    }
+    case InputTrace::Type::Relay: {
+      InputTrace::RelayRecord rr{};
+      InputTrace::decode(r, rr);
+      if (_attached) _recorded.push_back({_boot, r.ms, rr.on, rr.cause, false});
+      if (_opt.log) {
+        line(r.ms, "relay %s holy=%d cause=%s (recorded)\n", onOff(rr.on), rr.holy ? 1 : 0, InputTrace::causeName(rr.cause));
+      }
+      break;
+    }
+    case InputTrace::Type::Wifi: {
+      InputTrace::WifiRecord w{};
+      InputTrace::decode(r, w);
+      if (_opt.log) {
+        const IPAddress ip(w.staIp);
+        line(r.ms, "wifi changes=0x%02x sta=%d ap=%d clients=%u ch=%u reason=%u ip=%u.%u.%u.%u\n", w.changes,
+             w.staConnected ? 1 : 0, w.apActive ? 1 : 0, w.apClients, w.channel, w.disconnectReason, ip[0], ip[1], ip[2],
+             ip[3]);
+      }
+      break;
+    }
+    case InputTrace::Type::Http: {
+      InputTrace::HttpRecord h{};
+      InputTrace::decode(r, h);
+      _r.http[h.line] += 1;
+      if (_opt.log) line(r.ms, "http %s\n", h.line);
+      break;
+    }
+    }
+    if (r.type == InputTrace::Type::Sync) _keyframeMs = r.ms;
+  }
+
+  void applyConfig(const InputTrace::Record &r) {
+    const std::vector<uint8_t> raw(r.data, r.data + r.len);
+    if (raw == _lastConfig) return;
+    if (!_lastConfig.empty()) _r.configChanges += 1;
+    _lastConfig = raw;
+    InputTrace::decode(r, _cfg);
+    if (_opt.log) {
+      line(r.ms, "config runMode=%u bootMode=%u holyOnNo=%d tz=%d dstMode=%u before=%d after=%d windows=%u\n",
+           _cfg.runMode, _cfg.relayBootMode, _cfg.relayHolyOnNo ? 1 : 0, _cfg.tzOffsetMinutes, _cfg.dstMode,
+           _cfg.minutesBeforeShkia, _cfg.minutesAfterTzeit, _cfg.windowCount);
+    }
+    if (!_attached) return;
+    _relay.applyConfig(_cfg);
+    _schedule.invalidate();
+  }
+
+  // Mirrors setup(). The first boot the replay sees is seeded with the state the device restored.
+  void boot(uint32_t ms, const InputTrace::BootRecord &b) {
+    if (!_attached) {
+      relaystate::load(_seedScratch);
+      relaystate::save(b.restoredOn);
+    }
+    if (b.reason == REASON_DEFAULT_RST) {
+      hostrt::powerLoss();
+    } else {
+      hostrt::warmReset(b.reason);
+    }
+    _nowMs = 0;
+    advanceTo(ms);
+    _boot += 1;
+    _r.boots += 1;
+    _attached = true;
+    _nextPassMs = -1;
+    _time = TimeKeeper();
+    _schedule = ScheduleEngine();
+
+    bool lastOn = false;
+    relaystate::load(lastOn);
+    _relay = RelayController();
+    _relay.begin(_cfg, lastOn);
+    bool forced = false;
+    if (relaylogic::bootState(_cfg, _time.isTimeValid(), forced)) {
+      _relay.setOn(forced);
+      relaystate::save(forced);
+    }
+    _schedule.begin(_zmanim, _holidays, _parasha);
+    _time.begin(_cfg);
+
+    if (lastOn != b.restoredOn || _relay.isOn() != b.relayOn) {
+      _r.bootMismatches += 1;
+      report(ms, "boot", "replayed restored=%s relay=%s, recorded restored=%s relay=%s", onOff(lastOn),
+             onOff(_relay.isOn()), onOff(b.restoredOn), onOff(b.relayOn));
+    }
+    if (_opt.log) {
+      printf("---- boot %d reason=%u source=%s\n", _boot, b.reason,
+             relaystate::sourceToString(static_cast<relaystate::Source>(b.source)));
+      line(ms, "boot restored=%s relay=%s\n", onOff(b.restoredOn), onOff(b.relayOn));
+    }
+  }
+
+  // The ring lost its boot record: pick the run up at a keyframe, as if the device had just booted into it.
+  void attach(uint32_t ms, bool relayOn) {
+    hostrt::powerLoss();
+    relaystate::load(_seedScratch);
+    relaystate::save(relayOn);
+    _nowMs = 0;
+    advanceTo(ms);
+    _boot = 0;
+    _attached = true;
+    _nextPassMs = -1;
+    _time = TimeKeeper();
+    _schedule = ScheduleEngine();
+    _relay = RelayController();
+    _relay.begin(_cfg, relayOn);
+    _schedule.begin(_zmanim, _holidays, _parasha);
+    _time.begin(_cfg);
+    if (_opt.log) {
+      printf("---- attached at keyframe\n");
+      line(ms, "sync relay=%s\n", onOff(relayOn));
+    }
+  }
+
+  void pass() {
+    const auto t0 = std::chrono::steady_clock::now();
+    const relaylogic::Pass p = relaylogic::run(_cfg, _schedule, _time, _relay);
+    _passNsTotal += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+    _r.passes += 1;
+    if (!p.changed) return;
+    _replayed.push_back({_boot, _nowMs, p.decision.desiredRelay, InputTrace::RelayCause::Schedule, false});
+    if (_opt.log) line(_nowMs, "relay %s holy=%d (replayed)\n", onOff(p.decision.desiredRelay), p.decision.desiredHoly ? 1 : 0);
+  }
+
+  // Pairs recorded and replayed transitions: same boot, same state, closest in time within the tolerance.
+  void match() {
+    const int64_t tol = _opt.toleranceMs;
+    for (Transition &rec : _recorded) {
+      Transition *best = nullptr;
+      int64_t bestDist = 0;
+      for (Transition &rep : _replayed) {
+        if (rep.matched || rep.boot != rec.boot || rep.on != rec.on) continue;
+        const int64_t d = static_cast<int64_t>(rep.ms) - static_cast<int64_t>(rec.ms);
+        const int64_t dist = d < 0 ? -d : d;
+        if (dist > tol || (best && dist >= bestDist)) continue;
+        best = &rep;
+        bestDist = dist;
+      }
+      if (!best) continue;
+      best->matched = true;
+      rec.matched = true;
+      _r.matched += 1;
+      _r.maxOffsetMs = std::max(_r.maxOffsetMs, bestDist);
+    }
+    for (const Transition &t : _recorded) {
+      if (t.matched) continue;
+      _r.unmatchedRecorded += 1;
+      reportAt(t.boot, t.ms, "transition", "recorded relay=%s cause=%s has no replayed match", onOff(t.on),
+               InputTrace::causeName(t.cause));
+    }
+    for (const Transition &t : _replayed) {
+      if (t.matched) continue;
+      _r.unmatchedReplayed += 1;
+      reportAt(t.boot, t.ms, "transition", "replayed relay=%s was not recorded", onOff(t.on));
+    }
+  }
+
+  void line(uint32_t ms, const char *fmt, ...) __attribute__((format(printf, 3, 4))) {
+    printf("#%d +%9.3fs  ", _boot, ms / 1000.0);
+    va_list ap;
+    va_start(ap, fmt);
+    vprintf(fmt, ap);
+    va_end(ap);
+  }
+
+  void report(uint32_t ms, const char *kind, const char *fmt, ...) __attribute__((format(printf, 4, 5))) {
+    if (_reported >= kMaxReported) return;
+    _reported += 1;
+    char msg[160];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(msg, sizeof(msg), fmt, ap);
+    va_end(ap);
+    printf("FAIL #%d +%.3fs %s %s\n", _boot, ms / 1000.0, kind, msg);
+  }
+
+  void reportAt(int32_t boot, uint32_t ms, const char *kind, const char *fmt, ...) __attribute__((format(printf, 5, 6))) {
+    if (_reported >= kMaxReported) return;
+    _reported += 1;
+    char msg[160];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(msg, sizeof(msg), fmt, ap);
+    va_end(ap);
+    printf("FAIL #%d +%.3fs %s %s\n", boot, ms / 1000.0, kind, msg);
+  }
+};
+
+void usage() { fprintf(stderr, "usage: trace_replay [--log] [--tolerance-ms N] FILE...\n"); }
+
+void printResult(const Result &r, size_t files, size_t bytes) {
+  printf("trace files=%zu bytes=%zu records=%u", files, bytes, r.records);
+  for (uint8_t t = 1; t < 8; t += 1) {
+    if (r.byType[t]) printf(" %s=%u", InputTrace::typeName(static_cast<InputTrace::Type>(t)), r.byType[t]);
+  }
+  printf("\n");
+  printf("replay boots=%u passes=%llu passNs=%.0f configChanges=%u clockSets=%u clockSteps=%u maxStep=%.3fs\n",
+         r.boots, static_cast<unsigned long long>(r.passes), r.passNs, r.configChanges, r.clockSets, r.steps,
+         static_cast<double>(r.maxStepUs) / kUs);
+  printf("transitions matched=%u maxOffset=%lldms unmatchedRecorded=%u unmatchedReplayed=%u\n", r.matched,
+         static_cast<long long>(r.maxOffsetMs), r.unmatchedRecorded, r.unmatchedReplayed);
+  printf("checks keyframes=%u mismatches=%u bootMismatches=%u\n", r.syncChecks, r.syncMismatches, r.bootMismatches);
+
+  std::vector<std::pair<uint32_t, std::string>> top;
+  for (const auto &h : r.http) top.push_back({h.second, h.first});
+  std::sort(top.begin(), top.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+  for (size_t i = 0; i < top.size() && i < 8; i += 1) printf("http %6u  %s\n", top[i].first, top[i].second.c_str());
+  printf("%s\n", r.failures() ? "DIVERGED" : "OK");
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  Options opt;
+  for (int i = 1; i < argc; i += 1) {
+    const char *a = argv[i];
+    if (!strcmp(a, "--log")) {
+      opt.log = true;
+    } else if (!strcmp(a, "--tolerance-ms") && i + 1 < argc) {
+      opt.toleranceMs = static_cast<uint32_t>(atoi(argv[++i]));
+    } else if (a[0] == '-') {
+      usage();
+      return 2;
+    } else {
+      opt.files.push_back(a);
+    }
+  }
+  if (opt.files.empty()) {
+    usage();
+    return 2;
+  }
+
+  // Buffers stay alive for the whole run: records point into them.
+  std::vector<std::vector<uint8_t>> images(opt.files.size());
+  std::vector<InputTrace::Record> records;
+  size_t bytes = 0;
+  for (size_t i = 0; i < opt.files.size(); i += 1) {
+    if (!readFile(opt.files[i], images[i])) {
+      fprintf(stderr, "%s: cannot read\n", opt.files[i]);
+      return 2;
+    }
+    bytes += images[i].size();
+    InputTrace::Reader reader(images[i].data(), images[i].size());
+    if (!reader.headerOk()) {
+      fprintf(stderr, "%s: not an input trace (version %u expected)\n", opt.files[i], InputTrace::kVersion);
+      return 2;
+    }
+    InputTrace::Record rec;
+    while (reader.next(rec)) records.push_back(rec);
+    if (reader.truncated()) {
+      fprintf(stderr, "%s: malformed record at offset %zu; ignoring the rest\n", opt.files[i], reader.offset());
+    }
+  }
+
+  hostrt::setSerialEcho(false);
+  ZmanimDb zmanim;
+  HolidayDb holidays;
+  ParashaDb parasha;
+  zmanim.begin();
+  holidays.begin();
+  parasha.begin();
+
+  Replay replay(opt, zmanim, holidays, parasha);
+  const Result r = replay.run(records);
+  printResult(r, opt.files.size(), bytes);
+  return r.failures() ? 1 : 0;
+}
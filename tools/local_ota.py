@@ -4,10 +4,12 @@ Local OTA helper for SmartShabat.
 
 What it does:
 1) Builds firmware via `pio run` (optional)
-2) Serves `ota.json` + `firmware.bin` over HTTP
+2) Serves `ota.json` + `firmware.bin` over HTTP (with Range support, see ota_standin.py)
 3) Tells the device to use the manifest served from *this* client IP
 4) Triggers `/api/ota/update`
 
+With --drop-pct the server cuts that share of responses short, to watch the device resume.
+
 Run this while your computer is connected to the device Hotspot (usually 192.168.4.1).
 """
 
@@ -15,18 +17,17 @@ from __future__ import annotations
 
 import argparse
 import hashlib
-import http.server
 import json
-import os
 import shutil
 import subprocess
-import threading
 import time
 import urllib.error
 import urllib.parse
 import urllib.request
 from pathlib import Path
 
+from ota_standin import Behaviour, start_server
+
 DEFAULT_MANIFEST_URL = "https://github.com/yk8-git/smart-shabat/releases/latest/download/ota.json"
 
 
@@ -67,38 +68,26 @@ def _http_get_json(url: str, timeout_s: float) -> dict:
         raise RuntimeError(f"Non-JSON response from {url}: {raw[:200]!r}")
 
 
+def _wait_job(device_base: str, started: dict, timeout_s: float, deadline_s: float, settled=None) -> dict:
+    """Polls /api/jobs/<id> for an endpoint that answered 202 with a job id; returns the final job."""
+    job_id = started.get("job")
+    if not job_id:
+        return started
+    deadline = time.time() + deadline_s
+    while True:
+        job = _http_get_json(f"{device_base}/api/jobs/{job_id}", timeout_s=timeout_s)
+        if job.get("done") or (settled and settled(job)):
+            return job
+        if time.time() > deadline:
+            raise RuntimeError(f"job {job_id} still {job.get('state')} after {deadline_s:.0f}s: {job}")
+        time.sleep(0.5)
+
+
 def _reset_manifest(device_base: str, default_url: str, timeout_s: float) -> None:
     payload = {"ota": {"manifestUrl": default_url}}
     _http_post_json(f"{device_base}/api/config", payload, timeout_s=timeout_s)
 
 
-class _CountingHandler(http.server.SimpleHTTPRequestHandler):
-    ota_hits = 0
-    bin_hits = 0
-    _lock = threading.Lock()
-
-    def log_message(self, fmt: str, *args) -> None:
-        # Keep logs compact and single-line.
-        msg = fmt % args
-        print(f"[http] {self.address_string()} {msg}")
-
-    def do_GET(self) -> None:  # noqa: N802
-        with self._lock:
-            if self.path.startswith("/ota.json"):
-                type(self).ota_hits += 1
-            elif self.path.startswith("/firmware.bin"):
-                type(self).bin_hits += 1
-        super().do_GET()
-
-
-def _start_server(directory: Path, port: int) -> tuple[http.server.ThreadingHTTPServer, threading.Thread]:
-    handler = lambda *args, **kwargs: _CountingHandler(*args, directory=str(directory), **kwargs)  # noqa: E731
-    httpd = http.server.ThreadingHTTPServer(("0.0.0.0", port), handler)
-    t = threading.Thread(target=httpd.serve_forever, daemon=True)
-    t.start()
-    return httpd, t
-
-
 def main() -> int:
     p = argparse.ArgumentParser(description="Local OTA helper (build + serve + trigger update).")
     p.add_argument("-d", "--device", default="192.168.4.1", help="Device IP (default: 192.168.4.1)")
@@ -111,6 +100,7 @@ def main() -> int:
         default="ota-local",
         help="Directory to serve from (default: ota-local)",
     )
+    p.add_argument("--drop-pct", type=float, default=0.0, help="Cut this share of responses short (default: 0)")
     args = p.parse_args()
 
     repo = Path(__file__).resolve().parents[1]
@@ -129,7 +119,8 @@ def main() -> int:
     shutil.copy2(firmware_src, firmware_dst)
     md5 = _md5_file(firmware_dst)
 
-    httpd, _ = _start_server(ota_dir, args.port)
+    behaviour = Behaviour(drop_pct=args.drop_pct)
+    httpd, _ = start_server(ota_dir, args.port, behaviour)
     print(f"[ota] serving on 0.0.0.0:{args.port} from {ota_dir}")
 
     device_base = f"http://{args.device}"
@@ -159,22 +150,27 @@ def main() -> int:
         print(f"[ota] wrote manifest {ota_dir / 'ota.json'} (bin host {host_ip})")
 
         # Ensure the manifest is reachable by the device before triggering update.
+        # Both endpoints run as background jobs (202 + job id).
         chk = _http_post_json(device_base + "/api/ota/check", {}, timeout_s=args.timeout)
+        chk = _wait_job(device_base, chk, timeout_s=args.timeout, deadline_s=120)
         print(f"[ota] check: {chk}")
+        # The job downloads firmware.bin in range requests and settles once the image is verified and
+        # about to be installed.
+        print("[ota] device downloading firmware.bin…")
         upd = _http_post_json(device_base + "/api/ota/update", {}, timeout_s=args.timeout)
+        upd = _wait_job(
+            device_base,
+            upd,
+            timeout_s=args.timeout,
+            deadline_s=600,
+            settled=lambda job: (job.get("result") or {}).get("installing") is True,
+        )
         print(f"[ota] update: {upd}")
-
-        print("[ota] waiting for device to download firmware.bin…")
-        download_deadline = time.time() + 90
-        while time.time() < download_deadline:
-            if _CountingHandler.bin_hits > 0:
-                print("[ota] firmware.bin downloaded; waiting a bit for reboot…")
-                time.sleep(10)
-                break
-            time.sleep(0.25)
-        else:
-            print("[ota] timeout waiting for firmware.bin download. Check device logs (/api/ota/status or serial).")
+        print(f"[ota] server: {behaviour.summary()}")
+        if not (upd.get("result") or {}).get("installing"):
+            print("[ota] download did not finish. Check device logs (/api/ota/status or serial).")
             return 2
+        time.sleep(10)
 
         print("[ota] waiting for device to reboot and report OTA status…")
         status_deadline = time.time() + 120
@@ -0,0 +1,6 @@
+#!/bin/zsh
+set -euo pipefail
+cd "${0:A:h}/.."
+out="${TMPDIR:-/tmp}/smartshabat-ntp-probe"
+c++ -std=c++17 -O2 -Wall -Wextra -Isrc -o "$out" tools/host/ntp_probe.cpp src/NtpSampler.cpp
+exec "$out" "$@"
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""
+Local SNTP stand-in for exercising the firmware NTP sampler on a Linux host.
+
+Each `--server` spec starts one UDP responder:
+
+    PORT[:OFFSET_MS[:DELAY_MS[:JITTER_MS[:DROP_PCT[:STRATUM]]]]]
+
+- OFFSET_MS: how far this server's clock is ahead of the host clock
+- DELAY_MS / JITTER_MS: simulated one-way network delay (base + uniform random jitter),
+  applied symmetrically before t2 and after t3 so the client sees it in the round trip
+- DROP_PCT: percentage of requests silently dropped
+- STRATUM: stratum reported in replies (0 sends a kiss-of-death "RATE")
+
+Example (one good server, one congested, one lossy):
+
+    python3 tools/ntp_standin.py --server 12301:0:2:1 --server 12302:250:120:200 --server 12303:-40:5:5:50
+"""
+
+from __future__ import annotations
+
+import argparse
+import random
+import socket
+import struct
+import threading
+import time
+
+NTP_UNIX_DELTA = 2208988800
+
+
+def _ntp_ts(unix_s: float) -> bytes:
+    sec = int(unix_s) + NTP_UNIX_DELTA
+    frac = int((unix_s - int(unix_s)) * (1 << 32))
+    return struct.pack("!II", sec & 0xFFFFFFFF, frac & 0xFFFFFFFF)
+
+
+class _Spec:
+    def __init__(self, raw: str) -> None:
+        parts = raw.split(":")
+        vals = [float(p) if p else 0.0 for p in parts]
+        vals += [0.0] * (6 - len(vals))
+        self.port = int(vals[0])
+        self.offset_s = vals[1] / 1000.0
+        self.delay_s = vals[2] / 1000.0
+        self.jitter_s = vals[3] / 1000.0
+        self.drop = vals[4] / 100.0
+        self.stratum = int(vals[5]) if len(parts) >= 6 else 2
+
+    def one_way(self) -> float:
+        return self.delay_s + random.uniform(0.0, self.jitter_s)
+
+
+def _reply(sock: socket.socket, spec: _Spec, req: bytes, addr) -> None:
+    time.sleep(spec.one_way())
+    t2 = time.time() + spec.offset_s
+    li_vn_mode = (0 << 6) | (4 << 3) | 4
+    ref_id = b"RATE" if spec.stratum == 0 else b"LOCL"
+    header = struct.pack("!BBbb", li_vn_mode, spec.stratum, 4, -20)
+    root_delay = struct.pack("!I", int(0.001 * 65536))
+    root_disp = struct.pack("!I", int(0.002 * 65536))
+    origin = req[40:48]
+    t3 = time.time() + spec.offset_s
+    pkt = header + root_delay + root_disp + ref_id + _ntp_ts(t2) + origin + _ntp_ts(t2) + _ntp_ts(t3)
+    time.sleep(spec.one_way())
+    sock.sendto(pkt, addr)
+
+
+def _serve(spec: _Spec, bind: str) -> None:
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind((bind, spec.port))
+    print(
+        f"[ntp] udp://{bind}:{spec.port} offset={spec.offset_s * 1000:.0f}ms delay={spec.delay_s * 1000:.0f}ms "
+        f"jitter={spec.jitter_s * 1000:.0f}ms drop={spec.drop * 100:.0f}% stratum={spec.stratum}"
+    )
+    while True:
+        req, addr = sock.recvfrom(512)
+        if len(req) < 48 or (req[0] & 0x07) != 3:
+            continue
+        if random.random() < spec.drop:
+            continue
+        threading.Thread(target=_reply, args=(sock, spec, req, addr), daemon=True).start()
+
+
+def main() -> int:
+    p = argparse.ArgumentParser(description="Local SNTP stand-in with configurable offset/delay/jitter/loss.")
+    p.add_argument("--server", action="append", required=True, help="PORT[:OFFSET_MS[:DELAY_MS[:JITTER_MS[:DROP_PCT[:STRATUM]]]]]")
+    p.add_argument("--bind", default="127.0.0.1", help="Bind address (default: 127.0.0.1)")
+    args = p.parse_args()
+
+    for raw in args.server:
+        threading.Thread(target=_serve, args=(_Spec(raw), args.bind), daemon=True).start()
+    try:
+        while True:
+            time.sleep(3600)
+    except KeyboardInterrupt:
+        return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,6 @@
+#!/bin/zsh
+set -euo pipefail
+cd "${0:A:h}/.."
+out="${TMPDIR:-/tmp}/smartshabat-ota-resume"
+c++ -std=c++17 -O2 -Wall -Wextra -Isrc -o "$out" tools/host/ota_resume.cpp src/OtaDownload.cpp
+exec "$out" "$@"
@@ -0,0 +1,229 @@
+#!/usr/bin/env python3
+"""
+Local HTTP stand-in for exercising the resumable firmware download (src/OtaDownload.cpp).
+
+Serves the files of one directory with HTTP Range support (206 + Content-Range) and can misbehave
+on purpose (faults apply to *.bin only; the manifest is always served whole):
+
+- --drop-after BYTES: every response is cut (connection closed) after this many body bytes
+- --drop-pct PCT: each response is cut at a random point with this probability
+- --fail-pct PCT: each request is answered 503 with this probability
+- --no-range: ignore Range and always send the whole file (200)
+- --kbps N: throttle the body to about N kilobytes per second
+
+With --bin FILE, FILE is copied in as firmware.bin and an ota.json manifest (version, bin, md5) is
+written next to it, so a device can be pointed at it (see README, "Resumable OTA download").
+
+Examples:
+
+    python3 tools/ota_standin.py --bin .pio/build/esp12e/firmware.bin --port 8070 --drop-pct 30
+    ./tools/ota_resume.sh --md5 <md5> http://127.0.0.1:8070/firmware.bin
+"""
+
+from __future__ import annotations
+
+import argparse
+import hashlib
+import http.server
+import json
+import os
+import random
+import re
+import shutil
+import socket
+import threading
+import time
+from pathlib import Path
+
+_RANGE_RE = re.compile(r"^bytes=(\d*)-(\d*)$")
+
+
+class Behaviour:
+    def __init__(self, drop_after: int = 0, drop_pct: float = 0.0, fail_pct: float = 0.0,
+                 no_range: bool = False, kbps: float = 0.0) -> None:
+        self.drop_after = drop_after
+        self.drop_pct = drop_pct
+        self.fail_pct = fail_pct
+        self.no_range = no_range
+        self.kbps = kbps
+        self.requests = 0
+        self.ranges = 0
+        self.drops = 0
+        self.failures = 0
+        self.bytes_sent = 0
+        self.lock = threading.Lock()
+
+    def summary(self) -> str:
+        return (f"requests={self.requests} ranges={self.ranges} drops={self.drops} "
+                f"failures={self.failures} bytes={self.bytes_sent}")
+
+
+def make_handler(directory: Path, behaviour: Behaviour, log=print):
+    """Request handler class serving `directory` with Range support and the configured faults."""
+
+    class RangeHandler(http.server.BaseHTTPRequestHandler):
+        # Keep-alive, like release hosts: the firmware reuses one connection across ranges.
+        protocol_version = "HTTP/1.1"
+
+        def log_message(self, fmt: str, *args) -> None:
+            log(f"[http] {self.address_string()} {fmt % args}")
+
+        def do_GET(self) -> None:  # noqa: N802
+            with behaviour.lock:
+                behaviour.requests += 1
+            name = self.path.split("?", 1)[0].lstrip("/")
+            path = (directory / name).resolve()
+            if directory.resolve() not in path.parents or not path.is_file():
+                self.send_error(404)
+                return
+            faulty = path.suffix == ".bin"
+            if faulty and behaviour.fail_pct and random.uniform(0, 100) < behaviour.fail_pct:
+                with behaviour.lock:
+                    behaviour.failures += 1
+                self.send_error(503, "stand-in failure")
+                return
+
+            size = path.stat().st_size
+            first, last = 0, size - 1
+            status = 200
+            m = _RANGE_RE.match(self.headers.get("Range", "").strip())
+            if m and not (faulty and behaviour.no_range) and size > 0:
+                a, b = m.group(1), m.group(2)
+                if a:
+                    first = int(a)
+                    last = min(int(b), size - 1) if b else size - 1
+                elif b:  # suffix range: the last N bytes
+                    first = max(0, size - int(b))
+                if first >= size or first > last:
+                    self.send_response(416)
+                    self.send_header("Content-Range", f"bytes */{size}")
+                    self.send_header("Content-Length", "0")
+                    self.end_headers()
+                    return
+                status = 206
+                with behaviour.lock:
+                    behaviour.ranges += 1
+
+            length = last - first + 1
+            self.send_response(status)
+            self.send_header("Content-Type", "application/octet-stream")
+            self.send_header("Content-Length", str(length))
+            self.send_header("Accept-Ranges", "bytes")
+            if status == 206:
+                self.send_header("Content-Range", f"bytes {first}-{last}/{size}")
+            self.end_headers()
+
+            cut = length
+            if faulty and behaviour.drop_after and behaviour.drop_after < cut:
+                cut = behaviour.drop_after
+            if faulty and behaviour.drop_pct and random.uniform(0, 100) < behaviour.drop_pct:
+                cut = min(cut, random.randrange(0, length))
+            self._send_body(path, first, length, cut)
+
+        def _send_body(self, path: Path, first: int, length: int, cut: int) -> None:
+            sent = 0
+            with path.open("rb") as f:
+                f.seek(first)
+                while sent < cut:
+                    chunk = f.read(min(1460, cut - sent))
+                    if not chunk:
+                        break
+                    try:
+                        self.wfile.write(chunk)
+                    except (BrokenPipeError, ConnectionResetError):
+                        return
+                    sent += len(chunk)
+                    if behaviour.kbps:
+                        time.sleep(len(chunk) / (behaviour.kbps * 1024.0))
+            with behaviour.lock:
+                behaviour.bytes_sent += sent
+            if sent < length:
+                with behaviour.lock:
+                    behaviour.drops += 1
+                log(f"[http] dropped connection after {sent}/{length} bytes")
+                try:
+                    self.wfile.flush()
+                    self.connection.shutdown(socket.SHUT_RDWR)
+                except OSError:
+                    pass
+                self.close_connection = True
+
+    return RangeHandler
+
+
+def start_server(directory: Path, port: int, behaviour: Behaviour, log=print):
+    httpd = http.server.ThreadingHTTPServer(("0.0.0.0", port), make_handler(directory, behaviour, log))
+    t = threading.Thread(target=httpd.serve_forever, daemon=True)
+    t.start()
+    return httpd, t
+
+
+def _md5_file(path: Path) -> str:
+    h = hashlib.md5()
+    with path.open("rb") as f:
+        for chunk in iter(lambda: f.read(1024 * 256), b""):
+            h.update(chunk)
+    return h.hexdigest()
+
+
+def _local_ip() -> str:
+    s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    try:
+        s.connect(("192.0.2.1", 9))  # no packet is sent; picks the outgoing interface
+        return s.getsockname()[0]
+    except OSError:
+        return "127.0.0.1"
+    finally:
+        s.close()
+
+
+def main() -> int:
+    p = argparse.ArgumentParser(description="HTTP stand-in with Range support and injected faults.")
+    p.add_argument("--port", type=int, default=8070)
+    p.add_argument("--dir", default="ota-standin", help="Directory to serve (default: ota-standin)")
+    p.add_argument("--bin", help="Firmware image to publish as firmware.bin (+ ota.json)")
+    p.add_argument("--host", help="Host/IP written into ota.json (default: this machine's address)")
+    p.add_argument("--drop-after", type=int, default=0)
+    p.add_argument("--drop-pct", type=float, default=0.0)
+    p.add_argument("--fail-pct", type=float, default=0.0)
+    p.add_argument("--no-range", action="store_true")
+    p.add_argument("--kbps", type=float, default=0.0)
+    p.add_argument("--seed", type=int, help="Random seed (repeatable fault pattern)")
+    args = p.parse_args()
+
+    if args.seed is not None:
+        random.seed(args.seed)
+    directory = Path(args.dir)
+    directory.mkdir(parents=True, exist_ok=True)
+    if args.bin:
+        dst = directory / "firmware.bin"
+        shutil.copy2(args.bin, dst)
+        md5 = _md5_file(dst)
+        version = str(int(time.time()))
+        host = args.host or _local_ip()
+        manifest = {
+            "version": version,
+            "bin": f"http://{host}:{args.port}/firmware.bin",
+            "md5": md5,
+            "notes": f"stand-in build {version}",
+        }
+        (directory / "ota.json").write_text(json.dumps(manifest, indent=2) + "\n", encoding="utf-8")
+        print(f"[standin] firmware.bin {dst.stat().st_size} bytes md5={md5}")
+        print(f"[standin] manifest http://{host}:{args.port}/ota.json")
+
+    behaviour = Behaviour(args.drop_after, args.drop_pct, args.fail_pct, args.no_range, args.kbps)
+    httpd, _ = start_server(directory, args.port, behaviour)
+    print(f"[standin] serving {os.path.abspath(directory)} on 0.0.0.0:{args.port} (Ctrl-C to stop)")
+    try:
+        while True:
+            time.sleep(3600)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        httpd.shutdown()
+        print(f"[standin] {behaviour.summary()}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
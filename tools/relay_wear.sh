@@ -0,0 +1,8 @@
+#!/bin/zsh
+set -euo pipefail
+cd "${0:A:h}/.."
+out="${TMPDIR:-/tmp}/smartshabat-relay-wear"
+c++ -std=gnu++17 -O2 -Wall -funsigned-char -Itools/host/arduino -Isrc \
+  -Wl,--wrap=time,--wrap=gettimeofday,--wrap=settimeofday \
+  -o "$out" tools/host/relay_wear_sim.cpp tools/host/arduino/host_runtime.cpp src/RelayState.cpp src/SpanTrace.cpp src/JsonWriter.cpp
+exec "$out" "$@"
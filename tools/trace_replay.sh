@@ -0,0 +1,11 @@
+#!/bin/zsh
+set -euo pipefail
+cd "${0:A:h}/.."
+out="${TMPDIR:-/tmp}/smartshabat-trace-replay"
+c++ -std=gnu++17 -O2 -Wall -funsigned-char -Itools/host/arduino -Isrc \
+  -Wl,--wrap=time,--wrap=gettimeofday,--wrap=settimeofday \
+  -o "$out" tools/host/trace_replay.cpp tools/host/arduino/host_runtime.cpp \
+  src/InputTrace.cpp src/RelayLogic.cpp src/RelayState.cpp src/RelayController.cpp src/OverrideWindows.cpp \
+  src/ScheduleEngine.cpp src/TimeKeeper.cpp src/NtpSampler.cpp src/ZmanimDb.cpp src/HolidayDb.cpp src/ParashaDb.cpp \
+  src/SpanTrace.cpp src/AppLog.cpp src/JsonWriter.cpp
+exec "$out" "$@"
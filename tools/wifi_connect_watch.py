@@ -28,6 +28,22 @@ def _post_json(url: str, payload: dict, timeout_s: float) -> object:
     return json.loads(raw) if raw else None
 
 
+def _scan(base: str, timeout_s: float) -> list:
+    # A fresh cached survey comes back directly as {networks: [...]}; otherwise the scan runs as a
+    # background job: 202 + job id, then poll /api/jobs/<id> for the result.
+    started = _get_json(base + "/api/wifi/scan", timeout_s=timeout_s) or {}
+    if "networks" in started:
+        return started["networks"]
+    job_id = started.get("job")
+    deadline = time.time() + 30
+    while job_id and time.time() < deadline:
+        time.sleep(0.5)
+        job = _get_json(f"{base}/api/jobs/{job_id}", timeout_s=timeout_s) or {}
+        if job.get("done"):
+            return (job.get("result") or {}).get("networks") or []
+    return []
+
+
 def _disc_reason_name(code: int) -> str:
     # ESP8266 wifi_station_disconnect_reason (partial, most useful ones)
     names = {
@@ -73,7 +89,7 @@ def main() -> int:
     ssid = args.ssid
     pw_len = len(args.password or "")
 
-    nets = _get_json(base + "/api/wifi/scan", timeout_s=args.http_timeout) or []
+    nets = _scan(base, timeout_s=args.http_timeout)
     best = None
     for n in nets:
         if not isinstance(n, dict):